@@ -0,0 +1,160 @@
+//compiles the Super Famicom database into super-famicom-table.hpp
+//entries are placed by a perfect hash of their SHA-256 digest, so that loaders can find a game
+//with a single probe instead of parsing the whole database on every load
+
+#include <nall/nall.hpp>
+using namespace nall;
+
+namespace Database {
+  #include "super-famicom.hpp"
+}
+
+struct Entry {
+  uint8_t sha256[32];
+  string markup;
+  unsigned romSize;
+  unsigned roms;
+};
+
+static uint32_t hash(const uint8_t* sha256, unsigned offset) {
+  return sha256[offset + 0] << 0 | sha256[offset + 1] << 8 | sha256[offset + 2] << 16 | sha256[offset + 3] << 24;
+}
+
+//must match SuperFamicomTable::find() below
+static unsigned place(uint32_t key, unsigned seed, unsigned bits) {
+  return (uint32_t)((key ^ seed) * 0x9e3779b1u) >> (32 - bits);
+}
+
+static string escape(const string& text) {
+  string output;
+  for(auto& c : text) {
+    if(c == '\\') output.append("\\\\");
+    else if(c == '"') output.append("\\\"");
+    else if(c == '?') output.append("\\?");  //avoid trigraphs
+    else output.append(c);
+  }
+  return output;
+}
+
+int main(int argc, char** argv) {
+  string filename = argc >= 2 ? argv[1] : "super-famicom-table.hpp";
+
+  //split exactly as Ananke::openSuperFamicom() does
+  vector<Entry> entries;
+  lstring databaseItem = string{Database::SuperFamicom}.strip().split("\n\n");
+  for(auto& item : databaseItem) {
+    item.append("\n");
+    auto document = Markup::Document(item);
+    string sha256 = document["release/information/sha256"].text();
+    if(sha256.size() != 64) continue;
+
+    Entry entry;
+    for(unsigned n = 0; n < 32; n++) entry.sha256[n] = hex(substr(sha256, n * 2, 2));
+    entry.markup = item;
+    entry.romSize = 0;
+    entry.roms = 0;
+    for(auto& node : document["release/information/configuration"]) {
+      if(node.name != "rom") continue;
+      entry.romSize += node["size"].decimal();
+      entry.roms++;
+    }
+    entries.append(entry);
+  }
+
+  //hash and displace: each bucket (selected by the first word of the digest) is given the smallest
+  //seed that places all of its keys (hashed from the second word) into free slots
+  unsigned bits = 1;
+  while((1u << bits) < entries.size() * 5 / 4) bits++;
+  unsigned slots = 1 << bits;
+  unsigned buckets = slots / 4;
+
+  vector<vector<unsigned>> bucket;
+  bucket.resize(buckets);
+  for(unsigned n = 0; n < entries.size(); n++) bucket[hash(entries[n].sha256, 0) & (buckets - 1)].append(n);
+
+  vector<unsigned> order;
+  for(unsigned n = 0; n < buckets; n++) order.append(n);
+  order.sort([&](unsigned x, unsigned y) { return bucket[x].size() > bucket[y].size(); });
+
+  vector<int> slot;
+  slot.resize(slots);
+  for(auto& s : slot) s = -1;
+  vector<unsigned> displacement;
+  displacement.resize(buckets);
+  for(auto& d : displacement) d = 0;
+
+  for(auto b : order) {
+    if(bucket[b].size() == 0) continue;
+    unsigned d = 0;
+    for(; d < 65536; d++) {
+      bool fits = true;
+      vector<unsigned> used;
+      for(auto n : bucket[b]) {
+        unsigned s = place(hash(entries[n].sha256, 4), d, bits);
+        if(slot[s] >= 0 || used.find(s)) { fits = false; break; }
+        used.append(s);
+      }
+      if(fits) break;
+    }
+    if(d == 65536) {
+      print("database/compile: no perfect hash found\n");
+      return 1;
+    }
+    displacement[b] = d;
+    for(auto n : bucket[b]) slot[place(hash(entries[n].sha256, 4), d, bits)] = n;
+  }
+
+  string output;
+  output.append("//generated from super-famicom.hpp by database/compile.cpp; do not edit (make database)\n\n");
+  output.append("namespace SuperFamicomTable {\n");
+  output.append("  struct Entry {\n");
+  output.append("    uint8_t sha256[32];\n");
+  output.append("    uint32_t offset;   //release entry within markup[]\n");
+  output.append("    uint32_t length;\n");
+  output.append("    uint32_t romSize;  //combined size of the ROMs in the configuration\n");
+  output.append("    uint32_t roms;\n");
+  output.append("  };\n\n");
+  output.append("  enum : unsigned { Buckets = ", buckets, ", SlotBits = ", bits, ", Slots = 1 << SlotBits };\n\n");
+
+  output.append("  static const uint16_t displacement[Buckets] = {");
+  for(unsigned n = 0; n < buckets; n++) {
+    if(n % 16 == 0) output.append("\n    ");
+    output.append(displacement[n], ",");
+  }
+  output.append("\n  };\n\n");
+
+  string markup;
+  output.append("  static const Entry entry[Slots] = {\n");
+  for(unsigned n = 0; n < slots; n++) {
+    if(slot[n] < 0) { output.append("    {},\n"); continue; }
+    auto& e = entries[slot[n]];
+    output.append("    {{");
+    for(unsigned i = 0; i < 32; i++) output.append("0x", hex<2>(e.sha256[i]), i < 31 ? "," : "");
+    output.append("}, ", markup.size(), ", ", e.markup.size(), ", ", e.romSize, ", ", e.roms, "},\n");
+    markup.append(e.markup);
+  }
+  output.append("  };\n\n");
+
+  output.append("  static const char markup[] =\n");
+  lstring lines = markup.split("\n");
+  for(unsigned n = 0; n < lines.size(); n++) {
+    if(n + 1 == lines.size() && lines[n].empty()) break;
+    output.append("    \"", escape(lines[n]), "\\n\"\n");
+  }
+  output.append("  ;\n\n");
+
+  output.append("  //returns the entry whose image has this SHA-256 digest, or nullptr\n");
+  output.append("  inline const Entry* find(const uint8_t* sha256) {\n");
+  output.append("    uint32_t bucket = sha256[0] << 0 | sha256[1] << 8 | sha256[2] << 16 | sha256[3] << 24;\n");
+  output.append("    uint32_t key    = sha256[4] << 0 | sha256[5] << 8 | sha256[6] << 16 | sha256[7] << 24;\n");
+  output.append("    const Entry& e = entry[(uint32_t)((key ^ displacement[bucket & (Buckets - 1)]) * 0x9e3779b1u) >> (32 - SlotBits)];\n");
+  output.append("    return e.length && !memcmp(e.sha256, sha256, 32) ? &e : nullptr;\n");
+  output.append("  }\n");
+  output.append("}\n");
+
+  if(file::write(filename, output) == false) {
+    print("database/compile: unable to write ", filename, "\n");
+    return 1;
+  }
+  return 0;
+}
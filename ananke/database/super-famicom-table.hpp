@@ -0,0 +1,13697 @@
+//generated from super-famicom.hpp by database/compile.cpp; do not edit (make database)
+
+namespace SuperFamicomTable {
+  struct Entry {
+    uint8_t sha256[32];
+    uint32_t offset;   //release entry within markup[]
+    uint32_t length;
+    uint32_t romSize;  //combined size of the ROMs in the configuration
+    uint32_t roms;
+  };
+
+  enum : unsigned { Buckets = 256, SlotBits = 10, Slots = 1 << SlotBits };
+
+  static const uint16_t displacement[Buckets] = {
+    1,1,5,26,1,2,1,2,3,10,0,0,0,1,9,0,
+    1,1,2,6,4,13,2,5,1,0,3,0,3,0,2,6,
+    7,0,0,1,0,2,2,8,0,2,2,1,6,8,1,1,
+    0,0,2,4,0,6,2,0,9,4,4,42,1,0,0,2,
+    0,3,2,0,0,3,1,24,1,0,0,0,0,1,3,13,
+    0,5,0,0,1,2,0,0,0,26,4,6,10,3,8,2,
+    1,11,2,0,0,1,2,1,6,0,4,9,2,3,1,2,
+    5,0,6,13,4,20,2,8,3,0,5,17,0,2,0,9,
+    35,2,1,1,0,1,3,21,0,5,0,2,0,26,1,0,
+    0,3,8,2,22,3,2,5,3,1,5,0,1,5,9,6,
+    2,2,4,0,4,0,0,0,1,15,0,1,7,6,4,13,
+    0,19,1,0,11,11,6,3,7,19,17,11,1,36,3,5,
+    1,0,10,0,0,8,6,0,2,0,61,9,12,21,0,1,
+    2,5,20,36,1,7,17,0,24,5,4,0,0,9,4,2,
+    3,14,33,0,5,10,2,0,5,1,4,5,1,1,2,1,
+    8,6,25,7,14,1,0,8,7,13,1,21,76,2,0,4,
+  };
+
+  static const Entry entry[Slots] = {
+    {},
+    {{0x83,0x04,0xd8,0xbc,0x55,0xaa,0x9e,0x64,0xbd,0xd1,0x44,0xd3,0x84,0xf4,0xb1,0x85,0xaf,0x24,0x26,0xe7,0xd6,0x48,0x88,0xc6,0xc2,0x3d,0xd4,0x13,0x66,0xa5,0x39,0x81}, 0, 537, 1048576, 1},
+    {{0xc7,0xd6,0x22,0x39,0x1f,0x76,0x99,0xfb,0x0d,0xc6,0x36,0x7e,0x14,0x1c,0x89,0x4e,0x70,0x0c,0xc9,0xbd,0x8a,0xbc,0xa6,0x9f,0x36,0x78,0x5e,0x7b,0xc2,0xf4,0x2a,0x49}, 537, 516, 1048576, 1},
+    {{0x84,0x91,0x41,0x37,0x0f,0x16,0x4d,0x6d,0xb3,0xe5,0x70,0x9d,0xa6,0x70,0x72,0x6f,0x95,0x8c,0xe1,0x3f,0xfe,0xf6,0x93,0x19,0x56,0x4d,0xb3,0xfb,0x0b,0x12,0xc6,0x9d}, 1053, 601, 2097152, 1},
+    {},
+    {},
+    {{0x7c,0x0f,0x91,0x5b,0x58,0x17,0x96,0xe5,0xb6,0xdd,0x38,0x4e,0xcd,0xc0,0xda,0xd8,0xaf,0x4d,0x95,0x64,0x92,0xfb,0xce,0xde,0xc6,0x28,0xc8,0x84,0x5d,0x91,0x1d,0x7e}, 1654, 522, 1048576, 1},
+    {{0x25,0x41,0x4d,0xe0,0x2c,0x68,0x05,0xca,0x62,0x57,0x4c,0xfb,0x39,0xc2,0x3b,0xf2,0x92,0xb3,0xd8,0xc4,0xff,0x33,0xeb,0x8f,0x21,0x2c,0xcd,0xbc,0xd6,0x1c,0x5a,0xe3}, 2176, 567, 1048576, 1},
+    {{0x8d,0x17,0x06,0x28,0xd2,0xd2,0xfd,0xf1,0x42,0xbb,0x82,0xad,0x80,0xe9,0x08,0xbb,0xa5,0x4c,0x45,0xfa,0x33,0x24,0x1c,0x77,0x9b,0x8e,0xaf,0xaf,0x1b,0x21,0x17,0x1f}, 2743, 537, 2097152, 1},
+    {{0x13,0x0a,0x74,0xe7,0x63,0x69,0xb0,0xec,0x4d,0x63,0x78,0xa0,0x14,0x55,0x09,0x21,0x43,0x3f,0x1a,0xe1,0xac,0x1d,0xdd,0xff,0xb5,0x1f,0x77,0xc9,0xf2,0x1a,0x81,0x8f}, 3280, 662, 1572864, 1},
+    {},
+    {{0x25,0x9c,0x25,0xd4,0x61,0x3f,0x97,0xf5,0xfa,0x79,0x92,0x90,0x0f,0xb5,0x83,0x62,0x5d,0x7f,0xb9,0x12,0xc7,0xae,0x09,0xfa,0x9d,0xef,0x2e,0x68,0x28,0x34,0xdc,0x9f}, 3942, 615, 1048576, 1},
+    {{0xd1,0xf6,0x1b,0x6b,0xb4,0xbb,0x68,0x79,0xa4,0xfb,0xd2,0xc8,0x2d,0x77,0x39,0x0c,0x54,0x6e,0xe7,0xf8,0x21,0xed,0xdd,0xc8,0x84,0xfb,0x9c,0xc7,0x46,0x3a,0xd7,0x9b}, 4557, 524, 1048576, 1},
+    {{0x2a,0x11,0x79,0x51,0xad,0xcf,0xbc,0x42,0x98,0x76,0x36,0x73,0xa8,0x34,0xd5,0x02,0xc3,0xf7,0xa3,0x96,0x4d,0xb1,0xe5,0x96,0x50,0xf1,0x13,0xc0,0x7b,0xb8,0x31,0xfb}, 5081, 562, 1048576, 1},
+    {{0x91,0x0a,0x29,0xf8,0x34,0x19,0x9c,0x63,0xc2,0x2b,0xed,0xdc,0x74,0x9b,0xab,0xa7,0x46,0xda,0x99,0x22,0x19,0x6a,0x55,0x32,0x55,0xde,0xad,0xe5,0x9f,0x4f,0xc1,0x27}, 5643, 575, 4194304, 1},
+    {{0xe3,0x6a,0xab,0xa6,0x4b,0xe0,0x16,0xca,0xbc,0x33,0xa2,0xdc,0xf8,0x89,0x13,0x34,0x1e,0x2e,0xda,0xcc,0x72,0x2e,0x2a,0x1e,0xbe,0x04,0xec,0xcd,0xa2,0xa5,0xd6,0xe7}, 6218, 500, 3145728, 1},
+    {},
+    {{0xb7,0x66,0xc2,0x64,0x98,0xd0,0xaf,0xd6,0x3f,0x44,0xae,0xfd,0xef,0x42,0x64,0x2d,0x24,0x83,0xb5,0x4f,0x18,0xd2,0xb8,0x1a,0x4f,0x1d,0x67,0xa5,0x7f,0x64,0x10,0x44}, 6718, 635, 1572864, 1},
+    {{0x8d,0x4a,0xda,0x4f,0x98,0x46,0x4d,0x17,0x6a,0xe7,0xf0,0xfb,0x8a,0x20,0x03,0x20,0x56,0x68,0x0f,0x32,0x41,0x63,0x7a,0x0f,0x90,0x3f,0x23,0xf3,0x1f,0x41,0xff,0x36}, 7353, 567, 2097152, 1},
+    {{0xe0,0x3d,0x11,0x7d,0x8b,0x30,0x93,0xb0,0xbb,0xad,0x52,0x24,0x63,0x8f,0x85,0x37,0x8b,0x25,0x4b,0x81,0xeb,0x30,0x4e,0x50,0x6a,0x73,0x2b,0x43,0x38,0x80,0x2e,0x0f}, 7920, 557, 2097152, 1},
+    {{0x5a,0x76,0x34,0x76,0x72,0xea,0x7d,0x27,0xbb,0x33,0x4b,0x1e,0x30,0xbb,0xc7,0x3e,0x06,0xf9,0x23,0x73,0x88,0x3b,0xed,0x49,0x92,0x45,0x37,0x73,0x27,0xa8,0xf0,0xcf}, 8477, 530, 524288, 1},
+    {{0xf2,0xbc,0x4c,0xb4,0x60,0xdf,0xc5,0xd5,0x28,0x80,0x65,0xa2,0xf5,0x29,0x19,0x0b,0x72,0xe6,0x9d,0x4e,0x02,0x63,0x42,0x46,0x08,0x62,0x44,0xc2,0x0f,0x30,0x52,0x1c}, 9007, 554, 1048576, 1},
+    {},
+    {{0x2b,0xb3,0x68,0xc4,0x71,0x89,0xce,0x81,0x3a,0xd7,0x16,0xee,0xf1,0x6c,0x01,0xcd,0x47,0x68,0x5c,0xb9,0x8e,0x2c,0x1c,0xb3,0x5f,0xa6,0xf0,0x17,0x3c,0x97,0xdd,0x7c}, 9561, 518, 524288, 1},
+    {},
+    {{0xf4,0x44,0x82,0xe2,0xcc,0xcd,0x9f,0xcf,0xd5,0x87,0x5d,0x84,0xff,0x70,0x0f,0x6e,0x78,0x3f,0x3b,0xd8,0xab,0xd1,0xac,0x4d,0x93,0x90,0x74,0xcd,0x6a,0xd3,0xfe,0x65}, 10079, 559, 524288, 1},
+    {{0x5e,0xff,0x7c,0x27,0xf6,0x9b,0x3e,0xbc,0x1e,0xc1,0x29,0x4f,0xfc,0xd1,0xde,0xbf,0x35,0x12,0xbc,0x3e,0x6c,0x1c,0x75,0xfb,0xdc,0x5e,0x77,0x8d,0xca,0xab,0xa1,0xc9}, 10638, 573, 2097152, 1},
+    {},
+    {{0xe6,0xc4,0xf4,0x68,0xb3,0x9f,0x2d,0xea,0x34,0x36,0xb6,0x37,0x58,0xdb,0x8a,0xc9,0xb2,0x97,0x31,0x35,0x7b,0x98,0x2e,0xc3,0x73,0x33,0x4a,0x36,0xf2,0x02,0x62,0x3f}, 11211, 534, 1048576, 1},
+    {{0x3a,0x52,0xbf,0x09,0x85,0x0a,0xa0,0x54,0xdc,0xa4,0x43,0xf7,0xea,0x74,0xd4,0x3f,0x20,0x1d,0xff,0xec,0xc4,0x03,0x26,0x92,0x4e,0xcb,0xa9,0xb0,0xf1,0x45,0x0e,0x43}, 11745, 526, 1048576, 1},
+    {{0x8f,0x62,0xd0,0x14,0xf5,0x13,0xa7,0xdc,0xbc,0xa5,0xaa,0x76,0xcb,0xe4,0x76,0xc3,0xe4,0x52,0x61,0x00,0xf3,0x49,0x13,0xaf,0x83,0x1b,0xc0,0x5d,0xab,0x02,0x9b,0xd1}, 12271, 517, 2097152, 1},
+    {},
+    {{0x9a,0xbb,0x42,0x6b,0xac,0x62,0xe0,0x3e,0x44,0x37,0xf5,0xa9,0xa8,0x45,0x5c,0x30,0x00,0x04,0x2f,0x33,0x91,0x25,0xcc,0x60,0xae,0x29,0x38,0x2a,0xe8,0x9d,0x84,0x93}, 12788, 534, 524288, 1},
+    {{0xf0,0x5d,0x77,0x7e,0x3d,0xe6,0x9a,0xab,0x18,0xd3,0x36,0xca,0xc0,0xaf,0x07,0xf7,0x94,0xf8,0xd0,0x00,0x90,0xd0,0x85,0xf8,0x6c,0xeb,0xae,0xd3,0x67,0x9c,0xab,0xad}, 13322, 563, 2097152, 1},
+    {{0xd2,0x97,0xc7,0x6e,0xfb,0xcd,0x9a,0x52,0x8d,0x8e,0xe5,0x10,0x25,0xf8,0x77,0x4a,0xb2,0xcb,0x6b,0xbc,0x67,0x6c,0x24,0xe2,0x85,0x92,0xc5,0x0f,0x47,0xe7,0x1b,0xfc}, 13885, 604, 1572864, 1},
+    {},
+    {{0x55,0x36,0xce,0xa2,0xda,0x39,0xf2,0x57,0x2a,0xbe,0x3b,0x0f,0xcf,0x71,0xf8,0xfc,0xd9,0x81,0x37,0x6b,0x47,0x0b,0x17,0x49,0x69,0x77,0x2a,0xae,0x4a,0x7a,0x18,0x45}, 14489, 656, 2097152, 1},
+    {{0x21,0x15,0xc3,0x9f,0x05,0x80,0xce,0x19,0x88,0x5b,0x54,0x59,0xad,0x70,0x8e,0xaa,0x80,0xcc,0x80,0xfa,0xbf,0xe5,0xa9,0x32,0x5e,0xc2,0x28,0x0a,0x5b,0xcd,0x78,0x70}, 15145, 576, 1572864, 1},
+    {{0x57,0xb9,0x4f,0x5f,0x57,0x6a,0xbb,0xe8,0xbd,0x8f,0x5a,0x4e,0xeb,0x6c,0xf9,0x27,0x30,0x0e,0xc1,0xb5,0xf0,0x59,0x66,0x10,0xf3,0x53,0x9b,0xa7,0x33,0x50,0x5c,0x12}, 15721, 543, 1048576, 1},
+    {{0x79,0x41,0x52,0xfc,0x6f,0x55,0xcb,0x15,0xa0,0xb2,0x03,0xfa,0x64,0x5a,0xc9,0xfa,0x31,0x4a,0x29,0x3d,0xa9,0x99,0xd8,0xec,0x8b,0x3d,0xda,0x08,0x04,0x34,0xd1,0x75}, 16264, 582, 1048576, 1},
+    {{0x16,0x22,0x37,0x1a,0x5a,0x40,0x01,0xff,0xf9,0x69,0x03,0x23,0xe8,0x9b,0x7a,0x8d,0x44,0x9c,0xdc,0x3c,0xae,0x6d,0xcd,0x12,0x49,0xf0,0xc7,0xdc,0x8c,0x65,0x1d,0x33}, 16846, 606, 524288, 1},
+    {{0xd4,0xd9,0xf1,0xb4,0x1d,0xad,0x7e,0x7a,0x12,0x6a,0x9a,0xdb,0xe8,0xd8,0x6c,0x4b,0x33,0x9e,0x12,0x0c,0x86,0x61,0x56,0x79,0x6d,0xe1,0xcb,0x0c,0x9a,0x21,0x41,0x89}, 17452, 584, 524288, 1},
+    {{0x10,0xc8,0xab,0xce,0x67,0xb4,0x9f,0x8a,0xfb,0xe8,0x80,0xd2,0xf1,0x3e,0x0f,0xd6,0xd5,0xef,0xc1,0x62,0xdf,0x34,0xd5,0x94,0x1e,0x4a,0x94,0x85,0x1f,0x23,0xb2,0xff}, 18036, 516, 524288, 1},
+    {{0xf5,0x7c,0x49,0xcc,0x3e,0x4c,0x5e,0x34,0x92,0x9e,0x12,0x65,0x8d,0xb0,0xde,0x87,0x94,0x26,0x5c,0x51,0x7e,0x42,0xf3,0xc5,0x18,0xbb,0x14,0x66,0xba,0x46,0xf1,0x4a}, 18552, 516, 524288, 1},
+    {{0xed,0xf9,0x90,0xe5,0x02,0xc6,0x46,0xa2,0xfe,0x83,0xfc,0xd1,0xd3,0x59,0xca,0x0e,0xd5,0x00,0x3a,0xce,0x06,0xcb,0x4c,0x3d,0xe5,0xa5,0x1a,0x0c,0x56,0xd6,0xec,0x54}, 19068, 604, 524288, 1},
+    {{0xf9,0xf7,0xa2,0xde,0x8c,0xba,0xfd,0x6f,0x90,0x42,0x84,0x1d,0xfc,0x42,0x52,0x9f,0x82,0x45,0xd7,0x5f,0x43,0x6b,0xed,0x1c,0x23,0xf9,0xba,0x16,0x63,0x18,0x2e,0x61}, 19672, 645, 2097152, 1},
+    {{0xd1,0x91,0x13,0x96,0x4c,0x4d,0x26,0x8e,0x98,0x60,0x18,0xe2,0x56,0xe9,0x35,0x8c,0xde,0x9a,0x23,0xa0,0x5e,0x60,0x53,0xb5,0x4c,0x0f,0x2d,0x95,0x0d,0xcd,0xf3,0x95}, 20317, 508, 1048576, 1},
+    {{0x5e,0xb9,0x73,0x6d,0x66,0xb3,0xac,0x73,0x0e,0xbb,0xfd,0xd1,0x9e,0xf2,0x39,0x72,0x82,0xb5,0xf1,0xa6,0x2d,0xc0,0x04,0x80,0x93,0xe0,0x41,0xe2,0x3b,0x80,0x77,0x41}, 20825, 532, 524288, 1},
+    {{0x68,0x74,0x56,0x8d,0x98,0x5f,0x65,0xdd,0x81,0x7d,0x4b,0x03,0x99,0x8e,0x71,0xc8,0xcb,0xac,0xc8,0xd8,0x70,0x74,0x11,0xfd,0xe7,0xbf,0xfe,0xe3,0x50,0x60,0x5a,0x88}, 21357, 630, 1572864, 1},
+    {{0xb6,0x95,0x7b,0xae,0x7f,0xd9,0x7b,0xa6,0x81,0xaf,0xbf,0x89,0x62,0xfe,0x21,0x38,0xe2,0x09,0x64,0x9f,0xd8,0x8e,0xd9,0xad,0xd2,0xd5,0x23,0x31,0x78,0x68,0x0a,0xaa}, 21987, 585, 1048576, 1},
+    {{0xb7,0x29,0x10,0x88,0xf5,0xc4,0x9e,0x1f,0xc5,0x5b,0xf9,0x32,0x07,0x6e,0xc0,0x3f,0x7b,0x39,0xf6,0xe4,0x09,0xae,0x06,0xe8,0x84,0xb5,0x70,0x24,0xc5,0x6c,0xdc,0x87}, 22572, 526, 2097152, 1},
+    {},
+    {},
+    {{0xf2,0x45,0x52,0x53,0xdb,0x31,0x6b,0x6c,0xcd,0x0c,0x5c,0x68,0x6d,0x1f,0x1e,0x2d,0x94,0xcd,0x5e,0x37,0x53,0x4e,0x70,0xa3,0xa0,0x7a,0x40,0x91,0x20,0xd5,0x8d,0xf6}, 23098, 612, 2097152, 1},
+    {{0x46,0x28,0x6d,0x08,0x39,0xa4,0x39,0x7f,0xc4,0xc0,0x67,0xb3,0x97,0x83,0xf9,0x8d,0x2a,0xef,0xec,0xa8,0x70,0xa4,0x68,0xba,0xe6,0x01,0xa1,0x43,0x4f,0x1d,0xde,0x90}, 23710, 580, 1572864, 1},
+    {{0x4d,0xd6,0x31,0x43,0x3c,0x86,0x7b,0xa9,0x20,0x99,0x7f,0xd3,0xad,0xd2,0xc8,0x38,0xb6,0x2e,0x70,0xe0,0x6e,0x0e,0xf5,0x5c,0x53,0x88,0x4b,0x8b,0x68,0xb0,0xdd,0x27}, 24290, 677, 1572864, 1},
+    {{0x5b,0x1a,0x90,0xc7,0x0d,0xf7,0x53,0x77,0x43,0x90,0x0a,0xd1,0x59,0xe9,0x2b,0xa3,0xf7,0x2e,0x45,0x60,0x93,0x4a,0x64,0xa4,0x6d,0x62,0xfa,0xba,0x2c,0xa8,0x3a,0x70}, 24967, 883, 577536, 3},
+    {},
+    {{0x95,0x90,0x11,0x0a,0x99,0x0e,0x90,0xf5,0x25,0xd5,0xc8,0xd7,0x0f,0xc2,0xa3,0xda,0x10,0x87,0x93,0x78,0x00,0x31,0x73,0xb6,0x76,0x1a,0xfb,0x8b,0xf0,0x42,0xee,0x0d}, 25850, 540, 1048576, 1},
+    {{0xd8,0x02,0x71,0x5f,0xb4,0xf0,0x9d,0x7e,0x49,0x9b,0x5b,0x3e,0x57,0x7a,0xf6,0x41,0x59,0x8a,0x72,0x3d,0xae,0x7c,0xed,0xea,0xa9,0x39,0x43,0xbb,0x53,0xc6,0xed,0xbb}, 26390, 535, 2097152, 1},
+    {{0x0e,0xf6,0xf4,0xcc,0xe5,0xa2,0x27,0x3f,0xa4,0x9f,0xe1,0xce,0x72,0x4e,0x00,0x48,0xa8,0xe3,0x9c,0x91,0xda,0x6b,0x00,0xdb,0xb6,0x93,0xfe,0x1b,0xa9,0x09,0x17,0x7d}, 26925, 540, 1048576, 1},
+    {{0xb2,0x57,0xcf,0xfb,0x34,0x84,0xe6,0xbe,0x05,0x1a,0x56,0x26,0x8c,0xb9,0x9e,0xe8,0x88,0xbd,0x6d,0x3e,0x9c,0x0e,0x8d,0x6d,0x07,0x79,0xff,0x66,0xc4,0x11,0xf6,0xba}, 27465, 601, 3145728, 1},
+    {},
+    {{0x6d,0x9c,0xd7,0xf0,0xcd,0xa3,0xc0,0xa8,0x2e,0xd3,0xf6,0xa9,0x2c,0xbb,0xba,0x4f,0xe8,0x36,0x54,0x38,0xe0,0xa7,0x86,0x7a,0xd1,0xca,0xe2,0x04,0x4d,0x17,0x38,0xeb}, 28066, 486, 1048576, 1},
+    {},
+    {},
+    {},
+    {},
+    {{0xac,0xa9,0xeb,0x59,0xd6,0x78,0x3e,0x2c,0xae,0x37,0x87,0xc6,0x90,0x53,0x88,0x8f,0xea,0x98,0xf5,0xdf,0xe4,0xc8,0xaf,0x8b,0x5a,0x63,0x60,0xe0,0xaf,0xb3,0xb5,0xd7}, 28552, 534, 524288, 1},
+    {{0xc0,0x4d,0x80,0xb8,0x45,0x14,0x20,0x2f,0xf3,0x19,0x38,0x4c,0xa2,0x06,0x41,0xeb,0x01,0x89,0xe9,0x75,0xee,0xd5,0x61,0x29,0x15,0xbd,0x9c,0x22,0x4b,0x2a,0xb3,0x0a}, 29086, 782, 1048576, 1},
+    {{0x05,0xf1,0x4e,0x6e,0xd3,0x39,0x4d,0x92,0x73,0xe2,0x39,0x77,0x69,0xa8,0xac,0xf1,0xa9,0xdb,0x64,0x6b,0xe6,0x06,0x6e,0x82,0x26,0x95,0x21,0xe8,0xee,0xc5,0x35,0x62}, 29868, 535, 1048576, 1},
+    {{0x84,0x81,0xe4,0x73,0x81,0xbd,0x98,0xc2,0x7b,0x97,0x82,0xb5,0x72,0x7a,0x5d,0x5f,0x09,0x76,0xfb,0xb3,0xaa,0x3d,0xf2,0x5c,0x2c,0x42,0xaa,0x37,0xe0,0x58,0x68,0x15}, 30403, 621, 1572864, 1},
+    {{0xeb,0x95,0x88,0x01,0xfd,0x1f,0x08,0x77,0x1e,0x5a,0x09,0x33,0xf7,0x70,0x1d,0x63,0x32,0x62,0xef,0xbf,0xe8,0xd4,0x7d,0xe2,0x1d,0xda,0x18,0xe3,0xb7,0x76,0x70,0xde}, 31024, 517, 2097152, 1},
+    {{0xc8,0x8a,0x88,0x2a,0xd7,0x2d,0xfa,0x07,0xa9,0xb1,0xeb,0x8a,0x21,0x83,0xaa,0x10,0x05,0x7d,0x60,0x87,0x7a,0x02,0xed,0xf9,0x0c,0xf2,0xcd,0x8c,0x78,0xab,0xe6,0x5e}, 31541, 526, 1572864, 1},
+    {},
+    {},
+    {{0xe3,0xc6,0x2c,0x9f,0xe5,0x5d,0x23,0x11,0xaa,0x6a,0x26,0x4f,0x41,0xb4,0x5d,0x6c,0xbc,0x7b,0x1b,0x06,0x9e,0xd3,0xaa,0x82,0xee,0x57,0xd3,0x81,0xc0,0x62,0x54,0x7d}, 32067, 630, 2097152, 1},
+    {{0x06,0xc8,0xfc,0x46,0x68,0x05,0xf9,0x7c,0x91,0x47,0x71,0x1b,0x2d,0x83,0x70,0xd4,0xf4,0xd0,0x5d,0x9f,0xa3,0xa9,0x16,0xf1,0x7a,0xa1,0x68,0x2f,0x73,0xc9,0xa6,0x3b}, 32697, 495, 2621440, 1},
+    {},
+    {},
+    {{0x18,0xd4,0x0a,0x80,0x7d,0x5f,0x88,0xc5,0xb6,0xa1,0xad,0x84,0x9e,0xec,0x7e,0x0f,0x18,0x92,0x25,0xd9,0xa1,0x58,0x60,0x37,0xc8,0x50,0xf6,0x68,0x0b,0x58,0x44,0xde}, 33192, 524, 2097152, 1},
+    {{0xb2,0x22,0x1d,0x0a,0x59,0xa3,0x99,0xe4,0x37,0x71,0x0e,0x11,0x91,0xa3,0x70,0x71,0xd0,0xa5,0x9c,0x72,0xd8,0xe6,0x24,0x27,0xcd,0x49,0x9d,0xe8,0xd8,0xfd,0x7b,0x61}, 33716, 526, 2097152, 1},
+    {{0x6c,0xde,0xc3,0xcb,0x9c,0x91,0xaa,0x23,0xfe,0xb1,0x30,0x05,0xf8,0x74,0xbd,0xa5,0x80,0xc2,0xf5,0x48,0x30,0x28,0x74,0x49,0x1a,0x31,0x95,0x10,0x31,0xc9,0xdb,0xbd}, 34242, 572, 1572864, 1},
+    {{0xc6,0xbd,0x72,0x39,0xcb,0x20,0x74,0xff,0x1c,0x47,0x1d,0x14,0x53,0x5b,0xea,0xd6,0x29,0x0b,0xba,0x2d,0x7c,0x75,0xb4,0xf0,0x32,0x09,0xcb,0x11,0x48,0x77,0xb4,0xc8}, 34814, 553, 1048576, 1},
+    {{0xc0,0xbd,0x1b,0x37,0x83,0x37,0xc3,0x20,0x47,0xa6,0xb7,0x12,0x2a,0x38,0x13,0xbe,0xb6,0x46,0xe4,0x96,0xfb,0xdb,0x1f,0xa5,0xc8,0x7a,0xb9,0x85,0x62,0x71,0xe4,0xc5}, 35367, 617, 1048576, 1},
+    {},
+    {},
+    {},
+    {{0x69,0x4a,0xd2,0xb3,0x4a,0xb8,0x08,0xbd,0x8a,0x1a,0xa9,0xdd,0xa3,0x59,0x59,0x4c,0xfd,0x3a,0x5f,0xd9,0xd9,0x5d,0x4c,0xf2,0x62,0xcc,0xaa,0x0e,0xb5,0x7e,0xef,0x67}, 35984, 520, 524288, 1},
+    {{0x11,0x35,0x85,0x8a,0x1c,0xe6,0x86,0xa0,0xa1,0x63,0xbb,0x0e,0x6f,0x3a,0x4d,0x7c,0xd7,0x1c,0x0c,0xd5,0x6e,0xfb,0xc7,0x96,0x77,0x37,0x2f,0x26,0x24,0xcf,0x23,0x06}, 36504, 538, 1048576, 1},
+    {{0xb1,0x66,0x61,0xd5,0x15,0x1d,0x73,0xce,0xa5,0xac,0x46,0xd7,0xc8,0x99,0x53,0x1c,0x7b,0x2c,0xde,0xe2,0x55,0x80,0x92,0xc2,0x3a,0x54,0x60,0xc8,0x09,0x2b,0x80,0xb8}, 37042, 518, 1048576, 1},
+    {{0xba,0x54,0xd7,0x15,0xab,0xf1,0x00,0xb9,0x4f,0xee,0x80,0x13,0x51,0x98,0x6f,0xa8,0x18,0xe4,0x30,0x97,0x30,0xce,0xfb,0xac,0xf9,0xb4,0xfa,0xd3,0x6e,0x28,0x4c,0x1c}, 37560, 564, 1048576, 1},
+    {{0x3e,0x12,0x09,0xf4,0x73,0xbf,0xf8,0xcd,0x4b,0xcb,0xf7,0x1d,0x07,0x1e,0x7f,0x8d,0xf1,0x7a,0x2d,0x56,0x4e,0x9a,0x5c,0x4c,0x42,0x7e,0xe8,0x19,0x8c,0xeb,0xb6,0x15}, 38124, 515, 1572864, 1},
+    {{0x3f,0x8e,0xfb,0x19,0xea,0xe6,0x8f,0x24,0xfe,0xb4,0x2c,0x01,0x8b,0x7d,0xc7,0xa8,0x19,0xbf,0xd8,0xd9,0x93,0xab,0x36,0x89,0x96,0x81,0xca,0xa7,0xee,0x94,0xb0,0x6e}, 38639, 528, 524288, 1},
+    {{0x41,0xcc,0x90,0x0d,0x24,0x61,0xa8,0xdc,0x47,0x06,0x64,0x0e,0x49,0x38,0x85,0xdd,0xf8,0x5d,0xb0,0x4d,0x8d,0xff,0xce,0xeb,0xf7,0xa0,0xed,0x89,0xcc,0x98,0x3d,0x8d}, 39167, 520, 1048576, 1},
+    {{0xff,0x09,0xd7,0x2d,0x62,0x41,0xb3,0x31,0xdc,0x42,0x9d,0x1c,0xf2,0x7c,0x04,0xc2,0x65,0x46,0xf2,0x33,0x12,0xa2,0x2c,0x7a,0x14,0xe6,0xa4,0xbf,0x41,0xed,0x10,0x69}, 39687, 554, 2097152, 1},
+    {{0x9e,0x3a,0xd5,0xe5,0x21,0xe7,0x59,0xa2,0xe2,0x26,0x0e,0xa8,0x07,0x2e,0xb3,0x31,0x4b,0x6f,0xcf,0x67,0xa3,0xb7,0x24,0x73,0x57,0xa5,0xde,0x9b,0xcb,0x24,0xee,0xaa}, 40241, 541, 2097152, 1},
+    {},
+    {},
+    {},
+    {{0x38,0x57,0xb5,0x29,0x4e,0xa8,0xf7,0x46,0x88,0x49,0x43,0x7b,0xb2,0xd8,0x27,0x15,0x64,0xe8,0xa0,0xff,0x30,0x77,0x46,0x22,0xe9,0xc8,0x72,0xbc,0xbd,0x53,0xa8,0x4d}, 40782, 666, 1048576, 1},
+    {{0xb0,0xe7,0x4f,0x0f,0xe8,0xd1,0xe7,0xfe,0x2f,0xe4,0x04,0x34,0x1f,0xea,0x7c,0x68,0xe2,0x8f,0x3a,0x0a,0xb7,0x85,0x52,0xd5,0x09,0x2d,0x41,0x3f,0x2e,0xce,0xc4,0x17}, 41448, 592, 1048576, 1},
+    {{0xea,0xf1,0xb8,0x3e,0x95,0xd8,0xa0,0x4f,0x9a,0x84,0xd4,0x96,0x0c,0xf8,0x7c,0xc1,0x82,0xfc,0x60,0xef,0x07,0xbe,0x35,0xeb,0x89,0x29,0xc4,0x03,0x3d,0x6f,0xef,0x67}, 42040, 702, 1572864, 1},
+    {{0x05,0x74,0x84,0x55,0x8e,0xbd,0x18,0x16,0x5f,0x98,0xe5,0x56,0xb9,0x94,0x08,0x05,0x35,0xe3,0x1c,0xef,0xdd,0x98,0xb5,0xed,0xb1,0x90,0x51,0x6f,0x70,0x40,0xfc,0x9d}, 42742, 519, 1572864, 1},
+    {{0x40,0xb5,0x5e,0xe4,0x4b,0xc6,0xf1,0xc8,0x3d,0xaa,0xc3,0xe1,0x80,0x6d,0xcf,0x7e,0xcd,0x5b,0x35,0x28,0x0c,0xdb,0x6a,0x63,0xc7,0xa5,0xe5,0x2f,0xbd,0x21,0x15,0xe6}, 43261, 524, 1048576, 1},
+    {{0xde,0x1c,0xf1,0x51,0x2e,0x48,0x47,0x3b,0x03,0xad,0xb8,0x7b,0x75,0x04,0xf3,0x94,0xe8,0xb3,0x30,0xb3,0x46,0xba,0xc2,0x40,0x44,0xf8,0x33,0xd8,0x36,0x09,0x79,0x9a}, 43785, 542, 1048576, 1},
+    {{0xa0,0xc5,0x54,0xd4,0x60,0x34,0xca,0xef,0x23,0x1c,0x36,0xdd,0x68,0x49,0x82,0x8c,0xa3,0x97,0x03,0x67,0x8f,0xb7,0xfd,0xd1,0x5a,0x11,0xf2,0x92,0xb9,0x3b,0xcd,0x6b}, 44327, 489, 2621440, 1},
+    {{0x24,0x31,0xf8,0xdc,0x06,0x7b,0xa2,0x7c,0x6c,0x3a,0x84,0x69,0x29,0xf3,0xde,0xac,0x6a,0x45,0xaa,0x53,0xa9,0xa9,0xac,0x20,0xed,0xe8,0xec,0x5c,0xa6,0x85,0x4e,0xa2}, 44816, 510, 1048576, 1},
+    {{0xb8,0x05,0x58,0x44,0x82,0x56,0x53,0x21,0x0d,0x25,0x2d,0x29,0xa2,0x22,0x9f,0x9a,0x3e,0x7e,0x51,0x20,0x04,0xe8,0x39,0x40,0x62,0x01,0x73,0xc5,0x7d,0x87,0x23,0xf0}, 45326, 568, 1048576, 1},
+    {{0x93,0xda,0x75,0x2a,0x0c,0x76,0x16,0x7d,0x09,0x07,0xef,0xa8,0x32,0x36,0x7e,0x5d,0x14,0xaa,0xb8,0xe8,0x35,0xb8,0x64,0xf3,0x45,0xc3,0x86,0x07,0x1a,0x9a,0xf7,0x18}, 45894, 518, 524288, 1},
+    {{0xea,0x76,0xcf,0xdb,0xb2,0xa5,0x55,0xa7,0xb6,0xef,0xf8,0xb4,0x66,0xa8,0x79,0xf9,0xa9,0x18,0x96,0x39,0x41,0x6e,0x8c,0x2f,0xb4,0x5b,0xf0,0x74,0xe6,0x95,0x10,0x5f}, 46412, 492, 2097152, 1},
+    {},
+    {{0x02,0x5d,0xd3,0x04,0x7c,0x47,0x4d,0x87,0x9e,0x69,0xb9,0x1a,0x39,0x18,0xad,0xd9,0xcd,0xab,0xed,0xf4,0x18,0x2e,0x1c,0x1e,0x10,0xe5,0xf0,0xc1,0x3a,0x12,0x4b,0xf9}, 46904, 531, 1048576, 1},
+    {{0xf1,0x4e,0x30,0xee,0x45,0x2e,0xc9,0x30,0xa6,0xd0,0x80,0x94,0x09,0x4b,0x28,0x7d,0x0c,0x40,0xc8,0x10,0x8f,0x20,0x17,0xc4,0x18,0x01,0x52,0x42,0x98,0x76,0x49,0xb3}, 47435, 599, 1048576, 1},
+    {},
+    {{0xed,0xe6,0x0f,0x0d,0x28,0x3b,0x6e,0xa3,0xa4,0x53,0x08,0x98,0x1d,0x99,0xe7,0xc4,0x22,0xa0,0x29,0x6e,0x5f,0xad,0xde,0x51,0xc6,0xba,0xfd,0x4d,0xcc,0x78,0x9c,0xa2}, 48034, 792, 1056768, 3},
+    {{0xc3,0x9e,0xbf,0x88,0xaf,0x13,0x8e,0x87,0xca,0x5d,0x96,0x3e,0xd7,0x1a,0x8b,0x7d,0xef,0xba,0x3e,0x2b,0xc2,0x71,0xd7,0x21,0x86,0xd0,0x00,0x56,0xe8,0x22,0x57,0x21}, 48826, 526, 524288, 1},
+    {{0x74,0x4d,0x1a,0x16,0xc3,0xf9,0x99,0x70,0x28,0x35,0x97,0xae,0x8f,0x43,0xb7,0xc3,0x62,0x1c,0x5f,0x99,0x5c,0x45,0x66,0xef,0x24,0xb8,0xd7,0x0b,0x06,0x92,0x00,0x7b}, 49352, 521, 1310720, 1},
+    {{0xec,0xd9,0x64,0xae,0x44,0xe6,0x12,0x03,0xbc,0x87,0x59,0xcf,0xc6,0x44,0x13,0x65,0xbf,0x0c,0x6e,0x7b,0xae,0x6a,0xd2,0xa0,0xfd,0x55,0x3d,0x4c,0x7e,0xfa,0xb7,0x1e}, 49873, 557, 1048576, 1},
+    {{0x91,0x46,0x52,0xf7,0x2d,0x6c,0xeb,0x83,0xb8,0xb4,0x34,0x14,0xd6,0xc4,0x25,0x81,0xec,0x12,0xe9,0xb3,0xf4,0x52,0x59,0xb8,0xb2,0x76,0x8d,0x26,0xb8,0xd4,0xf0,0x73}, 50430, 546, 1048576, 1},
+    {{0x46,0x37,0x0b,0x3b,0xd6,0xff,0x9e,0xe0,0x4c,0x42,0x5e,0xef,0x0f,0x48,0x2f,0x52,0x1f,0x3b,0x61,0xbd,0x4b,0x05,0x8f,0x2f,0x4e,0x9d,0x32,0x22,0x53,0xd7,0xb5,0xde}, 50976, 587, 1572864, 1},
+    {},
+    {{0x69,0x31,0xa3,0xea,0xcb,0x7a,0xb3,0xc2,0xf2,0xfb,0x57,0xba,0x7d,0x59,0xc6,0xda,0x56,0xfe,0x6c,0x7d,0x60,0x48,0x4c,0xeb,0xec,0x93,0x32,0xe6,0xca,0xca,0x3a,0xe9}, 51563, 538, 1048576, 1},
+    {},
+    {{0xb5,0x0b,0xf9,0xd9,0x54,0x85,0xe8,0xae,0xb7,0xa6,0x73,0x0e,0x9f,0x9f,0x9c,0x9c,0x4e,0xc2,0x3a,0x85,0xb3,0x36,0xa4,0xfb,0x2e,0x3b,0x63,0x03,0x45,0x31,0xe3,0x6f}, 52101, 815, 4194304, 1},
+    {{0x24,0xf3,0xf2,0x29,0x49,0xf3,0x6e,0xbf,0x8a,0xb4,0xbe,0xaa,0x8c,0xba,0x22,0xdb,0x10,0x7e,0xfe,0x7a,0x75,0x85,0xf7,0x49,0x34,0x3f,0x28,0x60,0xbf,0x04,0x1f,0xe1}, 52916, 549, 524288, 1},
+    {{0x39,0xbb,0x99,0xed,0xdb,0x22,0x4d,0xe5,0xf0,0x78,0x9f,0x80,0x7f,0xfe,0xf0,0x6b,0x9e,0xfa,0x2e,0xfb,0x79,0x62,0xdc,0xed,0x31,0xfb,0x27,0x2f,0x98,0x66,0x99,0xcd}, 53465, 518, 524288, 1},
+    {{0x28,0x91,0xf1,0xea,0xb2,0x85,0x13,0x33,0x64,0xec,0xc3,0x79,0xa5,0xc9,0xe1,0xd0,0x02,0x6d,0x60,0xf4,0x25,0xf1,0xa4,0x58,0xd1,0x49,0x01,0x4f,0x38,0x6c,0xfa,0x50}, 53983, 518, 1048576, 1},
+    {{0xe1,0x53,0x19,0x5d,0xe7,0xb5,0x9d,0xd5,0xb9,0x85,0x49,0x52,0xcc,0xcc,0xa6,0xbb,0x93,0x16,0x4e,0x5f,0xdf,0xf8,0x29,0x21,0x24,0xbe,0xe6,0xbb,0xe5,0xdb,0xf1,0x6f}, 54501, 520, 1048576, 1},
+    {},
+    {},
+    {{0x35,0x15,0x87,0x36,0x6e,0xca,0x8a,0xeb,0x38,0x23,0x6e,0x4a,0xd6,0xcb,0xd4,0xa1,0xb6,0xe3,0x7b,0x8c,0xc5,0x92,0x72,0x5a,0x79,0x24,0x9c,0x3a,0x05,0x4f,0xa3,0xa7}, 55021, 578, 1048576, 1},
+    {{0x78,0xbf,0x9d,0x79,0xfb,0x2f,0xf3,0xf9,0xd0,0x3e,0xcc,0x11,0x76,0xd0,0x70,0xe5,0x3d,0xda,0xca,0x2c,0x6b,0x0c,0xda,0x69,0xe7,0x4c,0x19,0xa4,0xe5,0x0b,0x19,0x5b}, 55599, 572, 1048576, 1},
+    {{0xa3,0xf1,0xab,0xf2,0x74,0x0f,0xf6,0x40,0x42,0xd8,0x2f,0x7a,0x94,0x0f,0xb4,0x26,0x9e,0xce,0x57,0xd7,0xc6,0x96,0x75,0x71,0x54,0x9d,0x8b,0x60,0xb2,0x0f,0x30,0x5a}, 56171, 478, 524288, 1},
+    {{0x73,0x73,0x1a,0x5a,0x79,0x32,0x96,0x5d,0xe0,0x2a,0x9e,0x98,0x05,0x5d,0xcf,0x88,0xb4,0xd1,0x7b,0x8f,0x71,0x0a,0x6e,0xcf,0xde,0x3e,0x36,0xa1,0xf2,0x48,0x77,0x3b}, 56649, 609, 1048576, 1},
+    {{0x1b,0x58,0xd0,0xae,0xd4,0x51,0x08,0x11,0xc7,0x3d,0x26,0x72,0x44,0xa7,0xe9,0x15,0xaa,0x0b,0x33,0x4c,0x86,0xe6,0x8f,0x3f,0xa5,0x88,0x3f,0x5c,0xb5,0x34,0xe4,0xd7}, 57258, 541, 2621440, 1},
+    {},
+    {{0xd7,0x8f,0xf4,0x2e,0xfd,0xbb,0x0e,0x18,0x07,0x77,0xd1,0x7b,0x5f,0x7a,0x96,0xe0,0x85,0x30,0xab,0x77,0xf1,0x5a,0x99,0x23,0x7f,0x60,0x71,0x4f,0x7c,0xfe,0x2b,0x74}, 57799, 532, 1048576, 1},
+    {{0x22,0x77,0xa2,0xd8,0xdd,0xdb,0x01,0xfe,0x5c,0xb0,0xae,0x9a,0x0f,0xa2,0x25,0xd4,0x2b,0x3a,0x11,0xad,0xcc,0xae,0xaf,0xa1,0x8e,0x3c,0x33,0x9b,0x37,0x94,0xa3,0x2b}, 58331, 695, 4194304, 1},
+    {},
+    {{0x80,0x83,0x30,0x7f,0x3f,0x4b,0x7d,0xf9,0xe5,0xbf,0x53,0xd5,0xf2,0x58,0x77,0xc2,0xe5,0x48,0xf0,0xf6,0x77,0x54,0x0d,0x4e,0xe6,0x2d,0x60,0xcc,0xca,0x30,0x98,0xf8}, 59026, 565, 2097152, 1},
+    {{0x89,0xad,0x4b,0xa0,0x2a,0x25,0x18,0xca,0x79,0x2c,0xf9,0x6b,0x61,0xb3,0x66,0x13,0xf8,0x6b,0xaa,0xc9,0x23,0x44,0xc9,0xc1,0x0d,0x7f,0xab,0x54,0x33,0xbe,0xbc,0x16}, 59591, 949, 532480, 3},
+    {{0x74,0x06,0x46,0xf3,0x53,0x5b,0xfb,0x36,0x5c,0xa4,0x4e,0x70,0xd4,0x6a,0xb4,0x33,0x46,0x7b,0x14,0x2b,0xd8,0x40,0x10,0x39,0x30,0x70,0xbd,0x0b,0x14,0x1a,0xf8,0x53}, 60540, 878, 4194304, 1},
+    {},
+    {},
+    {},
+    {{0xaa,0x69,0xd4,0xe1,0x9c,0x2e,0xb2,0x06,0xfe,0x88,0xeb,0xa6,0x59,0x94,0xc8,0x30,0x25,0x6c,0x22,0x0e,0x55,0x06,0xf5,0x98,0x24,0xae,0xfa,0x0a,0x75,0xdd,0x44,0xd5}, 61418, 558, 524288, 1},
+    {{0xe2,0xbe,0x17,0x3c,0x77,0xbd,0x19,0x57,0x78,0x7b,0xe3,0x6d,0x13,0x33,0x4f,0x65,0x5e,0x14,0xd3,0x2d,0xad,0x99,0xca,0xcb,0x0f,0xd5,0xe5,0xfc,0x65,0xd9,0x6f,0xa1}, 61976, 593, 2097152, 1},
+    {{0x38,0xbe,0x80,0x13,0xbb,0xe0,0x7b,0x20,0x20,0xba,0x30,0x03,0x1f,0xb0,0xa2,0xc7,0x7b,0xad,0x8a,0x3e,0xb6,0x1f,0xac,0x82,0x17,0xad,0xfe,0x82,0xd6,0xc4,0x02,0xaf}, 62569, 503, 4194304, 1},
+    {},
+    {{0x4f,0xb9,0xb0,0x10,0xe4,0xb1,0xdc,0x16,0x6a,0xb7,0x99,0x5a,0x6f,0x94,0x91,0x11,0x40,0x63,0xb6,0x8a,0xac,0x34,0x40,0x04,0xb1,0xed,0xfc,0x55,0x59,0x51,0xd9,0x59}, 63072, 494, 2097152, 1},
+    {{0xd9,0x90,0x08,0xd2,0x18,0x19,0x86,0xdc,0x7f,0x65,0x22,0x86,0x96,0xd9,0x40,0xb5,0xd3,0x1b,0xe8,0x47,0x1f,0x16,0x6d,0x1a,0xb9,0xb1,0xc1,0x4f,0x15,0x03,0xbc,0xfb}, 63566, 601, 1048576, 1},
+    {{0x7d,0xbf,0xc4,0x4d,0x28,0xa4,0x6e,0x6d,0x39,0x96,0x28,0xe4,0x30,0x86,0xaa,0x9f,0xd0,0xb2,0xab,0xed,0xa4,0xc1,0x08,0x75,0x1a,0x5a,0xd9,0x1c,0x10,0x2c,0x3a,0xaf}, 64167, 514, 1048576, 1},
+    {{0x60,0xd0,0x1a,0x3f,0x49,0x94,0x63,0x15,0x65,0x46,0xec,0xde,0xe1,0x8e,0xe3,0xe9,0x46,0xb9,0x53,0x02,0xee,0x0b,0x15,0x69,0xde,0xcb,0x97,0xf5,0x23,0x72,0xd2,0xeb}, 64681, 562, 524288, 1},
+    {{0x81,0x5b,0xfc,0xf4,0xfd,0x6e,0xb2,0x3a,0x20,0xc2,0xe5,0x0d,0xde,0x02,0x3c,0x21,0x0b,0x27,0x3f,0xfb,0x6c,0xd8,0x6a,0x93,0x90,0x9d,0x80,0x3c,0x36,0x43,0xce,0x46}, 65243, 609, 1048576, 1},
+    {},
+    {},
+    {{0xed,0xac,0xb4,0x53,0xda,0x14,0xf8,0x25,0xf0,0x5d,0x11,0x34,0xd6,0x03,0x5f,0x4b,0xf0,0x34,0xe5,0x5f,0x7c,0xfb,0x97,0xc7,0x0c,0x4e,0xe1,0x07,0xea,0xbc,0x73,0x42}, 65852, 762, 262144, 1},
+    {{0x30,0x59,0xd8,0x6c,0xdc,0x38,0x39,0x85,0xc5,0x64,0xa7,0xa8,0x91,0xfe,0x18,0xe0,0x8f,0x52,0x22,0xea,0xd7,0xed,0xe9,0xfa,0x30,0x91,0x59,0xd6,0x0c,0xde,0x13,0xa1}, 66614, 627, 1572864, 1},
+    {{0x40,0x68,0xad,0xd4,0x12,0x57,0x1b,0xd8,0x5a,0xda,0xc3,0x2d,0xff,0x98,0x35,0xe4,0xa4,0x88,0x60,0x77,0xd7,0x52,0xad,0xb1,0x04,0xfe,0xe3,0x90,0x8e,0x42,0xb7,0xef}, 67241, 561, 1048576, 1},
+    {{0xd5,0xc6,0x51,0xd7,0x26,0xdd,0x95,0x7b,0x80,0xd0,0x3a,0xb6,0xfd,0xbe,0xd4,0xcd,0xd2,0x6a,0x3c,0xcc,0xf5,0xec,0x9d,0x91,0xaf,0x67,0x25,0x1b,0x3e,0xc2,0x6a,0x3c}, 67802, 518, 524288, 1},
+    {{0xc4,0x11,0x50,0xc0,0xe8,0x40,0x55,0x80,0x13,0x77,0xfb,0x7c,0xb2,0x73,0xcc,0x51,0xca,0x44,0x2b,0x26,0x9c,0xa6,0x28,0x7c,0xad,0xf5,0x14,0xf5,0x53,0xe3,0x47,0x50}, 68320, 522, 524288, 1},
+    {{0xa2,0xad,0xeb,0x4b,0xf0,0xe7,0xcc,0x94,0x36,0x11,0xac,0x72,0x6e,0x55,0x78,0xda,0x40,0x43,0x73,0xa7,0x9e,0x91,0x43,0x6c,0x9b,0xbd,0x15,0x48,0x06,0x88,0xb1,0x5c}, 68842, 526, 524288, 1},
+    {{0xec,0xaf,0x51,0x85,0x2e,0x11,0x15,0x12,0x38,0x5c,0x5f,0x20,0x9d,0x51,0x57,0x8e,0x65,0xb4,0x5f,0xca,0xa1,0x7b,0x29,0x5c,0xa0,0x61,0x20,0xc8,0xd1,0x46,0x45,0x20}, 69368, 529, 2097152, 1},
+    {{0x34,0x02,0x93,0xc0,0x65,0x36,0xd7,0xb6,0x98,0x1a,0xd7,0xc6,0x81,0xe4,0x04,0xf4,0x39,0x0f,0xf6,0xc6,0x23,0x40,0xf8,0x44,0xa4,0x55,0x88,0x77,0xc1,0xb8,0x2a,0xf0}, 69897, 514, 262144, 1},
+    {{0x78,0xe2,0xb8,0x21,0x0d,0x8d,0xd8,0x77,0x6e,0xe2,0x31,0x53,0xeb,0x3d,0xce,0x2c,0xbf,0x7d,0x8d,0xdc,0x3e,0x8a,0x5d,0x25,0xb5,0x80,0x42,0x8f,0x59,0xd9,0x8b,0xdb}, 70411, 564, 1048576, 1},
+    {},
+    {{0x02,0xcb,0x7f,0x1e,0xd2,0x1e,0xd6,0xbf,0xb9,0xea,0xa0,0xe9,0x1d,0xf2,0xad,0xb0,0x63,0xa9,0xbf,0x4c,0xbd,0x6f,0xeb,0x6c,0xd0,0x24,0xd6,0x76,0x82,0x9e,0x22,0x7e}, 70975, 534, 524288, 1},
+    {{0x1e,0x2d,0xed,0x7b,0x1e,0x35,0x04,0x49,0xb7,0xa9,0x9b,0x7e,0xc4,0x14,0x52,0x5e,0x4b,0x9b,0x08,0x6c,0x41,0x6d,0xee,0xee,0x5e,0xb3,0xe4,0x8e,0x03,0x2c,0x46,0xbd}, 71509, 668, 1572864, 1},
+    {{0xb4,0xd0,0xb4,0xa3,0xfd,0x73,0x46,0x9f,0x54,0x69,0xdf,0xcc,0x23,0x16,0xe5,0x08,0x48,0xeb,0xf0,0x63,0x0a,0x22,0x5d,0xf2,0x96,0x9c,0x74,0x07,0x59,0xe3,0x21,0xf4}, 72177, 613, 1048576, 1},
+    {{0x5a,0x4b,0x0c,0x89,0x60,0x6f,0x71,0x18,0x2f,0xa5,0x55,0x2a,0xc4,0x76,0xcc,0x3b,0xbd,0xa5,0xdd,0xc7,0xd4,0x4e,0x33,0xf9,0x18,0x41,0x14,0xaa,0xea,0x38,0x02,0x0d}, 72790, 602, 1048576, 1},
+    {{0x4c,0xb5,0x2b,0xa7,0x51,0xc4,0x2d,0x9e,0x12,0xca,0x42,0x9e,0x5d,0x65,0x76,0x22,0xa3,0x70,0xb6,0x08,0x00,0x28,0x80,0xa9,0x97,0xf6,0x4d,0xe4,0x53,0xf0,0xde,0x20}, 73392, 554, 1572864, 1},
+    {},
+    {},
+    {{0x55,0xf3,0x43,0x2a,0x13,0x00,0x85,0xc1,0x12,0xd6,0x5a,0xa6,0x44,0x3c,0x41,0xeb,0x7a,0x8a,0xee,0xc5,0x9a,0xad,0x2c,0x2b,0x4b,0x2a,0xc5,0x36,0xb6,0x04,0xb4,0x49}, 73946, 530, 524288, 1},
+    {{0xf7,0xe3,0xc3,0x01,0x2a,0xf2,0xdb,0xad,0x35,0x06,0x46,0xb6,0xef,0x34,0x70,0xf0,0xb4,0xc4,0x2e,0x4a,0x28,0x73,0x10,0x9f,0x7a,0xa6,0xc8,0x1d,0x71,0x57,0xc8,0x87}, 74476, 552, 1048576, 1},
+    {},
+    {{0x93,0x27,0x21,0x80,0x09,0x0e,0x84,0x18,0x58,0x2f,0x69,0xb7,0x9c,0x5c,0xee,0x6b,0x28,0x63,0x8b,0x9a,0x93,0x19,0x2c,0xc4,0xbc,0xd9,0x62,0x91,0xa4,0xfc,0xa0,0x2d}, 75028, 508, 524288, 1},
+    {{0x7f,0x3d,0x0e,0xba,0xc6,0xec,0xfb,0x99,0xcf,0xd1,0xd5,0xb1,0x32,0x10,0xe9,0x89,0xdf,0x9e,0x8b,0x2f,0x23,0x19,0xa6,0x3c,0x42,0xfa,0xef,0x8a,0xd1,0x15,0xa9,0x64}, 75536, 590, 524288, 1},
+    {},
+    {{0xc7,0x81,0x4c,0xee,0x0f,0xc9,0x5d,0x64,0x22,0xcf,0x19,0xa3,0xdc,0x8c,0x9a,0x65,0xb6,0x0f,0x6f,0x56,0xda,0x75,0xf0,0x9c,0xeb,0xea,0x02,0xcc,0x5f,0x99,0x26,0x1b}, 76126, 510, 1048576, 1},
+    {{0x6b,0x0a,0xc4,0xd5,0x2d,0x24,0x53,0x6c,0xdb,0x7d,0x9d,0x0d,0xc7,0xd1,0x9e,0xe3,0x0d,0x08,0xac,0x34,0x36,0x39,0x83,0x29,0x0c,0x59,0x12,0xcc,0xc8,0x50,0xfa,0x0d}, 76636, 514, 524288, 1},
+    {},
+    {{0xdf,0x02,0xd0,0xf4,0xf4,0x0e,0x27,0x32,0x13,0x83,0x09,0xd3,0x8e,0x91,0xb4,0x8a,0xef,0x48,0x24,0x90,0x97,0x90,0x07,0xec,0xb6,0x33,0x59,0xa3,0x51,0x15,0xdf,0xd4}, 77150, 571, 1048576, 1},
+    {{0x32,0x77,0x45,0xac,0xeb,0x70,0x8d,0x82,0x41,0x9c,0x3d,0x2c,0xff,0xdf,0xfa,0x78,0xf5,0x5d,0xf0,0x87,0x8b,0xb1,0x78,0x6e,0x1b,0x7f,0xc2,0x94,0x38,0x5f,0x20,0xba}, 77721, 916, 1581056, 3},
+    {{0xf6,0x53,0xb8,0x30,0x8b,0x61,0x7e,0x1c,0xba,0x1c,0xaf,0x00,0x4e,0x5a,0x67,0x00,0x88,0xb8,0x82,0xe3,0x20,0xfa,0x6a,0xfc,0xc7,0xa2,0x9d,0xd3,0xb2,0xdd,0x0e,0xa0}, 78637, 564, 1048576, 1},
+    {{0x06,0x4a,0x88,0x0a,0x8d,0xfc,0xf5,0x76,0xf7,0x4a,0xe8,0xa1,0x7c,0x3e,0xc7,0xb0,0xa2,0x7e,0x8c,0xb0,0x30,0x0a,0x5e,0x59,0x59,0x45,0x2f,0xcc,0x30,0x42,0x2f,0x14}, 79201, 535, 2097152, 1},
+    {},
+    {},
+    {},
+    {{0xaa,0xd8,0xc9,0xbe,0x1b,0x7a,0x96,0x62,0x25,0x6b,0x0c,0x3d,0x76,0xf5,0xb7,0xa2,0x73,0xbc,0xd4,0x97,0xaa,0x83,0x82,0x32,0xd3,0x07,0xe9,0xf2,0xe8,0x0c,0xf6,0x99}, 79736, 518, 524288, 1},
+    {{0x45,0x4c,0x58,0x04,0x98,0xa7,0xd3,0x17,0xed,0x61,0xcb,0x58,0x63,0xb1,0x99,0x9e,0xff,0x57,0xad,0x44,0x0e,0xcd,0x30,0xeb,0xb7,0x6e,0x19,0x3c,0x9c,0x52,0xf3,0xac}, 80254, 528, 2097152, 1},
+    {{0x9c,0x2b,0x45,0x8e,0x8f,0xda,0x5c,0xb4,0x37,0xa4,0xc6,0xd2,0x8f,0xb4,0x30,0xe4,0x5c,0x4c,0xfe,0xf9,0x84,0x20,0xc4,0x05,0x46,0xb8,0xe0,0x85,0x63,0xa4,0xfc,0x7d}, 80782, 496, 1048576, 1},
+    {{0x57,0x1d,0x31,0x29,0x35,0x0b,0xfb,0x7c,0xca,0x22,0x85,0x49,0x9c,0xf3,0x1d,0xda,0x48,0xd1,0x04,0x7c,0xf9,0xea,0xef,0x12,0x2c,0x8c,0x33,0xdf,0xfa,0x9a,0xd2,0x96}, 81278, 817, 2097152, 1},
+    {{0xb2,0x96,0x05,0x4e,0xff,0xb1,0x94,0x80,0x39,0x63,0x50,0x44,0xbc,0x90,0x5f,0xdf,0x8f,0xf5,0x3e,0x7a,0x73,0x03,0x8f,0xd5,0xd8,0x43,0x6a,0x91,0x3e,0xa5,0xad,0x8a}, 82095, 492, 1048576, 1},
+    {{0xdb,0x57,0xf4,0x5e,0x11,0x31,0x27,0xb7,0x14,0x8c,0x1b,0x0a,0xdd,0x2d,0xa8,0x88,0xe1,0x6e,0x16,0xb3,0xe4,0x67,0x49,0xf9,0x59,0x73,0xb3,0xef,0x49,0x7a,0xe9,0x0b}, 82587, 522, 1048576, 1},
+    {{0xf6,0x51,0xa4,0x2b,0xb3,0x51,0xf7,0x69,0x1b,0x88,0x08,0x27,0x17,0x8c,0x36,0xfc,0xf6,0xc2,0x65,0xc7,0x83,0x3c,0x6d,0xe1,0xd9,0x4f,0x7e,0xd6,0x9b,0xac,0x05,0x17}, 83109, 522, 1048576, 1},
+    {{0x22,0xb2,0x1f,0xb3,0x9d,0x40,0x44,0x78,0x46,0xf6,0xff,0x77,0xa0,0x7f,0x7b,0x4a,0xba,0x2a,0x74,0x73,0x94,0x1b,0xa5,0x0c,0x78,0x7a,0xae,0x61,0x53,0xb1,0xfb,0x5e}, 83631, 545, 1048576, 1},
+    {{0xa3,0x62,0x03,0x3d,0x0d,0x7e,0x75,0x4d,0x79,0x20,0x2b,0x25,0x56,0x79,0x18,0x6a,0xd7,0x99,0xb9,0xe7,0x84,0x71,0x96,0x14,0xb9,0x13,0xec,0x8c,0x98,0x57,0xae,0x33}, 84176, 520, 1048576, 1},
+    {{0x69,0xc5,0x80,0x5a,0xd0,0x49,0x47,0x03,0xe7,0xd6,0x36,0xd3,0xd4,0x0d,0x61,0x5d,0x33,0xe7,0x9b,0xeb,0xef,0x9d,0x2c,0xdb,0x4a,0x23,0xb7,0x3d,0x44,0xc7,0xb6,0xf9}, 84696, 587, 1048576, 1},
+    {},
+    {},
+    {},
+    {{0x4d,0x22,0x27,0x9e,0x53,0x48,0x48,0x01,0x2e,0x0f,0x15,0x95,0x46,0x86,0x87,0x74,0x2a,0xe1,0x8c,0xab,0xc3,0xfe,0x44,0xee,0xef,0x93,0x8b,0xc3,0xa4,0xdd,0x08,0xbf}, 85283, 571, 524288, 1},
+    {{0x2b,0x2f,0xe6,0x1a,0xc7,0xa7,0x9c,0x3c,0xfa,0xa0,0xbc,0x16,0xf1,0xb1,0xf4,0xda,0x54,0x4f,0xcc,0x37,0xcf,0xdf,0x3c,0x18,0x87,0x9d,0x31,0xb8,0xb9,0xf8,0x79,0x41}, 85854, 606, 1048576, 1},
+    {{0x3d,0x5b,0xbc,0x06,0xe7,0xe9,0x79,0x7d,0x93,0x7c,0x80,0x36,0x10,0xc4,0x0b,0x26,0x2c,0x14,0xc3,0xf0,0xa3,0x9e,0x80,0x48,0xdd,0x6b,0x0b,0x05,0x2a,0x04,0x0f,0xc1}, 86460, 594, 1048576, 1},
+    {{0x21,0xa2,0xaa,0x48,0x8c,0xb8,0x14,0x0c,0xa3,0x18,0xf7,0xd1,0xf5,0x13,0x10,0x3d,0x14,0xe7,0x58,0x18,0x1a,0xa3,0x36,0xa5,0x94,0x09,0x7d,0x32,0xba,0x0a,0x75,0x87}, 87054, 562, 1310720, 1},
+    {{0x07,0x73,0xeb,0x74,0x1c,0xe2,0x8f,0x96,0x3f,0x76,0x7f,0xc7,0xdd,0x44,0x67,0x8e,0xb3,0xd3,0x7e,0xd4,0xdc,0x7f,0xc8,0x2b,0xb9,0xcc,0xe7,0xd5,0x5f,0x1c,0xfc,0x64}, 87616, 607, 2097152, 1},
+    {{0x03,0xd2,0x52,0x27,0xfb,0x88,0x89,0x9d,0x0f,0x32,0x34,0xc4,0xa3,0xf7,0x6f,0x1d,0xbe,0x8d,0x58,0x2c,0xb6,0x42,0x94,0x54,0xfd,0x6f,0x1c,0x4c,0xf1,0x4d,0x5c,0x6e}, 88223, 904, 1056768, 3},
+    {{0xb1,0x58,0x6c,0x8e,0xce,0x4d,0xa9,0x69,0x7f,0x06,0x02,0xa6,0x84,0xd7,0xa9,0x10,0x80,0x27,0x24,0x7a,0x34,0x65,0x2c,0x37,0x71,0x83,0x1d,0x31,0xf8,0x2e,0xe0,0x78}, 89127, 530, 1048576, 1},
+    {{0x6e,0x45,0xa8,0x0e,0xa1,0x48,0x65,0x45,0x14,0xcb,0x4e,0x86,0x04,0xa0,0xff,0xcb,0xc7,0x26,0x94,0x6e,0x70,0xf9,0xe0,0xb9,0x86,0x0e,0x36,0xc0,0xf3,0xfa,0x48,0x77}, 89657, 520, 524288, 1},
+    {{0xbb,0xde,0x8b,0x46,0xc7,0x26,0x2f,0x9d,0x4a,0x5b,0x39,0x26,0xa0,0x08,0x50,0xcb,0x00,0xb4,0xf7,0x71,0x1f,0x64,0x21,0xf0,0xad,0xf4,0xe2,0xb0,0xc8,0x47,0xa5,0xd6}, 90177, 540, 1048576, 1},
+    {},
+    {},
+    {{0x3f,0xfb,0xb6,0xe0,0xcc,0xf8,0xe9,0xf5,0xe4,0xc7,0x2d,0x9f,0xe5,0x26,0xa1,0x63,0x71,0xe5,0x62,0xb7,0x1a,0x91,0xd6,0x43,0x0e,0x56,0x2b,0xf3,0x58,0xa5,0x12,0x6b}, 90717, 532, 524288, 1},
+    {{0x1b,0xd3,0xaf,0x01,0x25,0x74,0x3b,0xf9,0xbb,0xba,0xc6,0xe7,0xdc,0x21,0x5f,0xe3,0x2c,0x4f,0xf7,0x04,0x3a,0x2e,0xe0,0x34,0xd5,0x6b,0x62,0x7e,0x3f,0x68,0x75,0xf0}, 91249, 573, 1048576, 1},
+    {},
+    {{0xb7,0x2f,0xbb,0xfe,0x73,0x7e,0xff,0x49,0xf5,0x9d,0xce,0xf9,0xf1,0x3b,0x96,0x3e,0x50,0xc5,0xbc,0x32,0x2d,0x7e,0xb0,0xe7,0xb4,0xc2,0x5f,0x3a,0x71,0xaa,0x08,0x15}, 91822, 577, 3145728, 1},
+    {{0x4d,0x6c,0x7d,0x6d,0x26,0x93,0xd8,0xd4,0x3b,0xaf,0xaf,0xf7,0x58,0x2f,0x9a,0x94,0x88,0x53,0x62,0xda,0xdd,0x9e,0xe4,0x01,0x2b,0xbb,0xdc,0xe1,0xba,0x10,0xc3,0x0e}, 92399, 561, 2097152, 1},
+    {{0xa2,0x55,0xfe,0xc3,0x24,0x53,0x73,0x99,0x03,0xa1,0x95,0x41,0x49,0xf1,0x9b,0xc9,0x65,0x8f,0x4a,0x41,0x56,0x00,0xb4,0x4b,0xad,0xf1,0xd4,0xe5,0xe1,0x3a,0x16,0xf9}, 92960, 492, 2097152, 1},
+    {{0x19,0xf4,0xa1,0xf0,0x8a,0xa5,0x5f,0xf3,0xcc,0x8f,0xf7,0xae,0x60,0xff,0xe0,0x3f,0x0e,0x43,0x6e,0x8d,0x89,0x01,0x45,0x5f,0x13,0x11,0xf2,0x27,0x64,0x97,0xa4,0x92}, 93452, 536, 1048576, 1},
+    {{0x41,0x0e,0x90,0xdb,0x3d,0x38,0x50,0x7c,0xcc,0x85,0xad,0x3b,0xca,0x6b,0x27,0xa0,0x80,0x12,0x3f,0xd5,0x16,0x0e,0x82,0xb5,0xde,0x4d,0x91,0x4d,0x4b,0x6d,0x6e,0x61}, 93988, 506, 4194304, 1},
+    {{0xba,0x67,0x9a,0x11,0x26,0x4e,0x96,0x95,0x89,0x5a,0x6c,0x17,0x35,0x8a,0x41,0xe8,0x45,0x9b,0xe0,0x61,0x66,0xd0,0x56,0x81,0x1d,0xf9,0xc2,0x73,0x8f,0xef,0x3d,0x0d}, 94494, 583, 1048576, 1},
+    {{0x3a,0xb1,0xca,0x18,0x10,0x00,0xf1,0x0c,0xb7,0xc2,0xae,0x8d,0xc9,0xfa,0xfe,0xec,0xd5,0xd7,0x73,0x14,0xee,0x92,0x96,0x0e,0x26,0xdf,0xf0,0xd6,0xa1,0xfd,0x11,0xee}, 95077, 541, 524288, 1},
+    {{0x60,0x7b,0xfa,0x0f,0x74,0xe5,0x72,0x98,0xf5,0x9e,0xbe,0x23,0x7c,0x2e,0x7b,0x59,0x36,0x40,0x24,0xd8,0x44,0x53,0x4f,0x3b,0xef,0xb9,0xad,0x13,0x01,0xbb,0xed,0xf8}, 95618, 540, 1048576, 1},
+    {{0xc9,0x88,0x97,0x99,0xa9,0xae,0x85,0x58,0xf2,0x6d,0x66,0xae,0x54,0x6d,0xb9,0x30,0xc9,0x9a,0xcb,0x78,0xd9,0x21,0xb4,0x39,0x5a,0xfb,0xbc,0x38,0xda,0x62,0x72,0xaa}, 96158, 563, 1048576, 1},
+    {{0xf0,0xd9,0x8e,0x90,0x61,0xd0,0xf6,0xa1,0x93,0xbb,0x85,0x6d,0xe8,0xa5,0x92,0xf3,0x36,0xda,0xda,0x97,0xc4,0x19,0x66,0xe8,0xd0,0x31,0x19,0xba,0x97,0x46,0x54,0x13}, 96721, 560, 1048576, 1},
+    {{0x86,0x20,0x20,0x3d,0xa7,0x1d,0x32,0xd0,0x17,0xbb,0x21,0xf5,0x42,0x86,0x4c,0x1d,0x90,0x70,0x5b,0x87,0xeb,0x67,0x81,0x5d,0x06,0xb4,0x3f,0x09,0x12,0x03,0x18,0xaa}, 97281, 968, 5242880, 2},
+    {},
+    {},
+    {{0x2a,0x2d,0xc2,0xef,0x84,0xef,0xd9,0xa7,0x73,0xd1,0xe8,0x23,0x1b,0x7e,0x3e,0x57,0xf0,0xde,0x7e,0x45,0x28,0x96,0x86,0x70,0x96,0x3f,0x2f,0x1f,0x35,0x8e,0xef,0x39}, 98249, 613, 1572864, 1},
+    {},
+    {{0x05,0x03,0xcd,0x93,0xb4,0xd2,0x11,0xa8,0x25,0xac,0xd4,0x7f,0xf3,0x81,0x36,0x68,0xb4,0xce,0x68,0x89,0x0c,0x8b,0xe2,0xfb,0xfe,0x5a,0xc2,0xb4,0x68,0x82,0xdf,0xcf}, 98862, 564, 2097152, 1},
+    {{0xc4,0x14,0xa4,0x08,0x4b,0x3d,0x03,0xab,0xa1,0x94,0x96,0xd2,0xef,0xdd,0x68,0xfc,0xf8,0x26,0x19,0x4d,0x8f,0x13,0x08,0xf5,0xc9,0x8e,0x3a,0x7a,0xf2,0xfc,0xc0,0x63}, 99426, 503, 2097152, 1},
+    {},
+    {{0x8f,0x13,0x11,0x82,0xb2,0x86,0xbd,0x87,0xf1,0x2c,0xf4,0xf0,0x04,0x53,0x33,0x65,0x38,0xce,0x69,0x0d,0x0e,0x1f,0x09,0x72,0xac,0x0b,0xe9,0x8d,0xf4,0xd4,0x89,0x87}, 99929, 547, 3145728, 1},
+    {{0x56,0xba,0x3d,0x58,0x5b,0xf6,0xb7,0x01,0xe3,0x42,0xd8,0x6a,0x0b,0xd1,0x64,0xab,0x0a,0x97,0xdf,0xbd,0x5d,0xf4,0x6b,0x3a,0x96,0x45,0x06,0x84,0x26,0x33,0x45,0x9c}, 100476, 524, 1048576, 1},
+    {{0x82,0x67,0xe2,0xf0,0x92,0xc8,0x6d,0x5a,0x29,0xc9,0xa8,0x26,0xdb,0x82,0xc7,0x47,0x36,0x38,0xe2,0x8e,0x25,0x07,0xcd,0xaf,0x5c,0x86,0x98,0x1f,0x07,0xcd,0x0b,0xef}, 101000, 532, 1048576, 1},
+    {{0x5d,0xb8,0x04,0x17,0x1f,0xca,0x42,0x48,0x64,0x85,0xed,0x85,0xe4,0xaf,0xe4,0x5b,0x29,0xe6,0xd0,0x13,0x04,0xbd,0xf7,0x5d,0x52,0x0b,0xfc,0x42,0x42,0x97,0x39,0xe3}, 101532, 497, 4194304, 1},
+    {{0x22,0xc9,0x07,0xb5,0x6a,0xc6,0xf4,0x14,0x36,0x58,0x01,0xed,0x37,0x5c,0x3f,0xbf,0x75,0x69,0x6c,0xe7,0xf3,0x4e,0xc8,0x9e,0x17,0x24,0x62,0x8d,0xc5,0x62,0x29,0x57}, 102029, 591, 2097152, 1},
+    {{0xcd,0xe8,0x87,0x6b,0x99,0xc3,0x37,0xff,0x93,0x23,0x22,0x50,0x6c,0xee,0xf0,0x55,0x19,0xe5,0x88,0x2b,0x85,0x3c,0x54,0xbb,0x8c,0x65,0x0d,0x95,0x00,0xcd,0x59,0x57}, 102620, 582, 1572864, 1},
+    {{0xa3,0x14,0x58,0x3b,0x11,0xd5,0x94,0xb8,0x24,0x5b,0x51,0x77,0xaa,0x64,0xa4,0xd3,0xb7,0x49,0x7d,0x09,0x6e,0xda,0xbb,0xea,0x7c,0x18,0x42,0xc5,0x7a,0xa2,0xad,0x2b}, 103202, 568, 2097152, 1},
+    {{0xdc,0x37,0x92,0xe9,0xfe,0x7e,0xf7,0xaa,0xea,0x4a,0xc6,0x75,0xa4,0x8a,0xd0,0x61,0x29,0xdd,0x3e,0xbd,0xd4,0xb9,0x6a,0x51,0x3b,0xc8,0x24,0x15,0x49,0xcb,0xd5,0x79}, 103770, 526, 1048576, 1},
+    {{0x39,0xde,0x64,0x10,0x1c,0xf7,0xf2,0x58,0x63,0xce,0x55,0xe0,0x3a,0x27,0xd1,0x34,0x22,0xea,0x57,0x2e,0xe9,0x96,0x74,0x65,0x78,0xb5,0x93,0x6f,0xea,0x80,0x22,0x8b}, 104296, 518, 1048576, 1},
+    {{0x2d,0x40,0xc8,0x6b,0xc1,0x9d,0x85,0x55,0x5b,0xf2,0x67,0x2a,0xcf,0x51,0x5b,0x04,0xdb,0xf5,0x6a,0x6a,0x59,0xb2,0x9a,0xd5,0x03,0xe6,0x72,0x31,0x0b,0x0f,0xae,0x3b}, 104814, 526, 3145728, 1},
+    {{0xea,0x52,0xb3,0x9a,0x8e,0x1e,0xa1,0x5b,0xfa,0xd6,0xb9,0x28,0x83,0xc9,0xa5,0xfe,0x74,0x4c,0xec,0xd7,0xc0,0xe1,0x75,0xaa,0x3b,0xd4,0x02,0x80,0xcf,0x7a,0x96,0x6e}, 105340, 530, 3145728, 1},
+    {{0xf9,0xda,0xc7,0x09,0xb2,0xc2,0x85,0x9f,0x82,0x81,0x03,0xa0,0xdd,0x98,0x07,0x16,0x81,0x7e,0x2b,0xde,0x3b,0x9d,0x7e,0x2f,0xde,0xa3,0x6e,0x9b,0xb9,0xbe,0xd7,0xf2}, 105870, 496, 3145728, 1},
+    {},
+    {{0xb2,0x1a,0x16,0x1f,0xed,0x74,0x89,0x20,0xe5,0x4c,0xd7,0x2c,0x54,0x09,0x54,0x16,0xb1,0xd9,0x99,0x63,0x6e,0x03,0x88,0xd7,0xd1,0x47,0x88,0x47,0x79,0xc5,0x28,0x33}, 106366, 632, 2097152, 1},
+    {},
+    {},
+    {{0xe4,0xe9,0xbe,0xae,0xeb,0x3e,0x96,0x8a,0xf7,0x72,0xd1,0xc4,0xc9,0xe4,0xc1,0xb4,0xdf,0xdb,0xa4,0xe4,0x7c,0x02,0x05,0xb4,0x58,0xe1,0xab,0x3a,0x62,0xa9,0x60,0x60}, 106998, 573, 1048576, 1},
+    {{0x31,0x56,0x9b,0xef,0x66,0x2b,0xc4,0x38,0x19,0x47,0x26,0x96,0x79,0x70,0xbf,0x19,0xf5,0x04,0x10,0x10,0x60,0x76,0x3c,0xbd,0x64,0x93,0x50,0x36,0x2f,0xb6,0xef,0x2f}, 107571, 593, 524288, 1},
+    {{0xb0,0x72,0xfd,0x9b,0x08,0x04,0x2e,0x32,0x62,0x44,0x6f,0xdf,0x41,0x8a,0x41,0x84,0x82,0x51,0x07,0x2a,0x32,0xbd,0x7f,0x83,0x35,0xcc,0x03,0x54,0x3c,0x4a,0xe6,0xc8}, 108164, 525, 1048576, 1},
+    {{0x1d,0x3c,0xce,0xaa,0x05,0xe0,0x54,0xb0,0x02,0xca,0xeb,0x09,0xfd,0x5f,0xb9,0xe7,0x18,0xec,0x44,0x67,0x64,0xf4,0x16,0x9d,0x97,0xbc,0x18,0x5d,0xa7,0x6f,0xdf,0x4d}, 108689, 520, 1048576, 1},
+    {{0x5f,0xd7,0x66,0x6e,0x50,0x9f,0x9d,0x3c,0xf1,0xfd,0x6b,0x20,0x9d,0xc2,0x2f,0x2f,0x38,0x48,0xf7,0x4e,0xae,0x7b,0x83,0x23,0x9d,0x10,0x90,0xe0,0x31,0xfc,0x6d,0xf2}, 109209, 520, 1048576, 1},
+    {{0x75,0x2d,0x24,0xfa,0xb2,0x40,0xf4,0xdd,0x1d,0xfb,0xfe,0xa5,0xec,0x83,0x43,0x89,0x98,0x31,0x68,0x06,0xad,0x44,0x48,0x8b,0xf8,0xc8,0x44,0x30,0xca,0x5a,0x2c,0xd0}, 109729, 528, 2097152, 1},
+    {{0xfe,0xde,0x9d,0x4a,0xec,0x8c,0x35,0xed,0x11,0xe2,0x86,0x8c,0x3c,0x51,0x7b,0xce,0x53,0xee,0x3e,0x6a,0xf7,0x24,0x08,0x5c,0x92,0x50,0x0e,0x99,0xe4,0x3e,0x63,0xde}, 110257, 633, 3145728, 1},
+    {{0xf9,0x21,0x29,0x7c,0x36,0x1f,0x16,0xad,0x3f,0x12,0x57,0xe9,0x18,0x29,0x63,0x8f,0xc7,0x95,0xf9,0x32,0x31,0x72,0x01,0x5d,0x72,0x37,0xed,0x64,0x8c,0x8f,0x75,0x15}, 110890, 512, 524288, 1},
+    {{0x44,0x6a,0x10,0x36,0xd0,0x36,0x98,0x6f,0xde,0xa7,0x90,0x6c,0x83,0x83,0x2d,0x3b,0xa7,0x9e,0xf6,0x3a,0x6e,0xd8,0xc4,0xe8,0x8b,0x89,0xab,0x9c,0xb2,0x5d,0xad,0xed}, 111402, 599, 1048576, 1},
+    {},
+    {{0xd0,0x7e,0x88,0x02,0xa6,0xd9,0xc7,0x77,0x24,0x78,0x74,0xe0,0x5e,0xc0,0x8f,0xce,0x7e,0x0f,0xa1,0xbf,0x12,0x2c,0xc1,0xab,0x99,0x13,0xf7,0xd8,0x28,0xe4,0x07,0x2b}, 112001, 596, 1048576, 1},
+    {{0x35,0xdd,0x02,0x0c,0xf5,0x7f,0xc4,0x02,0x41,0x7a,0xb6,0xe4,0xa6,0xc4,0x98,0x66,0xc5,0xa8,0x6b,0xba,0x25,0x21,0x8c,0x0a,0xaf,0x7c,0xe8,0x5c,0xb1,0x34,0xbc,0xf8}, 112597, 576, 1572864, 1},
+    {{0x97,0x12,0x82,0x9b,0x38,0xf2,0x32,0x29,0xd4,0xe3,0xd6,0x5d,0xa7,0x82,0x37,0x65,0x9c,0x79,0x02,0x35,0xf4,0x25,0xc6,0xb1,0x24,0x87,0xe4,0xd9,0xe9,0xa3,0x7a,0xe9}, 113173, 518, 2097152, 1},
+    {{0x0c,0x08,0xe6,0xb8,0x17,0xe4,0xd0,0xb3,0x33,0xac,0xb9,0x10,0xa0,0xbd,0xe3,0xd7,0x9b,0xd2,0xdc,0x18,0x8d,0xef,0xc5,0xdf,0x9a,0x7c,0x12,0x33,0xfa,0x81,0xc9,0x8d}, 113691, 510, 524288, 1},
+    {{0xc2,0x01,0x5d,0x03,0xdd,0x3d,0xb0,0x80,0x69,0xb2,0xa6,0xea,0x1e,0xd6,0xb3,0xe1,0xac,0x1e,0x3a,0x5f,0x80,0x4b,0x02,0x29,0x5c,0x3c,0xd3,0x71,0x7a,0xdd,0x91,0xef}, 114201, 520, 1048576, 1},
+    {{0x47,0xdd,0x8e,0xa2,0xd1,0x2a,0x6b,0xb2,0xa9,0x77,0x4d,0xe1,0xd4,0x92,0x25,0x9f,0xc4,0xfb,0x9f,0x8e,0xc7,0x97,0x63,0x83,0xbb,0xfd,0x92,0x25,0x32,0x67,0x1f,0x6b}, 114721, 518, 2097152, 1},
+    {{0x9f,0xf6,0xbb,0xcc,0xe7,0xdc,0x1f,0x3b,0xde,0xd9,0x68,0x60,0xa8,0x66,0x98,0xca,0xb1,0x61,0xd1,0x3e,0xe1,0x67,0xc5,0x7b,0x5b,0x11,0x4a,0xc6,0x46,0xee,0xa0,0xea}, 115239, 530, 2097152, 1},
+    {{0xa8,0xac,0xbb,0xd6,0xf8,0xaf,0xbf,0x28,0x9a,0x6b,0x83,0x7d,0xa6,0xcd,0x8b,0xd1,0x09,0xa0,0x0c,0xd3,0x86,0x25,0xc9,0x56,0xab,0x8f,0xf7,0x39,0x73,0x2d,0x9e,0x4f}, 115769, 488, 1048576, 1},
+    {},
+    {},
+    {},
+    {{0x66,0x87,0x1d,0x66,0xbe,0x19,0xad,0x2c,0x34,0xc9,0x27,0xd6,0xb1,0x4c,0xd8,0xeb,0x6f,0xc3,0x18,0x19,0x65,0xb6,0xe5,0x17,0xcb,0x36,0x1f,0x73,0x16,0x00,0x9c,0xfb}, 116257, 630, 1048576, 1},
+    {{0xa3,0x1a,0xf0,0xe3,0x9a,0xfb,0x55,0xbb,0xc9,0x2a,0x55,0x43,0xb5,0x04,0x32,0x7f,0xbe,0x7e,0x8c,0xd0,0xa5,0xe0,0x86,0x26,0x97,0x6b,0xed,0x7b,0x65,0x37,0x67,0x37}, 116887, 606, 1048576, 1},
+    {{0x49,0xdd,0x77,0xb3,0x10,0xb4,0x76,0xc8,0x75,0x63,0x33,0x35,0x24,0x35,0x53,0xbe,0x59,0xec,0xfb,0x0b,0xff,0xae,0x62,0xe4,0x6f,0x2e,0x53,0xff,0x05,0xc2,0x0f,0xcd}, 117493, 548, 2097152, 1},
+    {{0x32,0xf4,0x2f,0xda,0x06,0x67,0xd9,0x43,0x5a,0x2d,0xe8,0x4c,0x7c,0xe7,0xb0,0x67,0xbc,0xba,0xb1,0x16,0x4f,0x8f,0x6d,0x83,0x79,0x92,0xad,0x6c,0xfa,0xc4,0xf8,0xde}, 118041, 522, 1048576, 1},
+    {{0x9d,0x72,0x17,0x53,0x30,0x12,0x78,0x32,0x5c,0x85,0x1f,0x18,0x43,0xd6,0x69,0xa6,0x97,0xae,0xd7,0x57,0xdc,0xf6,0x49,0x5a,0x31,0xfc,0x31,0xdd,0xf6,0x64,0xb1,0x82}, 118563, 535, 1048576, 1},
+    {},
+    {},
+    {{0x9c,0xf8,0x2d,0xd9,0xa8,0x51,0xcd,0xc3,0x8b,0xf2,0xaf,0xc2,0x86,0xc0,0x77,0xff,0x18,0xa0,0xa5,0xd3,0xbb,0x30,0x1e,0xba,0x60,0x6c,0xc5,0x2d,0xb6,0x2f,0x89,0x65}, 119098, 524, 524288, 1},
+    {},
+    {{0x98,0xc5,0x1c,0x3b,0xb5,0x77,0x60,0x0f,0xe7,0x95,0x77,0xc3,0x23,0x33,0x3a,0x79,0x1b,0xaa,0x30,0x90,0x4f,0x37,0xc6,0x95,0x89,0x0e,0x6e,0x38,0x0b,0x75,0xe3,0xc8}, 119622, 490, 3145728, 1},
+    {{0x08,0x38,0xe5,0x31,0xfe,0x22,0xc0,0x77,0x52,0x8f,0xeb,0xe1,0x4c,0xb3,0xff,0x7c,0x49,0x2f,0x1f,0x5f,0xa8,0xde,0x35,0x41,0x92,0xbd,0xff,0x71,0x37,0xc2,0x7f,0x5b}, 120112, 582, 524288, 1},
+    {{0x13,0x2c,0xa0,0xb6,0xa4,0x88,0x8e,0xdf,0x7d,0xe7,0x85,0xd4,0x8f,0x44,0x17,0xfa,0xc2,0x85,0x22,0x64,0x6e,0x6c,0x75,0x14,0xf8,0x0c,0x5e,0x9f,0xf1,0x43,0x8d,0x5f}, 120694, 557, 1048576, 1},
+    {{0x88,0x54,0x5d,0x24,0xc6,0x0c,0x18,0xc6,0x95,0xcc,0x3f,0xce,0x8c,0x40,0x74,0xf4,0x6a,0xd1,0xba,0xc9,0x05,0xe8,0xa3,0x9a,0x61,0xd8,0xa6,0xae,0x6b,0x60,0x86,0x21}, 121251, 870, 1056768, 3},
+    {{0x62,0x4a,0x66,0x60,0x7c,0xae,0xf2,0xca,0x34,0x92,0x0e,0xa1,0x5b,0x84,0xb2,0x8c,0xdd,0x19,0x16,0xee,0x08,0x9d,0x49,0x6c,0xec,0x4f,0x1d,0x43,0x62,0x1f,0xdb,0xb3}, 122121, 554, 2097152, 1},
+    {},
+    {},
+    {{0x4c,0x13,0x54,0x33,0x7e,0xfa,0x78,0x81,0x69,0x38,0x74,0x58,0xfa,0x6b,0xdb,0xcf,0x4b,0xe0,0xc9,0x83,0x69,0x92,0x0a,0xf2,0xbd,0x87,0x6a,0xd9,0x8d,0x29,0x07,0x0f}, 122675, 522, 524288, 1},
+    {{0x2c,0x61,0x19,0xfb,0xe4,0x0d,0x23,0x57,0x6a,0xdd,0xe5,0x68,0xd6,0x0f,0xfa,0xe7,0x93,0xbb,0xf6,0xb5,0x12,0xf8,0xfe,0xa8,0xdc,0xd0,0xb1,0xcd,0x26,0x23,0xef,0x02}, 123197, 668, 3145728, 1},
+    {{0xee,0x97,0x59,0xfd,0xb5,0x90,0xba,0x90,0x8f,0x56,0x9c,0x2b,0xb8,0xa6,0x37,0x03,0xd2,0x82,0xb5,0x8b,0x84,0xbd,0x1f,0xe0,0xa4,0x72,0xea,0x47,0x68,0x5a,0xcd,0xc5}, 123865, 554, 2097152, 1},
+    {{0x01,0xc0,0xb5,0x8d,0x5f,0xd5,0xd5,0x48,0x4f,0xea,0x98,0x84,0x55,0xa5,0x5a,0x71,0xed,0x9e,0x60,0x65,0x38,0xd2,0xb3,0xce,0x3f,0x21,0x61,0x59,0xcc,0x69,0x29,0xb0}, 124419, 611, 1048576, 1},
+    {{0x3b,0xc5,0xf2,0x96,0xc3,0xdb,0xee,0x01,0x2e,0x93,0xa5,0xcf,0x25,0x56,0x8f,0x92,0x88,0xce,0x87,0xb3,0x4d,0x74,0x08,0x54,0x01,0xa5,0x60,0x35,0x0e,0xac,0xa0,0x3f}, 125030, 530, 2097152, 1},
+    {{0x11,0x21,0xdf,0x3f,0x05,0xdd,0x9d,0xbb,0x74,0x9f,0x6b,0x78,0x5e,0xb9,0xb3,0xeb,0x69,0x96,0x80,0x04,0xf9,0xd6,0xce,0xff,0xa6,0xf8,0x47,0x57,0xaf,0x2f,0x37,0x02}, 125560, 562, 1048576, 1},
+    {{0x2d,0x6f,0xc4,0x21,0x42,0x45,0x68,0x4a,0x8f,0x8f,0x9b,0xb5,0x53,0xde,0x63,0x7b,0x7c,0x66,0x09,0x19,0xec,0x77,0x5b,0xfe,0x3b,0xaa,0xf7,0x40,0x60,0xc9,0x15,0x7e}, 126122, 578, 1572864, 1},
+    {{0xe9,0x31,0xc3,0xc0,0x8f,0x20,0xf7,0x8e,0x3a,0x43,0xad,0x92,0xd1,0x6e,0xb4,0x72,0xbe,0x61,0x9a,0xba,0xa1,0x7c,0x2d,0x8e,0x2b,0x0f,0xcd,0x5d,0x05,0xdb,0xd7,0x4d}, 126700, 561, 1048576, 1},
+    {{0xba,0x93,0x72,0x1b,0xdb,0x0f,0x19,0x50,0x6e,0x72,0x2b,0xc5,0x80,0xd0,0xb4,0xda,0xd6,0xe8,0x64,0x8d,0xdd,0xbc,0x52,0xe3,0xce,0x45,0xdd,0x75,0xea,0x16,0x5f,0x72}, 127261, 617, 3145728, 1},
+    {{0xb5,0x49,0x2a,0xea,0x29,0x6e,0xe4,0xbf,0xcd,0x2c,0x67,0x7f,0xbe,0xc5,0x15,0x3f,0xd4,0xc4,0xdb,0x75,0x8c,0x83,0x5b,0x37,0x2e,0xf7,0x50,0xcf,0x23,0x99,0x64,0x9b}, 127878, 568, 1572864, 1},
+    {},
+    {},
+    {{0xc3,0xbc,0xd5,0xc7,0x16,0xf9,0x6e,0x63,0x59,0xeb,0xcf,0xd8,0x5c,0x3e,0x9b,0x07,0xb4,0x6c,0x51,0x24,0xbf,0x40,0x10,0xd8,0x9c,0xee,0xf5,0xb6,0xf2,0xf8,0x68,0xf6}, 128446, 533, 524288, 1},
+    {},
+    {{0x33,0xdd,0xa5,0x83,0x82,0x64,0xc9,0x33,0x41,0xef,0x86,0x55,0x12,0xe4,0xb8,0x6e,0x16,0xfd,0x4a,0x03,0x87,0xed,0xa0,0x4e,0x33,0x15,0x17,0xbf,0xae,0xcf,0x1c,0x0b}, 128979, 528, 1572864, 1},
+    {{0x8b,0x75,0xab,0x4b,0xb1,0xb6,0x3c,0x45,0xa5,0x6e,0x7a,0x4c,0x5a,0x37,0xc0,0x86,0x4f,0x14,0x37,0x5a,0xb3,0x13,0x1e,0xdc,0x33,0x48,0x97,0x64,0x42,0x6a,0xd8,0x88}, 129507, 526, 524288, 1},
+    {{0x9e,0x1a,0x39,0xaa,0xf3,0x58,0x5a,0xf0,0xd6,0xa5,0xd7,0x9d,0xe3,0xc3,0x5f,0xcf,0xe0,0x30,0xc3,0x4b,0xd4,0xb0,0x96,0x06,0xa6,0xfb,0x8c,0x7d,0xef,0x19,0x34,0x0b}, 130033, 729, 1310720, 1},
+    {{0x43,0x7e,0xa4,0x87,0x11,0xd5,0x4c,0x22,0x75,0x28,0x61,0x70,0xa1,0x79,0x48,0xcb,0x57,0xba,0x9d,0x96,0x1b,0xa4,0x75,0x71,0x5c,0x0d,0xba,0x5f,0xbd,0x61,0xa2,0xdb}, 130762, 629, 524288, 1},
+    {},
+    {},
+    {},
+    {{0x74,0x91,0x0c,0xe0,0x1d,0x19,0xd2,0x5c,0xb9,0x7a,0x24,0x3a,0x51,0xf2,0x1c,0x3d,0x52,0x2f,0x02,0xfb,0x11,0x66,0x82,0xf6,0x04,0x40,0xda,0x32,0x92,0xbb,0x14,0xf7}, 131391, 566, 1048576, 1},
+    {{0x14,0xd3,0xec,0xe3,0x08,0x98,0x58,0x7e,0xda,0x20,0xc6,0x61,0xa4,0xa5,0x5e,0xc5,0x95,0xba,0x63,0x52,0xca,0x1f,0x0b,0xfc,0x17,0x75,0x42,0xaa,0x0e,0xef,0x00,0x39}, 131957, 543, 524288, 1},
+    {},
+    {},
+    {{0xe8,0x42,0xca,0xc1,0xa4,0x30,0x1b,0xe1,0x96,0xf1,0xe1,0x37,0xfb,0xd1,0xa1,0x68,0x66,0xd5,0xc9,0x13,0xf2,0x4d,0xbc,0xa3,0x13,0xf4,0xdd,0x8b,0xd7,0x47,0x2f,0x45}, 132500, 574, 1048576, 1},
+    {{0xa9,0x3e,0xa8,0x7f,0xc8,0x35,0xc5,0x30,0xb5,0x13,0x5c,0x52,0x94,0x43,0x3d,0x15,0xee,0xf6,0xdb,0xf6,0x56,0x14,0x4b,0x38,0x7e,0x89,0xac,0x19,0xcf,0x86,0x49,0x96}, 133074, 551, 1048576, 1},
+    {},
+    {{0x2e,0x82,0x03,0xe4,0x21,0xf9,0x7c,0xf1,0x65,0xf0,0x3a,0x5d,0x4f,0x69,0xda,0xdf,0x0b,0xcc,0xa1,0x8c,0x42,0xc6,0xa1,0xdf,0xe7,0x9c,0x87,0x05,0xc5,0x22,0xcc,0x54}, 133625, 562, 1048576, 1},
+    {},
+    {},
+    {{0x80,0x49,0x17,0x57,0x67,0xed,0xdb,0xc3,0xe2,0x1c,0xa5,0xb9,0x4e,0xe2,0x3f,0xc2,0x25,0xf8,0x34,0xcc,0xfa,0xb4,0xde,0xd3,0x0d,0x2e,0x98,0x1b,0x0e,0xf7,0x3a,0xb6}, 134187, 544, 1048576, 1},
+    {},
+    {{0xf0,0x91,0x33,0x58,0xcb,0x08,0x70,0xc3,0xdc,0xc7,0xf0,0xc0,0xd2,0xd6,0x97,0x04,0x87,0x4c,0x31,0xa1,0x13,0x15,0x0e,0xda,0x66,0x8c,0x95,0x02,0x4c,0x0d,0x6f,0xd9}, 134731, 532, 1048576, 1},
+    {{0x15,0x9d,0x53,0x41,0xd1,0x3d,0x68,0x01,0x32,0x4e,0x82,0x71,0xf7,0x19,0x1c,0x02,0x23,0x61,0x7c,0x9d,0x30,0x98,0x46,0x76,0x31,0x9b,0x2d,0xf7,0x93,0x7c,0x78,0xc0}, 135263, 517, 3145728, 1},
+    {{0x99,0x45,0x0b,0x45,0xcc,0xc7,0x0a,0x1e,0xd3,0x87,0xf9,0x68,0xc8,0xf8,0x63,0xa3,0xc7,0xf6,0xa4,0xb8,0x68,0x09,0xe8,0x41,0xc2,0x5a,0x71,0xe1,0xe9,0x04,0xac,0x61}, 135780, 533, 2097152, 1},
+    {{0xe0,0x16,0x5b,0xaf,0xeb,0x8d,0x65,0xbe,0x08,0xa5,0xa4,0x07,0x9f,0x86,0x51,0x10,0x44,0x71,0xf4,0x50,0xc6,0x07,0x94,0xb7,0x61,0xb1,0x25,0x58,0x53,0xca,0x2d,0x98}, 136313, 518, 1048576, 1},
+    {},
+    {},
+    {{0xfd,0x57,0x61,0xf9,0xdd,0x1f,0x2b,0x87,0xad,0x11,0xdf,0x60,0x85,0x04,0x6d,0x0d,0xfc,0xdc,0x3a,0x79,0x13,0x92,0x63,0xe4,0x7b,0x0c,0xff,0x70,0x79,0x66,0xba,0x51}, 136831, 543, 1572864, 1},
+    {{0x85,0x4d,0x24,0x92,0xd1,0xcb,0x05,0x97,0x49,0xbb,0x09,0x04,0xca,0x5f,0x92,0xa5,0xee,0xec,0x09,0x16,0x7a,0xbf,0x84,0xf7,0xcc,0xa4,0x02,0x3b,0x18,0x19,0xe4,0xf0}, 137374, 514, 1048576, 1},
+    {{0xf2,0x92,0x59,0x8a,0xc4,0x62,0xfd,0xfc,0xd3,0x2a,0xd9,0xb6,0xb3,0x5a,0xc0,0x1d,0x4b,0xab,0x02,0x03,0x91,0xdf,0xf9,0x2b,0xfe,0x94,0x78,0x0e,0xc6,0x04,0x28,0x9a}, 137888, 583, 1048576, 1},
+    {},
+    {{0xc7,0xf0,0x26,0x94,0x98,0xd1,0x90,0xe4,0xfd,0x0f,0x6f,0x88,0x0a,0x14,0x8f,0xbe,0x37,0x13,0xcd,0x3a,0x63,0x20,0x83,0xba,0xc1,0xe5,0xbd,0x18,0xf8,0x17,0x23,0x71}, 138471, 554, 1048576, 1},
+    {{0x60,0x6a,0xbf,0x53,0x64,0x40,0x17,0x3a,0xe3,0x64,0x66,0xdb,0x36,0x0c,0x7d,0xb6,0xb4,0x74,0xbe,0xb7,0xa1,0x05,0xc8,0xa6,0x2b,0xc7,0x4a,0x54,0xcb,0xe1,0xc3,0x8b}, 139025, 565, 1048576, 1},
+    {{0x22,0x45,0x31,0x82,0xd4,0x43,0x80,0xf0,0x80,0x04,0xa1,0x2c,0x64,0x92,0xa0,0xc4,0xb2,0xe1,0xf5,0x84,0xe2,0x68,0xdc,0xc3,0x29,0x6a,0x03,0xea,0x03,0xae,0x09,0x09}, 139590, 551, 1048576, 1},
+    {{0xbc,0x6b,0x03,0x44,0xa4,0x34,0x64,0x4c,0x39,0x1a,0xc6,0x9a,0x53,0xc7,0x72,0x0c,0x51,0xe2,0xd3,0xc5,0xc0,0x82,0xb8,0xd7,0x85,0x98,0xae,0x4d,0xf1,0x00,0xc4,0x64}, 140141, 532, 3145728, 1},
+    {{0x12,0xab,0xf1,0xba,0x06,0x3c,0x12,0x0c,0x1a,0x98,0x49,0x5a,0x1c,0x85,0xe6,0x7a,0x00,0x07,0xaf,0xf7,0x71,0xef,0x92,0xad,0xcb,0x94,0xb4,0xa0,0xa2,0xfd,0x5a,0xdb}, 140673, 528, 524288, 1},
+    {{0x06,0xd1,0xc2,0xb0,0x6b,0x71,0x60,0x52,0xc5,0x59,0x6a,0xaa,0x0c,0x2e,0x56,0x32,0xa0,0x27,0xfe,0xe1,0xa9,0xa2,0x84,0x39,0xe5,0x09,0xf8,0x13,0xc3,0x08,0x29,0xa9}, 141201, 627, 4194304, 1},
+    {{0x7a,0x6e,0x5d,0xa4,0x6b,0x02,0x69,0x00,0xfb,0xa4,0x58,0x4a,0x32,0xad,0x40,0xd9,0x40,0xb9,0xec,0xf9,0xfc,0xcf,0xb1,0x1f,0x96,0xa2,0x05,0xa9,0x14,0x01,0x47,0x84}, 141828, 557, 1048576, 1},
+    {},
+    {{0xc8,0x65,0xfb,0x17,0xe8,0xc5,0x9a,0x21,0xd3,0x2b,0x9a,0x60,0x53,0x19,0x24,0x1f,0xa7,0x4e,0xc7,0x32,0xe3,0xf0,0xee,0x58,0xf5,0xd7,0xfc,0xbd,0x8e,0xe5,0x7c,0x6b}, 142385, 563, 1048576, 1},
+    {{0x87,0x15,0xa6,0x41,0xf2,0xe4,0xdd,0x8b,0x60,0x66,0xbe,0x7f,0x26,0x83,0xd9,0x12,0x9f,0xff,0x3f,0xcc,0xca,0xf0,0xa0,0x9c,0xc8,0xbd,0xd2,0xaa,0x56,0x46,0x07,0x64}, 142948, 548, 2097152, 1},
+    {},
+    {{0xfe,0xff,0x03,0xcf,0xa1,0x95,0x51,0x2a,0xd8,0x7d,0xc8,0x76,0x01,0x2d,0x70,0x52,0x0c,0xf1,0x92,0xe2,0x87,0x4c,0x51,0x8b,0x6d,0xbd,0xf3,0xd8,0x76,0xea,0x60,0xc4}, 143496, 560, 1048576, 1},
+    {},
+    {},
+    {{0x03,0xf6,0xc6,0x9a,0xef,0x92,0xd3,0x6b,0x5e,0xa2,0x5a,0x60,0x23,0x36,0x8d,0xa0,0xe1,0xda,0x9f,0xa1,0x60,0xe8,0x31,0x6e,0xbd,0x53,0x3d,0x4f,0x35,0x8f,0xfa,0xcf}, 144056, 504, 524288, 1},
+    {{0x5a,0x6d,0xeb,0x56,0x17,0xe8,0x6a,0x9f,0x4b,0x98,0x10,0x31,0xe9,0x39,0x51,0x0e,0x30,0xc5,0xc8,0xad,0x04,0x7f,0x5f,0x01,0x2e,0x40,0x44,0x21,0x13,0xfd,0x28,0xc2}, 144560, 484, 2097152, 1},
+    {{0x3c,0x6d,0x3e,0x4a,0x9c,0x9a,0xf1,0x60,0xf1,0xc1,0xcf,0x11,0xce,0x4e,0xad,0x53,0x1d,0x95,0x00,0xc1,0xf5,0x8f,0x1c,0xbe,0x68,0x2c,0x90,0xa5,0xea,0xa3,0xef,0xb2}, 145044, 521, 2097152, 1},
+    {},
+    {{0x6c,0xbc,0x4d,0xb8,0x5c,0xb8,0x42,0x00,0x20,0xf9,0xed,0xbf,0xd2,0x90,0xc0,0xf4,0x35,0xb3,0x13,0xa5,0x95,0x77,0xac,0xa6,0x53,0x14,0xd3,0x1f,0x8b,0x81,0x66,0x20}, 145565, 576, 1048576, 1},
+    {{0x6e,0x43,0x60,0x20,0xd9,0x67,0xd3,0x5a,0x0f,0x7c,0xe4,0x3e,0x38,0xe8,0x3a,0x61,0x6b,0x70,0x69,0x6a,0xe7,0xd3,0x5b,0x37,0xcd,0x56,0x60,0x1c,0xfb,0x38,0x22,0xba}, 146141, 532, 1048576, 1},
+    {},
+    {{0x96,0x70,0xc6,0x7e,0xee,0xb5,0x58,0x1f,0xa5,0x34,0x50,0x25,0xa2,0xe2,0xee,0x87,0x51,0x79,0xe0,0xda,0x9f,0x5b,0xe4,0xbf,0x78,0x64,0x1e,0x47,0x7d,0x78,0x5f,0x17}, 146673, 689, 3145728, 1},
+    {{0xbc,0xce,0xd1,0xbe,0x76,0xef,0x92,0x0b,0x56,0x2a,0x55,0x56,0x96,0xbc,0xb4,0x58,0x3d,0x1c,0x8c,0xea,0x4d,0x4b,0x05,0x7c,0xab,0x6e,0x0e,0x09,0xbe,0x8e,0xf8,0xc4}, 147362, 536, 1048576, 1},
+    {{0x96,0xda,0x35,0x12,0xa1,0xaa,0x05,0xa4,0x0f,0x1e,0x5d,0x61,0xc4,0x89,0x32,0xb0,0xd5,0x5d,0x9f,0x13,0x6d,0x64,0x18,0xb8,0x48,0x15,0x3a,0x9f,0xec,0xab,0x06,0xde}, 147898, 534, 2097152, 1},
+    {{0x58,0x25,0x48,0xdc,0x86,0x59,0x8a,0x35,0x57,0xe9,0xe3,0xc2,0x72,0x85,0xc8,0x19,0x64,0xb0,0x06,0xa9,0x54,0xaf,0xfe,0x5c,0x73,0x94,0x8d,0xa5,0x37,0x5e,0xa1,0x1c}, 148432, 532, 1048576, 1},
+    {},
+    {{0x81,0x13,0xc2,0xce,0xda,0xfc,0x8f,0xd5,0xa5,0x6c,0x86,0x38,0xae,0x34,0x0f,0xb2,0x75,0xf2,0x63,0xff,0x5c,0x5e,0x18,0xd0,0x4d,0xc6,0xc3,0xeb,0xc5,0xcf,0xff,0xee}, 148964, 608, 2097152, 1},
+    {{0x25,0xb3,0x80,0xf5,0x29,0xf5,0xa9,0x29,0x5d,0xf7,0xc0,0xad,0xcc,0x52,0x13,0xd6,0x7f,0x13,0x1f,0x55,0x2d,0x07,0x8a,0x3d,0x8f,0x54,0x5f,0x98,0x80,0x47,0xc9,0x0a}, 149572, 526, 2097152, 1},
+    {{0xe6,0x79,0x40,0xa2,0x10,0x6c,0x15,0x07,0xf3,0xa8,0xd3,0x87,0x90,0xf2,0x63,0xbb,0xbf,0x81,0x45,0x78,0xeb,0xf3,0xdb,0xc4,0xe3,0xeb,0x60,0x07,0xd3,0x10,0x79,0x3c}, 150098, 550, 1048576, 1},
+    {{0x6b,0xf0,0xe7,0xa7,0xb9,0x56,0x13,0xb9,0xd0,0xe5,0xc8,0xcc,0x98,0xee,0xe5,0xd0,0xac,0x20,0x0e,0x88,0xb5,0xd4,0x44,0x4a,0xd5,0xcf,0x93,0xd3,0xe8,0x26,0x51,0x18}, 150648, 559, 1048576, 1},
+    {{0xfb,0x60,0x1e,0xad,0x64,0x5e,0xdc,0xe1,0x39,0xb0,0x48,0x3d,0x31,0x55,0xb4,0xe3,0xd7,0xab,0x24,0x5b,0xf8,0x7a,0x3a,0x66,0xcb,0x88,0xc0,0xa6,0x17,0xc0,0xa5,0x26}, 151207, 535, 1572864, 1},
+    {},
+    {{0x71,0xe7,0x08,0x3c,0xfc,0xf3,0x2b,0x73,0x8f,0x60,0xf5,0xee,0xff,0xd4,0xf9,0xd1,0xfd,0x92,0x50,0xaf,0xbd,0xe0,0xc5,0x6e,0x22,0xa4,0xb9,0x7a,0xba,0xc3,0x77,0xa1}, 151742, 562, 524288, 1},
+    {{0xc7,0x0b,0x81,0x2a,0x9d,0x2d,0xf7,0xf9,0x5b,0x27,0x9e,0x40,0x50,0xe0,0x3a,0x4b,0x8a,0x68,0x58,0x8a,0x37,0x08,0x16,0xe6,0x45,0xf3,0x78,0x29,0x6b,0x84,0xe5,0xd1}, 152304, 542, 1048576, 1},
+    {{0x7c,0x34,0x90,0x85,0x26,0xdb,0x2a,0x63,0x42,0x16,0xfa,0xb0,0x27,0x6c,0x42,0xa8,0xe4,0xe2,0x2d,0x59,0xc7,0x28,0xcd,0x58,0x62,0x00,0x14,0x2a,0x12,0xdd,0x2c,0x2c}, 152846, 516, 524288, 1},
+    {},
+    {{0xaf,0x2f,0xe0,0x62,0x7d,0xe2,0xbb,0x26,0x72,0xf4,0xf6,0x5d,0xcb,0xda,0xae,0xe2,0x2b,0x21,0x12,0x75,0xf6,0x79,0xf1,0x23,0xd5,0xfa,0x5d,0x37,0xfd,0x69,0x93,0x63}, 153362, 623, 3145728, 1},
+    {{0xc4,0xae,0x27,0x97,0xfa,0xc2,0x58,0x6b,0x86,0x40,0x06,0x4b,0xe6,0x39,0x8f,0x2b,0x4f,0x2b,0x31,0x58,0xa0,0x7f,0x26,0xc6,0x69,0x12,0xb2,0x9f,0x7f,0xd1,0x97,0xde}, 153985, 516, 524288, 1},
+    {},
+    {{0xda,0xf3,0xe4,0x5b,0xaf,0xbe,0xc8,0x1f,0xfa,0x59,0x11,0xb9,0x48,0x10,0xb2,0xcd,0x26,0x75,0x74,0xde,0x71,0x72,0x92,0x36,0x0f,0x99,0x40,0xf4,0x1f,0xb2,0xa6,0xa9}, 154501, 526, 3145728, 1},
+    {},
+    {{0xee,0x00,0xc5,0x7d,0xdf,0xa9,0xb9,0x67,0xd1,0x85,0x7a,0xcb,0x51,0x8d,0xf0,0x39,0xba,0x73,0x05,0x5b,0xde,0xbe,0x78,0xdb,0x01,0x4d,0xe0,0xf5,0xda,0x26,0x2f,0xd9}, 155027, 548, 2097152, 1},
+    {{0x54,0x04,0x6e,0xc1,0xfc,0x57,0xf6,0x16,0x5a,0xd3,0x30,0x80,0x50,0x2f,0x72,0x80,0x9d,0x1b,0x06,0xb4,0x38,0xa5,0xa0,0xd0,0xa8,0x0f,0xfa,0x2b,0xb3,0xdf,0x8b,0x0b}, 155575, 584, 2097152, 1},
+    {},
+    {},
+    {{0x67,0x93,0x7d,0xd7,0xa2,0x9a,0x93,0xb1,0xaa,0xab,0xb6,0xdf,0x89,0xf0,0x74,0x83,0x69,0xff,0x47,0xf3,0xf6,0xc6,0x55,0xa4,0x02,0xc0,0x0d,0x56,0x57,0x97,0x31,0x40}, 156159, 532, 1048576, 1},
+    {{0xf0,0x99,0x93,0x7a,0xc4,0xc8,0xaf,0xb3,0x8c,0x51,0x7c,0x5d,0x85,0x47,0x52,0x24,0x98,0x5f,0xb8,0xf3,0x45,0xda,0xcb,0x44,0x99,0x4a,0x61,0x7e,0xa0,0x5b,0xf4,0xe5}, 156691, 518, 2097152, 1},
+    {{0x7e,0x77,0xe1,0x96,0xdb,0x47,0xe8,0x7a,0x5b,0x29,0x7e,0x60,0xf0,0xdf,0xa7,0xce,0x41,0xdf,0x8d,0x2d,0x1f,0xdd,0x91,0x52,0xe0,0x66,0x28,0xd0,0xb0,0xe5,0x86,0xaf}, 157209, 496, 1048576, 1},
+    {{0xb7,0x37,0xde,0x81,0x31,0x5e,0xef,0x8d,0xed,0x7c,0xfd,0x5d,0xf6,0xb3,0x7a,0xba,0x01,0xd9,0xe6,0xe1,0x45,0x66,0x48,0x6d,0xb7,0xec,0x83,0xeb,0x0c,0x1a,0xa8,0x5e}, 157705, 523, 1310720, 1},
+    {},
+    {{0x41,0x58,0xe3,0xe8,0x89,0x0a,0x52,0xf0,0xb1,0x2d,0xc9,0xad,0x5a,0x29,0x27,0x60,0x58,0xa2,0x47,0xff,0x41,0xe9,0xf1,0xd2,0x28,0x97,0xeb,0xde,0x1e,0xb1,0x12,0x69}, 158228, 504, 1048576, 1},
+    {{0xa9,0xe3,0xe5,0x7d,0x59,0x1e,0x99,0x5e,0x8e,0x0d,0xd2,0x28,0xb6,0x19,0xb6,0xae,0xd4,0x22,0x05,0xea,0xf5,0x53,0x16,0xfa,0x8f,0xf3,0x3f,0x23,0x6b,0x3a,0x32,0xb3}, 158732, 586, 2097152, 1},
+    {{0x71,0xb6,0x94,0x90,0xc7,0x8d,0x0b,0xba,0xf4,0x7d,0xa2,0x52,0x17,0xc5,0xda,0xe2,0x95,0x19,0x03,0x11,0xaa,0x5d,0xf7,0x56,0x53,0xc3,0xfa,0xc0,0xa1,0xb4,0x53,0x58}, 159318, 564, 1048576, 1},
+    {},
+    {{0x27,0x1a,0x67,0xb3,0x2b,0x3b,0xb0,0x0c,0xeb,0x0f,0x4e,0x7d,0x81,0x49,0x48,0x88,0xd0,0xd8,0x21,0x63,0x5f,0x0f,0x93,0x6d,0x48,0x1d,0xfb,0xe6,0x71,0x56,0x7c,0x08}, 159882, 528, 1572864, 1},
+    {},
+    {{0xbc,0xba,0x4c,0xa3,0x9f,0x02,0x79,0xf7,0xa5,0x26,0x57,0xbc,0xcb,0xff,0xa8,0x45,0x64,0xea,0xea,0x45,0x5e,0x25,0x65,0x59,0x7b,0x93,0x94,0x2e,0xc2,0x45,0xfd,0xb1}, 160410, 610, 524288, 1},
+    {},
+    {},
+    {{0xce,0xd8,0xc0,0xbc,0x27,0x91,0xff,0xe4,0x7c,0xb9,0xee,0xc0,0x3d,0xb6,0x75,0x67,0x94,0x5a,0xf8,0xc5,0x8b,0x53,0x30,0x32,0x67,0x22,0xf1,0xcf,0xca,0x41,0xbf,0x51}, 161020, 720, 1572864, 1},
+    {{0x88,0x9b,0xeb,0x58,0xd2,0xa4,0x8a,0x05,0xa6,0x23,0x0c,0xab,0xda,0x14,0x55,0x5c,0xb0,0x30,0xe2,0xe9,0x86,0xc0,0x29,0x3b,0xdf,0x39,0x6e,0x85,0xaf,0x5c,0x67,0x98}, 161740, 557, 1048576, 1},
+    {{0x8c,0x47,0xf9,0xdc,0x79,0x74,0x8c,0x0a,0xe6,0xc6,0x48,0xf8,0x48,0x06,0x14,0xd2,0x2e,0xae,0xfa,0xde,0x06,0x56,0x12,0xad,0x1f,0xe7,0x49,0xfc,0x3d,0xb4,0xd1,0xbc}, 162297, 528, 1048576, 1},
+    {{0x62,0x55,0x7e,0xe2,0xa3,0xfc,0x3b,0x5a,0x3f,0x59,0x43,0x1f,0x96,0x6e,0xb6,0x1b,0xb3,0x80,0xba,0x98,0x3e,0xf6,0xc7,0x74,0x2c,0xb5,0x5c,0xf0,0x75,0xf1,0x5f,0x6c}, 162825, 562, 1048576, 1},
+    {},
+    {},
+    {},
+    {},
+    {{0x48,0xcd,0x94,0x76,0xfe,0xf1,0xed,0x68,0x5b,0x9c,0x30,0xdd,0x16,0x69,0xb4,0x60,0x48,0xf7,0x29,0x5c,0xbb,0xb2,0xab,0xcf,0xa5,0xb1,0xa4,0x86,0x99,0x34,0x6e,0xa3}, 163387, 556, 524288, 1},
+    {{0x8b,0x7b,0x33,0xf3,0xd2,0xed,0xb8,0x44,0xf1,0xd4,0x3c,0xfd,0xd5,0x95,0xb8,0xc2,0xcb,0x6f,0xc0,0x05,0xd5,0x9a,0xcb,0x89,0x9a,0x1a,0xfd,0xa9,0x99,0xe4,0x76,0x38}, 163943, 510, 2097152, 1},
+    {{0x0a,0x4e,0x9d,0x6f,0xa2,0xac,0x16,0xaa,0x51,0xda,0x55,0x38,0xd9,0x32,0x80,0x73,0x4d,0xe4,0x80,0xe4,0x4c,0x43,0x01,0x73,0xed,0x14,0x82,0x6c,0x84,0x55,0x3c,0x7d}, 164453, 526, 2097152, 1},
+    {{0xcb,0x2f,0xdf,0xce,0x61,0x85,0x80,0x63,0xbf,0x4c,0x9d,0xa4,0x22,0x83,0x81,0xc3,0xec,0x3a,0xbe,0x42,0x3f,0x4d,0x37,0x8c,0xdd,0xd1,0x74,0xae,0x4a,0xdb,0x26,0x1e}, 164979, 518, 4194304, 1},
+    {{0x5d,0x65,0x8b,0x63,0xd3,0x5e,0x2e,0x0b,0xaf,0x48,0xae,0x3b,0xb0,0x4e,0xa5,0xe1,0x55,0x38,0x55,0xb3,0x4b,0xb3,0x9f,0xc2,0xc7,0xca,0x41,0xfb,0xd3,0x89,0x4d,0x52}, 165497, 522, 1048576, 1},
+    {{0x8e,0x82,0xf9,0x8d,0x2e,0x62,0xbc,0x1e,0x5f,0xcf,0x23,0x86,0xc2,0xb5,0xca,0x54,0x99,0x83,0x98,0x22,0x0e,0xfc,0xed,0xd6,0x78,0x58,0xaa,0xaa,0x92,0x28,0x9a,0x42}, 166019, 516, 1048576, 1},
+    {},
+    {{0x67,0x56,0xf9,0x2f,0xe8,0xe0,0x66,0xbe,0x4b,0x20,0x4c,0xfd,0xc9,0x4c,0x16,0x15,0xba,0x6e,0xce,0x7e,0x78,0xfb,0x5d,0x2c,0x77,0xc8,0x1a,0x9d,0x29,0x8a,0xa7,0x44}, 166535, 501, 3145728, 1},
+    {{0x4f,0x43,0xce,0x12,0xe1,0xd8,0xcd,0x19,0x54,0x68,0xd7,0x04,0x84,0x94,0xad,0x29,0x30,0x72,0x1e,0x5b,0xf9,0xe6,0x9b,0xfd,0x86,0xee,0xee,0x70,0x7f,0xfc,0x63,0x4b}, 167036, 518, 524288, 1},
+    {},
+    {{0xb2,0x7e,0x2e,0x95,0x7f,0xa7,0x60,0xf4,0xf4,0x83,0xe2,0xaf,0x30,0xe0,0x30,0x62,0x03,0x4a,0x6c,0x00,0x66,0x98,0x4f,0x2e,0x28,0x4c,0xc2,0xcb,0x43,0x0b,0x20,0x59}, 167554, 534, 1048576, 1},
+    {{0x6f,0x32,0x35,0x5b,0xef,0x68,0xd4,0xad,0x58,0x82,0x2f,0x50,0x07,0x4b,0x46,0xbc,0xc9,0xa6,0x83,0x57,0xcd,0x2c,0x6a,0x54,0x70,0xc9,0x6b,0xf5,0x34,0x4f,0x84,0xd8}, 168088, 520, 1048576, 1},
+    {{0x0b,0x9a,0xbf,0x2f,0xc2,0x5a,0x5f,0x07,0xc7,0x1f,0x9d,0x8e,0xfb,0xb0,0xd0,0xe6,0x16,0xc1,0x49,0x40,0x60,0x13,0x8f,0xbb,0x63,0xf7,0x39,0x8e,0x9c,0x26,0x19,0x8e}, 168608, 544, 1048576, 1},
+    {{0x7c,0xec,0x4f,0xfc,0x3e,0xda,0x04,0x41,0x56,0x17,0x17,0xcf,0x55,0x92,0x79,0x01,0xb5,0xfb,0xbd,0x66,0x9c,0x25,0x40,0x79,0xf7,0x8c,0xa7,0x4c,0x67,0xc4,0xa1,0x7b}, 169152, 516, 524288, 1},
+    {{0xce,0x16,0x48,0x72,0xc4,0xf5,0x81,0x4b,0xce,0x04,0xcf,0x05,0x65,0xed,0xcd,0xb5,0xb7,0x96,0x9a,0xe9,0x5a,0x3b,0x5c,0xd5,0x15,0xcf,0xb6,0x26,0xb5,0xcd,0xe7,0xb3}, 169668, 546, 2097152, 1},
+    {},
+    {{0xd4,0x2f,0x8c,0x79,0x69,0xb4,0xc4,0x34,0xf9,0xca,0x04,0xce,0x00,0x80,0xd8,0x97,0x87,0x7a,0x5e,0x71,0xc2,0x92,0x6d,0x30,0x9e,0xf5,0xda,0xe9,0x3b,0xa2,0x55,0x48}, 170214, 536, 524288, 1},
+    {},
+    {{0x78,0xbf,0x82,0x96,0x3c,0xde,0xd9,0x16,0x2e,0x25,0x03,0x50,0x53,0xc8,0xb1,0xa9,0xf7,0x60,0x74,0x8f,0xf0,0xbe,0xac,0xc2,0x30,0xd0,0x05,0x20,0x49,0x92,0x73,0x7d}, 170750, 527, 1572864, 1},
+    {},
+    {{0xbe,0x42,0x07,0x15,0x15,0x23,0x94,0xe0,0xe4,0xa2,0x5a,0xb1,0x09,0x31,0xb6,0x7f,0x92,0xf9,0x10,0xcf,0xcf,0x77,0x93,0xe3,0x1d,0xfe,0xe1,0xc6,0x33,0x48,0x08,0xe5}, 171277, 579, 1048576, 1},
+    {{0xa8,0x29,0x4d,0x44,0x9b,0xbb,0x83,0x70,0x81,0x6e,0xfe,0x03,0x74,0x70,0x4e,0x8a,0xf2,0x0d,0xbb,0xde,0x9c,0x19,0xaf,0xe9,0x69,0xd8,0x98,0x52,0x8b,0xc2,0x93,0xd0}, 171856, 546, 524288, 1},
+    {{0x44,0x7d,0xfa,0x71,0x0e,0x69,0x47,0x91,0x59,0xe9,0xd4,0x07,0x47,0x4f,0xbf,0x5f,0x67,0xd3,0xa3,0x33,0x0a,0xb0,0xc7,0x62,0x7a,0xfd,0x12,0x3d,0xed,0x3f,0xdb,0x3a}, 172402, 549, 1048576, 1},
+    {},
+    {{0x00,0x3d,0xba,0x01,0x93,0xac,0xc5,0x33,0x68,0x40,0x30,0x71,0x94,0x64,0x3c,0xa3,0xb1,0xf8,0x48,0xdc,0xfc,0x77,0x58,0x0b,0x4e,0x17,0xc6,0x05,0x10,0x5b,0x27,0xf5}, 172951, 526, 1048576, 1},
+    {},
+    {{0x36,0x5f,0x10,0xf9,0xd9,0xf6,0x8c,0xc5,0x9e,0x76,0x9e,0xeb,0x45,0x1c,0x41,0x7e,0x1f,0xf7,0x41,0x50,0x22,0xa6,0x25,0xde,0x99,0x76,0xa3,0xb9,0x24,0xc0,0xbd,0x61}, 173477, 559, 1048576, 1},
+    {{0x34,0xe1,0xaf,0x06,0x42,0xc8,0x51,0x48,0xc5,0xa3,0xdc,0x3c,0x7a,0xb4,0xbc,0xbd,0xa1,0x3a,0x9f,0xea,0x19,0x09,0x34,0xb5,0x52,0x6c,0x55,0x5f,0xff,0x03,0x56,0x51}, 174036, 519, 4194304, 1},
+    {{0xfa,0x41,0x86,0x18,0x78,0x71,0x45,0x29,0x12,0x01,0xb3,0xd9,0x24,0x70,0x48,0xb2,0xd7,0xdf,0xba,0x37,0xf6,0x55,0x6d,0xcb,0x1d,0x40,0xdb,0x49,0x91,0x24,0xdd,0x60}, 174555, 518, 524288, 1},
+    {{0xc0,0x1f,0xb8,0x98,0x9d,0x39,0x1d,0x3e,0x34,0x30,0x03,0x93,0x49,0x37,0xf0,0x2b,0xd8,0xef,0x9a,0xac,0xda,0xd6,0x8c,0x32,0xc3,0xd3,0xf5,0x6f,0xeb,0x72,0xf5,0xb0}, 175073, 516, 524288, 1},
+    {},
+    {},
+    {{0x16,0x59,0x38,0x81,0x09,0x48,0xf3,0x22,0x6f,0x74,0x46,0x97,0x8f,0xa3,0x6a,0xe8,0xbc,0x78,0x16,0x16,0xd9,0x5b,0x39,0xcd,0x12,0x6d,0x5c,0x8a,0xfb,0xf6,0xe2,0xee}, 175589, 528, 1048576, 1},
+    {},
+    {{0x24,0xb6,0x87,0xf9,0x5b,0xb9,0x73,0x7d,0x22,0x37,0x38,0xf1,0x3c,0x00,0xae,0xaa,0x7d,0x69,0x7f,0xa9,0xe2,0xfd,0x50,0x59,0x7b,0x81,0xd0,0xcf,0xa2,0x16,0x0d,0xaa}, 176117, 524, 524288, 1},
+    {},
+    {{0x7d,0xa4,0xa3,0xcf,0xa5,0xde,0x4b,0xb4,0x72,0x2a,0x6e,0x2a,0x42,0xc2,0x6a,0xae,0x32,0x2b,0x5e,0x66,0x8f,0x16,0x45,0xd8,0xc8,0x70,0xfb,0x99,0xe6,0x08,0x06,0x00}, 176641, 602, 1572864, 1},
+    {{0x1d,0x1b,0x25,0x7d,0xcf,0x85,0x9c,0xc4,0x12,0xd3,0xa9,0x52,0x1f,0xc5,0x8d,0xc8,0x76,0xa5,0x91,0x7e,0x6a,0x69,0xcd,0x1d,0x96,0x0a,0x8e,0x98,0x40,0x45,0x4b,0xb4}, 177243, 584, 2097152, 1},
+    {{0x27,0x31,0xf0,0xbd,0x1c,0x87,0xe7,0x51,0x21,0xf4,0x1d,0x1e,0xd5,0xcc,0x9f,0xbf,0x17,0x7f,0x41,0x4b,0x8b,0xf8,0x31,0xc7,0x6f,0xd9,0xc4,0xb5,0x8c,0x86,0xed,0x08}, 177827, 554, 2097152, 1},
+    {{0xb9,0x59,0x4d,0x58,0x88,0x16,0xae,0x57,0x0e,0xa5,0xfe,0xa1,0x45,0x77,0xed,0x47,0xde,0x4d,0xb9,0xac,0x9a,0x40,0xa1,0x16,0xc8,0x4e,0x0a,0xd7,0xa2,0xce,0x58,0xf8}, 178381, 499, 2621440, 1},
+    {{0x14,0xdc,0x44,0x68,0x7c,0x8d,0xa3,0x5a,0xec,0x63,0xb9,0xed,0xad,0xba,0xac,0x21,0xbf,0x72,0x93,0xf5,0x17,0x16,0x46,0xf6,0x14,0x13,0x91,0x92,0xe8,0x2a,0xb0,0x71}, 178880, 524, 524288, 1},
+    {},
+    {{0xdb,0x1a,0xc0,0x3c,0xc8,0xb7,0xda,0xaa,0x81,0x2d,0xa2,0x39,0x02,0x9b,0xcf,0x99,0x9b,0x30,0xb2,0xaf,0xe1,0xc0,0x3d,0x51,0xf7,0xae,0x84,0x9a,0x79,0x66,0x17,0xea}, 179404, 569, 2097152, 1},
+    {{0xc6,0x70,0xe1,0x6c,0x07,0x6f,0x6d,0x92,0xba,0x58,0x1b,0x78,0x76,0x9b,0x60,0x4e,0x79,0xad,0x56,0x7c,0x04,0xc6,0x47,0xda,0xc5,0x57,0xf4,0x5a,0x48,0xc3,0x44,0x8f}, 179973, 539, 1572864, 1},
+    {{0x87,0x84,0x61,0x48,0x96,0xe2,0xb3,0xe8,0xd9,0x8c,0x81,0x66,0x61,0x3c,0xa5,0xd2,0x32,0x96,0x43,0x79,0x5a,0x4d,0xc1,0x07,0x79,0x1c,0x58,0xc6,0xc5,0x1e,0x12,0x68}, 180512, 526, 524288, 1},
+    {{0x2b,0x34,0x16,0x1e,0x96,0xef,0x3f,0x0f,0x48,0xce,0xcd,0x67,0xe5,0x31,0xa9,0xbb,0x94,0x31,0x06,0x52,0xd8,0x68,0x6f,0x30,0x1b,0xac,0x42,0x6e,0x4a,0xb9,0x7e,0x77}, 181038, 571, 2097152, 1},
+    {},
+    {{0x85,0xe2,0xe5,0x8e,0x1f,0x99,0xfc,0xe3,0x66,0xc8,0x5d,0x49,0xf7,0x74,0x46,0x39,0x55,0x84,0xca,0x49,0x59,0xef,0x77,0x2a,0x70,0x7f,0xe4,0x54,0xed,0x46,0xc6,0x8f}, 181609, 528, 1048576, 1},
+    {},
+    {{0xde,0x1d,0xe8,0x5a,0xd5,0x49,0xa6,0xaa,0xf0,0x43,0x1c,0xce,0xb4,0x7c,0xbd,0x07,0xe1,0xf6,0xe8,0x1f,0x9e,0x16,0xfd,0x62,0x57,0x53,0x05,0xe2,0xc1,0xf0,0x62,0x40}, 182137, 516, 1048576, 1},
+    {{0xa8,0x80,0x6b,0xfe,0x07,0xcd,0x3c,0x99,0x45,0xd9,0xfd,0x3f,0xce,0xa9,0x32,0xae,0x1c,0xd6,0x71,0xca,0xb5,0xca,0xe1,0x2b,0xb7,0xa2,0xae,0x72,0x6c,0xbf,0x91,0x75}, 182653, 626, 2621440, 1},
+    {{0x33,0x26,0x06,0x11,0x60,0xad,0x12,0xc7,0xae,0xf5,0x17,0x65,0x44,0xec,0x1c,0x8e,0xf2,0xf5,0x34,0xa5,0x19,0x60,0xca,0x88,0x2d,0xbc,0x7f,0xcb,0x9b,0x1a,0x73,0x84}, 183279, 607, 2097152, 1},
+    {{0x8c,0xfd,0x4c,0x55,0x25,0xf4,0xbd,0x4b,0xba,0x5a,0xf7,0xe2,0x32,0x3f,0x1e,0x61,0xf2,0x7c,0xe9,0x7c,0x6d,0x56,0x17,0xcf,0xa6,0x85,0xc9,0x27,0x6f,0xbf,0x64,0x07}, 183886, 625, 2097152, 1},
+    {{0xfa,0xf5,0x95,0xb4,0x67,0x1f,0x00,0x5f,0xa9,0x36,0x7b,0xa3,0xfc,0xd3,0x0d,0xbf,0xf3,0x71,0xbc,0x7a,0x9c,0xa8,0xbb,0xfb,0xc0,0xeb,0xfc,0xc5,0x82,0x6b,0x60,0xf8}, 184511, 597, 2097152, 1},
+    {{0x08,0x88,0xd2,0x0a,0xb2,0xf8,0x34,0xc7,0x7b,0x0a,0x2d,0xc2,0x16,0x2c,0x43,0x89,0x0a,0x16,0x40,0xad,0xc7,0x8c,0x6b,0x0b,0xb5,0x89,0x2c,0xa8,0xd5,0x00,0x8a,0xd3}, 185108, 534, 1048576, 1},
+    {{0x51,0x32,0xe1,0xc0,0xd4,0x66,0x96,0x3e,0x6a,0xdc,0x09,0xe8,0xa6,0x08,0xeb,0xd9,0x06,0x19,0xab,0x94,0xf7,0xfc,0x90,0x8d,0x62,0x6b,0xba,0xf6,0xa9,0x9d,0xfa,0x19}, 185642, 512, 1048576, 1},
+    {{0x3a,0x70,0x93,0x83,0x20,0x8d,0x82,0x58,0xdc,0xeb,0x20,0xa5,0xe5,0x66,0x90,0x33,0x26,0x51,0x5b,0xa4,0x29,0x31,0xbf,0x97,0xfd,0x38,0x9a,0x41,0x5a,0x13,0xa7,0x2d}, 186154, 709, 1048576, 1},
+    {},
+    {{0x4b,0x28,0xd2,0xdd,0xab,0x40,0x59,0x76,0xbb,0x56,0xe4,0x1a,0x40,0xec,0x1e,0xa1,0x1d,0x73,0x62,0xa8,0xf3,0x98,0xd5,0xf8,0xc1,0x17,0xd7,0x15,0xa1,0x57,0x19,0xca}, 186863, 514, 1048576, 1},
+    {{0xd5,0xf0,0xfb,0xee,0xd3,0x77,0x4b,0xbc,0xcb,0xd7,0x69,0x69,0x8f,0xc4,0x05,0x14,0x87,0xa0,0xa5,0xeb,0x69,0x97,0x90,0xa8,0xa0,0x94,0x45,0x15,0x95,0x60,0x0f,0x60}, 187377, 564, 1048576, 1},
+    {},
+    {{0xfc,0xcc,0x96,0xaf,0x24,0xa2,0x46,0x3b,0x1c,0x53,0x25,0x3e,0x1c,0x5c,0x8e,0xf6,0x36,0x41,0x35,0x5f,0xae,0x53,0xc0,0xfb,0x41,0x04,0x27,0xf2,0x97,0x43,0x26,0x2b}, 187941, 542, 1572864, 1},
+    {{0xe6,0xbc,0x0a,0x59,0x5d,0x5c,0x7c,0x4b,0xc0,0xbb,0xb6,0x1f,0xfe,0x35,0xa7,0x02,0x88,0xa7,0x7e,0xb7,0x85,0x44,0xed,0x74,0x68,0x2d,0x48,0x9a,0x9e,0x6f,0x07,0xf4}, 188483, 571, 1048576, 1},
+    {{0x23,0x57,0xd3,0x44,0xaf,0x77,0xd2,0x5d,0xda,0x03,0x05,0x20,0xce,0x20,0x30,0x45,0xfd,0x90,0x60,0xf8,0x3e,0x3b,0x96,0x09,0xa2,0x28,0xdb,0xa8,0x59,0xd9,0x01,0x7b}, 189054, 486, 2097152, 1},
+    {},
+    {{0x55,0xe5,0x7c,0x5e,0x01,0x25,0x83,0xff,0x0f,0xaf,0xd1,0xae,0xe1,0x6b,0x3f,0x82,0x69,0xee,0x2b,0x34,0xfe,0x10,0xf1,0x0b,0x93,0xba,0x0d,0xde,0x72,0xf2,0xb7,0x8d}, 189540, 498, 2097152, 1},
+    {},
+    {{0xec,0xef,0xb4,0x11,0x7a,0x6a,0xae,0x11,0x7e,0x03,0x3c,0x8c,0xc0,0x7f,0x0d,0xb2,0x79,0x7d,0x6b,0xe9,0x3d,0xd5,0xcd,0xce,0xfc,0x23,0x69,0x2a,0x21,0xfa,0xe0,0x2e}, 190038, 531, 1048576, 1},
+    {{0x49,0x02,0x06,0x95,0xa0,0x17,0xac,0xc3,0xdf,0xad,0xea,0x97,0xa6,0x0e,0x28,0x60,0x9e,0x58,0x35,0x71,0xf6,0x9c,0x5a,0xbe,0xb3,0xc6,0xb1,0xc2,0xdb,0x81,0x13,0xfa}, 190569, 548, 1572864, 1},
+    {{0x18,0xa5,0x53,0xda,0xfd,0x49,0x80,0xcc,0x28,0x69,0x18,0x0b,0x05,0xf9,0xfd,0xf6,0xe9,0x80,0xbf,0x09,0x2c,0xc6,0x83,0xe4,0x98,0xec,0x63,0x73,0xc9,0x70,0x1c,0x6e}, 191117, 532, 1048576, 1},
+    {},
+    {{0x8e,0xf5,0xd5,0xc5,0x0f,0xfe,0xca,0x1e,0x62,0xe8,0x8e,0x4f,0xe2,0x90,0x9e,0xaf,0x19,0x1e,0x28,0xfb,0xb5,0xa9,0xfa,0xf9,0x8b,0x7b,0x10,0xbe,0xa7,0x2c,0x9e,0xd9}, 191649, 578, 1048576, 1},
+    {{0xad,0xd0,0x82,0xca,0xff,0xe7,0x07,0xdf,0x2c,0x02,0x59,0x48,0x9c,0x3e,0x27,0x2d,0x65,0x57,0xab,0x07,0xba,0x3f,0xf8,0x56,0xcb,0xc0,0xad,0xba,0x0d,0x7d,0xb6,0xa5}, 192227, 552, 1048576, 1},
+    {},
+    {{0xd2,0x4c,0x01,0x75,0xee,0x4e,0xaf,0xed,0x88,0xe2,0x77,0x69,0x1c,0x5f,0x5d,0xaf,0xd4,0xe1,0x97,0x72,0x30,0x97,0xe2,0xeb,0x68,0xaa,0x6b,0x40,0xf4,0x49,0xff,0xf2}, 192779, 613, 1572864, 1},
+    {{0x65,0xfe,0x17,0xfd,0x6b,0x29,0x7f,0x52,0xdf,0x6c,0xe9,0x81,0x2e,0xcb,0x02,0xc3,0xbb,0x1b,0xfd,0xa3,0xeb,0xc0,0x5a,0x19,0xc4,0xa8,0xde,0xcb,0xf9,0xa4,0x46,0xae}, 193392, 521, 2097152, 1},
+    {{0xbc,0x68,0xf4,0x00,0x75,0xf9,0x98,0x3f,0x50,0x27,0xfe,0x26,0x4c,0x30,0x37,0xd1,0xa8,0x31,0xe8,0xe7,0x6a,0x6c,0x9a,0xdb,0x60,0xd1,0x02,0x26,0xf6,0xef,0x00,0x5b}, 193913, 622, 1048576, 1},
+    {{0xdf,0x26,0x44,0xd4,0x35,0x33,0x01,0x92,0xa1,0x37,0x68,0xcc,0x1f,0x79,0xc5,0xaa,0x30,0x84,0xa6,0x42,0x17,0xa5,0x25,0x0c,0x6d,0xd4,0xff,0xdb,0xe2,0x17,0x5b,0xe4}, 194535, 628, 4194304, 1},
+    {},
+    {{0xac,0xcc,0x83,0x6c,0x3a,0xda,0xba,0xdc,0x81,0x0f,0xbe,0x35,0x70,0x2c,0x6a,0x64,0xd5,0x0a,0x09,0xf4,0xc6,0x72,0xd2,0x73,0x4f,0xa5,0x8b,0x25,0x1d,0x7a,0x20,0xaa}, 195163, 514, 1048576, 1},
+    {{0xda,0x48,0x4f,0x2a,0x63,0x6b,0x8d,0x69,0x28,0x40,0xf4,0x0e,0x54,0x68,0xe9,0x92,0xc5,0xf2,0xaf,0x26,0xd3,0x65,0xc6,0x9f,0xbc,0x12,0xef,0x29,0x23,0x58,0x8d,0x23}, 195677, 750, 1575936, 2},
+    {},
+    {{0x62,0xd3,0xd6,0x50,0xe9,0x56,0xf2,0x3f,0x3b,0x22,0x1f,0x83,0xc5,0xc5,0xbd,0x20,0x4a,0xfd,0x0e,0x4f,0x4d,0x9c,0x47,0xa3,0x25,0x19,0x62,0x32,0x3d,0xe9,0x60,0x89}, 196427, 522, 1048576, 1},
+    {},
+    {{0xd6,0x89,0x39,0x28,0x84,0xdf,0x91,0xc2,0xbb,0x84,0xb1,0x41,0x1a,0x96,0xf3,0x91,0x9b,0x6c,0x9c,0xc8,0xa5,0x83,0xdf,0xf9,0x01,0xa9,0x8f,0x0d,0x86,0xd3,0x1c,0x30}, 196949, 522, 524288, 1},
+    {{0x31,0xbc,0x86,0x2a,0xb0,0xa8,0xea,0xbf,0x23,0xb5,0x12,0x4e,0x13,0x94,0x0c,0xb3,0x50,0x1e,0x7e,0xcd,0xd3,0xf1,0x5e,0x34,0x14,0x22,0x48,0xce,0xb4,0xaa,0x13,0x9a}, 197471, 565, 1048576, 1},
+    {{0xfb,0xe8,0x92,0x6f,0xc0,0x14,0x9d,0x3e,0x8e,0x2a,0xec,0x20,0xf1,0x56,0x40,0xea,0x68,0x14,0xf4,0xf4,0xb0,0x1c,0x39,0x60,0xf3,0xc4,0x77,0xf5,0xf1,0x7e,0x89,0x0f}, 198036, 522, 2097152, 1},
+    {{0xd8,0xb3,0xd9,0x26,0x74,0x70,0xad,0xb8,0xef,0x2d,0x19,0x7a,0xde,0x44,0x47,0x6e,0x50,0x4c,0x08,0x23,0xf8,0xfe,0x9d,0x2c,0xf2,0x88,0x3a,0x03,0xaa,0x75,0xbd,0x49}, 198558, 576, 1048576, 1},
+    {},
+    {{0x69,0xd0,0x6a,0x3f,0x3a,0x4f,0x3b,0xa7,0x69,0x54,0x1f,0xe9,0x4e,0x92,0xb4,0x21,0x42,0xe4,0x23,0xe9,0xf0,0x92,0x4e,0xab,0x97,0x86,0x5b,0x2d,0x82,0x6e,0xc8,0x2d}, 199134, 1016, 5242880, 2},
+    {},
+    {{0x9f,0xfd,0x95,0x48,0x69,0x04,0x80,0x4a,0xca,0x1f,0x70,0x68,0xc9,0x9f,0x1c,0x9e,0x91,0xc2,0xc0,0xe5,0x47,0x4e,0xc7,0x58,0xdf,0x1a,0x91,0x33,0x93,0x57,0x1c,0xc7}, 200150, 518, 2097152, 1},
+    {},
+    {{0x6f,0xa6,0xb8,0xa8,0x80,0x4f,0xf6,0x54,0x4b,0xde,0xdf,0x94,0x33,0x9a,0x86,0xba,0x64,0xce,0x0b,0x6d,0xbf,0x05,0x96,0x05,0xab,0xb1,0xcd,0x6f,0x10,0x2d,0x34,0x83}, 200668, 614, 524288, 1},
+    {},
+    {{0x58,0x74,0xb9,0x42,0xf9,0x74,0xbb,0x90,0x6d,0x8c,0xbc,0x33,0xb6,0x01,0xa1,0xfa,0xf8,0xf1,0x4a,0xee,0x8d,0x09,0x95,0x12,0x4c,0x8d,0xc8,0x4b,0xb4,0x97,0x38,0x08}, 201282, 527, 2097152, 1},
+    {},
+    {{0x0b,0x1b,0xa3,0x1a,0xe9,0x5b,0x61,0xd7,0xd9,0xa0,0xf5,0x50,0x9b,0x58,0x36,0xff,0xf8,0x4f,0x60,0x91,0x58,0x02,0xe3,0xb3,0xba,0x11,0x70,0xa5,0xc5,0x0a,0x4b,0x71}, 201809, 492, 3145728, 1},
+    {{0xa1,0x79,0xa1,0x18,0x82,0x20,0xb5,0x97,0x87,0xc4,0x9a,0x78,0xa0,0xdd,0xe7,0x9b,0x89,0x38,0x0e,0x3a,0x8a,0x8a,0x0a,0xb5,0x58,0xf0,0x10,0x2c,0x57,0x96,0xf8,0x73}, 202301, 533, 1048576, 1},
+    {},
+    {{0x70,0x00,0x8e,0xfe,0x51,0x18,0x5e,0xb0,0xa2,0xf8,0xd8,0xd8,0xac,0x2b,0xdb,0xb9,0x9b,0xd3,0xdf,0xcc,0x16,0x9d,0xcc,0x47,0x49,0x62,0xf8,0x26,0x92,0x99,0x80,0x51}, 202834, 530, 524288, 1},
+    {{0xe1,0x9f,0x7d,0x8d,0x5c,0x3e,0x4c,0xef,0xef,0xf5,0x88,0x93,0x80,0xd8,0x78,0x04,0x95,0xe0,0x1f,0x05,0x53,0xd1,0x3b,0xe4,0x18,0x2a,0x15,0xa5,0xd4,0xb6,0x15,0xbb}, 203364, 510, 524288, 1},
+    {{0xc9,0x2f,0x38,0x9d,0x25,0x87,0x0a,0xad,0xa3,0x00,0x27,0x75,0x83,0x8e,0xc9,0xf6,0x9a,0x98,0x81,0x20,0xc0,0x23,0x8a,0xf8,0x85,0xfd,0x08,0xd4,0x6b,0xd9,0x49,0x30}, 203874, 515, 1572864, 1},
+    {{0x68,0xa5,0x1b,0x7a,0x06,0xb6,0xa9,0xe7,0x10,0x0a,0x89,0x52,0x1e,0x52,0xb5,0xc4,0x67,0xc4,0x6c,0x82,0x8c,0x0f,0x65,0x04,0xbe,0xe6,0x77,0xbe,0xac,0x2a,0xa6,0xfd}, 204389, 573, 1048576, 1},
+    {{0x21,0xd4,0xa7,0x24,0x61,0xd8,0x68,0x0c,0xf7,0x5c,0xf3,0xb8,0xeb,0xa4,0x2e,0x13,0x12,0x78,0x15,0xbc,0x17,0xb6,0x24,0x9d,0x89,0xa5,0xe3,0x9b,0xeb,0x3f,0x14,0x06}, 204962, 490, 1572864, 1},
+    {{0xdd,0x73,0x69,0x0d,0xd3,0x16,0x5a,0x16,0x58,0x0e,0x19,0x1c,0x92,0xa4,0x97,0x10,0x27,0x58,0xf3,0x12,0xc7,0x59,0x35,0x3f,0x68,0x5e,0x37,0x17,0x55,0xc6,0x63,0xa8}, 205452, 628, 1572864, 1},
+    {{0xe4,0x34,0x3c,0x0f,0xad,0xc0,0x0f,0xfd,0xc3,0xdc,0x31,0x34,0x50,0x68,0xd7,0x51,0xee,0xa5,0xd6,0x39,0xf8,0x26,0x73,0x1f,0x08,0xcb,0x81,0x67,0x3d,0x50,0x8c,0x40}, 206080, 551, 2097152, 1},
+    {},
+    {{0x54,0xb2,0xf0,0x33,0x93,0x10,0x9a,0xc7,0xfd,0x36,0xd8,0xc7,0x75,0x2f,0x15,0xa4,0x4d,0x96,0x07,0xab,0x01,0x87,0xa3,0x71,0xb8,0x53,0x19,0x1d,0xb3,0x59,0x2c,0x01}, 206631, 522, 1048576, 1},
+    {{0x22,0xd0,0xb7,0x68,0x7d,0x66,0x43,0x6a,0xba,0xf4,0x47,0xbb,0x29,0x55,0x8e,0x43,0xf5,0x62,0x28,0x3e,0xc4,0xdb,0xe7,0x44,0xdf,0x7d,0x79,0xa3,0xe2,0x7a,0x25,0x77}, 207153, 510, 917504, 1},
+    {{0xdd,0x96,0xa8,0xf4,0xf9,0xc8,0x98,0x83,0x01,0xff,0x71,0x0a,0x4c,0x70,0xeb,0xe3,0xbf,0x79,0x14,0x90,0x1f,0x35,0x47,0xab,0xe1,0xd5,0xf0,0xdd,0x5c,0x0b,0x92,0x1b}, 207663, 594, 1048576, 1},
+    {{0x0d,0x4e,0x0d,0x13,0x43,0x96,0xbd,0x1c,0x72,0x54,0xcd,0xc1,0xda,0x35,0x6e,0xb9,0x44,0xca,0x14,0x91,0x0b,0x66,0x90,0xf4,0x84,0xa7,0x5a,0x9c,0x3a,0x81,0x06,0xe7}, 208257, 565, 1048576, 1},
+    {{0xd1,0x7c,0xb5,0xc7,0x31,0x74,0x06,0x0f,0xcb,0xd9,0xcb,0xa6,0xc7,0x05,0x64,0x3f,0x19,0xc3,0xb8,0xbe,0x24,0xd0,0xf7,0xee,0x43,0xae,0xe6,0x74,0xff,0x1e,0xa3,0x8e}, 208822, 554, 4194304, 1},
+    {{0x86,0x59,0x19,0xb2,0x5a,0x9d,0x24,0x1c,0x90,0x7b,0xcd,0xa1,0x8b,0x38,0x0e,0x3c,0x70,0x4f,0x33,0xf4,0x99,0x7a,0xd4,0x45,0x59,0x04,0x6f,0x0f,0x08,0xc4,0x96,0x8b}, 209376, 520, 1048576, 1},
+    {},
+    {},
+    {{0x96,0x74,0xcc,0x26,0x9d,0x89,0xa5,0x2d,0x17,0x19,0xa4,0x87,0xb4,0x4a,0xcf,0x00,0x4f,0xb7,0x77,0xcb,0xd5,0x8d,0x76,0xb1,0x9a,0x2c,0xd2,0x57,0x49,0x72,0x82,0x15}, 209896, 518, 1048576, 1},
+    {{0x61,0x51,0x38,0x9f,0x33,0xce,0x2e,0x53,0xdb,0x3c,0xd9,0x95,0x92,0x44,0x0c,0x00,0x20,0xf5,0xf4,0x66,0x8f,0x58,0x1c,0xe3,0xbd,0x61,0x5b,0xc9,0x20,0x77,0xf2,0x55}, 210414, 603, 524288, 1},
+    {{0xf8,0xd5,0xc5,0x1f,0x74,0xdf,0x33,0xed,0xc8,0x27,0xfb,0xf8,0xdf,0x7a,0xab,0x70,0x16,0x07,0x70,0xab,0x0a,0x89,0x6d,0xb6,0xe5,0x94,0x38,0xad,0x92,0x08,0xcc,0x6e}, 211017, 526, 1048576, 1},
+    {{0xc7,0xaf,0x9e,0x7f,0x32,0x43,0xba,0x1b,0x5d,0xd8,0x1f,0x32,0xf7,0x10,0xe6,0x0c,0x2a,0xe1,0xd4,0x43,0xec,0xaf,0x71,0x40,0xbf,0x42,0xd7,0x1a,0x1b,0x69,0xd8,0xa2}, 211543, 561, 524288, 1},
+    {{0xdd,0x0f,0xeb,0x78,0xe2,0xd5,0xd8,0x1f,0x59,0x24,0x1b,0xaf,0x3b,0xca,0x5e,0x2e,0xda,0xeb,0xbe,0x98,0xf0,0xac,0x86,0x0a,0x4e,0xb6,0xd4,0x48,0x71,0x8f,0x1c,0xa5}, 212104, 520, 524288, 1},
+    {{0x6a,0xbe,0x90,0x8b,0x40,0x05,0xa6,0x8d,0x1f,0x6e,0x9a,0x54,0x33,0x9c,0x94,0xa3,0x3d,0xb4,0x18,0x01,0x89,0x0d,0x8c,0x05,0x8c,0xe9,0x74,0xfd,0xab,0x3d,0x0b,0xcd}, 212624, 632, 1572864, 1},
+    {{0x90,0x84,0x40,0xf9,0x6f,0xd0,0xdf,0x14,0x60,0x2f,0xc6,0xd1,0xda,0xee,0x85,0x19,0xfc,0x31,0xf7,0x65,0xad,0x00,0xbf,0x64,0xaa,0xba,0x35,0xc2,0xc6,0xef,0x0b,0x56}, 213256, 659, 2097152, 1},
+    {{0x3d,0xb8,0xa4,0x96,0xa4,0x9d,0x47,0xb1,0xac,0x2a,0x89,0x3f,0xea,0xf6,0x82,0x72,0x27,0x65,0xb2,0xcd,0xe6,0x3c,0x22,0xaf,0x3a,0xa6,0x82,0x12,0xdc,0xfa,0x97,0x5f}, 213915, 569, 2097152, 1},
+    {{0xb4,0x62,0x6c,0xf0,0xc8,0x76,0xa1,0x24,0xb5,0x0f,0x94,0x21,0xc4,0x8a,0x7d,0x76,0x2e,0x9e,0xd8,0x08,0xad,0x33,0x6c,0x79,0x9d,0x54,0x3d,0x60,0xb4,0x84,0x89,0x7c}, 214484, 524, 1048576, 1},
+    {},
+    {},
+    {{0xfe,0x10,0x23,0x8a,0xe4,0x2e,0xd9,0xeb,0x4d,0x90,0x6a,0x81,0xdd,0x50,0xeb,0xe5,0x85,0x14,0x09,0x82,0xcd,0xfe,0x26,0x63,0x08,0xce,0x1f,0x16,0xe7,0x8e,0x69,0x03}, 215008, 530, 1048576, 1},
+    {},
+    {{0x5c,0xbe,0xd0,0x40,0x17,0x34,0x14,0x21,0x84,0x16,0x69,0x17,0x42,0x7d,0x24,0xf9,0xe5,0xf1,0x07,0xa7,0xad,0xea,0x66,0x5e,0x2f,0x4b,0x41,0x01,0x49,0x1a,0xd5,0x4b}, 215538, 510, 1310720, 1},
+    {},
+    {{0x2e,0x2a,0x8c,0x0d,0xa7,0xf6,0xde,0xf6,0x17,0x07,0x7a,0x25,0xb2,0x22,0x06,0x2f,0x69,0x88,0xef,0x14,0xb3,0x6b,0x2e,0xdf,0xe1,0x0d,0x47,0xc6,0xa9,0x42,0xd0,0x23}, 216048, 861, 1048576, 1},
+    {{0x8b,0x75,0x25,0xb2,0xaa,0x30,0xcb,0xea,0x9e,0x3d,0xee,0xe6,0x01,0xdd,0x26,0xe0,0x10,0x0b,0x81,0x69,0xc1,0x94,0x8f,0x19,0x86,0x6b,0xe1,0x5c,0xae,0x0a,0xc0,0x0d}, 216909, 492, 2097152, 1},
+    {{0x59,0x85,0xcd,0xad,0x45,0x95,0x8a,0x5b,0x8c,0x59,0x67,0xad,0x39,0xef,0xe5,0x15,0x69,0xf5,0x60,0xbf,0x23,0x7a,0x4e,0x98,0x64,0xf2,0x11,0x11,0x08,0x2a,0x85,0x00}, 217401, 526, 524288, 1},
+    {{0xf3,0x01,0xbb,0x8e,0xa8,0x67,0xe5,0x30,0xec,0xb6,0x4e,0x8e,0xff,0x50,0x4e,0xd5,0xb9,0x69,0x7c,0xf0,0x76,0xc7,0x0e,0x20,0x36,0xec,0xf2,0xff,0xbe,0x6c,0x48,0x7a}, 217927, 577, 1048576, 1},
+    {{0x8d,0x81,0x2e,0xa4,0xfa,0x89,0x72,0x74,0x11,0x6f,0x7f,0x43,0xbc,0x68,0x9e,0x11,0x0f,0x1c,0xfb,0xd3,0xf7,0xeb,0x3a,0x17,0x37,0xc2,0xa8,0x5d,0x36,0x36,0x91,0x59}, 218504, 530, 2097152, 1},
+    {{0x85,0x79,0xdd,0x35,0x2d,0x20,0x58,0x90,0x72,0xed,0x5c,0x02,0x6b,0xde,0x7a,0xda,0xdd,0x62,0x29,0xd1,0x8a,0x02,0x2e,0x7c,0xb4,0x7c,0xf5,0x60,0x2b,0x54,0x01,0x5e}, 219034, 516, 2097152, 1},
+    {},
+    {{0x3c,0x10,0x9e,0x50,0xb9,0x1e,0xc6,0xdf,0x3b,0xb8,0x50,0x97,0x78,0xae,0x54,0x4c,0x99,0x43,0x3f,0xb4,0x0d,0xda,0x9b,0x80,0x11,0x78,0xdf,0xe5,0x13,0x05,0x36,0x18}, 219550, 523, 1572864, 1},
+    {{0x4e,0x80,0x44,0xb1,0xe7,0xa7,0x79,0x68,0x5d,0x67,0x51,0x35,0x1e,0xef,0x23,0x91,0x27,0x2a,0xc8,0xb2,0xbd,0x90,0x9e,0xde,0xec,0xfc,0x3d,0x3c,0x5a,0x59,0x4b,0xef}, 220073, 548, 1048576, 1},
+    {{0x34,0x2d,0xdf,0x43,0x8a,0xec,0x3f,0x06,0x96,0xde,0x8f,0x2c,0xd7,0x4b,0xb7,0xf4,0x8a,0x95,0x6f,0x48,0x8f,0x12,0x46,0xee,0xcc,0xaf,0xf5,0xef,0x24,0x6c,0xa5,0x0b}, 220621, 506, 1048576, 1},
+    {{0x33,0x7e,0x64,0x3d,0x3e,0x63,0x91,0x5d,0xe0,0x64,0x29,0x99,0x2f,0x30,0x6e,0x8d,0x2b,0x73,0xae,0xd6,0x84,0x9b,0x79,0x5f,0x9c,0x85,0x5c,0x2d,0x03,0xc1,0x81,0x80}, 221127, 512, 1048576, 1},
+    {{0x21,0x43,0xbb,0xd8,0x7e,0xa1,0xc5,0xcf,0xe5,0xea,0xf4,0x6a,0xe3,0x9e,0x3e,0xbb,0x11,0xa2,0xe9,0x29,0xd0,0x5c,0xbb,0x92,0x99,0x04,0x03,0x7f,0x4d,0x72,0xac,0xfe}, 221639, 559, 524288, 1},
+    {},
+    {{0xa2,0x03,0xa1,0x38,0x70,0xea,0xec,0x92,0x09,0x5d,0xae,0xf1,0x19,0x6a,0x0c,0x9f,0xe8,0x41,0x6e,0x60,0x05,0x04,0xd5,0x5d,0xd0,0xdc,0x72,0x4d,0x4f,0x5f,0x5c,0xb0}, 222198, 556, 3145728, 1},
+    {{0xc3,0xcb,0x1d,0x2f,0xd9,0x77,0x5a,0xa9,0xd1,0x5b,0x7e,0xed,0xd4,0x5a,0xd8,0x25,0x19,0xb7,0x3d,0x47,0xca,0x16,0x67,0x37,0xed,0x39,0x8c,0x74,0x87,0x17,0xbc,0xc4}, 222754, 592, 1572864, 1},
+    {},
+    {},
+    {},
+    {{0x18,0x3a,0xf7,0xd6,0x42,0xb5,0x5d,0x52,0xcd,0x59,0x47,0x86,0xec,0x2f,0x03,0x1d,0x03,0x3c,0xc6,0xc8,0xc1,0xa2,0xa8,0x4a,0x83,0x4e,0x4a,0xda,0x04,0x30,0x1b,0x26}, 223346, 568, 2097152, 1},
+    {{0xa8,0x23,0x93,0x55,0x63,0x1d,0x30,0x3e,0xce,0xbf,0xd4,0x3f,0xc1,0x4e,0x80,0xf1,0x48,0xe4,0xac,0x99,0x37,0x23,0x4e,0x29,0xcc,0x87,0xd6,0xf9,0x39,0xb0,0x33,0xa0}, 223914, 534, 1048576, 1},
+    {},
+    {{0x26,0xe0,0x9f,0x5b,0xc2,0xbd,0xe2,0x8d,0x57,0xae,0xca,0x0b,0xf5,0xbe,0x7f,0x7f,0xb8,0xe3,0xb3,0x88,0x7a,0xf9,0x75,0xbc,0xbf,0x2e,0x6f,0x29,0xb0,0x7d,0xf5,0x6f}, 224448, 522, 524288, 1},
+    {{0x46,0xfc,0xca,0x4c,0xe2,0x9f,0x47,0x2a,0xfa,0x85,0x19,0x95,0x8d,0x25,0x6e,0xec,0x34,0x7c,0x2d,0xc2,0xda,0x15,0x4c,0x95,0xf2,0x63,0xa0,0x51,0xc5,0xc0,0x2d,0xbb}, 224970, 590, 1572864, 1},
+    {{0x4e,0xfa,0xb3,0xf4,0x9c,0xbe,0x91,0xec,0x77,0xb6,0xcb,0xa7,0x47,0xdd,0xfe,0xdf,0xdc,0x0b,0x08,0x0c,0x75,0x5a,0x8b,0x6b,0xa5,0x12,0x34,0xf0,0x67,0x6c,0x00,0x0f}, 225560, 496, 524288, 1},
+    {{0x7f,0xb5,0x23,0x6d,0x10,0x85,0x21,0x25,0xf0,0xf3,0x7c,0x21,0x88,0xb9,0x07,0xd6,0x36,0x64,0x74,0x00,0xa5,0x7b,0xcc,0xbd,0xb2,0xf6,0x30,0x98,0xff,0xae,0x8b,0x2d}, 226056, 536, 2097152, 1},
+    {{0x48,0x9d,0x6d,0x70,0x4d,0x3d,0x91,0x7d,0x9b,0x46,0xce,0x38,0x22,0x30,0x70,0x04,0x19,0x98,0x3a,0x8d,0x0d,0x61,0xa9,0x8f,0xe0,0x7e,0x08,0xc9,0x35,0x52,0x2d,0xde}, 226592, 586, 2097152, 1},
+    {{0xb9,0xb9,0x82,0xcd,0x8f,0x91,0xc5,0x10,0x89,0xd4,0x9b,0x55,0x0f,0x11,0x88,0x2b,0x1e,0xe7,0x85,0xeb,0xdd,0xcb,0x73,0x55,0xcf,0xc4,0x65,0x91,0x6d,0x61,0xa0,0x42}, 227178, 514, 1048576, 1},
+    {},
+    {{0x63,0xec,0xdc,0xa7,0xf8,0x9b,0x24,0x32,0xcc,0xd5,0x7b,0xdb,0x81,0xc0,0x87,0x5f,0x63,0x36,0x35,0x3f,0x58,0x97,0xf7,0x56,0xef,0x16,0x2a,0xb2,0xec,0x2e,0xe7,0x07}, 227692, 593, 2097152, 1},
+    {{0x5f,0xb0,0x72,0xc3,0xc2,0xe9,0xd8,0xe7,0xf8,0x4b,0xea,0x9c,0x4b,0xf2,0x25,0x3e,0x68,0x68,0xeb,0x2b,0x1f,0x13,0xe3,0x5a,0x7d,0x75,0xfd,0xf0,0x58,0x96,0xd8,0x73}, 228285, 566, 2097152, 1},
+    {{0x04,0x15,0xad,0xfe,0x80,0x97,0x74,0x85,0xf8,0x4c,0xdf,0xfa,0xaa,0x79,0xf1,0x8c,0x91,0xc0,0x04,0xc7,0xdb,0xa2,0x02,0xb4,0xcf,0x9a,0x94,0xeb,0x11,0xad,0xea,0xda}, 228851, 555, 1048576, 1},
+    {{0xa4,0x27,0xdb,0x48,0x60,0xcb,0x51,0x40,0x93,0x5f,0x26,0x3b,0xa8,0x72,0xfe,0x14,0x94,0x9c,0x35,0x48,0xdb,0x64,0x4f,0xed,0x46,0xb2,0xed,0xf3,0xdf,0xf3,0xd4,0xa8}, 229406, 542, 2097152, 1},
+    {{0x36,0x77,0x25,0xa1,0x49,0xa4,0x71,0x41,0x1e,0x4f,0x72,0xad,0x77,0x60,0x3b,0x61,0xfb,0x10,0x1c,0x9c,0xab,0x45,0x21,0xbe,0x56,0x47,0xe1,0x37,0x08,0xcc,0x97,0xba}, 229948, 547, 2097152, 1},
+    {{0x4b,0x94,0x54,0x93,0xd2,0x86,0x53,0xd5,0xd0,0x47,0xa3,0x75,0x13,0x6e,0xc9,0x79,0x2f,0x27,0xe6,0x52,0xbe,0x4a,0xf0,0x0e,0x2c,0x03,0xc4,0x03,0x69,0xbd,0x6e,0xcf}, 230495, 584, 2097152, 1},
+    {},
+    {{0x17,0xc8,0x64,0xa7,0x6d,0x49,0x8f,0xeb,0x64,0x79,0xee,0xe8,0xe7,0xd6,0x80,0x7b,0x95,0x1c,0x66,0x22,0x50,0x33,0x22,0x86,0x22,0xbb,0x66,0x75,0x4b,0xaa,0xb1,0xdb}, 231079, 635, 3145728, 1},
+    {},
+    {},
+    {},
+    {},
+    {{0x9f,0x77,0x82,0xa9,0x2f,0xda,0x78,0x9f,0x9d,0x11,0x9b,0x1f,0x0a,0x2f,0x7d,0xa0,0xf3,0x56,0x06,0x35,0x75,0x56,0xa4,0x8e,0xca,0x94,0x87,0x79,0x7e,0xe1,0xa8,0x88}, 231714, 528, 1048576, 1},
+    {},
+    {},
+    {},
+    {{0x7a,0x8f,0xfa,0xf8,0xbb,0x54,0x9b,0x40,0x0e,0xc2,0xf0,0xbd,0xa9,0xf3,0xc0,0xdb,0xf5,0x85,0x2c,0x38,0x61,0x8c,0xdb,0x21,0xcd,0x78,0x3c,0x36,0x83,0x83,0xe2,0xc7}, 232242, 524, 1048576, 1},
+    {{0xbb,0x83,0xf9,0x82,0x96,0x1c,0x33,0xb8,0x1f,0xef,0xc1,0xf5,0x45,0xe1,0x8a,0xb5,0x72,0xd1,0xc4,0x3c,0xf6,0xc2,0x41,0x94,0x85,0x44,0xf0,0x5a,0x1a,0x71,0xf2,0xba}, 232766, 603, 1048576, 1},
+    {{0xdd,0x49,0x94,0x45,0x27,0x5f,0xca,0x66,0x92,0xc0,0x48,0x7a,0x8b,0xd7,0x0a,0x23,0xf6,0xc8,0xe7,0x8e,0x76,0x6d,0xf0,0xe3,0xc5,0x8f,0xbb,0xe5,0x3f,0x8a,0xdb,0x06}, 233369, 636, 1048576, 1},
+    {{0x02,0x88,0xec,0x04,0x97,0x23,0xcd,0x0c,0x7f,0x11,0x48,0xcd,0xc1,0xae,0xf0,0xb6,0x92,0x2b,0x8a,0x75,0x6a,0xff,0xe3,0x73,0xc9,0x9d,0x56,0x90,0xe0,0xdf,0xce,0xaa}, 234005, 556, 1048576, 1},
+    {{0x31,0x4d,0x53,0xf4,0x09,0xb6,0x6b,0xa3,0xf4,0x42,0x6a,0x6f,0x1b,0xb7,0xc6,0x9f,0x67,0x79,0xae,0xed,0x27,0x7c,0xe2,0xe1,0x95,0x35,0xf9,0x4d,0x7c,0x8c,0xa5,0x86}, 234561, 513, 1048576, 1},
+    {{0xd2,0xfe,0x66,0xc1,0xce,0x66,0xc6,0x5c,0xe1,0x4e,0x47,0x8c,0x94,0xbe,0x2e,0x61,0x6f,0x9e,0x2c,0xad,0x37,0x4b,0x57,0x83,0xa6,0xa6,0x4d,0x3c,0x1a,0x99,0xcf,0xa9}, 235074, 574, 2097152, 1},
+    {{0x0b,0x15,0x5a,0x54,0xb6,0x13,0x46,0x01,0xfc,0x07,0x91,0x25,0x2a,0x63,0xca,0x73,0xef,0xd5,0x22,0x66,0x7c,0x3d,0x6f,0xd7,0xa4,0x4f,0x5b,0x3c,0x50,0x00,0x39,0xd7}, 235648, 522, 1048576, 1},
+    {{0xd9,0x8d,0x7d,0xa1,0xe7,0x63,0x6e,0x06,0x75,0x63,0xe2,0xe4,0x80,0xd7,0xdf,0xbc,0x01,0x3b,0x7e,0x9b,0xdf,0x13,0x29,0xfd,0x61,0xc5,0xca,0xca,0xc0,0x29,0x3e,0x1d}, 236170, 527, 2097152, 1},
+    {{0x0d,0x7f,0x87,0x58,0x77,0xfe,0x85,0x60,0x66,0xcf,0xb3,0x9b,0x4e,0xcd,0xbb,0xe7,0xd4,0x83,0x93,0xa7,0x57,0x70,0x72,0x08,0x76,0xc9,0x44,0x19,0xf8,0x09,0xbb,0x1c}, 236697, 530, 2097152, 1},
+    {{0x92,0x0b,0xba,0xaf,0x6a,0x32,0xca,0xb5,0xfe,0xab,0xb5,0xbc,0x8b,0x2b,0x42,0x7d,0xcc,0xd5,0x3b,0xfd,0x31,0xd0,0xda,0x8a,0xcb,0x7e,0xa4,0xe8,0x19,0x13,0x9e,0x4f}, 237227, 539, 2097152, 1},
+    {{0x19,0x09,0x99,0x12,0x2a,0xac,0xc2,0xcf,0xf2,0x0c,0x56,0x77,0xb3,0xf6,0x0e,0xd9,0x38,0xd8,0xa3,0x6b,0x69,0x6d,0x16,0xcc,0x1b,0xf4,0x16,0x70,0x5e,0xfe,0x15,0x1e}, 237766, 542, 1048576, 1},
+    {{0x21,0x67,0xfc,0x7c,0x54,0x47,0xb2,0x28,0x76,0x68,0xd2,0xf3,0xe4,0xef,0x1a,0x28,0x53,0x61,0xb2,0x29,0x2e,0xcc,0x8a,0x4c,0xbd,0x9f,0x96,0x6a,0x46,0x0a,0xd7,0xa2}, 238308, 526, 1048576, 1},
+    {{0x4e,0x09,0x5f,0xbb,0xde,0xc4,0xa1,0x6b,0x07,0x5d,0x71,0x40,0x38,0x5f,0xf6,0x8b,0x25,0x98,0x70,0xca,0x9e,0x33,0x57,0xf0,0x76,0xdf,0xff,0x7f,0x3d,0x1c,0x4a,0x62}, 238834, 807, 4194304, 1},
+    {{0xd4,0x5e,0x26,0xeb,0x10,0xc3,0x23,0xec,0xd4,0x80,0xe5,0xf2,0x32,0x6b,0x22,0x3e,0x29,0x26,0x4c,0x3a,0xdd,0xe6,0x7f,0x48,0xf0,0xd2,0x79,0x11,0x28,0xe5,0x19,0xe8}, 239641, 752, 2097152, 1},
+    {},
+    {{0xb8,0x39,0x25,0x3b,0x87,0x88,0x21,0xff,0x00,0x84,0x74,0x91,0xd1,0x14,0x52,0xe9,0x33,0xba,0xaf,0x30,0x3f,0x49,0xdd,0x39,0xd2,0x2e,0x3a,0x52,0x4e,0xa1,0xff,0x81}, 240393, 528, 1048576, 1},
+    {{0x0f,0x47,0x4d,0xaf,0xe5,0xa2,0x6f,0x3d,0xea,0x49,0x1d,0x18,0x07,0x3d,0xd4,0x90,0xd2,0xf1,0xf9,0x13,0x13,0xa7,0xe9,0x10,0x86,0x56,0x55,0x10,0xd3,0x8d,0x9a,0x09}, 240921, 530, 1048576, 1},
+    {{0x2a,0x08,0x70,0x47,0x48,0xf5,0xef,0x64,0x88,0x34,0x8c,0x40,0x99,0x72,0x9f,0xec,0xa6,0x00,0x41,0x2d,0x33,0x1b,0xda,0x37,0x56,0xe5,0x1e,0xfd,0x8b,0x94,0xe1,0x13}, 241451, 570, 1048576, 1},
+    {{0xc2,0xa1,0xa6,0x66,0x48,0xa0,0xa0,0xbf,0xe2,0xf2,0x01,0xcf,0x4f,0x92,0x6d,0x13,0x8e,0x41,0x0f,0xbf,0x85,0xec,0xf4,0x36,0xcc,0xb9,0xaa,0xc7,0x0c,0x0d,0xf3,0xde}, 242021, 518, 524288, 1},
+    {{0x29,0x72,0x05,0x7a,0x00,0x87,0xf8,0x23,0x9d,0x25,0x23,0xea,0xa9,0x95,0x40,0x5f,0x06,0xe5,0xd5,0xba,0x3a,0x32,0x03,0xb6,0xb5,0x0d,0x40,0x13,0x79,0xc8,0xeb,0xde}, 242539, 625, 2097152, 1},
+    {{0x25,0x00,0xd6,0xc8,0x46,0xc7,0x8b,0xcb,0x72,0x9f,0x15,0x53,0x5b,0xf2,0xb8,0x52,0xa1,0x20,0x41,0x18,0x91,0xca,0xba,0xaa,0xa6,0xfc,0x40,0x79,0x06,0xd0,0x21,0x4e}, 243164, 616, 524288, 1},
+    {{0xb6,0x4f,0x9f,0x95,0xfb,0x24,0x4f,0xed,0xdb,0x3f,0xf5,0x0b,0xf0,0x97,0x2a,0xf8,0x8f,0x5d,0x00,0x6e,0x9b,0x09,0x05,0x0b,0x93,0x03,0x74,0xfe,0xf8,0xb3,0x78,0x62}, 243780, 587, 524288, 1},
+    {{0x83,0x5d,0xed,0x94,0x79,0xf0,0xe7,0xba,0xba,0xe0,0x04,0x05,0xd8,0x52,0x33,0xd7,0x67,0xe8,0x2f,0xa2,0x47,0xaa,0x1a,0x9c,0xdc,0x14,0xfd,0x1f,0x14,0x7b,0x62,0xef}, 244367, 617, 1572864, 1},
+    {{0x8f,0xcb,0x9c,0x34,0xae,0xa8,0x63,0xd4,0x9f,0xf0,0x8a,0x0a,0xce,0x3f,0x83,0xd3,0x01,0xb8,0x1f,0x01,0xe2,0xed,0xe2,0x8b,0xee,0x7e,0x6d,0x77,0x88,0x78,0xd0,0xcc}, 244984, 684, 1310720, 1},
+    {{0x76,0xd7,0x60,0xda,0x59,0xaa,0x7f,0xc2,0xfd,0x44,0x26,0xc1,0xd1,0xae,0xc5,0x74,0x12,0x70,0x3a,0xb9,0x01,0xb9,0xdf,0x60,0xac,0x2b,0xe1,0x6e,0xde,0x80,0xb0,0xe7}, 245668, 544, 524288, 1},
+    {{0xa4,0xab,0x8c,0xfa,0xd2,0xf2,0x36,0x67,0x5b,0x1c,0x01,0x24,0xf8,0x48,0x46,0x88,0xe1,0x49,0xf3,0x8e,0x86,0x28,0xa3,0xb3,0x8e,0x9e,0xc1,0x4d,0x49,0x1e,0xc0,0x7e}, 246212, 524, 2097152, 1},
+    {{0x75,0xa7,0xb5,0xb8,0xad,0x03,0x29,0xdc,0x82,0x8d,0x32,0x01,0x08,0x9e,0x12,0x5f,0xd5,0x5f,0xdf,0xc9,0x9d,0x4c,0xec,0x70,0x4f,0xfc,0xd7,0xe3,0x03,0x6c,0x24,0x10}, 246736, 528, 1048576, 1},
+    {{0x55,0x37,0x67,0x15,0xf2,0x43,0xb1,0xba,0xcd,0x9a,0xee,0xcf,0x10,0x92,0xbb,0xc7,0x83,0x7f,0xe5,0x12,0x59,0x2a,0x2c,0x17,0x03,0xd2,0x4b,0x08,0x29,0xfc,0x19,0x34}, 247264, 494, 3145728, 1},
+    {},
+    {{0xbe,0xd1,0x8c,0x96,0x8a,0xee,0x0e,0xb0,0xc8,0x66,0xc1,0x96,0x4c,0x28,0x13,0x53,0x64,0xcd,0x6d,0x65,0xff,0xf7,0xbc,0xb5,0x87,0x33,0x42,0xc0,0x4e,0x63,0x75,0x0d}, 247758, 544, 524288, 1},
+    {},
+    {{0xa1,0x37,0xf4,0xfc,0x1c,0x63,0x5f,0x70,0x6d,0x10,0xe0,0xc7,0x92,0x7e,0x71,0xf5,0x2d,0xa1,0x71,0xce,0x2d,0x27,0x39,0x4c,0xe0,0xde,0xb4,0x51,0xb5,0xbe,0xd8,0xae}, 248302, 512, 2097152, 1},
+    {},
+    {{0x71,0xbd,0xd4,0x48,0xa3,0x0b,0x88,0x72,0x58,0x64,0xe5,0x55,0x94,0xeb,0xb6,0x7a,0x11,0x8b,0x1f,0x19,0x7a,0x3f,0x9e,0x5d,0xd3,0x9d,0xbf,0x23,0x39,0x9e,0xfa,0x15}, 248814, 490, 1572864, 1},
+    {},
+    {},
+    {},
+    {{0x34,0x72,0xdd,0x57,0x4b,0x50,0xae,0xd2,0xfa,0x99,0x8f,0x46,0x43,0x98,0xdb,0x4f,0xbb,0x00,0xf5,0xa3,0x00,0xa6,0x72,0xc3,0x73,0x7e,0xe9,0x33,0x6a,0x00,0x8a,0x16}, 249304, 514, 1048576, 1},
+    {{0x0e,0x2b,0xa5,0x74,0xff,0x73,0x58,0x7f,0x21,0x1c,0x8f,0x81,0x8d,0x44,0x46,0x31,0x58,0x48,0x32,0xe9,0x24,0x05,0x48,0xf0,0x03,0x17,0x1c,0x11,0xb8,0x98,0xad,0x62}, 249818, 806, 532480, 3},
+    {{0x41,0x78,0x74,0xaa,0x57,0x85,0x6f,0xe9,0x3e,0xef,0xdb,0x24,0x06,0x6f,0xa1,0xa9,0xca,0x3f,0x23,0xc7,0x2c,0x09,0xd5,0x24,0x7a,0xe2,0xb3,0xab,0x4b,0x3d,0x09,0xd1}, 250624, 500, 4194304, 1},
+    {{0x3e,0x62,0x87,0x2b,0xf6,0x9e,0xa9,0x0d,0xd7,0x09,0x36,0x08,0x26,0x8f,0x8d,0xef,0xa2,0xc6,0x01,0x6a,0xdb,0x10,0x11,0x74,0x5d,0xab,0x3c,0x2a,0xf4,0x5d,0x69,0xb7}, 251124, 538, 1048576, 1},
+    {{0x05,0x6a,0xc8,0x16,0x03,0x63,0xd5,0x77,0xe3,0xff,0xc2,0xf5,0x93,0x80,0x1b,0x8b,0xb3,0xd0,0x24,0xfe,0x4f,0x3a,0x33,0x31,0xb7,0x11,0xdc,0x55,0x62,0x04,0x94,0x9d}, 251662, 524, 524288, 1},
+    {},
+    {{0xf5,0xb7,0x41,0x8c,0x00,0xcc,0xac,0x44,0x61,0x5c,0xfc,0x57,0xc7,0xe1,0x7d,0x57,0x53,0x38,0x37,0x05,0x68,0x86,0xf6,0xd7,0x33,0xe6,0xb7,0x14,0xc3,0x6d,0xec,0x1f}, 252186, 528, 1048576, 1},
+    {{0xe3,0xb0,0x7a,0x59,0xf9,0x69,0xce,0xd9,0x1c,0x45,0x79,0xbb,0x45,0x9f,0x2c,0x74,0x7a,0x6c,0x3f,0x12,0xc4,0x5a,0xe4,0x77,0x64,0x83,0xef,0x48,0x30,0xf5,0xf0,0x0f}, 252714, 555, 1048576, 1},
+    {{0x9a,0x06,0x4b,0x67,0xf5,0x22,0xb7,0x5b,0x82,0xd0,0x85,0x75,0x19,0xc0,0xe3,0x3b,0x4d,0xbb,0xe4,0x94,0xc2,0xef,0x79,0xa4,0x4f,0xdc,0x91,0x3d,0x60,0x5d,0x0b,0x26}, 253269, 526, 524288, 1},
+    {{0xcb,0xc4,0x96,0xa7,0x87,0x9b,0xa7,0x8f,0x32,0xc5,0x1c,0x3d,0xf4,0xba,0x1a,0x1a,0x42,0xf1,0x7d,0x78,0xd4,0x8a,0x39,0xea,0x9c,0x70,0x9d,0x1a,0xd1,0x8c,0xb8,0xdf}, 253795, 578, 1572864, 1},
+    {{0x1b,0x42,0x5e,0xa5,0xa8,0x83,0xb7,0x46,0x46,0x37,0xb7,0x4c,0x29,0x37,0xfd,0xe6,0x99,0xff,0xff,0x52,0xb5,0x3a,0xd6,0x94,0x0a,0x66,0x28,0x5e,0x06,0x63,0x19,0x4a}, 254373, 549, 1310720, 1},
+    {{0x14,0xbc,0xe5,0x64,0xf9,0x76,0xd1,0x43,0x11,0x27,0x25,0x9e,0xdb,0xcb,0x23,0xc5,0x2c,0x79,0x36,0x1f,0xed,0x98,0x14,0xd3,0x07,0xd6,0x27,0xc4,0x65,0x0e,0x80,0x0e}, 254922, 602, 1048576, 1},
+    {{0x00,0x99,0xbd,0xb5,0x6e,0x41,0x90,0xf8,0x14,0x40,0xc8,0xc2,0x93,0x95,0xec,0xc1,0x5d,0x78,0xee,0xab,0xfc,0x38,0xa9,0x3d,0xca,0x47,0x73,0x81,0x7d,0x6f,0x72,0x0f}, 255524, 560, 1048576, 1},
+    {},
+    {{0x57,0x9b,0xf1,0xa1,0x98,0x8d,0x4a,0xf0,0x6a,0x69,0xcc,0x1d,0x82,0xa2,0x47,0x8e,0xbe,0x51,0x94,0x0c,0x5c,0xed,0x7f,0x97,0xe8,0x30,0x29,0xa2,0x4e,0x6a,0xa7,0x78}, 256084, 528, 1048576, 1},
+    {},
+    {},
+    {},
+    {{0x74,0x68,0xc2,0x71,0xd7,0x24,0x0c,0xf4,0xe0,0xd0,0x8c,0x16,0xe9,0x96,0x9a,0x1b,0x1b,0x1c,0xaf,0x5a,0xdc,0x0e,0x5a,0xdc,0x56,0x8d,0x93,0xc9,0x26,0x51,0xa0,0x57}, 256612, 541, 1048576, 1},
+    {{0x34,0x5e,0x79,0x50,0x00,0xe7,0x4f,0x51,0x70,0x47,0x74,0xed,0xfc,0x80,0x49,0x47,0x34,0x61,0x76,0x1a,0x65,0xeb,0x47,0xca,0xb7,0x10,0xca,0xa2,0x9e,0x09,0x89,0x7b}, 257153, 485, 4194304, 1},
+    {},
+    {{0xc7,0x02,0xc3,0x86,0x0e,0x9d,0xff,0xda,0xa1,0x91,0x7d,0x01,0x3e,0xcb,0xce,0xfd,0xd2,0xc4,0x7f,0x89,0x72,0x69,0x92,0xf7,0xf8,0x10,0xd8,0x79,0x77,0x2d,0xcc,0x4d}, 257638, 540, 2097152, 1},
+    {},
+    {{0xfc,0x5d,0xf5,0xdb,0x0a,0x96,0xd3,0x9d,0x3d,0xf6,0x51,0xf6,0x39,0x93,0xad,0xf0,0xf5,0xcb,0x5a,0x6b,0x92,0xa3,0x62,0x11,0xf3,0xa0,0x5d,0x46,0x0d,0x92,0xc7,0x2d}, 258178, 538, 2097152, 1},
+    {},
+    {{0x88,0xfa,0x0a,0x78,0xca,0x98,0xc6,0x38,0x6e,0x08,0x6c,0x7f,0xa9,0xe8,0x1a,0x26,0x25,0xbd,0xec,0xc5,0x51,0x15,0xdd,0xe6,0xc6,0xf4,0x77,0x0b,0x06,0x70,0xaa,0x40}, 258716, 751, 1572864, 1},
+    {{0x1f,0x57,0x38,0x55,0x2c,0x51,0xde,0x25,0xff,0xe8,0xaa,0x44,0xff,0x39,0x6c,0x1a,0xb2,0x38,0x43,0x52,0x96,0xf1,0xe8,0xf9,0x9f,0x8c,0xf3,0x35,0x48,0x3c,0x03,0xd5}, 259467, 524, 1048576, 1},
+    {},
+    {{0x32,0x00,0x8c,0x42,0x9e,0xaf,0xe7,0xeb,0x59,0xaf,0xf7,0xa8,0x9f,0x77,0xe1,0xa2,0x67,0xf0,0x2f,0x90,0x61,0xff,0x88,0x30,0xad,0xe7,0xb9,0x90,0x81,0xe2,0x7f,0x7c}, 259991, 554, 1048576, 1},
+    {{0x5b,0x82,0xcd,0xd6,0xf2,0xda,0x56,0xf4,0x36,0x80,0xd6,0xa5,0x02,0x1f,0xae,0xbe,0x2e,0x06,0x03,0x6d,0x30,0x60,0x2c,0x1a,0x79,0x17,0xaa,0x41,0x4c,0xf8,0xb5,0xf4}, 260545, 595, 1048576, 1},
+    {},
+    {{0x76,0xba,0x0f,0xc1,0xf5,0xc1,0xf3,0x93,0x54,0xbb,0x31,0x73,0xa6,0x00,0xf2,0x39,0x15,0xf1,0x19,0x1f,0x40,0x0f,0x7d,0x52,0x5d,0x22,0x0b,0x4b,0x3c,0x8d,0x95,0x8d}, 261140, 540, 2097152, 1},
+    {{0x4c,0x15,0x01,0x31,0x31,0x35,0x1e,0x69,0x4e,0x05,0xf2,0x2e,0x38,0xbb,0x1b,0x3e,0x40,0x31,0xde,0xda,0xc7,0x7e,0xc7,0x5a,0xbe,0xce,0xbe,0x85,0x20,0xd8,0x2d,0x5f}, 261680, 623, 2097152, 1},
+    {{0x65,0xaf,0xf1,0x40,0x38,0x38,0xc9,0x38,0xd7,0xc6,0x17,0x0f,0x30,0x44,0xa2,0xb0,0x31,0x7c,0xd2,0xee,0x13,0xad,0x79,0x35,0x3a,0x4c,0xdd,0x2a,0xa8,0x2f,0x4e,0x87}, 262303, 563, 1048576, 1},
+    {{0x05,0xc7,0xf6,0x46,0x12,0x09,0x02,0x07,0x85,0xfb,0xa3,0x30,0x07,0xe1,0x83,0x08,0x20,0xaa,0x44,0xad,0xa4,0xb1,0xa6,0xf9,0x91,0xd9,0x36,0xbf,0x23,0x35,0xb1,0x5b}, 262866, 522, 1048576, 1},
+    {},
+    {{0x64,0xbc,0x47,0x07,0xf4,0x22,0x66,0x1a,0x66,0x61,0x80,0x88,0x88,0x7e,0x23,0x63,0xa5,0xf8,0x96,0xea,0x68,0x3c,0x58,0x98,0x4f,0xff,0xd9,0x6d,0xd2,0x1a,0xb5,0xf0}, 263388, 653, 2097152, 1},
+    {{0x2e,0x47,0x85,0x69,0x94,0x9c,0x39,0x35,0x52,0x9c,0x95,0x64,0x48,0x94,0x7e,0xf9,0x0b,0xae,0x64,0xab,0xaf,0x3d,0x52,0x3b,0xd8,0x9e,0x7f,0x4c,0xf5,0xe8,0x37,0x02}, 264041, 497, 1572864, 1},
+    {{0x35,0x42,0x1a,0x9a,0xf9,0xdd,0x01,0x1b,0x40,0xb9,0x1f,0x79,0x21,0x92,0xaf,0x9f,0x99,0xc9,0x32,0x01,0xd8,0xd3,0x94,0x02,0x6b,0xdf,0xb4,0x2c,0xbf,0x2d,0x86,0x33}, 264538, 675, 4194304, 1},
+    {{0xdc,0xce,0xb5,0xbe,0x53,0x6c,0x9b,0x91,0xbf,0x34,0xf6,0x5e,0x7f,0xce,0xc4,0xb5,0x5a,0x78,0xaf,0x01,0x92,0x32,0x3c,0xf8,0x6f,0x3b,0x95,0x55,0x07,0x20,0x37,0xee}, 265213, 521, 1048576, 1},
+    {{0x5e,0x5c,0xac,0x64,0xfd,0xcf,0x09,0xa5,0x2a,0x9c,0x0a,0xb1,0xeb,0xc8,0xbd,0x30,0x9d,0xcb,0x12,0x56,0xfa,0xf1,0x40,0x52,0x84,0x44,0x35,0x69,0xb5,0x28,0x4f,0xe5}, 265734, 599, 1048576, 1},
+    {},
+    {{0x48,0x0a,0xe7,0x18,0x6f,0xd5,0xb2,0x82,0x00,0xcd,0x88,0xe1,0x36,0xb9,0xcd,0x3b,0x66,0x00,0xd3,0x25,0x08,0xe2,0x80,0xa0,0xbc,0x27,0xea,0x0e,0xd8,0xd3,0xc0,0xbb}, 266333, 512, 524288, 1},
+    {{0x8f,0x0a,0x76,0x70,0xfe,0x53,0xd3,0x0f,0x72,0x17,0x84,0xe5,0xff,0xf7,0x83,0x49,0xeb,0x15,0x7a,0x9f,0x0e,0xb2,0x24,0x62,0x06,0xf9,0xd7,0xdb,0x47,0x8b,0x7c,0x56}, 266845, 504, 1048576, 1},
+    {{0x0a,0x52,0xdc,0x1e,0x78,0x20,0xf5,0x54,0x1f,0x53,0xce,0x0e,0x1e,0x96,0x14,0x4f,0xe0,0x79,0xaf,0x0e,0xfe,0x3d,0xae,0x5c,0x2c,0x89,0xd8,0x63,0x65,0xfe,0xb8,0xb1}, 267349, 512, 1048576, 1},
+    {{0xfe,0x91,0xd4,0x52,0x01,0x75,0x3a,0xe9,0x65,0x5d,0x5c,0xe3,0x88,0x38,0xe3,0x52,0xf4,0x78,0xb2,0x6b,0x2d,0x93,0x3c,0x1b,0xcb,0x5b,0xd8,0x33,0x01,0x21,0xf9,0xff}, 267861, 524, 2097152, 1},
+    {{0x96,0x4d,0x21,0x99,0x6e,0x38,0x5e,0x03,0x2b,0x5d,0x18,0xba,0xf7,0x16,0x69,0x2b,0xa1,0xdb,0x78,0x02,0x45,0xcd,0x71,0x95,0x6c,0x21,0x20,0x45,0xc1,0xb8,0xeb,0x9a}, 268385, 571, 2097152, 1},
+    {{0x94,0x49,0x6e,0x73,0xfc,0x7f,0xdf,0x2f,0x72,0xf1,0x6b,0xf2,0xbe,0xcb,0x0c,0x39,0x35,0xdb,0x2e,0xbd,0x97,0x55,0x5e,0xac,0x73,0xb6,0x34,0x00,0xac,0xbc,0xee,0xc6}, 268956, 563, 524288, 1},
+    {{0x83,0x72,0x7f,0x69,0x54,0xbc,0xe0,0x24,0xed,0xac,0x7f,0x3f,0xd1,0x8a,0x6f,0xbf,0x63,0xd0,0x5b,0x58,0x0f,0x69,0x2d,0x96,0xfa,0xa3,0x7e,0x60,0x89,0x3c,0x91,0xcd}, 269519, 610, 1310720, 1},
+    {{0x49,0x41,0x90,0xcd,0x6d,0x7f,0xd6,0x88,0x82,0xcb,0xe2,0x55,0xa6,0xe2,0x37,0xd9,0xc4,0xbd,0xaf,0x39,0x88,0x61,0x5e,0xde,0x02,0x97,0xa5,0xe2,0x85,0xad,0x5d,0xd9}, 270129, 530, 1048576, 1},
+    {},
+    {{0x86,0xe9,0xd7,0x6a,0x88,0x34,0x73,0x2e,0x51,0x12,0x53,0xd8,0x09,0x27,0x27,0xbd,0xbf,0xb4,0x09,0xb3,0xd0,0xff,0x1c,0x06,0xb6,0xb6,0xe4,0x81,0xc9,0xa0,0x39,0xef}, 270659, 686, 1572864, 1},
+    {},
+    {{0xb2,0xaa,0x2c,0x0a,0x62,0x1d,0xfb,0xed,0x3b,0x52,0x8d,0xe9,0x32,0x82,0xfc,0x91,0xab,0xb1,0x63,0x25,0xd3,0x58,0x68,0x0d,0x34,0x75,0x3d,0x43,0x62,0x92,0x63,0xcf}, 271345, 750, 2100224, 2},
+    {{0x3d,0xd6,0x59,0xd0,0x48,0xab,0xa8,0xfc,0x7d,0x07,0xb6,0xab,0x72,0x6c,0x9f,0x71,0x1c,0x94,0x81,0x41,0xe9,0x9e,0x39,0x36,0x85,0xae,0x6c,0xc3,0x11,0xa8,0x3d,0xc5}, 272095, 982, 688128, 3},
+    {{0x09,0x7c,0xbe,0x97,0x20,0x90,0x3b,0xc1,0x45,0x99,0x15,0x8b,0x80,0xe0,0xcc,0x31,0x4e,0xf2,0xfe,0x8a,0x58,0x5d,0x6d,0x0a,0x89,0x62,0xeb,0x16,0x26,0x03,0x14,0x92}, 273077, 512, 1048576, 1},
+    {{0x1c,0xe7,0x27,0x67,0x79,0x5f,0x41,0x04,0x9a,0x1f,0x4d,0x28,0x29,0xe8,0x37,0xa8,0x88,0x5e,0xb9,0x1e,0x1c,0x14,0xfa,0xf1,0xca,0x62,0xd0,0x58,0x39,0xeb,0xe3,0xc9}, 273589, 514, 524288, 1},
+    {{0xcf,0x61,0x1b,0x40,0xf9,0x57,0x0e,0x8f,0xcf,0xdc,0x21,0xdb,0x62,0x39,0x65,0xda,0x62,0x56,0x1e,0x8c,0xa8,0x2d,0xed,0x59,0xe4,0x32,0xba,0x6f,0xb0,0xbf,0xb5,0x62}, 274103, 568, 2097152, 1},
+    {},
+    {{0xc9,0x56,0x3c,0xb5,0x73,0x14,0x58,0x8a,0xa3,0xdb,0x22,0xb7,0x6d,0xc8,0xac,0xfb,0xa3,0xe7,0x37,0x33,0xdd,0x35,0x38,0xed,0xd9,0x0a,0xf5,0xa1,0x55,0x95,0x83,0x0e}, 274671, 545, 1048576, 1},
+    {{0x4f,0x50,0x0d,0xa1,0x9d,0xbb,0x15,0x57,0xa7,0xbc,0x0c,0xe1,0x44,0x37,0x09,0x8c,0x14,0x02,0x47,0x8d,0x57,0x3f,0xb5,0x69,0x30,0x3b,0x81,0xc0,0x11,0xf8,0x6f,0xbf}, 275216, 522, 524288, 1},
+    {{0x47,0x5c,0x9b,0xaa,0x1c,0x2b,0x76,0xa6,0xb3,0x11,0x9e,0x47,0xd3,0x28,0x14,0xdc,0x1c,0x08,0xe8,0x4e,0x23,0x25,0x0a,0xe0,0x15,0xbb,0x0b,0xcc,0xea,0x91,0x56,0x37}, 275738, 514, 524288, 1},
+    {{0x82,0xbb,0xa8,0xae,0x2b,0xb4,0xdb,0xc7,0x4a,0x18,0xaf,0x31,0xaa,0xec,0x19,0xc3,0x68,0x57,0x6e,0x43,0x69,0xdd,0x70,0xb3,0x96,0xca,0xa5,0xe8,0x72,0x95,0x40,0xbb}, 276252, 518, 2097152, 1},
+    {{0x0a,0x8c,0xd5,0x10,0x1f,0x84,0x9c,0xcd,0x4e,0x40,0xd5,0x5f,0xdc,0x4e,0xdc,0xe9,0x14,0xb2,0x82,0x5b,0x69,0xeb,0x76,0xec,0x31,0xcf,0x53,0xb5,0x97,0x19,0xe7,0x9e}, 276770, 588, 1048576, 1},
+    {{0x55,0xc3,0x3e,0xfb,0x51,0x45,0x68,0xc9,0x94,0x6c,0x4b,0x86,0x6c,0x16,0x0e,0xd1,0x90,0xfe,0x43,0x6f,0xae,0xe2,0x65,0xee,0x2f,0xb1,0x07,0xf7,0xfe,0x94,0xd5,0x24}, 277358, 580, 1048576, 1},
+    {{0x4b,0x69,0xd4,0x95,0x8e,0x09,0x9c,0x3b,0x3f,0x6a,0xe4,0x5e,0x15,0x3c,0xed,0x9b,0x24,0x75,0x5d,0x8c,0x16,0x1d,0xfe,0xe0,0x6c,0x9f,0x67,0x88,0x6a,0x7c,0x0f,0x09}, 277938, 538, 1048576, 1},
+    {{0x00,0xb5,0xb3,0xd3,0xfe,0xbd,0x1a,0x6f,0x28,0xce,0xb4,0x9e,0x39,0xcd,0xd9,0x47,0x6a,0x94,0x4f,0xe6,0x2e,0xa3,0x85,0x08,0x08,0xcd,0xea,0xfa,0xaa,0xa6,0x30,0x40}, 278476, 585, 1048576, 1},
+    {{0xf5,0x9a,0x0a,0x8e,0xd1,0x1e,0xa2,0xba,0x62,0x17,0xb1,0x64,0x0e,0x74,0xba,0xb8,0xd8,0xd8,0x16,0x1a,0x45,0x85,0xf5,0xae,0x4a,0x02,0xed,0xd7,0x95,0x8a,0xd9,0xa3}, 279061, 538, 2097152, 1},
+    {},
+    {{0x7b,0x2f,0xda,0xb9,0x72,0xe3,0x93,0x39,0x5f,0x53,0x79,0xd7,0xfb,0x13,0xe4,0x04,0x64,0xdb,0x15,0x2f,0x6a,0xcf,0x58,0xb2,0xd2,0xa6,0xa1,0x8f,0x81,0xce,0xfe,0xcb}, 279599, 587, 2097152, 1},
+    {{0x68,0x05,0x35,0xdc,0x1c,0x41,0x96,0xc5,0x3b,0x40,0xdc,0x9c,0x2c,0x9b,0xc1,0x59,0xa7,0x78,0x02,0xab,0x8d,0x4b,0x47,0x4b,0xef,0x5d,0xc0,0x28,0x1c,0x15,0xad,0x06}, 280186, 582, 1048576, 1},
+    {{0x82,0xe2,0xb6,0x36,0xe6,0x6c,0x4e,0xdb,0xae,0x27,0xa5,0xbe,0x91,0xa6,0x11,0x94,0xef,0x28,0x81,0xec,0x93,0xf4,0x0d,0x1d,0xe9,0x3a,0x61,0x53,0x61,0x7b,0x12,0xf2}, 280768, 512, 524288, 1},
+    {{0x39,0xbf,0xe8,0x28,0x57,0x1c,0xdb,0x23,0xe7,0xc8,0x5c,0x23,0xcf,0x5b,0x17,0x59,0x79,0xdc,0xc2,0x04,0x2c,0x58,0x41,0xad,0xd5,0x8f,0x5a,0xe6,0x49,0x21,0x68,0xa9}, 281280, 553, 1048576, 1},
+    {{0x04,0x08,0xe3,0xd9,0xf2,0x25,0x90,0x44,0x34,0x4a,0x3b,0xfb,0xd7,0xa7,0xca,0x3c,0x34,0x27,0xf8,0x21,0x08,0xfb,0xec,0xd6,0xe5,0xc4,0xc4,0x1e,0x80,0xcd,0x30,0x3b}, 281833, 536, 1048576, 1},
+    {},
+    {},
+    {{0x40,0x70,0xa7,0x70,0x2d,0xc5,0x06,0xa1,0xce,0xb6,0xf6,0x5b,0x5c,0x33,0x0b,0x3a,0x16,0x2d,0xf6,0xf0,0x17,0x35,0xc8,0xf2,0x06,0x93,0x4f,0xd4,0x7b,0x81,0x0e,0xd4}, 282369, 514, 524288, 1},
+    {{0xf7,0x53,0xde,0x4a,0x38,0xbd,0x83,0xf7,0xd9,0x37,0xfc,0x7b,0xf5,0x56,0x5a,0x3c,0x35,0x1a,0x79,0x4c,0x11,0x3d,0xea,0xd8,0xfd,0xee,0x6d,0x86,0xc8,0x56,0x33,0xe8}, 282883, 587, 1048576, 1},
+    {{0xdb,0x44,0xf8,0xb5,0x8a,0x31,0xb6,0x40,0xa4,0x7a,0xa4,0x39,0x01,0x01,0xc3,0xc6,0xa5,0xf6,0x13,0xe4,0xe4,0x9c,0x63,0x6d,0x44,0x78,0x62,0x78,0x03,0x3d,0xec,0x19}, 283470, 516, 1048576, 1},
+    {},
+    {},
+    {{0x4d,0xc2,0xb5,0xde,0x98,0xe9,0x10,0x95,0x83,0xd9,0xb6,0x1b,0x38,0xd2,0x6a,0x82,0x16,0xaf,0x4d,0xba,0x24,0x6e,0xf7,0x13,0x50,0x12,0x22,0x13,0x63,0x05,0x62,0xd0}, 283986, 514, 1048576, 1},
+    {{0x0a,0xf7,0xb0,0xd3,0x02,0x2a,0xcd,0x24,0xa1,0xfb,0x15,0x86,0x5a,0x07,0x65,0x19,0xf7,0xf5,0x6e,0x7a,0x4b,0x33,0xf1,0x2b,0x6d,0x85,0x1b,0x3a,0x91,0xe5,0x38,0x8c}, 284500, 481, 3145728, 1},
+    {{0xda,0xd9,0xc1,0x16,0x28,0x33,0x22,0xd5,0xa1,0x3f,0xd6,0x59,0x87,0x4c,0x68,0x15,0x82,0xab,0xdf,0xf3,0xdf,0x18,0x2c,0xc4,0xc9,0x05,0x11,0xd3,0x3f,0xb7,0x11,0x0a}, 284981, 532, 2097152, 1},
+    {{0x43,0xe3,0x6a,0x74,0xfb,0x73,0xa7,0xef,0xc4,0x6b,0x38,0x05,0x99,0xe2,0x69,0xb1,0xff,0xf8,0xf5,0x5e,0xcf,0x80,0xf5,0xcf,0x50,0xc3,0x4d,0x02,0xce,0xda,0x04,0x1a}, 285513, 496, 3145728, 1},
+    {{0x10,0xea,0xda,0xab,0x16,0x87,0x07,0x82,0x94,0x18,0x70,0x23,0x86,0xe1,0xbc,0xed,0xd2,0x61,0x9d,0x9b,0xbe,0xfc,0x37,0xcf,0x31,0xc4,0x11,0x83,0x13,0xbc,0xf6,0xde}, 286009, 502, 3145728, 1},
+    {{0xa2,0xc1,0x97,0x06,0x70,0xe2,0x83,0x1e,0x47,0xe2,0x4c,0xed,0x01,0xbf,0x4b,0xa5,0xab,0xa0,0x5c,0xac,0x37,0x73,0xbf,0x52,0x4c,0x62,0xd6,0x89,0xc3,0x56,0x87,0xe1}, 286511, 506, 1048576, 1},
+    {{0x7c,0x34,0xec,0xb1,0x6c,0x10,0xf5,0x51,0x12,0x0e,0xd7,0xb8,0x6c,0xfb,0xc9,0x47,0x04,0x2f,0x47,0x9b,0x52,0xee,0x74,0xbb,0x3c,0x40,0xe9,0x2f,0xdd,0x19,0x2b,0x3a}, 287017, 622, 2621440, 1},
+    {},
+    {},
+    {},
+    {{0x99,0xf4,0x0f,0x06,0xfa,0x4d,0xbe,0xee,0xa4,0xfe,0x67,0xd2,0xde,0x5b,0x4c,0x1b,0xf3,0x01,0xbe,0xda,0xc1,0x95,0x8b,0xa1,0xc2,0x39,0xdc,0xaf,0x39,0xb0,0xa9,0x98}, 287639, 533, 524288, 1},
+    {{0xd0,0xf4,0xa5,0x04,0x0e,0xcf,0x96,0xdc,0x49,0xaa,0x00,0x84,0x16,0x0e,0x29,0x1a,0x38,0xf2,0xee,0x75,0x31,0x97,0x50,0xdb,0x4d,0x66,0x87,0xab,0x36,0x82,0x8d,0xa9}, 288172, 542, 1048576, 1},
+    {},
+    {{0xb7,0x00,0x99,0x18,0x6d,0x37,0x74,0x35,0x5a,0xc5,0xdb,0x37,0x02,0x40,0xe3,0x70,0xc7,0x3f,0x9c,0xe5,0x34,0x1f,0x6c,0x80,0x5c,0xf9,0xf7,0x71,0x37,0x4b,0x43,0xae}, 288714, 599, 1048576, 1},
+    {},
+    {},
+    {},
+    {},
+    {{0x36,0xec,0x2f,0x40,0x9f,0x08,0xa0,0x8f,0x83,0x27,0x57,0x0e,0xad,0xcd,0x89,0x60,0xb6,0xa4,0x7b,0xf5,0x79,0x74,0x41,0xc2,0xdf,0x05,0xfc,0xc5,0x0c,0x5b,0x76,0x2b}, 289313, 518, 1048576, 1},
+    {{0xe9,0xfa,0xe4,0xc2,0xe1,0x71,0xa1,0xfc,0x4f,0x2b,0xd8,0x00,0xab,0xd9,0xe4,0x27,0x50,0xaa,0xf7,0xa4,0xdb,0x9e,0x40,0xc5,0xb9,0x14,0x2e,0x15,0x02,0x95,0x00,0xbd}, 289831, 553, 524288, 1},
+    {},
+    {{0x11,0x65,0x9b,0xd8,0xdd,0x62,0x0d,0x50,0x40,0x0d,0x16,0x04,0x2a,0xeb,0x2d,0x0d,0xdb,0x00,0xc7,0x18,0x3f,0xc1,0xec,0xb9,0x5b,0x1a,0x34,0xf0,0x7d,0xb0,0x43,0x1b}, 290384, 610, 1048576, 1},
+    {{0xdc,0x53,0x53,0xdd,0xc3,0x50,0x81,0x66,0x19,0x23,0x0f,0x25,0xf8,0xc5,0x1b,0xdd,0xab,0xf7,0x43,0x8e,0x6d,0xfb,0xa2,0x16,0x62,0xeb,0x1c,0x47,0x94,0x85,0x67,0x35}, 290994, 524, 262144, 1},
+    {{0x67,0x0d,0x89,0x8b,0xdc,0xf9,0x7d,0x7c,0xa3,0xaa,0xb6,0xc2,0xdd,0x16,0x41,0xf1,0x27,0x0f,0xcc,0x2a,0x07,0x0b,0xbd,0x30,0x28,0xab,0x41,0x3a,0xef,0x2b,0x2e,0xcc}, 291518, 551, 1310720, 1},
+    {{0x61,0x8a,0x23,0x63,0x6e,0x07,0x11,0x0e,0x09,0x42,0x77,0xec,0x1d,0x1e,0x60,0xc3,0x62,0x0a,0x6e,0x9a,0x5f,0x38,0x62,0x92,0x80,0x82,0x67,0x59,0x3f,0xa8,0x03,0xad}, 292069, 500, 4194304, 1},
+    {{0xe2,0x13,0x00,0xc8,0xc4,0x17,0x0e,0x08,0x4f,0xd8,0x3c,0xe4,0xc8,0x42,0xdd,0x73,0xf9,0x39,0xfb,0xd1,0x0d,0xdf,0xe4,0x7c,0x9a,0x49,0xb6,0xe2,0x91,0xdc,0xd5,0x2d}, 292569, 552, 1048576, 1},
+    {{0x70,0xde,0xa2,0x9a,0x92,0x8c,0x16,0x25,0xde,0xf3,0x1c,0x86,0x2d,0xc7,0x49,0x60,0xe3,0x9e,0x58,0x7e,0x41,0x6b,0x45,0x82,0x9e,0xfc,0x21,0xf1,0x3e,0xbd,0x96,0x30}, 293121, 516, 1048576, 1},
+    {},
+    {},
+    {},
+    {{0xc3,0xc4,0xaf,0xde,0xb6,0x71,0x36,0x61,0x9c,0x64,0x3b,0xd9,0xa9,0xf3,0xfe,0x90,0x33,0x75,0x41,0xa4,0x07,0x45,0x50,0x3b,0x5d,0x4e,0xb9,0xb9,0xe6,0xe6,0x4b,0x67}, 293637, 578, 1048576, 1},
+    {{0x45,0x7a,0xbe,0x63,0x4e,0x0a,0x8b,0xe0,0x3e,0x29,0x51,0x3a,0x3d,0xca,0x8f,0x3e,0x9d,0x0d,0xdc,0x6b,0xf9,0x7d,0x89,0x31,0xf2,0x31,0x60,0x94,0x26,0x0f,0x37,0x12}, 294215, 499, 3145728, 1},
+    {{0x4d,0x7f,0xc3,0x31,0xa8,0x11,0xb8,0xdc,0x63,0x0b,0x46,0x92,0x62,0xfd,0x6f,0x45,0xe2,0x89,0x24,0x3c,0xef,0x83,0x10,0x1f,0x32,0x03,0x81,0x58,0x96,0x7d,0x1b,0x28}, 294714, 693, 262400, 2},
+    {{0xbd,0xbc,0xc5,0x3b,0x26,0x61,0x59,0xb5,0xa0,0x8e,0x30,0x7e,0x5b,0x60,0xfd,0xb0,0xcb,0x5a,0x1b,0xa8,0xf8,0xc1,0xc6,0xc7,0xf8,0x9d,0x81,0xea,0xf5,0x13,0x3e,0x85}, 295407, 549, 1048576, 1},
+    {{0x49,0xa1,0xf9,0xf5,0xe6,0x08,0x4b,0x3d,0xaa,0x1b,0x13,0xab,0x5a,0x37,0xeb,0xe8,0xbd,0x3c,0xf2,0x0e,0x1c,0x74,0x29,0xfb,0xf7,0x22,0x29,0x80,0x92,0x89,0x3e,0x81}, 295956, 522, 524288, 1},
+    {{0xac,0xad,0x4c,0x59,0x4f,0x15,0x6e,0x0f,0x30,0xde,0xc2,0x53,0x2b,0x35,0xfc,0xb3,0xba,0xb8,0x00,0xe0,0x82,0x63,0x37,0x76,0x34,0xe2,0xd9,0x6d,0xfd,0x05,0x5f,0x3e}, 296478, 506, 1048576, 1},
+    {{0x3a,0xe7,0xbf,0xd3,0x8a,0x3d,0xc2,0x73,0xf4,0xd3,0x87,0xaf,0x3b,0x15,0x62,0x1b,0xee,0xfe,0xbf,0x50,0x56,0x73,0x1a,0xf0,0x6e,0x38,0x22,0xf5,0xe5,0x7d,0xb5,0xc5}, 296984, 878, 1101824, 3},
+    {{0x62,0x6f,0x1f,0xe5,0x2b,0x0d,0xf0,0xf8,0xed,0xe2,0x3f,0x00,0x62,0xcd,0x84,0x23,0x21,0xc8,0xda,0xbf,0x14,0xae,0xfd,0xca,0x12,0xe5,0x26,0x87,0x6e,0xcf,0x38,0x3a}, 297862, 522, 1048576, 1},
+    {},
+    {},
+    {{0x42,0xee,0x78,0x29,0xd3,0xdb,0x02,0x13,0xb7,0x18,0x16,0x8c,0x29,0x67,0x48,0x79,0xbb,0x45,0x32,0x57,0x3e,0x9f,0xb3,0x45,0x0a,0x5b,0x41,0x71,0x74,0xa1,0x6e,0xd0}, 298384, 520, 1048576, 1},
+    {{0x77,0x1a,0x03,0x22,0xd9,0xf5,0xf8,0xe1,0x3a,0x52,0xd0,0x1e,0x80,0x25,0x7a,0x1f,0x75,0xcc,0x69,0x3c,0xf4,0xab,0xf7,0x47,0x93,0x52,0x0e,0xb5,0xf8,0xb5,0x58,0x0e}, 298904, 531, 2097152, 1},
+    {{0x79,0x2e,0x61,0x5a,0x34,0xce,0xae,0x5a,0x1b,0x9a,0x4f,0x54,0xc5,0xa5,0xd9,0xb5,0x3e,0x39,0x29,0x93,0x32,0xfe,0xce,0x83,0xe4,0xbc,0xec,0xa2,0xc2,0x2e,0xfb,0x21}, 299435, 526, 1048576, 1},
+    {{0xc5,0x14,0xf8,0x55,0xad,0x37,0x72,0x42,0x58,0x29,0x52,0xee,0xe9,0x55,0x13,0xa2,0x15,0x2e,0xbb,0xf6,0xbb,0x5b,0x06,0xbd,0xf9,0xf0,0x31,0xfc,0x5a,0xc7,0x48,0xab}, 299961, 590, 1966080, 1},
+    {},
+    {{0x7f,0x05,0x95,0x9f,0x42,0x3b,0xc6,0x56,0x09,0x1e,0xa3,0xbd,0xdf,0xbc,0x89,0xc8,0x77,0xae,0x24,0x3d,0xca,0x34,0x6f,0x63,0x23,0x3e,0x27,0x97,0x3f,0x34,0xe0,0xeb}, 300551, 543, 2621440, 1},
+    {{0x67,0xfa,0xa6,0xed,0x34,0x06,0xa5,0xab,0x0d,0x72,0x24,0xb8,0x11,0xc0,0x96,0x0b,0xb3,0x65,0x60,0x04,0x0e,0xe9,0x59,0xbb,0x33,0x04,0xc9,0x29,0x3c,0xea,0xa0,0x93}, 301094, 537, 3145728, 1},
+    {{0x8f,0x38,0x7d,0x08,0x3d,0xe1,0x39,0x9b,0xb7,0x9e,0x53,0x12,0xc3,0x1a,0x6f,0x17,0x57,0xf2,0xa5,0x36,0xbf,0xa2,0x5c,0xec,0xf1,0xae,0xa7,0x7b,0xfd,0x77,0x05,0x8b}, 301631, 532, 1048576, 1},
+    {},
+    {{0xe0,0xfb,0xf7,0x31,0x55,0x02,0x66,0xd7,0x9a,0x0b,0x6c,0xa4,0x60,0xaf,0xd0,0x4c,0x8c,0x31,0x2f,0x70,0x23,0xb2,0xc9,0x88,0x2c,0x4f,0xc3,0xac,0xc3,0xe7,0x93,0x2f}, 302163, 556, 1048576, 1},
+    {{0x6a,0x59,0x11,0x5a,0x99,0x58,0xd4,0xa9,0xfa,0x16,0x70,0x95,0x50,0x5a,0x2d,0xdf,0x22,0x2c,0xa6,0x29,0x12,0x09,0xd0,0x76,0x18,0x31,0x9e,0x39,0xa2,0xbe,0x8b,0x61}, 302719, 592, 3145728, 1},
+    {},
+    {{0x32,0x8c,0x8f,0x57,0xe2,0xea,0x37,0x1f,0x6f,0xd5,0xb8,0xa9,0x83,0x4c,0x56,0xe3,0x5e,0xb3,0xbf,0xe7,0x10,0x50,0x2d,0xd8,0x0f,0x37,0x07,0x39,0xf9,0xcc,0xb7,0xe1}, 303311, 520, 1048576, 1},
+    {{0x0f,0x18,0xc4,0x96,0x42,0x6b,0xb9,0x7f,0xe5,0xe8,0xb9,0x1a,0xd5,0x29,0x9f,0x0b,0x1c,0x38,0x98,0xac,0x17,0x04,0x7b,0x74,0x5c,0x86,0xb1,0x67,0xc2,0x12,0xab,0x7a}, 303831, 512, 2097152, 1},
+    {{0x0e,0x83,0x46,0x47,0x66,0x97,0x83,0xc2,0xb7,0x9c,0xc1,0x12,0x0c,0x05,0x7c,0x87,0x0c,0x54,0x10,0x79,0xa7,0xab,0xd1,0xee,0xe3,0xf7,0x87,0xd5,0x9d,0xc3,0xc3,0xeb}, 304343, 543, 2097152, 1},
+    {{0xae,0x57,0x2a,0x51,0xeb,0xe4,0x29,0xcf,0xc0,0x6a,0x3b,0x75,0xd7,0xdb,0x95,0x81,0xf2,0x88,0x4f,0x9a,0xdc,0x78,0x82,0x7d,0xc1,0x62,0xb4,0xc4,0xdd,0xc6,0xce,0x2d}, 304886, 623, 1048576, 1},
+    {{0xcf,0xd6,0x66,0xf0,0xbb,0xab,0xec,0x59,0x61,0x3d,0x9f,0xe1,0x89,0xdb,0x7d,0x0a,0x06,0x0a,0x78,0x04,0x7b,0xc0,0x84,0xc0,0xc3,0x65,0x84,0x07,0x69,0x04,0x7b,0xf2}, 305509, 567, 1048576, 1},
+    {{0xa8,0xfe,0x22,0x26,0x72,0x80,0x02,0x78,0x6d,0x68,0xc2,0x7d,0xdd,0xdf,0x0b,0x90,0xa8,0x94,0xdb,0x52,0xe4,0xdf,0xe2,0x68,0xfd,0xf7,0x2a,0x68,0xca,0xe5,0xf0,0x2e}, 306076, 615, 3145728, 1},
+    {{0x59,0x65,0xbd,0xe4,0x49,0xff,0x77,0x5c,0x1a,0x0d,0x9f,0xd3,0xcf,0x2f,0xb8,0xc5,0x1a,0x86,0xb4,0x4a,0xd1,0x94,0x2d,0xfb,0x5c,0x14,0xa9,0x1f,0x10,0x3b,0xe0,0x30}, 306691, 538, 524288, 1},
+    {{0x0a,0x96,0x09,0xa5,0x05,0xdd,0x15,0x55,0x00,0x6b,0x16,0xf5,0x3d,0x96,0x1b,0x3c,0xe5,0x0c,0x51,0x8a,0xa1,0x59,0x7a,0x77,0xdc,0xd4,0x6e,0x55,0xec,0xc7,0x16,0xff}, 307229, 521, 1572864, 1},
+    {{0xc4,0x9b,0xe8,0x67,0xcd,0xd2,0x76,0x70,0x3a,0x3a,0xe4,0x6a,0x6b,0x17,0x67,0x3b,0x9e,0x35,0x9a,0xf4,0xf9,0xaf,0x23,0x29,0xc8,0xeb,0x74,0x71,0x20,0x24,0x58,0x17}, 307750, 579, 2097152, 1},
+    {{0xbf,0x74,0xc5,0x8e,0x41,0x90,0xfa,0xca,0x2f,0x3a,0x96,0x7d,0xc1,0x90,0xfe,0x52,0x9d,0x13,0x88,0x7d,0x12,0x62,0xb7,0x2e,0x05,0x7b,0x53,0x53,0xe4,0x3c,0xf6,0x7f}, 308329, 620, 2097152, 1},
+    {{0xd3,0x2f,0x19,0x4e,0x27,0xd1,0x77,0xe6,0x4b,0xf3,0xbd,0xa0,0x46,0x88,0x9b,0x81,0x98,0x27,0x6f,0xca,0x2e,0x87,0x72,0xe4,0xb0,0x2a,0x17,0x15,0x2e,0x92,0x73,0xe4}, 308949, 526, 1048576, 1},
+    {},
+    {{0xc6,0x46,0xb1,0xe6,0x0e,0x2c,0xd5,0xa2,0x74,0x19,0x15,0xf5,0xd3,0xdf,0xe3,0xc1,0x7f,0x45,0xff,0x72,0x83,0xf8,0x05,0x2e,0x84,0x0b,0xd4,0x35,0x4b,0x09,0x90,0xe1}, 309475, 539, 1048576, 1},
+    {},
+    {{0x7c,0x72,0x2f,0x99,0x41,0x95,0x76,0x30,0x46,0x7c,0x17,0x84,0xd0,0xeb,0x3f,0x92,0xfb,0xfc,0x0a,0x2a,0x1d,0xa3,0xc8,0xf5,0xc2,0x7f,0x59,0x3e,0xca,0x2a,0x5a,0x04}, 310014, 534, 2097152, 1},
+    {{0x1f,0x45,0x4f,0x2c,0xe1,0x6f,0xb9,0x6b,0xa0,0xb9,0x50,0xce,0xaa,0x09,0x8f,0xe6,0xea,0xbe,0xd9,0xe4,0xa0,0xe5,0x12,0x25,0x2d,0xeb,0xad,0x8f,0xa6,0xbc,0x5e,0xf5}, 310548, 548, 1048576, 1},
+    {},
+    {},
+    {},
+    {{0xc7,0x37,0x57,0xee,0xa2,0x58,0xe1,0x69,0xe5,0x06,0xea,0xef,0x98,0x92,0x27,0xa5,0x99,0x18,0x06,0x0f,0x94,0x11,0x79,0x17,0xf3,0x38,0x18,0x3d,0xb1,0x4c,0x50,0xb6}, 311096, 484, 2097152, 1},
+    {{0xc8,0xf1,0x59,0xe2,0x62,0x5a,0xc8,0x07,0x85,0x35,0xc0,0x68,0x57,0xea,0x28,0x47,0x57,0x06,0xda,0x45,0xdf,0x49,0x4d,0xe8,0xe4,0x6f,0x50,0x88,0x82,0x72,0xcf,0x71}, 311580, 518, 1048576, 1},
+    {{0x7c,0xc3,0x69,0x3c,0xc5,0xe1,0xe8,0x34,0xd5,0x77,0x95,0xf0,0x4b,0x04,0x8f,0xab,0x27,0x86,0x4a,0x89,0x8a,0x95,0x07,0xe7,0xca,0x38,0x37,0x71,0xe2,0x03,0x54,0x14}, 312098, 551, 1572864, 1},
+    {{0x85,0xe5,0xf6,0xfe,0xdc,0x42,0x09,0x25,0x55,0x70,0x92,0xd7,0x28,0xe1,0xdc,0x6b,0x4e,0x20,0x42,0x36,0x8f,0xb7,0x8b,0xf9,0x3c,0x0d,0xf4,0x47,0xf8,0xc9,0xc0,0xc0}, 312649, 514, 524288, 1},
+    {{0x72,0xb2,0xb3,0xbe,0xad,0x3f,0xcd,0x27,0xa1,0x61,0x0a,0xd5,0xd4,0xd8,0xbe,0x32,0x35,0xef,0xea,0xff,0x96,0xdf,0x2e,0x78,0x58,0x91,0x19,0x92,0xa5,0x89,0x2d,0x21}, 313163, 524, 1048576, 1},
+    {{0x5c,0x0b,0x52,0x66,0xa1,0x91,0x85,0x2c,0xa5,0x93,0x23,0x5f,0x07,0x18,0x0e,0x67,0x3c,0xb7,0x9e,0x3f,0x0b,0x0d,0xd3,0x1f,0x65,0x80,0x8e,0xef,0x83,0xbf,0x6e,0x90}, 313687, 574, 524288, 1},
+    {{0x7d,0x41,0x4b,0x7f,0x59,0x41,0xf1,0xed,0xdc,0x35,0x25,0x9a,0x22,0xac,0xcb,0xbb,0xd7,0xb4,0x7c,0x51,0x7d,0xfc,0xf8,0xba,0xd8,0x6c,0x4d,0xcf,0xa9,0xe5,0x0b,0x1e}, 314261, 552, 2097152, 1},
+    {{0x0d,0xeb,0x7a,0x91,0xfb,0xe5,0x84,0x8f,0x17,0x33,0xce,0x66,0x8d,0xaa,0xa4,0x9b,0x0d,0xad,0x3d,0x82,0x1b,0xac,0xc0,0x79,0x18,0x37,0xc1,0xba,0x15,0xe6,0x0d,0x7c}, 314813, 538, 1048576, 1},
+    {{0xc7,0xe7,0xdf,0x89,0x32,0xbf,0x00,0x56,0xaa,0x53,0x0f,0x3d,0xc3,0xc9,0x13,0xc1,0x17,0x1a,0x35,0x9a,0xf4,0xc1,0x97,0x09,0x4c,0x2b,0x97,0x29,0x46,0xdc,0x60,0x51}, 315351, 565, 1048576, 1},
+    {{0x19,0x07,0x42,0x79,0x2a,0x95,0x0a,0x11,0x2f,0x89,0x3c,0xba,0x0e,0x08,0x3e,0xb7,0x87,0xcf,0x24,0x29,0x3f,0x69,0x89,0x67,0xde,0xff,0xf9,0x29,0x63,0x5b,0xa0,0xe7}, 315916, 538, 1048576, 1},
+    {{0x05,0xeb,0x89,0x7d,0x76,0x96,0x55,0x57,0x90,0x59,0x1c,0x43,0x1c,0x9d,0x55,0xa4,0x3f,0xf9,0xa1,0xc1,0x21,0x62,0x44,0x3c,0x17,0xc5,0xfc,0xdd,0xfa,0x5e,0xb3,0xc5}, 316454, 522, 1048576, 1},
+    {{0x8c,0x43,0xb7,0xc2,0xf2,0xef,0x1f,0xca,0x92,0x37,0xc6,0x4c,0x2f,0x4c,0x9e,0x98,0xd1,0xa4,0x89,0x40,0xda,0xe5,0x00,0xce,0x8e,0xac,0x71,0x27,0x8d,0x34,0xef,0xb3}, 316976, 576, 1048576, 1},
+    {},
+    {{0x0b,0x3b,0x0f,0xd4,0x2b,0xbe,0x06,0xa8,0x12,0x05,0x3d,0xf3,0x76,0xb1,0x83,0x41,0x2f,0xc0,0xde,0x33,0x5c,0x4b,0x7c,0xb8,0xe4,0x5f,0x3f,0xe4,0x7b,0x00,0x44,0xe9}, 317552, 506, 1048576, 1},
+    {{0xdc,0x9c,0xef,0xb4,0xdd,0x50,0xdc,0xe2,0xe9,0xd6,0x26,0xac,0x71,0xd4,0xa0,0x63,0x06,0x51,0x6c,0xba,0x4b,0xc7,0x84,0xc9,0x0e,0x4a,0x30,0xfe,0x4e,0x7f,0xf4,0xef}, 318058, 536, 1048576, 1},
+    {},
+    {},
+    {{0x3c,0xe3,0x21,0x49,0x6e,0xdc,0x5d,0x77,0x03,0x8d,0xe2,0x03,0x4e,0xb3,0xfb,0x35,0x4d,0x77,0x24,0xaf,0xd0,0xbc,0x7f,0xd0,0x31,0x9f,0x3e,0xb5,0xd5,0x7b,0x98,0x4d}, 318594, 910, 1048576, 1},
+    {{0x18,0x69,0xc0,0xfa,0xf9,0x3b,0xf2,0x1b,0x7f,0xf9,0x65,0xf1,0x92,0x5f,0xad,0x4b,0x29,0x24,0xa6,0x4b,0x1e,0x48,0xf4,0x83,0x72,0x21,0xee,0xbd,0xf7,0x41,0x22,0x6c}, 319504, 522, 1048576, 1},
+    {{0x94,0x6d,0xe5,0x56,0xb4,0xf8,0x77,0xe5,0x4e,0x16,0xb5,0xc8,0x28,0xdb,0x89,0xc0,0x38,0xe5,0x03,0x49,0xcf,0xd0,0xdd,0xf8,0xea,0x96,0xb6,0x54,0x1f,0x9d,0x70,0xfa}, 320026, 522, 524288, 1},
+    {{0x51,0xc5,0x3e,0x36,0xed,0x0b,0x95,0x9b,0x06,0x95,0xfc,0x6e,0xf0,0x36,0xfa,0x73,0x02,0xd1,0xc9,0x95,0xec,0xa3,0x5c,0x28,0x26,0x1d,0x6f,0x3c,0xb7,0x7d,0xf0,0xca}, 320548, 530, 2097152, 1},
+    {{0x1a,0x79,0xd5,0x1a,0x2a,0xd7,0xdd,0x48,0x48,0x20,0x5a,0x07,0xff,0x8e,0x5d,0x87,0x3b,0x15,0x5d,0xc4,0x20,0xde,0x5e,0x52,0x15,0x8c,0x9b,0xab,0x93,0x5e,0x05,0xc3}, 321078, 514, 524288, 1},
+    {{0x63,0xab,0x79,0xe8,0x6e,0xa1,0x3e,0x2c,0xf9,0xbb,0x67,0xae,0xc9,0x71,0xfe,0xbb,0x68,0x45,0x0d,0xb9,0x86,0x5b,0x00,0xb5,0xf4,0x12,0x61,0x06,0x53,0x82,0x23,0x93}, 321592, 518, 1048576, 1},
+    {{0x09,0x45,0x55,0xd5,0x72,0x01,0x58,0xee,0x60,0xc9,0xd5,0xab,0x9a,0x13,0x11,0x01,0x92,0xdb,0x5e,0xbf,0x0f,0x6c,0xf6,0x9a,0xbb,0xb5,0x9a,0x00,0xbc,0x47,0x03,0x45}, 322110, 601, 1048576, 1},
+    {{0xd4,0x4f,0x48,0x7d,0x84,0xf5,0xbb,0x76,0x19,0x55,0xb7,0xb7,0x0a,0x54,0x64,0xb2,0xf0,0x94,0xe1,0x99,0x87,0x5f,0x59,0x5f,0x31,0x2c,0x88,0xe0,0x4a,0xc6,0x47,0xff}, 322711, 578, 1048576, 1},
+    {{0x5a,0xbf,0xb9,0x74,0xca,0x0e,0x56,0xaa,0xbb,0x3f,0x41,0x26,0x81,0x7d,0x14,0xa5,0x46,0xc5,0x7a,0x5a,0x5c,0x60,0x42,0xd3,0x11,0x96,0x06,0x3d,0x80,0x99,0x66,0x98}, 323289, 809, 1048576, 1},
+    {{0xcf,0x4d,0x60,0x3d,0xc0,0xa3,0x75,0x9d,0xa5,0x71,0x22,0x4c,0x67,0x1a,0x9b,0xfd,0x29,0xf9,0xe5,0x2c,0xa8,0xdb,0xb6,0x1b,0xcc,0x8a,0xc8,0xbe,0x54,0x81,0xe9,0xb2}, 324098, 525, 1310720, 1},
+    {{0x05,0x5d,0x9c,0x63,0x11,0xa6,0x63,0xaf,0x7c,0x89,0x9a,0x6f,0x76,0xa4,0x19,0xc2,0x74,0xc5,0x7b,0xaa,0xda,0x3e,0xf6,0x4c,0x52,0xfa,0xdb,0x1c,0x67,0x6b,0x14,0x46}, 324623, 516, 1048576, 1},
+    {{0xcc,0x33,0xae,0x02,0x11,0x4e,0xa1,0x8a,0x86,0x59,0x2d,0xe3,0x27,0xb2,0xb4,0xbc,0xc8,0x07,0x28,0xb1,0x1a,0x5e,0x4c,0x61,0x66,0x6d,0xca,0x71,0x48,0x0d,0x41,0x69}, 325139, 525, 1572864, 1},
+    {},
+    {{0x9b,0xf8,0x84,0xbe,0x56,0x27,0xd3,0x8f,0x06,0x0a,0xd7,0xf3,0xa6,0x1e,0xa1,0xfe,0xa1,0x47,0x4d,0x41,0x6e,0x1d,0x03,0x7d,0x33,0x01,0x4c,0xa9,0xd5,0x20,0x5c,0x1d}, 325664, 524, 1048576, 1},
+    {{0x5e,0x58,0x0f,0x22,0x0e,0xd1,0x62,0x81,0xdf,0x8e,0xe9,0xa5,0xf4,0x50,0xb5,0x53,0xf3,0x9f,0x8c,0x40,0x78,0xd3,0xf3,0x04,0x8d,0x66,0xbd,0xa1,0x5f,0x98,0xe1,0x9f}, 326188, 512, 524288, 1},
+    {{0xc7,0xb1,0x70,0x6a,0x0e,0xe9,0x6f,0x3e,0x0d,0x65,0xcd,0x04,0x3c,0x05,0x96,0x6b,0xfe,0x3d,0x5c,0x57,0xd0,0x8b,0xbd,0x2d,0xf3,0x11,0x88,0x17,0x42,0x4a,0xdf,0x82}, 326700, 494, 1048576, 1},
+    {{0x08,0xd8,0x08,0xe9,0xc5,0x85,0x1e,0x43,0x01,0xa3,0x8a,0x56,0xb3,0x50,0xa2,0x0e,0xa9,0xe3,0xad,0xbe,0xf5,0x15,0x46,0xe8,0x7e,0x17,0x85,0xd6,0x91,0xd0,0xf2,0xd5}, 327194, 554, 524288, 1},
+    {{0x45,0x79,0xe4,0x37,0x27,0x9f,0x79,0xee,0xdd,0x6b,0x9c,0xf6,0x48,0xa8,0x14,0xdf,0x2a,0xb2,0xc8,0x3d,0x93,0x7a,0x1b,0xce,0xc1,0x57,0x8d,0x28,0x96,0x5f,0xb9,0xa0}, 327748, 493, 3145728, 1},
+    {{0xc5,0x47,0x4d,0xe3,0x59,0x2e,0x2a,0x99,0xaa,0xc0,0xe5,0x51,0x15,0x16,0x65,0x8f,0x9f,0x0b,0x50,0x16,0x7c,0x75,0x4a,0x01,0x84,0x09,0x84,0x2e,0xc3,0x5b,0xcd,0x45}, 328241, 784, 524288, 1},
+    {},
+    {{0xbd,0x76,0x3c,0x1a,0x56,0x36,0x5c,0x24,0x4b,0xe9,0x2e,0x6c,0xff,0xef,0xd3,0x18,0x78,0x0a,0x2a,0x19,0xed,0xa7,0xd5,0xba,0xf1,0xc6,0xd5,0xbd,0x6c,0x1b,0x3e,0x06}, 329025, 807, 2097152, 1},
+    {{0xcd,0x01,0x6c,0x41,0xc7,0xef,0x9f,0x4f,0x24,0x3d,0x57,0xc2,0xb1,0x56,0x4b,0x4c,0xeb,0x3b,0x4c,0x38,0xcc,0x16,0x5c,0xd0,0x2a,0xb6,0xc8,0xe3,0x5c,0x93,0xaa,0x2e}, 329832, 514, 1048576, 1},
+    {{0x40,0xb4,0x6b,0xb2,0x97,0x85,0xfb,0x43,0x1b,0x32,0x5f,0x22,0x37,0x7f,0xaa,0x8b,0x09,0x9b,0xe4,0xd7,0x7a,0xec,0xc1,0xf0,0x30,0x00,0xb8,0xa4,0xcb,0x58,0x9b,0x63}, 330346, 528, 1048576, 1},
+    {{0xa4,0xce,0xb3,0x1b,0x82,0xea,0x53,0x2e,0x6e,0xb6,0x40,0xfa,0x2e,0xda,0x61,0x62,0x57,0x58,0xe7,0x22,0x51,0xef,0xa5,0xf0,0xae,0x9a,0x98,0x4f,0x4a,0x98,0xa8,0xa0}, 330874, 524, 1048576, 1},
+    {{0x8b,0x12,0xe5,0xe4,0x55,0x3f,0xc9,0x21,0xc2,0x37,0x39,0xd1,0xae,0xc2,0xed,0x51,0x75,0x35,0xec,0x23,0x9d,0xae,0xf8,0x00,0xf3,0x9f,0x60,0x2d,0x84,0x73,0x84,0x7f}, 331398, 551, 1048576, 1},
+    {{0x89,0xd5,0x7b,0xf3,0x08,0x03,0x3e,0xf1,0x7f,0x77,0x0a,0x80,0x08,0x0c,0xbe,0xed,0x2d,0x11,0x22,0x44,0x63,0x5d,0x5b,0x5f,0x86,0x0f,0x20,0x16,0x39,0x8c,0xd2,0xf6}, 331949, 512, 524288, 1},
+    {},
+    {{0x3a,0x16,0xad,0x45,0xae,0x3d,0x89,0xb1,0x3c,0x9e,0x53,0xe2,0x1c,0x2a,0x4c,0x72,0x5f,0xf7,0xce,0xc7,0xfb,0xe7,0x89,0x6d,0x53,0x8d,0x16,0x3f,0x92,0xcb,0x4a,0xac}, 332461, 597, 1048576, 1},
+    {{0x67,0xfa,0x71,0x15,0xeb,0x6b,0xf2,0x92,0xc0,0x24,0xc3,0xa8,0xb0,0x6c,0xe9,0xbd,0x45,0x7c,0x4d,0x46,0xde,0x18,0x2a,0x06,0xa5,0x73,0xaf,0xff,0x96,0x8c,0xc0,0xf1}, 333058, 547, 2097152, 1},
+    {},
+    {},
+    {{0x54,0x9f,0x2e,0x5b,0x17,0xf6,0x85,0xca,0xd2,0x5b,0xa7,0x1c,0xe7,0xbc,0x6e,0x00,0x4e,0x7b,0xfd,0x09,0xe6,0xbe,0x12,0xa8,0x27,0xaf,0x9a,0x9a,0x26,0x55,0x6f,0xff}, 333605, 536, 1048576, 1},
+    {{0xb0,0xdb,0xd4,0xd7,0xe5,0x68,0x9c,0x32,0x23,0x4e,0x80,0xb0,0xc5,0x36,0x2e,0xf6,0x7c,0x42,0x5a,0xb7,0x2d,0x6d,0xdb,0x49,0xd1,0xcb,0x11,0x33,0xef,0x63,0x0e,0xf7}, 334141, 554, 1048576, 1},
+    {{0x7f,0xe4,0xcb,0x9c,0x29,0x4d,0x66,0x58,0x9f,0xf7,0x8e,0x22,0x57,0x74,0x47,0x1e,0xcb,0x7d,0xb8,0x0d,0xf2,0x5f,0x2b,0x61,0x99,0xca,0x25,0x67,0x13,0x58,0x07,0x2b}, 334695, 522, 1048576, 1},
+    {{0xde,0x2d,0x5a,0x95,0x20,0x96,0xc5,0xf5,0x03,0x68,0xb9,0x27,0x0d,0x34,0x2a,0xa6,0xe7,0xa3,0x90,0x07,0xff,0xbe,0xc2,0x71,0x17,0xe1,0x82,0xe3,0x0e,0xf4,0xcf,0x32}, 335217, 640, 1572864, 1},
+    {{0x91,0xf9,0x38,0xb4,0x98,0x92,0x15,0xb1,0xcd,0x39,0x63,0x57,0x97,0xf2,0x3b,0x59,0xb9,0xd7,0xb6,0xd3,0x6e,0x58,0x3f,0x9e,0xb6,0x9d,0x02,0x2a,0xbe,0x53,0x7b,0xfc}, 335857, 520, 524288, 1},
+    {},
+    {{0xbf,0x16,0xc3,0xc8,0x67,0xc5,0x8e,0x2a,0xb0,0x61,0xc7,0x0d,0xe9,0x29,0x5b,0x69,0x30,0xd6,0x3f,0x29,0xf8,0x1c,0xc9,0x86,0xf5,0xec,0xae,0x03,0xe0,0xad,0x18,0xd2}, 336377, 558, 524288, 1},
+    {{0xd4,0xca,0xa6,0x68,0x3e,0xe1,0xb6,0xc7,0x0c,0x10,0xfd,0x05,0x55,0xad,0xe3,0x3d,0xad,0xcc,0x65,0x51,0xd9,0x4e,0x79,0x15,0x86,0xe6,0x4f,0xd6,0x83,0xd8,0xf3,0xa8}, 336935, 522, 524288, 1},
+    {},
+    {{0xd5,0x0a,0xaa,0x41,0xe1,0x53,0xca,0x35,0x6e,0xee,0x16,0xa9,0xde,0xcc,0xb1,0xa7,0x63,0xee,0x56,0xeb,0xbe,0x6c,0x80,0xcd,0x28,0xc5,0xad,0x1d,0xb6,0x6a,0x53,0x16}, 337457, 528, 1048576, 1},
+    {{0xd0,0x9c,0xa5,0xad,0xae,0xe6,0x5c,0xfd,0x68,0x67,0x42,0x48,0x2b,0xc5,0x5b,0x1a,0x3c,0xe9,0xbc,0x5e,0xbe,0xd6,0x1f,0x24,0xc5,0x63,0x15,0x55,0x15,0x1a,0x7f,0xc7}, 337985, 520, 1048576, 1},
+    {},
+    {{0x00,0x77,0x35,0xe6,0x8a,0x91,0xca,0xb4,0x03,0xf1,0xc9,0x55,0xd9,0xd5,0x62,0xe9,0x31,0x11,0x24,0xe6,0x60,0xfa,0x5b,0x32,0xe5,0xc5,0xd0,0xa2,0xe0,0x52,0x16,0x0e}, 338505, 520, 262144, 1},
+    {{0xe1,0x00,0x70,0xf0,0x18,0x45,0x50,0x5a,0xe8,0xbf,0xdf,0x7b,0x5b,0x49,0x2e,0x72,0x09,0xc2,0xae,0x87,0x6f,0x16,0x9f,0xb6,0xff,0x42,0x0d,0xea,0x26,0x9f,0x4d,0xa3}, 339025, 567, 524288, 1},
+    {{0x6b,0x69,0x21,0xd7,0xab,0xa9,0xba,0x35,0x3e,0x96,0xe3,0x9c,0x8d,0x79,0xd2,0x4e,0xef,0x1b,0x84,0xeb,0x5c,0x7f,0xa5,0x4e,0xda,0xa8,0x3d,0x24,0x47,0xdc,0xd9,0x54}, 339592, 589, 1048576, 1},
+    {{0x0f,0x98,0x4d,0xc5,0xfe,0x82,0x93,0xf7,0x5e,0x3b,0x8f,0xad,0x98,0xb0,0xcb,0x56,0x47,0x06,0xd9,0xb1,0xe3,0x90,0x2b,0x56,0x41,0x5a,0xa3,0x99,0xc2,0xd4,0xdf,0x2b}, 340181, 593, 1048576, 1},
+    {{0xd7,0x11,0x0d,0xdc,0x0b,0x34,0xaa,0x4e,0xcd,0x5e,0x55,0xf7,0xb8,0x46,0x65,0x7e,0xdb,0x98,0x2d,0xb8,0x2c,0xf0,0xba,0x34,0x0f,0xe0,0x46,0x4d,0xaf,0x0c,0xa9,0xbe}, 340774, 544, 524288, 1},
+    {{0xe5,0x98,0x0b,0x99,0x06,0x05,0xa9,0xc9,0x1f,0xa8,0x91,0x01,0xc4,0x40,0xb2,0xec,0x99,0x93,0x32,0x92,0x96,0xba,0x09,0xa9,0x53,0x80,0x42,0xd7,0x24,0xa0,0x80,0xfb}, 341318, 520, 1048576, 1},
+    {{0x05,0xe9,0x40,0x4b,0xfe,0x06,0x89,0xe4,0x84,0xa3,0x49,0x91,0xf2,0x27,0x12,0xc9,0xda,0x71,0x8c,0xf0,0x00,0xb0,0xf7,0x48,0x37,0x8a,0xf5,0x75,0x8b,0x65,0x4a,0x3d}, 341838, 666, 1048576, 1},
+    {{0x60,0xcc,0xa2,0x59,0x2d,0x07,0x56,0xb8,0xc4,0xc7,0xa0,0xa2,0x54,0xfa,0xfa,0x5a,0xc4,0x7a,0xa7,0x52,0x52,0x1f,0xd1,0xf7,0x7d,0xcb,0xf4,0xb6,0xee,0x1b,0xee,0x90}, 342504, 520, 1048576, 1},
+    {{0xcc,0xe4,0x55,0xb7,0x07,0x4f,0x62,0xff,0xdb,0x41,0x86,0x3e,0xe8,0xc1,0x60,0xea,0x06,0xf7,0xac,0xd0,0x28,0x83,0x76,0x66,0x32,0x9b,0xc1,0xe0,0xc3,0x56,0x7a,0xd0}, 343024, 690, 1572864, 1},
+    {{0x76,0xb2,0x70,0x2c,0x4b,0xe8,0xb6,0x68,0xc1,0x01,0x7f,0x28,0x17,0xc2,0x80,0x28,0x3c,0x27,0x5e,0xaa,0x41,0x53,0x5b,0xf6,0xff,0xa2,0xb8,0xd2,0x22,0x0b,0x68,0xc6}, 343714, 518, 1048576, 1},
+    {},
+    {{0x86,0x4a,0xa9,0x06,0x8f,0xb2,0x3c,0xd2,0x00,0x22,0xa9,0xac,0x36,0xfb,0x90,0x82,0x29,0x92,0x78,0xea,0x0c,0xb0,0x7a,0x20,0xde,0xec,0x2b,0x6a,0x1c,0x6c,0xbc,0x70}, 344232, 522, 524288, 1},
+    {{0x06,0x63,0x33,0x0b,0xc0,0x61,0xf4,0xb7,0x68,0xfa,0x18,0x06,0x61,0x08,0x78,0xef,0x6e,0x6c,0xf5,0x46,0xf3,0x60,0x41,0xae,0x08,0x7c,0x8e,0x55,0x70,0x36,0x93,0xb8}, 344754, 567, 1048576, 1},
+    {{0x22,0xd2,0x26,0x0d,0xe0,0x25,0x52,0xb1,0x20,0x5a,0xac,0x2f,0xf5,0xa2,0x02,0xa4,0xc8,0x05,0x32,0xac,0x28,0x04,0x5e,0xf5,0xa0,0x58,0xd8,0x82,0x79,0xab,0x75,0x8e}, 345321, 528, 2097152, 1},
+    {{0x20,0x58,0x90,0xf9,0x4e,0x27,0xe7,0xc1,0xb3,0x81,0x12,0x4c,0xc3,0x5c,0x86,0x63,0x51,0xba,0xfa,0x90,0x63,0x83,0xe5,0x07,0xcd,0x17,0xcc,0xb9,0xd1,0xb6,0x8f,0xfd}, 345849, 556, 524288, 1},
+    {{0xd3,0x22,0xce,0x44,0x00,0x76,0xbe,0x0e,0x36,0x78,0x27,0x75,0x96,0xac,0xee,0x80,0x89,0x09,0x8f,0x43,0x97,0xb3,0x5a,0xc8,0xb3,0xdf,0x88,0xbe,0x5c,0xe5,0xe0,0x2f}, 346405, 568, 1048576, 1},
+    {{0xca,0x98,0x89,0xf1,0x7f,0x18,0x4b,0x3d,0x99,0xa2,0xea,0xaa,0x82,0xaf,0x73,0xe3,0x66,0xf0,0x3e,0xd0,0x03,0x13,0xfd,0xd3,0x69,0xe5,0xe0,0x23,0xb2,0x08,0xe7,0x88}, 346973, 512, 524288, 1},
+    {{0x88,0x08,0x78,0x3f,0x78,0x9c,0xa6,0x41,0x33,0x64,0xa7,0xab,0xea,0x24,0x0f,0x6f,0x72,0x91,0xb5,0x90,0x60,0x26,0xf3,0x60,0xba,0x8c,0xfd,0xd2,0x79,0x1f,0xc1,0x79}, 347485, 506, 1572864, 1},
+    {{0x48,0xa3,0xac,0x52,0xe2,0xc9,0x12,0x8a,0xbc,0x2d,0xc6,0x0e,0x07,0x81,0x7a,0x51,0x89,0x8e,0x8a,0x93,0xbe,0x0d,0x51,0xd6,0xf5,0x41,0xa8,0x63,0x52,0x63,0xa0,0x89}, 347991, 529, 1572864, 1},
+    {},
+    {{0xa4,0xba,0x14,0x83,0xdb,0x79,0xc3,0xf6,0x27,0x80,0x82,0x38,0x7b,0xce,0x21,0x6d,0x8f,0x3e,0x3b,0x11,0xca,0x32,0xd4,0x95,0x16,0xd2,0x7f,0x5a,0xc0,0x71,0x35,0xa5}, 348520, 516, 1048576, 1},
+    {},
+    {},
+    {{0x85,0x9e,0xc9,0x9f,0xdc,0x25,0xdd,0x9b,0x23,0x9d,0x90,0x85,0xbf,0x65,0x6e,0x4f,0x49,0xc9,0x3a,0x32,0xfa,0xa5,0xbb,0x24,0x8d,0xa8,0x3e,0xfd,0x68,0xeb,0xd4,0x78}, 349036, 571, 2097152, 1},
+    {{0x72,0x41,0x44,0xe3,0x49,0x90,0x06,0x92,0x13,0x59,0x1b,0x5d,0xf0,0x67,0xdd,0x43,0x7a,0x61,0x3b,0x30,0xf6,0x69,0x84,0x0e,0x90,0x98,0xdb,0x1d,0xce,0x62,0x6d,0x2d}, 349607, 782, 532480, 3},
+    {},
+    {{0xab,0x3d,0x97,0xc1,0xa3,0xa9,0x79,0xe1,0x68,0x0a,0x42,0x8e,0xc6,0x5d,0xf5,0x4c,0xfb,0x72,0x99,0x7b,0xbf,0xe2,0x17,0x32,0x92,0x24,0x8a,0x4f,0xa8,0xc5,0x1b,0xa1}, 350389, 528, 1048576, 1},
+    {},
+    {{0x6f,0x0b,0xec,0x87,0xec,0xe5,0x03,0xb0,0xfb,0xe1,0x08,0xcd,0x15,0x9e,0xd6,0xf5,0xfa,0x77,0x11,0xb1,0xc4,0xfe,0x31,0xe9,0x82,0xaf,0x41,0xad,0x5c,0x63,0x80,0x93}, 350917, 569, 1048576, 1},
+    {{0xbd,0x70,0x74,0xef,0x4a,0x05,0xd7,0x90,0x64,0x6a,0xbe,0x14,0x5f,0xfd,0x25,0x87,0xfb,0x48,0x04,0x4e,0x4b,0x73,0x02,0x86,0xd8,0x07,0xab,0xe1,0x02,0x84,0x11,0x77}, 351486, 522, 1048576, 1},
+    {{0x7b,0xff,0xa1,0xdc,0x31,0x60,0x4f,0xa3,0xd6,0x1e,0x06,0xce,0x2c,0x59,0x16,0x80,0x98,0xcc,0x8d,0xd7,0xe5,0x99,0x98,0xe1,0xd5,0xf3,0x0c,0x49,0xbd,0xf8,0xd6,0x17}, 352008, 504, 1572864, 1},
+    {{0x26,0xff,0x14,0x3c,0x2f,0x1a,0x4a,0x16,0xca,0x83,0x8c,0xc4,0xb5,0x55,0x5e,0x39,0xbb,0xe7,0x20,0x85,0x15,0xdc,0xa8,0xf1,0xc4,0xb1,0xa0,0x0d,0xec,0x61,0xcf,0x09}, 352512, 587, 1572864, 1},
+    {{0xc7,0x06,0xb7,0x00,0x97,0xc6,0x79,0xf6,0xf0,0xce,0xd6,0xf7,0x7a,0x30,0x62,0x08,0x07,0xd0,0xb2,0x55,0x5f,0xc3,0xc6,0x83,0xc0,0xec,0x2f,0xc7,0x91,0x17,0x60,0x39}, 353099, 578, 1572864, 1},
+    {},
+    {{0xa3,0xb1,0xca,0xe3,0xfe,0x55,0xfe,0x52,0xc0,0x35,0xab,0x12,0x2e,0x7f,0x85,0x06,0x40,0xb0,0x93,0x55,0x24,0x49,0x6d,0x45,0xb1,0x91,0x5c,0xa3,0xc8,0xa9,0x34,0xf4}, 353677, 577, 2097152, 1},
+    {{0x15,0x76,0x06,0x6e,0x0c,0xb7,0x71,0xa9,0x1c,0xaf,0x79,0xe7,0xd4,0xf6,0xdc,0x00,0xeb,0x0d,0xaa,0x47,0xf0,0x78,0x6f,0x16,0x04,0xb3,0x25,0x37,0x42,0x9a,0x7f,0x45}, 354254, 576, 1048576, 1},
+    {},
+    {{0xfc,0x99,0x3c,0x12,0x20,0x79,0xb9,0x4e,0xbc,0x9b,0x94,0x52,0xb4,0x6a,0x55,0xd5,0xdd,0xcd,0x37,0x15,0xa4,0xb9,0x7a,0xf7,0x95,0x22,0x2b,0x26,0x48,0x27,0xe9,0x0f}, 354830, 550, 1048576, 1},
+    {},
+    {},
+    {{0x85,0x46,0xdf,0xc9,0x1f,0x62,0x56,0xdf,0x8b,0x21,0x08,0x35,0x31,0x45,0x7e,0x3e,0xdf,0x00,0x21,0xda,0x12,0xfc,0xe6,0x85,0x8e,0x2c,0x59,0xff,0x23,0x9c,0x31,0xda}, 355380, 563, 524288, 1},
+    {{0x0a,0x4b,0x4a,0x78,0x3a,0x7f,0xaf,0x6a,0xda,0x3e,0x13,0x26,0xec,0xf8,0x5d,0xe7,0x7e,0x8c,0x2a,0x17,0x16,0x59,0xb4,0x2a,0x78,0xa1,0xfa,0xe4,0x3f,0x80,0x6c,0xa6}, 355943, 502, 1048576, 1},
+    {{0x1d,0x65,0x73,0xe3,0xdb,0x2e,0xfa,0xb0,0xc9,0x8d,0x19,0x40,0xb4,0x17,0x1d,0x56,0x93,0x48,0xd2,0x7a,0x1c,0xc2,0x0e,0x80,0xa8,0x30,0x94,0xe6,0xc0,0xe6,0x6e,0x35}, 356445, 528, 524288, 1},
+    {{0x87,0x96,0xca,0x4d,0xe3,0xae,0xff,0xd3,0xa4,0x94,0xfe,0x28,0xe7,0xd7,0xe2,0xae,0xb2,0x20,0xca,0x65,0x2b,0x43,0x68,0x4f,0x29,0xe2,0xcc,0x94,0xf0,0x2c,0x20,0xc4}, 356973, 506, 1048576, 1},
+    {{0xfd,0xd7,0x63,0xdf,0xfc,0x6f,0xb3,0x89,0x75,0xd4,0xc6,0xd6,0xe3,0x12,0x3f,0x97,0x38,0x12,0x27,0x81,0xb7,0xd1,0x3e,0x1f,0xc7,0xf9,0x82,0x04,0x64,0xcb,0xae,0xb5}, 357479, 597, 524288, 1},
+    {{0x63,0x21,0x0a,0x91,0x57,0x3f,0xa8,0xe1,0x95,0x92,0xf2,0xe6,0xc7,0x46,0xa4,0x00,0x83,0x1d,0x80,0x4c,0x00,0x45,0x37,0x39,0x44,0x7d,0x2d,0xf3,0x2e,0x73,0x1d,0xf7}, 358076, 571, 1048576, 1},
+    {{0x0f,0x51,0xb4,0xfc,0xa4,0x1b,0x7f,0xd5,0x09,0xe4,0xb8,0xf9,0xd5,0x43,0x15,0x1f,0x68,0xef,0xa5,0xe9,0x7b,0x08,0x49,0x3e,0x4b,0x2a,0x0c,0x06,0xf5,0xd8,0xd5,0xe2}, 358647, 623, 3145728, 1},
+    {},
+    {},
+    {},
+    {{0x9e,0x6e,0xbe,0xbc,0xf1,0x46,0x09,0xc2,0xa3,0x8a,0x5f,0x44,0x09,0xd0,0xc8,0xc8,0x59,0x94,0x9c,0xde,0xd7,0x0c,0x5b,0x6f,0xd1,0x6f,0xd1,0x5d,0x99,0x83,0xd9,0xd3}, 359270, 507, 1048576, 1},
+    {},
+    {{0xdf,0xad,0xa6,0x5f,0x44,0x97,0xf4,0x82,0xd5,0xf8,0x19,0x64,0x32,0x2d,0x99,0x52,0xf6,0x78,0xf5,0x0e,0x65,0x41,0x8d,0x30,0x7d,0x45,0x03,0xf9,0xbf,0x9a,0x32,0xd9}, 359777, 822, 1056768, 3},
+    {},
+    {},
+    {{0x06,0xdb,0x3b,0xe5,0x69,0xa5,0x87,0xd7,0x9b,0x51,0xbf,0xc6,0x84,0xfd,0x2e,0xbd,0xea,0x97,0x78,0x63,0x87,0x5a,0xed,0xec,0x88,0x21,0x8f,0xbb,0x41,0x69,0xc2,0x1b}, 360599, 551, 1048576, 1},
+    {{0x6e,0x2a,0x02,0xa8,0x94,0x4c,0x19,0xdb,0x3d,0xa7,0x6d,0x26,0x46,0xf2,0x32,0xfb,0xe3,0xed,0x03,0x9b,0xc7,0xd4,0x4c,0xc0,0x39,0x10,0x81,0x4f,0xa7,0x7a,0x7a,0xcf}, 361150, 552, 524288, 1},
+    {},
+    {{0x32,0xd0,0xf1,0xca,0x5b,0x91,0xfd,0x9b,0x2c,0xaf,0x81,0x42,0x2f,0xb9,0xe8,0xfb,0x30,0xbc,0x09,0x1f,0x0b,0x2a,0x42,0x9b,0x92,0x69,0xdd,0x30,0x7f,0xcb,0xa4,0xfd}, 361702, 480, 3145728, 1},
+    {},
+    {},
+    {{0x32,0xad,0xc0,0x48,0xfd,0x89,0x22,0x8a,0x43,0x10,0xc0,0x3d,0xf2,0x43,0xe8,0x3d,0xe7,0xd4,0x36,0xcd,0xb2,0x46,0x0b,0x4c,0xc8,0x3a,0xde,0x20,0xd3,0x59,0xb2,0xbd}, 362182, 621, 2097152, 1},
+    {{0x77,0xb2,0xd5,0x45,0x0c,0xe3,0xc8,0x71,0x85,0xf9,0x13,0xc2,0x58,0x46,0x73,0x53,0x0c,0x13,0xdf,0xbe,0x8c,0xc4,0x33,0xb1,0xe9,0xfe,0x5e,0x9a,0x65,0x3b,0xf7,0xd5}, 362803, 764, 6291456, 1},
+    {{0x5c,0x7b,0x28,0xbb,0x24,0xba,0xd6,0x97,0x15,0x6a,0xd4,0x44,0xff,0x23,0xbd,0x15,0xad,0x67,0x44,0xdb,0xf9,0x89,0x9b,0x3c,0xcc,0xf2,0xaa,0x36,0xd5,0x59,0xd8,0x25}, 363567, 637, 1048576, 1},
+    {},
+    {{0xd7,0x27,0x1c,0xa0,0x84,0x00,0xbb,0xf5,0xae,0x16,0x5b,0x0a,0xaa,0x6e,0x8a,0x8a,0x1b,0x26,0x6f,0x72,0xe6,0xe0,0xae,0x10,0xaa,0xe5,0x29,0x73,0x2a,0x47,0x2f,0x7c}, 364204, 538, 1048576, 1},
+    {},
+    {},
+    {},
+    {{0xad,0x31,0xb9,0x4c,0xe9,0x28,0xec,0xff,0x60,0x5e,0x2b,0x89,0x08,0x21,0x54,0x67,0x16,0x91,0x50,0x9e,0x95,0xd3,0x83,0x70,0xed,0x38,0x14,0x37,0xf2,0xc3,0x66,0x98}, 364742, 518, 1048576, 1},
+    {{0x29,0xc2,0x81,0x88,0x23,0x4d,0xdb,0xb0,0xb7,0x2f,0xc8,0x42,0x53,0xdc,0xd3,0x51,0x4e,0x23,0x03,0x47,0x79,0xc7,0x73,0xdb,0x80,0x97,0xb0,0x73,0xb7,0x33,0x90,0xc8}, 365260, 554, 2097152, 1},
+    {{0xca,0x2f,0x86,0xca,0x77,0xf8,0x22,0xfc,0xd8,0xe8,0x6f,0x5a,0x28,0x7f,0x2a,0x76,0xd0,0xbe,0xcb,0xb8,0x1a,0x7b,0xce,0x73,0xae,0x22,0x90,0x9b,0xeb,0x2f,0x83,0x4c}, 365814, 496, 3145728, 1},
+    {},
+    {{0x21,0xcd,0x6d,0x74,0x96,0x74,0xc5,0x53,0x42,0xf5,0xf1,0xa8,0x95,0x64,0x2d,0x4b,0x58,0xb9,0xbd,0x7e,0xb2,0x11,0xf5,0xdf,0x3a,0x35,0xdc,0x6c,0x2f,0x5d,0x45,0x01}, 366310, 540, 2097152, 1},
+    {{0x81,0x1c,0xbc,0x32,0x87,0xc0,0x95,0x9e,0x8e,0xb2,0x42,0xe8,0x17,0x68,0x4d,0x36,0xde,0x66,0x4e,0xbe,0xbc,0x58,0x73,0xa1,0xfa,0x99,0x58,0x69,0x38,0x57,0xc4,0x38}, 366850, 587, 2097152, 1},
+    {},
+    {{0x80,0xc2,0x2c,0xc9,0x2d,0x51,0xa5,0x4d,0xe9,0xcd,0x9f,0xd0,0x0d,0xb5,0xff,0x58,0xa3,0x5f,0xff,0x35,0xe8,0x22,0x16,0x9c,0x94,0xe4,0x45,0xd5,0x08,0x34,0xfb,0xa3}, 367437, 524, 1048576, 1},
+    {{0xad,0x7d,0xd4,0xef,0xb8,0x83,0x6d,0x40,0x09,0xf6,0xc7,0x6b,0xd2,0x18,0x65,0xd8,0xf5,0xdc,0xf9,0xc3,0xcb,0xd8,0xfa,0x7b,0xb3,0x2d,0x68,0x64,0x88,0x84,0x71,0x20}, 367961, 563, 1310720, 1},
+    {},
+    {{0xee,0x0e,0x51,0xd9,0x22,0xd1,0xcf,0x8a,0xbe,0x3d,0xfc,0x6b,0x0d,0x84,0xa9,0x88,0xa6,0x63,0x5d,0xc9,0x6b,0x2a,0x96,0x96,0x20,0x07,0xc4,0x1a,0xaa,0x54,0x27,0x74}, 368524, 527, 524288, 1},
+    {{0x3c,0xde,0xbb,0xd8,0xad,0xc4,0xbb,0x67,0x73,0xa7,0x99,0x5f,0x54,0x2f,0xda,0xc4,0x9a,0xde,0xfc,0xa7,0x1c,0xba,0x58,0x32,0x55,0xa1,0xc1,0xbf,0x37,0xac,0x39,0x46}, 369051, 538, 1048576, 1},
+    {{0xa3,0x21,0x3e,0x40,0xd7,0xab,0xbc,0x25,0xa5,0xb9,0x09,0x64,0x24,0x33,0x10,0x3b,0x06,0xd8,0xf9,0x05,0x00,0xc9,0x30,0xbf,0x64,0x09,0x3a,0xde,0x03,0x29,0xda,0x78}, 369589, 817, 1056768, 3},
+    {},
+    {},
+    {{0x9c,0x47,0x21,0x33,0x9a,0x19,0x71,0x85,0xd6,0x1e,0x06,0x97,0xea,0x01,0x49,0xdb,0x14,0x3a,0x27,0xdd,0xb2,0xf5,0x7e,0xbd,0x39,0x8f,0x18,0xbc,0xf4,0xd7,0x72,0x4b}, 370406, 597, 1048576, 1},
+    {{0xa2,0x11,0x5e,0x75,0x76,0xde,0xc0,0x6e,0x0d,0xe6,0x13,0xef,0xb8,0x9d,0xe8,0x61,0x81,0x5a,0x78,0xef,0x72,0xe7,0x8a,0x37,0x84,0xbe,0x09,0xfb,0x75,0x41,0x92,0x8f}, 371003, 553, 1048576, 1},
+    {{0x83,0x0c,0x90,0x00,0x83,0xcc,0xcc,0x6d,0xed,0x74,0xc1,0x67,0xc4,0xe2,0x57,0xdb,0x34,0xdf,0x47,0x86,0xec,0xd6,0xe2,0xf0,0x53,0xde,0x45,0x4d,0xb7,0xd3,0x1f,0xe5}, 371556, 534, 1048576, 1},
+    {{0xce,0x9c,0x81,0x9d,0x64,0x96,0xe5,0x89,0x01,0xb3,0x9d,0x9b,0x04,0x55,0x8a,0x89,0xe0,0x9c,0xcc,0x3a,0xac,0x33,0x69,0x0b,0x8d,0x02,0xbb,0x04,0x06,0x68,0x2a,0x57}, 372090, 580, 1048576, 1},
+    {{0xd7,0xad,0x6f,0x67,0x86,0x0d,0xa7,0x8f,0xe2,0x5d,0x9e,0x79,0xdd,0x13,0xaf,0x7a,0xc7,0xef,0xaa,0x0c,0x8e,0x01,0x03,0x89,0x8a,0x48,0x49,0xab,0x4a,0xf9,0xe4,0x38}, 372670, 529, 1572864, 1},
+    {{0xfa,0x7e,0x2b,0x40,0x09,0x3f,0x0c,0xc7,0x23,0x3c,0xc7,0x7e,0x95,0xbb,0xbe,0xa2,0x14,0x4c,0x81,0x83,0xde,0xc1,0x04,0x46,0x59,0x03,0x96,0xff,0xfd,0x7c,0xda,0x37}, 373199, 516, 1048576, 1},
+    {},
+    {},
+    {{0x72,0x08,0x81,0x94,0xa6,0x5f,0xc0,0x57,0xf2,0x91,0x09,0x45,0xa3,0x3d,0x9f,0x07,0x16,0x82,0xa4,0xce,0xca,0xc8,0x99,0x6f,0x0b,0xda,0xbc,0xdb,0x5e,0xf3,0x99,0x62}, 373715, 631, 1048576, 1},
+    {},
+    {{0xa9,0x72,0x9d,0x04,0x9c,0xe5,0x80,0x83,0x9b,0xbf,0xef,0x18,0x36,0xa1,0x3d,0xc1,0x6f,0x2f,0xc9,0x34,0xd2,0x03,0xeb,0xf7,0x39,0x0e,0x0b,0x1c,0x47,0xea,0x9a,0x2d}, 374346, 512, 2097152, 1},
+    {},
+    {{0x44,0xcc,0x11,0x3c,0xe1,0xe7,0x61,0x6c,0xc7,0x37,0xad,0xea,0x9e,0x8f,0x14,0x04,0x36,0xc9,0xf1,0xc3,0xfb,0xa5,0x7e,0x8e,0x9d,0xb4,0x80,0x25,0xd4,0xac,0xe6,0x32}, 374858, 519, 2097152, 1},
+    {},
+    {{0xcb,0xca,0x00,0xfa,0x5d,0xfd,0x6c,0x72,0xdb,0x2f,0x21,0xd0,0x10,0x25,0x56,0x57,0xc3,0x3f,0x7a,0xc4,0x8d,0xe2,0x55,0x42,0x62,0x03,0x5e,0xad,0x11,0xbd,0xf3,0x14}, 375377, 518, 1048576, 1},
+    {{0xba,0x4f,0x31,0x35,0x3e,0x0e,0x12,0x33,0xb5,0x74,0x39,0x1a,0xd9,0x7a,0x80,0x90,0x1d,0x7d,0xe2,0x12,0xe2,0xc5,0x5d,0x7b,0xe2,0xaf,0x11,0xa9,0xa5,0x7c,0x82,0x25}, 375895, 574, 1048576, 1},
+    {{0x8d,0x3f,0x20,0xaf,0x0b,0xe5,0x88,0xcf,0x2e,0xdc,0x39,0xae,0xe0,0xd9,0x6d,0x40,0x85,0x51,0x29,0x19,0xa0,0x5c,0x0e,0x90,0xa7,0x84,0x8e,0x41,0x4c,0xc2,0x0e,0x42}, 376469, 652, 1048576, 1},
+    {{0x98,0x30,0x22,0x20,0x35,0x46,0xe0,0x31,0x77,0x3d,0xb0,0xd1,0xaf,0x75,0x52,0xc4,0x89,0x18,0x79,0x54,0x88,0x28,0x43,0xf1,0x3f,0xf1,0x23,0xf0,0x90,0x64,0xc1,0xd3}, 377121, 510, 1048576, 1},
+    {{0xf4,0x3f,0x8e,0xc5,0x46,0xb8,0x06,0x0e,0x9d,0x19,0x1f,0xca,0x86,0x0c,0x38,0xca,0xf5,0xa4,0x3e,0xda,0x86,0xa3,0x04,0xf0,0x07,0x36,0x47,0xc6,0xfa,0xd7,0xb2,0xc9}, 377631, 598, 3145728, 1},
+    {{0x04,0x4b,0x61,0x61,0x3e,0xd6,0x6e,0xae,0x08,0xab,0xd5,0xfa,0x5d,0xcd,0x13,0xb2,0x4a,0xab,0x11,0xa9,0x42,0xe3,0x30,0x9c,0xdf,0xf6,0x24,0xd1,0x98,0xc4,0x74,0x40}, 378229, 523, 1572864, 1},
+    {},
+    {},
+    {{0x15,0xd4,0xfc,0x90,0xcb,0x20,0x2a,0x93,0x91,0x71,0x8c,0xd4,0x0b,0x9f,0x03,0x84,0x16,0x5a,0xef,0x03,0x01,0x8e,0xd9,0x32,0x54,0x0e,0x8f,0x7c,0x18,0xb3,0x97,0xdd}, 378752, 542, 1572864, 1},
+    {{0x2f,0xfe,0x88,0x28,0x48,0x0f,0x94,0x30,0x56,0xfb,0x1a,0xb5,0xc3,0xc8,0x4d,0x48,0xa0,0xbf,0x8c,0xbe,0x3e,0xd7,0xc9,0x96,0x0b,0x34,0x9b,0x59,0xad,0xb0,0x7f,0x3b}, 379294, 536, 2097152, 1},
+    {{0x0a,0xd7,0x7a,0xe7,0xaf,0x23,0x13,0x13,0xe1,0x36,0x9a,0x52,0xd1,0x62,0x2b,0x88,0xe3,0x75,0x1a,0xa5,0xec,0x77,0x46,0x28,0xdf,0x70,0x71,0xf9,0xe4,0x24,0x4a,0xbc}, 379830, 625, 1048576, 1},
+    {{0x25,0x4d,0x17,0xa8,0x2a,0x32,0xd8,0xbd,0x23,0x1c,0xa3,0xa8,0x7d,0x35,0x6b,0x65,0xe6,0x5c,0xb0,0x22,0x99,0x02,0xa6,0x9a,0x57,0xc2,0x1a,0x4c,0x99,0xbb,0xba,0x1f}, 380455, 603, 2097152, 1},
+    {},
+    {{0xe3,0xea,0x89,0x96,0x4e,0xe8,0x2d,0x2a,0xe1,0xe5,0x73,0x9b,0x85,0x03,0xac,0xf6,0x27,0x32,0xae,0xde,0xf2,0x8d,0x1b,0x3d,0x5c,0xaa,0x9e,0xba,0xe0,0xfe,0xec,0x06}, 381058, 584, 524288, 1},
+    {{0xe9,0xc4,0x06,0xd4,0xf7,0x73,0x69,0x7b,0x9b,0x67,0x1e,0x7d,0xdf,0x22,0x07,0xc9,0xd0,0xab,0x24,0x2d,0x7f,0x23,0xe5,0x02,0xcd,0xd4,0x53,0xfb,0xb2,0x64,0xd3,0x92}, 381642, 524, 1048576, 1},
+    {{0x84,0x38,0xda,0x09,0xde,0x8c,0xe9,0xad,0xed,0x3b,0xb0,0x86,0x44,0x54,0x3f,0x7b,0x60,0xfb,0x60,0xcf,0xfc,0x68,0xce,0x2d,0x67,0xd6,0xa0,0x64,0x3f,0x2e,0xcf,0xc2}, 382166, 572, 1048576, 1},
+    {{0x41,0xb5,0x56,0x1d,0xe9,0xe4,0x98,0x42,0x76,0xe5,0x29,0x87,0xea,0x46,0xc5,0xf4,0xfa,0x85,0x26,0xd8,0x14,0x1c,0x70,0xc7,0x38,0x87,0x5a,0x9e,0xb9,0xfe,0x9d,0x70}, 382738, 768, 524288, 1},
+    {},
+    {{0x3e,0x48,0x7f,0x8b,0xa4,0x8c,0x0b,0x5e,0x31,0x74,0x4e,0x32,0x81,0xd6,0xbc,0xe3,0x75,0x08,0x9d,0xb6,0x07,0x5c,0x8e,0xb3,0xd9,0xa9,0x29,0x37,0x6b,0x81,0x73,0x81}, 383506, 541, 2621440, 1},
+    {},
+    {{0x18,0xb5,0x27,0x6b,0xe7,0x64,0xc0,0x65,0x31,0x21,0x9c,0x17,0x57,0xd4,0x02,0x14,0xae,0xec,0x06,0xfa,0xe6,0x8f,0x4c,0xe3,0xec,0x78,0xb5,0x8e,0xe7,0x50,0xa4,0x3e}, 384047, 657, 4194304, 1},
+    {{0xb3,0x2a,0xa9,0xcb,0xf8,0xf6,0xba,0xac,0xc8,0x4f,0x64,0x18,0xfa,0x6f,0xbc,0x33,0xb9,0xce,0x71,0x45,0x8f,0xec,0xc9,0x12,0x75,0xaa,0xfd,0xbf,0x6f,0x74,0x3a,0x99}, 384704, 532, 3145728, 1},
+    {{0xfa,0x14,0x37,0x84,0xfd,0x20,0x72,0x1d,0x61,0x10,0x19,0x20,0xe6,0xaa,0xe9,0xb7,0xf5,0x01,0x2b,0x81,0x57,0xb1,0xce,0x0c,0x7e,0xa8,0x3e,0xa6,0xc8,0x75,0xd8,0x4d}, 385236, 509, 1048576, 1},
+    {{0x31,0x04,0xd6,0xc0,0x6c,0x89,0x09,0xc5,0x6f,0x6a,0xdb,0x2f,0xae,0xcf,0x1b,0x43,0x82,0xf2,0x49,0x03,0x70,0x79,0x8b,0x60,0x56,0x31,0xda,0x92,0x6c,0x53,0x06,0xd8}, 385745, 636, 2097152, 1},
+    {},
+    {},
+    {{0x16,0xfb,0x96,0x51,0x30,0xe5,0x7f,0x37,0xdd,0xa2,0x46,0x6f,0x23,0x82,0x0f,0x09,0x1f,0x8b,0x96,0x75,0x8a,0xa7,0xe3,0x0b,0xa4,0xfd,0x63,0xcb,0x61,0x8e,0x5d,0xdb}, 386381, 518, 2097152, 1},
+    {{0xee,0x7a,0x29,0xeb,0x9c,0x30,0x2e,0xa2,0xbb,0x23,0x5e,0xf9,0x90,0xfd,0x83,0x44,0xa6,0xbe,0xb9,0x81,0x74,0x99,0x94,0x1c,0x40,0xa8,0xa9,0x4a,0xd5,0xf7,0xc9,0x64}, 386899, 586, 1048576, 1},
+    {},
+    {},
+    {{0x90,0xad,0x69,0xa4,0x89,0x19,0x4a,0xca,0x7e,0xf7,0xb7,0xfd,0x1d,0x30,0xe0,0x10,0x5d,0xa4,0x93,0x4a,0x81,0xac,0x8b,0x03,0x33,0xea,0x20,0xf9,0x24,0x8d,0xf9,0x2d}, 387485, 524, 524288, 1},
+    {{0xe6,0x78,0xa2,0x9a,0x93,0x11,0x1c,0xf2,0x01,0x6c,0x48,0x7b,0xa9,0x97,0x7b,0x14,0xde,0x8f,0x71,0x90,0x40,0x65,0x1a,0x42,0xc7,0x4b,0xd7,0x4e,0xea,0x2d,0x0d,0x81}, 388009, 565, 2097152, 1},
+    {{0x46,0xc8,0x11,0xf0,0xca,0xcf,0xfe,0x8f,0x20,0xe1,0xd6,0x30,0x72,0xd2,0x5d,0x7c,0x47,0xe9,0xbb,0x3f,0xd5,0x12,0x48,0x51,0xfd,0x05,0xac,0xa9,0x88,0x4d,0x21,0xfb}, 388574, 562, 1048576, 1},
+    {},
+    {},
+    {{0x73,0xa3,0xaa,0x87,0xdd,0xd5,0xce,0x5d,0xf5,0xba,0x51,0x29,0x23,0x16,0xf4,0x2b,0x6e,0x12,0x82,0x80,0x17,0x9b,0x0a,0x1b,0x11,0xb4,0xdc,0xdd,0xc1,0x7d,0x41,0x63}, 389136, 579, 2097152, 1},
+    {{0x4c,0xb6,0x01,0x16,0x8c,0x91,0xfa,0x06,0x08,0xc1,0x6a,0x8c,0xf2,0xf2,0x92,0xd9,0x91,0xc6,0xa5,0x61,0x5d,0x51,0x86,0x1d,0xee,0x2f,0x9b,0x91,0xc8,0xd6,0xbb,0x19}, 389715, 582, 1048576, 1},
+    {{0xbb,0x91,0x5b,0x28,0x6b,0x33,0x84,0x2e,0x39,0xe9,0x02,0x23,0x66,0x16,0x92,0x33,0xa4,0x04,0x15,0x15,0xc7,0xec,0xc6,0x0a,0xc4,0x28,0x42,0x0b,0x28,0xe4,0x8d,0xd5}, 390297, 530, 1048576, 1},
+    {},
+    {{0xf7,0xdf,0x5c,0xd1,0x6c,0xe6,0x62,0x45,0x67,0xd1,0xa2,0x4e,0x9b,0x9c,0x0b,0x90,0x50,0xea,0x9b,0x6a,0x9f,0xe5,0xa7,0x97,0x34,0x84,0x58,0x96,0x37,0x75,0x65,0x96}, 390827, 581, 2097152, 1},
+    {{0xce,0xb4,0x70,0x15,0x75,0x76,0xea,0xc3,0xb8,0xb8,0xc1,0x6e,0x8a,0xb6,0xb5,0x96,0x72,0x40,0x96,0x81,0xff,0xb4,0x23,0x2e,0x4e,0xc3,0x9d,0xd0,0xcb,0x37,0xef,0x91}, 391408, 520, 1048576, 1},
+    {{0xd9,0xb7,0xf9,0x35,0x6b,0xe0,0x78,0x0f,0x00,0x37,0x09,0x3a,0x86,0xef,0x84,0x50,0xf1,0x5e,0x56,0x9c,0xbd,0x36,0x80,0x07,0x3d,0x1c,0xd3,0x45,0xdf,0xad,0xb7,0x09}, 391928, 502, 2097152, 1},
+    {},
+    {},
+    {},
+    {{0xaa,0xc9,0xd6,0xf2,0xb8,0x40,0x8e,0x4b,0xbd,0xc8,0x3e,0xbb,0xba,0x75,0x54,0x28,0xca,0xf8,0x02,0x1f,0xef,0xbf,0xac,0x72,0x20,0xfb,0x4c,0x77,0x2a,0xbd,0x99,0x44}, 392430, 562, 1048576, 1},
+    {{0x12,0xfb,0xa2,0xaf,0xf0,0x4c,0x8e,0x39,0x96,0x8e,0x82,0x86,0x29,0xeb,0xd1,0x6c,0xaa,0x31,0x4b,0xca,0x39,0x7a,0x94,0x18,0xd3,0x5f,0xda,0xff,0xe8,0x18,0x8e,0x20}, 392992, 514, 1048576, 1},
+    {{0x17,0x11,0xfe,0x90,0x10,0x23,0x2b,0x41,0xec,0x40,0x69,0x00,0xe5,0xb4,0xef,0x52,0x8d,0xd2,0xbe,0xaa,0x97,0xb2,0x7d,0x94,0xed,0x7e,0xef,0x57,0xd6,0x39,0x04,0xa0}, 393506, 518, 1048576, 1},
+    {{0xe9,0xc0,0xbc,0x05,0x51,0x1e,0x05,0xa0,0xd7,0xc3,0xe7,0xcc,0x42,0xe7,0x61,0xe1,0xe8,0xe5,0x32,0xd4,0x6f,0x59,0xb9,0x85,0x4b,0x69,0x02,0xe1,0xa2,0xe9,0xdd,0x0a}, 394024, 559, 524288, 1},
+    {{0xa3,0xd8,0x03,0xb8,0xc6,0xb0,0xb6,0xac,0x55,0x08,0x56,0x71,0x04,0x0b,0x84,0x0f,0x99,0x35,0x43,0x91,0x5c,0x7f,0x80,0x2e,0x14,0xfb,0x65,0x1b,0xea,0xbe,0x9b,0x63}, 394583, 587, 2097152, 1},
+    {{0xaa,0x76,0x8b,0x8b,0x00,0x12,0x37,0x17,0xc8,0xd4,0x9f,0x2c,0x67,0x31,0xcd,0xbf,0xd8,0x0a,0xb6,0xa5,0x41,0x28,0xba,0xe7,0x59,0x4e,0x93,0xf4,0x5e,0x38,0xa1,0x9e}, 395170, 514, 1310720, 1},
+    {{0xb6,0x8e,0x86,0x5b,0x0b,0x5f,0xe6,0xaf,0x42,0x1a,0x17,0x1e,0x94,0xfb,0x1c,0xb0,0x00,0x6a,0xe3,0xe4,0x12,0xb6,0x36,0x1f,0x6f,0x85,0x8c,0x44,0xad,0xaa,0x30,0x4b}, 395684, 534, 2097152, 1},
+    {{0x98,0x85,0xca,0x14,0x8d,0x32,0xc4,0xdf,0x62,0x30,0x64,0x2b,0xcf,0xa1,0x53,0xf7,0xe5,0x1b,0x95,0x59,0x41,0x50,0x42,0xa8,0x31,0xdb,0x14,0xd0,0x7b,0x3e,0x6c,0x3d}, 396218, 523, 524288, 1},
+    {},
+    {{0xfe,0xc6,0xdd,0x09,0x7e,0x37,0x8e,0x79,0x5d,0xd1,0x64,0xbe,0x65,0x8b,0x10,0xb1,0xc6,0x06,0x72,0xb2,0x35,0x1a,0x7f,0x4a,0x77,0x22,0xd1,0xfe,0x57,0x36,0x41,0x0e}, 396741, 558, 1048576, 1},
+    {{0x16,0xf9,0xc9,0x0d,0x75,0xbd,0x23,0xd0,0x62,0x0b,0xe0,0x0e,0xcf,0x81,0x8f,0xcb,0x25,0xc5,0x93,0x5d,0x4e,0xe2,0x6b,0x1f,0xe1,0x7b,0x92,0x6f,0x89,0x87,0xaa,0x65}, 397299, 549, 1048576, 1},
+    {{0xe6,0x45,0x31,0x0d,0x24,0x06,0xac,0xe8,0x55,0x23,0xed,0x91,0x07,0x0e,0xe7,0xff,0x6a,0xa2,0x45,0x21,0x72,0x67,0xda,0xcb,0x15,0x8a,0xe9,0xfc,0x75,0x10,0x96,0x92}, 397848, 528, 1048576, 1},
+    {{0x3b,0x2b,0x8b,0x81,0x3b,0x58,0x04,0x9a,0x4a,0x86,0xce,0x1c,0x42,0xd2,0xa6,0x51,0xf1,0x9f,0xd9,0xbb,0xab,0x24,0x07,0xa4,0x94,0xe2,0x0c,0xf3,0x43,0xd3,0xc1,0xa4}, 398376, 516, 1048576, 1},
+    {{0xf4,0x66,0x63,0x55,0xe7,0xfe,0xa4,0x34,0x84,0x3d,0xc6,0xd5,0x11,0x96,0x73,0xbd,0x6c,0x23,0xe6,0x9b,0x88,0x4a,0xac,0x0b,0x38,0x2f,0xf0,0x36,0x99,0x7e,0x52,0xb5}, 398892, 672, 1572864, 1},
+    {{0xec,0x2d,0x91,0xe2,0x38,0xc2,0x6a,0x5d,0xdf,0x70,0x67,0xd1,0x04,0xb3,0xb3,0xe2,0xea,0xee,0x89,0x25,0x53,0x77,0xe1,0xeb,0x6c,0x4d,0xf8,0xf3,0x01,0x30,0x0e,0x64}, 399564, 522, 1048576, 1},
+    {{0x1b,0x85,0xc0,0x69,0x0a,0xa1,0x56,0xa2,0x55,0xc7,0xf7,0x9e,0x13,0x3e,0x45,0x33,0x45,0x45,0x26,0x98,0xfa,0x98,0xab,0xf8,0xdf,0x74,0x4c,0x26,0x2d,0x0c,0xf8,0x65}, 400086, 603, 1572864, 1},
+    {{0xdc,0xb3,0x3a,0x89,0xfc,0xb8,0xd8,0xca,0x8f,0x3a,0x46,0x70,0x34,0x72,0x8a,0xd6,0x37,0x52,0x73,0xd8,0xeb,0x51,0xa6,0x04,0x18,0xca,0x51,0xef,0x74,0x5e,0x9b,0x38}, 400689, 528, 2097152, 1},
+    {{0xe3,0x63,0x22,0x69,0x7c,0x48,0xba,0xae,0x64,0x92,0xdb,0x91,0xe6,0xcb,0xf3,0x84,0x4a,0x42,0x0f,0x6e,0x0c,0xc8,0xa7,0x5f,0x3a,0x73,0x55,0x60,0x26,0xdd,0xbb,0xb8}, 401217, 544, 524288, 1},
+    {{0x27,0xea,0xcc,0xb4,0xee,0xa9,0x38,0x32,0x63,0x95,0x65,0xa6,0x64,0xbf,0x35,0x61,0xed,0x5a,0x11,0xac,0x02,0x5d,0x37,0x7a,0x3f,0x33,0x26,0x2d,0x85,0x1c,0x1b,0x2b}, 401761, 557, 524288, 1},
+    {{0x75,0x99,0x30,0x76,0xc8,0x77,0x3e,0x7c,0x7d,0x55,0x5e,0xf2,0x90,0xbe,0x10,0x59,0x0d,0xef,0x40,0xca,0x7b,0x83,0x30,0x7b,0x8d,0xc8,0x65,0x56,0xb0,0x4a,0x65,0x65}, 402318, 546, 1048576, 1},
+    {{0x3d,0xff,0x35,0x13,0xae,0x6a,0xcb,0x85,0xa0,0x2b,0x00,0xb9,0xf5,0xad,0xb4,0x75,0x7a,0xb9,0x76,0x61,0x99,0x3b,0xde,0xd4,0xf3,0x29,0x12,0x7a,0x79,0x2c,0xef,0x87}, 402864, 520, 1048576, 1},
+    {{0xa0,0x52,0x1f,0x50,0xb0,0xd0,0xbf,0xf6,0x66,0x6b,0xfb,0x71,0x24,0x98,0x47,0x6e,0xb8,0xd5,0x97,0x4e,0xf3,0x8c,0xaf,0x15,0x7e,0x2f,0x67,0xcb,0xce,0x54,0x75,0xbb}, 403384, 647, 4194304, 1},
+    {{0xd4,0xf2,0xcb,0x6b,0x20,0x9d,0xb2,0x9f,0x7a,0xec,0x62,0xe5,0xa2,0x38,0x46,0x68,0x1c,0x14,0x66,0x5f,0xb0,0x07,0xe9,0x4d,0x7b,0xcf,0xc7,0xb5,0x61,0x1e,0x93,0x8b}, 404031, 673, 2097152, 1},
+    {{0xe3,0x17,0x7f,0x06,0x6b,0xf0,0x04,0xfd,0x99,0xae,0xf3,0x1f,0x26,0x92,0xba,0x0b,0x41,0x2d,0xd2,0x80,0xd6,0x13,0xdc,0x3f,0x4c,0xf3,0x34,0xd9,0x7f,0x4c,0x9a,0xf8}, 404704, 563, 1048576, 1},
+    {{0x44,0x42,0x8a,0x3d,0x1c,0x79,0x6f,0xbd,0x41,0xda,0x76,0x20,0xe3,0x21,0xc4,0x5f,0x11,0xcd,0x80,0xa0,0xe5,0xf4,0xab,0x8c,0x48,0x17,0x71,0x06,0xcb,0x96,0x0d,0x77}, 405267, 553, 2097152, 1},
+    {{0xd6,0xf6,0xc3,0x07,0x32,0xda,0xe8,0xd0,0x0c,0xd8,0x36,0x28,0xc3,0x15,0x6a,0xcb,0xdf,0x26,0xf9,0x9d,0xf7,0x01,0xf7,0x79,0x52,0x2e,0x21,0xde,0x74,0xda,0xe5,0xfe}, 405820, 522, 524288, 1},
+    {{0xef,0xe7,0x8f,0x6f,0xc6,0x8d,0xdd,0x0f,0x6e,0xf0,0xad,0x9e,0x02,0x23,0xd9,0x41,0x7c,0x14,0xfc,0xad,0xec,0xe9,0x87,0xdc,0x8f,0x50,0x42,0x3f,0xd6,0x72,0x3b,0x27}, 406342, 504, 1572864, 1},
+    {{0xb0,0xbe,0x35,0xa0,0xd5,0xe5,0x00,0xf4,0xff,0xfc,0xa5,0xf2,0x94,0x0e,0x0e,0xc5,0x2c,0x81,0xce,0x99,0xda,0xcd,0x77,0x3c,0x3c,0xa9,0xcf,0x92,0xf5,0x92,0xd9,0x43}, 406846, 581, 3145728, 1},
+    {{0x66,0x38,0xb5,0x54,0x10,0x59,0x81,0x4d,0x4c,0x34,0x57,0x4e,0x5e,0x27,0x7e,0xf6,0x13,0xae,0xbf,0x81,0xc9,0x1d,0x3d,0xef,0x55,0x7a,0x76,0x42,0xfb,0x58,0x40,0xe1}, 407427, 498, 2097152, 1},
+    {{0xa0,0xb3,0x9d,0x7f,0xd7,0xc3,0x9c,0x5b,0x0f,0x41,0xf3,0x54,0x2f,0xb8,0xd2,0x88,0x75,0x30,0xde,0xd1,0xc1,0x11,0xb4,0xff,0xb2,0xa8,0x63,0x84,0x5e,0x70,0x4e,0xcc}, 407925, 480, 1048576, 1},
+    {},
+    {{0x85,0x88,0x7d,0xfa,0x92,0x37,0x40,0x48,0xfb,0x20,0x80,0x9c,0x00,0xea,0xbe,0xa4,0x28,0x99,0x20,0x24,0xcf,0x87,0x5d,0x28,0x7d,0x04,0x31,0xb9,0x76,0x7c,0xc7,0xcb}, 408405, 516, 1048576, 1},
+    {{0x3f,0x59,0xcc,0x68,0x7d,0x22,0xcd,0x1b,0x23,0xcc,0x33,0xae,0x6e,0x45,0x18,0x23,0x4c,0x9d,0xa8,0x13,0xc0,0x1f,0x79,0xf4,0xc4,0x37,0x16,0xe1,0x2d,0x32,0xa1,0x2d}, 408921, 520, 1048576, 1},
+    {{0xe6,0x37,0xb8,0x24,0x1d,0x55,0xee,0x33,0x4a,0x34,0x52,0x88,0x8d,0xf5,0xe3,0x0d,0x72,0xc5,0x20,0xdb,0xb5,0x5c,0x49,0x8d,0xb1,0xa9,0x84,0x43,0x8b,0xab,0x3e,0x55}, 409441, 512, 1048576, 1},
+    {{0x1d,0x38,0xe3,0xaf,0x9e,0x3a,0x64,0x09,0xe9,0x3f,0x47,0x05,0xb6,0x8c,0x42,0x55,0x8f,0x55,0x8c,0x68,0xf3,0xe8,0x3e,0xf2,0xa4,0x0e,0x46,0xcf,0x56,0x0b,0x26,0xcc}, 409953, 590, 1048576, 1},
+    {{0x32,0xd3,0x2e,0xf5,0x6a,0xf8,0x38,0x87,0xcd,0xc2,0xc0,0x4b,0x3d,0xa4,0xbe,0x1c,0xd8,0x2a,0x47,0x39,0x88,0xde,0xaa,0x2e,0x7d,0xd5,0x0d,0x38,0xef,0x79,0xc3,0xa1}, 410543, 514, 1572864, 1},
+    {{0x12,0xb7,0x7c,0x4b,0xc9,0xc1,0x83,0x2c,0xee,0x88,0x81,0x24,0x46,0x59,0x06,0x5e,0xe1,0xd8,0x4c,0x70,0xc3,0xd2,0x9e,0x6e,0xaf,0x92,0xe6,0x79,0x8c,0xc2,0xca,0x72}, 411057, 570, 3145728, 1},
+    {},
+    {{0x05,0x15,0x2b,0xcf,0x9b,0xf0,0x86,0xe7,0xbc,0xdb,0xfa,0x7d,0xd8,0xed,0xfe,0x20,0x85,0xf1,0x33,0x9c,0x4d,0x7e,0x19,0x3e,0x00,0x71,0xc4,0x9a,0x10,0x47,0x1e,0xf4}, 411627, 514, 524288, 1},
+    {},
+    {{0x21,0x5a,0xb7,0xe5,0x76,0xb3,0x14,0x62,0xe3,0x28,0x4d,0x03,0x50,0x06,0xdc,0x63,0x8c,0xae,0x06,0xbb,0xfb,0x1a,0xf2,0xc5,0x61,0x74,0x03,0xb1,0x5a,0xb2,0xb2,0x5a}, 412141, 547, 1572864, 1},
+    {{0x6f,0xe7,0xc8,0xd3,0x9f,0xcf,0xab,0x7f,0x0a,0x18,0xe8,0x37,0xa7,0xee,0x0d,0xd1,0x62,0xe0,0x55,0x7d,0x69,0x89,0xc6,0xe0,0xd1,0x0c,0x81,0x61,0x6d,0x3a,0x0b,0x8b}, 412688, 506, 1572864, 1},
+    {{0x64,0x43,0xfe,0xce,0xbc,0xdc,0x2f,0xf7,0x06,0x1a,0x40,0x43,0x2f,0x3a,0xd1,0xdb,0x6d,0xfd,0x35,0x49,0x09,0xa5,0xf3,0x06,0x97,0x2c,0xf6,0xaf,0xa1,0x22,0x75,0x2c}, 413194, 560, 1048576, 1},
+    {{0x91,0xba,0x56,0x91,0xde,0xa3,0xcd,0xf1,0x03,0x17,0x7a,0xe5,0x77,0x91,0x10,0xfc,0x37,0x2f,0xce,0x82,0x29,0xcf,0x91,0xf2,0x63,0x07,0x36,0x67,0xe7,0xa8,0xb5,0xb7}, 413754, 540, 1048576, 1},
+    {{0xfe,0x1a,0xd1,0x28,0x31,0x3b,0x2b,0x9a,0x47,0xf8,0x9c,0xf0,0xd9,0x5d,0x4c,0x0c,0xc2,0xcb,0x35,0xa8,0x17,0xac,0x5d,0x91,0x5e,0xe6,0xc4,0xd9,0x8d,0x47,0xd6,0x75}, 414294, 543, 1572864, 1},
+    {{0xa0,0x35,0x28,0x34,0x4d,0x40,0xbf,0x80,0x0c,0xdb,0xde,0x2d,0xd2,0x40,0xb3,0x04,0x42,0xce,0xc7,0xae,0xa6,0x02,0x6f,0xbb,0xe3,0x12,0xa7,0xc3,0x6b,0xf0,0xf7,0x4a}, 414837, 545, 524288, 1},
+    {{0x0b,0x0f,0x99,0x1d,0xa7,0xce,0x4b,0x3c,0x29,0x74,0xd6,0xad,0xf6,0x21,0x91,0xec,0x55,0x4d,0xb9,0x79,0x3c,0x5d,0xef,0x14,0xcd,0xfb,0x62,0xb7,0xae,0x28,0xcc,0x98}, 415382, 532, 524288, 1},
+    {{0xe9,0x87,0xce,0xb5,0x3c,0xc1,0x40,0x7b,0x1b,0xa6,0x12,0xb1,0x3a,0x7b,0x53,0x91,0xdb,0x6c,0x41,0xea,0x14,0x55,0x2c,0x16,0x5a,0xe6,0x2a,0xd4,0x2e,0xea,0xa0,0xae}, 415914, 528, 1048576, 1},
+    {{0x49,0x58,0xed,0xa2,0x6f,0x24,0x19,0xf4,0x73,0x44,0x90,0x17,0xc6,0x41,0x21,0xca,0xee,0x5e,0x49,0xc4,0x80,0xff,0xa2,0x05,0x42,0x2e,0x7d,0xd4,0x5c,0xd2,0x3e,0x31}, 416442, 520, 1048576, 1},
+    {{0x6a,0x73,0x24,0x73,0x40,0x04,0xd9,0x92,0x06,0x43,0x94,0x30,0x24,0x3b,0x51,0xa0,0x5f,0xa8,0xc2,0x5f,0xfa,0x31,0x4d,0xaf,0xc7,0xf1,0x27,0x23,0x5d,0x1a,0x73,0x0f}, 416962, 577, 1048576, 1},
+    {{0xe6,0xef,0xb6,0x36,0x1a,0xf0,0x49,0x63,0xf2,0x2c,0x77,0x2f,0x87,0x9a,0x46,0x65,0x43,0xf5,0x6b,0x3b,0x6a,0x08,0x42,0x04,0xfe,0xf2,0xdc,0xb4,0x65,0x9d,0x82,0xd9}, 417539, 554, 1048576, 1},
+    {},
+    {},
+    {{0xdb,0x7d,0x72,0x7d,0xe8,0x6a,0x1a,0xc8,0x86,0xce,0x3c,0x24,0x3b,0xf5,0x94,0x19,0x10,0x15,0x4e,0xae,0xf3,0xbe,0x50,0x20,0x91,0x87,0xb9,0x71,0x15,0x92,0x83,0x0d}, 418093, 518, 1048576, 1},
+    {{0x1d,0xd0,0x1d,0xa6,0x8c,0xb6,0x1d,0xef,0x64,0x13,0x89,0xbf,0x3f,0xa8,0x7b,0x7a,0x29,0x11,0x3c,0x9c,0x8d,0xd1,0x72,0xcf,0x30,0x3c,0x0f,0x7e,0x03,0xba,0x6e,0x47}, 418611, 582, 1572864, 1},
+    {{0x04,0xca,0x1a,0x48,0x10,0x93,0xc4,0xa7,0xe1,0x2f,0x18,0xb3,0x36,0x97,0xd6,0xe0,0x5e,0x50,0xe3,0x0e,0x0f,0x5b,0x16,0x55,0xaa,0x26,0x5a,0xbd,0x14,0x71,0x9b,0xba}, 419193, 591, 2097152, 1},
+    {{0x62,0x81,0x47,0x46,0x8c,0x35,0x39,0x28,0x31,0x97,0xf5,0x8f,0x03,0xb9,0x4d,0xf4,0x97,0x58,0xa3,0x32,0x83,0x18,0x57,0x48,0x1e,0xa9,0xcc,0x31,0x64,0x5f,0x05,0x27}, 419784, 628, 4194304, 1},
+    {{0xee,0x5f,0xc2,0x7d,0xd1,0x9a,0x2e,0xcb,0x3c,0x3c,0x7c,0x73,0xd5,0x58,0xa1,0x8f,0xfd,0x5f,0xf3,0x65,0x71,0x0c,0x18,0xb8,0x81,0x50,0xe2,0x77,0xf0,0x8d,0x58,0x7e}, 420412, 524, 2097152, 1},
+    {{0xea,0xa0,0x64,0x70,0x73,0x4e,0xa5,0x7e,0xff,0x9b,0x88,0x81,0x37,0xaa,0x46,0x8f,0xcb,0x7b,0xb1,0x49,0xa0,0x87,0x0a,0x85,0xe6,0x8c,0x9d,0xb1,0x23,0xde,0x46,0x70}, 420936, 518, 1048576, 1},
+  };
+
+  static const char markup[] =
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    The Irem Skins Game\n"
+    "    name:     Irem Skins Game, The\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-02\n"
+    "    serial:   SNS-MT-USA\n"
+    "    sha256:   8304d8bc55aa9e64bdd144d384f4b185af2426e7d64888c6c23dd41366a53981\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Cool Spot\n"
+    "    name:     Cool Spot\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-C8-USA\n"
+    "    sha256:   c7d622391f7699fb0dc6367e141c894e700cc9bd8abca69f36785e7bc2f42a49\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Teenage Mutant Ninja Turtles V: Tournament Fighters\n"
+    "    name:     Teenage Mutant Ninja Turtles V - Tournament Fighters\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-KY-USA\n"
+    "    sha256:   849141370f164d6db3e5709da670726f958ce13ffef69319564db3fb0b12c69d\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Rocky Rodent\n"
+    "    name:     Rocky Rodent\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-NP-USA\n"
+    "    sha256:   7c0f915b581796e5b6dd384ecdc0dad8af4d956492fbcedec628c8845d911d7e\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Zool: Ninja of the \"Nth\" Dimension\n"
+    "    name:     Zool - Ninja of the 'Nth' Dimension\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-Z8-USA\n"
+    "    sha256:   25414de02c6805ca62574cfb39c23bf292b3d8c4ff33eb8f212ccdbcd61c5ae3\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    The Incredible Hulk\n"
+    "    name:     Incredible Hulk, The\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-8U-USA\n"
+    "    sha256:   8d170628d2d2fdf142bb82ad80e908bba54c45fa33241c779b8eafaf1b21171f\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2J5M revision=01\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    ram name=save.ram size=0x8000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "    map id=ram address=10-1f,90-9f:6000-7fff mask=0xe000\n"
+    "    map id=ram address=30-3f,b0-bf:6000-7fff mask=0xe000\n"
+    "  information\n"
+    "    title:    Brandish\n"
+    "    name:     Brandish\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2J5M-01\n"
+    "    serial:   SNS-QF-USA\n"
+    "    sha256:   130a74e76369b0ec4d6378a014550921433f1ae1ac1dddffb51f77c9f21a818f\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "      ram name=save.ram size=0x8000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A1M revision=01,11,20\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x800\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    The Twisted Tales of Spike McFang\n"
+    "    name:     Twisted Tales of Spike McFang, The\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A1M-11\n"
+    "    serial:   SNS-83-USA\n"
+    "    sha256:   259c25d4613f97f5fa7992900fb583625d7fb912c7ae09fa9def2e682834dc9f\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x800\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Street Racer\n"
+    "    name:     Street Racer\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-ASRE-USA\n"
+    "    sha256:   d1f61b6bb4bb6879a4fbd2c82d77390c546ee7f821edddc884fb9cc7463ad79b\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Captain America and The Avengers\n"
+    "    name:     Captain America and The Avengers\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-6A-USA\n"
+    "    sha256:   2a117951adcfbc4298763673a834d502c3f7a3964db1e59650f113c07bb831fb\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1N0N revision=01\n"
+    "    sdd1\n"
+    "      rom name=program.rom size=0x400000\n"
+    "      map id=io address=00-3f,80-bf:4800-4807\n"
+    "      map id=rom address=00-3f,80-bf:8000-ffff mask=0x8000\n"
+    "      map id=rom address=c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Street Fighter Alpha 2\n"
+    "    name:     Street Fighter Alpha 2\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1N0N-01\n"
+    "    serial:   SNS-AUZE-USA\n"
+    "    sha256:   910a29f834199c63c22beddc749baba746da9922196a553255deade59f4fc127\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x400000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x300000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Batman Forever\n"
+    "    name:     Batman Forever\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-20\n"
+    "    serial:   M/SNS-A3BE-USA\n"
+    "    sha256:   e36aaba64be016cabc33a2dcf88913341e2edacc722e2a1ebe04eccda2a5d6e7\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x300000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A3M revision=01,11,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Ogre Battle: The March of the Black Queen\n"
+    "    name:     Ogre Battle - The March of the Black Queen\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A3M-20\n"
+    "    serial:   M/SNS-OB-USA\n"
+    "    sha256:   b766c26498d0afd63f44aefdef42642d2483b54f18d2b81a4f1d67a57f641044\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Mutant Chronicles: Doom Troopers\n"
+    "    name:     Mutant Chronicles - Doom Troopers\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-AM9E-USA\n"
+    "    sha256:   8d4ada4f98464d176ae7f0fb8a20032056680f3241637a0f903f23f31f41ff36\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Pitfall: The Mayan Adventure\n"
+    "    name:     Pitfall - The Mayan Adventure\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-APAE-USA\n"
+    "    sha256:   e03d117d8b3093b0bbad5224638f85378b254b81eb304e506a732b4338802e0f\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    John Madden Football\n"
+    "    name:     Madden NFL '92\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-01\n"
+    "    serial:   SNS-JM-USA\n"
+    "    sha256:   5a76347672ea7d27bb334b1e30bbc73e06f92373883bed499245377327a8f0cf\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Bronkie the Bronchiasaurus\n"
+    "    name:     Bronkie the Bronchiasaurus\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-AB6E-USA\n"
+    "    sha256:   f2bc4cb460dfc5d5288065a2f529190b72e69d4e02634246086244c20f30521c\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Goof Troop\n"
+    "    name:     Goof Troop\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    MAXI-1A0N-30-2\n"
+    "    serial:   SNS-G6-USA\n"
+    "    sha256:   2bb368c47189ce813ad716eef16c01cd47685cb98e2c1cb35fa6f0173c97dd7c\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Rex Ronan: Experimental Surgeon\n"
+    "    name:     Rex Ronan - Experimental Surgeon\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-XR-USA\n"
+    "    sha256:   f44482e2cccd9fcfd5875d84ff700f6e783f3bd8abd1ac4d939074cd6ad3fe65\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Jurassic Park 2: The Chaos Continues\n"
+    "    name:     Jurassic Park 2 - The Chaos Continues\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-A2JE-USA\n"
+    "    sha256:   5eff7c27f69b3ebc1ec1294ffcd1debf3512bc3e6c1c75fbdc5e778dcaaba1c9\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Championship Pool\n"
+    "    name:     Championship Pool\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    MAXI-1A0N-30-2\n"
+    "    serial:   SNS-5P-USA\n"
+    "    sha256:   e6c4f468b39f2dea3436b63758db8ac9b29731357b982ec373334a36f202623f\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Pinball Dreams\n"
+    "    name:     Pinball Dreams\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-7D-USA\n"
+    "    sha256:   3a52bf09850aa054dca443f7ea74d43f201dffecc40326924ecba9b0f1450e43\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A0N revision=01,10,11,20\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Tuff E Nuff\n"
+    "    name:     Tuff E Nuff\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A0N-10\n"
+    "    serial:   SNS-TE-USA\n"
+    "    sha256:   8f62d014f513a7dcbca5aa76cbe476c3e4526100f34913af831bc05dab029bd1\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Andre Agassi Tennis\n"
+    "    name:     Andre Agassi Tennis\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-7A-USA\n"
+    "    sha256:   9abb426bac62e03e4437f5a9a8455c3000042f339125cc60ae29382ae89d8493\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Spider-Man: The Animated Series\n"
+    "    name:     Spider-Man - The Animated Series\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   SNS-ADME-USA\n"
+    "    sha256:   f05d777e3de69aab18d336cac0af07f794f8d00090d085f86cebaed3679cabad\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A3M revision=01,11,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    NCAA Final Four Basketball\n"
+    "    name:     NCAA Final Four Basketball\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A3M-20\n"
+    "    serial:   SNS-AFIE-USA\n"
+    "    sha256:   d297c76efbcd9a528d8ee51025f8774ab2cb6bbc676c24e28592c50f47e71bfc\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3M revision=10,20,21,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    College Football USA '97: The Road to New Orleans\n"
+    "    name:     College Football USA '97 - The Road to New Orleans\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3M-30\n"
+    "    serial:   M/SNS-AC7E-USA\n"
+    "    sha256:   5536cea2da39f2572abe3b0fcf71f8fcd981376b470b174969772aae4a7a1845\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A3M revision=01,11,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    NBA Live '95\n"
+    "    name:     NBA Live '95\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A3M-20\n"
+    "    serial:   SNS-ANBE-USA\n"
+    "    sha256:   2115c39f0580ce19885b5459ad708eaa80cc80fabfe5a9325ec2280a5bcd7870\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Mario's Early Years: Fun with Numbers\n"
+    "    name:     Mario's Early Years - Fun with Numbers\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-10\n"
+    "    serial:   SNS-YR-USA\n"
+    "    sha256:   57b94f5f576abbe8bd8f5a4eeb6cf927300ec1b5f0596610f3539ba733505c12\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3B revision=11,12,13\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-1f,80-9f:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Uncharted Waters\n"
+    "    name:     Uncharted Waters\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3B-13\n"
+    "    serial:   SNS-QK-USA\n"
+    "    sha256:   794152fc6f55cb15a0b203fa645ac9fa314a293da999d8ec8b3dda080434d175\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3B revision=11,12,13\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    ram name=save.ram size=0x200\n"
+    "    map id=rom address=00-1f,80-9f:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Super Baseball Simulator 1.000\n"
+    "    name:     Super Baseball Simulator 1.000\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3B-12\n"
+    "    serial:   SNS-UB-USA\n"
+    "    sha256:   1622371a5a4001fff9690323e89b7a8d449cdc3cae6dcd1249f0c7dc8c651d33\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "      ram name=save.ram size=0x200\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A1B revision=04,05,06\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    ram name=save.ram size=0x800\n"
+    "    map id=rom address=00-1f,80-9f:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    World League Soccer\n"
+    "    name:     World League Soccer\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A1B-05\n"
+    "    serial:   SNS-WS-USA\n"
+    "    sha256:   d4d9f1b41dad7e7a126a9adbe8d86c4b339e120c866156796de1cb0c9a214189\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "      ram name=save.ram size=0x800\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Pac-Attack\n"
+    "    name:     Pac-Attack\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-P9-USA\n"
+    "    sha256:   10c8abce67b49f8afbe880d2f13e0fd6d5efc162df34d5941e4a94851f23b2ff\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Hyper Zone\n"
+    "    name:     Hyper Zone\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-01\n"
+    "    serial:   SNS-HZ-USA\n"
+    "    sha256:   f57c49cc3e4c5e34929e12658db0de8794265c517e42f3c518bb1466ba46f14a\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A1B revision=04,05,06\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    ram name=save.ram size=0x800\n"
+    "    map id=rom address=00-1f,80-9f:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Radical Psycho Machine Racing\n"
+    "    name:     Radical Psycho Machine Racing\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A1B-05\n"
+    "    serial:   SNS-RP-USA\n"
+    "    sha256:   edf990e502c646a2fe83fcd1d359ca0ed5003ace06cb4c3de5a51a0c56d6ec54\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "      ram name=save.ram size=0x800\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3M revision=10,20,21,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Ken Griffey Jr. Presents Major League Baseball\n"
+    "    name:     Ken Griffey Jr. Presents Major League Baseball\n"
+    "    region:   NA\n"
+    "    revision: 1.1\n"
+    "    board:    SHVC-1A3M-21\n"
+    "    serial:   SNS-JR-USA\n"
+    "    sha256:   f9f7a2de8cbafd6f9042841dfc42529f8245d75f436bed1c23f9ba1663182e61\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=YA0N revision=01\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Battle Cars\n"
+    "    name:     Battle Cars\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-YA0N-01\n"
+    "    serial:   SNS-4B-USA\n"
+    "    sha256:   d19113964c4d268e986018e256e9358cde9a23a05e6053b54c0f2d950dcdf395\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super Soccer Champ\n"
+    "    name:     Super Soccer Champ\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-02\n"
+    "    serial:   SNS-HT-USA\n"
+    "    sha256:   5eb9736d66b3ac730ebbfdd19ef2397282b5f1a62dc0048093e041e23b807741\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J3M revision=01,11,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "    map id=ram address=20-3f,a0-bf:6000-7fff mask=0xe000\n"
+    "  information\n"
+    "    title:    Madden NFL '97\n"
+    "    name:     Madden NFL '97\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    EA-1J3M-20/P10018\n"
+    "    serial:   SNS-A7NE-USA\n"
+    "    sha256:   6874568d985f65dd817d4b03998e71c8cbacc8d8707411fde7bffee350605a88\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    The Addams Family 2: Pugsley's Scavenger Hunt\n"
+    "    name:     Addams Family 2 - Pugsley's Scavenger Hunt\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-AH-USA\n"
+    "    sha256:   b6957bae7fd97ba681afbf8962fe2138e209649fd88ed9add2d5233178680aaa\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Phantom 2040\n"
+    "    name:     Phantom 2040\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-A24E-USA\n"
+    "    sha256:   b7291088f5c49e1fc55bf932076ec03f7b39f6e409ae06e884b57024c56cdc87\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A1M revision=01,11,20\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    ram name=save.ram size=0x800\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Exertainment Mountain Bike Rally\n"
+    "    name:     Exertainment Mountain Bike Rally\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A1M-11\n"
+    "    serial:   SNS-9X-USA\n"
+    "    sha256:   f2455253db316b6ccd0c5c686d1f1e2d94cd5e37534e70a3a07a409120d58df6\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "      ram name=save.ram size=0x800\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A3M revision=01,11,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Paladin's Quest\n"
+    "    name:     Paladin's Quest\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A3M-01\n"
+    "    serial:   SNS-LN-USA\n"
+    "    sha256:   46286d0839a4397fc4c067b39783f98d2aefeca870a468bae601a1434f1dde90\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2J3M revision=01,11,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "    map id=ram address=10-1f,30-3f:6000-7fff mask=0xe000\n"
+    "    map id=ram address=90-9f,b0-bf:6000-7fff mask=0xe000\n"
+    "  information\n"
+    "    title:    The 7th Saga\n"
+    "    name:     7th Saga, The\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2J3M-01\n"
+    "    serial:   SNS-EL-USA\n"
+    "    sha256:   4dd631433c867ba920997fd3add2c838b62e70e06e0ef55c53884b8b68b0dd27\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1DS0B revision=10,20\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    necdsp model=uPD96050 frequency=11000000\n"
+    "      rom name=st011.program.rom size=0xc000\n"
+    "      rom name=st011.data.rom size=0x1000\n"
+    "      ram name=save.ram size=0x1000\n"
+    "      map id=io address=60-67,e0-e7:0000-3fff select=0x0001\n"
+    "      map id=ram address=68-6f,e8-ef:0000-7fff\n"
+    "  information\n"
+    "    title:    早指し二段森田将棋\n"
+    "    name:     Hayazashi Nidan Morita Shougi\n"
+    "    region:   JP\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1DS0B-10\n"
+    "    serial:   SHVC-2M\n"
+    "    sha256:   5b1a90c70df7537743900ad159e92ba3f72e4560934a64a46d62faba2ca83a70\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "      rom name=st011.program.rom size=0xc000\n"
+    "      rom name=st011.data.rom size=0x1000\n"
+    "      ram name=save.ram size=0x1000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Capcom's MVP Football\n"
+    "    name:     Capcom's MVP Football\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-NL-USA\n"
+    "    sha256:   9590110a990e90f525d5c8d70fc2a3da10879378003173b6761afb8bf042ee0d\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    SWAT Kats: The Radical Squadron\n"
+    "    name:     SWAT Kats - The Radical Squadron\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-20\n"
+    "    serial:   M/SNS-AK9E-USA\n"
+    "    sha256:   d802715fb4f09d7e499b5b3e577af641598a723dae7cedeaa93943bb53c6edbb\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super Castlevania IV\n"
+    "    name:     Super Castlevania IV\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    MAXI-1A0N-30-2\n"
+    "    serial:   SNS-AD-USA\n"
+    "    sha256:   0ef6f4cce5a2273fa49fe1ce724e0048a8e39c91da6b00dbb693fe1ba909177d\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=BA1M revision=01\n"
+    "    rom name=program.rom size=0x300000\n"
+    "    ram name=save.ram size=0x800\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    NBA Jam: Tournament Edition\n"
+    "    name:     NBA Jam - Tournament Edition\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-BA1M-01\n"
+    "    serial:   M/SNS-AJTE-USA\n"
+    "    sha256:   b257cffb3484e6be051a56268cb99ee888bd6d3e9c0e8d6d0779ff66c411f6ba\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x300000\n"
+    "      ram name=save.ram size=0x800\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Claymates\n"
+    "    name:     Claymates\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-10\n"
+    "    serial:   SNS-Y5-USA\n"
+    "    sha256:   6d9cd7f0cda3c0a82ed3f6a92cbbba4fe8365438e0a7867ad1cae2044d1738eb\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    King Arthur's World\n"
+    "    name:     King Arthur's World\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-RC-USA\n"
+    "    sha256:   aca9eb59d6783e2cae3787c69053888fea98f5dfe4c8af8b5a6360e0afb3b5d7\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1CA6B revision=01\n"
+    "    superfx revision=4\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x10000\n"
+    "      map id=io address=00-3f,80-bf:3000-34ff\n"
+    "      map id=rom address=00-3f,80-bf:8000-ffff mask=0x8000\n"
+    "      map id=rom address=40-5f,c0-df:0000-ffff\n"
+    "      map id=ram address=00-3f,80-bf:6000-7fff size=0x2000\n"
+    "      map id=ram address=70-71,f0-f1:0000-ffff\n"
+    "  information\n"
+    "    title:    Stunt Race FX\n"
+    "    name:     Stunt Race FX\n"
+    "    region:   NA\n"
+    "    revision: 1.1\n"
+    "    board:    SHVC-1CA6B-01\n"
+    "    serial:   SNS-CQ-USA\n"
+    "    sha256:   c04d80b84514202ff319384ca20641eb0189e975eed5612915bd9c224b2ab30a\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x10000\n"
+    "      superfx revision=4\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Strike Gunner S.T.G.\n"
+    "    name:     Strike Gunner STG\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-02\n"
+    "    serial:   SNS-SG-USA\n"
+    "    sha256:   05f14e6ed3394d9273e2397769a8acf1a9db646be6066e82269521e8eec53562\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A3M revision=01 mapper=MAD-R\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    E.V.O.: Search for Eden\n"
+    "    name:     EVO - Search for Eden\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A3M-01\n"
+    "    mapper:   MAD-R\n"
+    "    serial:   SNS-46-USA\n"
+    "    sha256:   8481e47381bd98c27b9782b5727a5d5f0976fbb3aa3df25c2c42aa37e0586815\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    The Tick\n"
+    "    name:     Tick, The\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-ATHE-USA\n"
+    "    sha256:   eb958801fd1f08771e5a0933f7701d633262efbfe8d47de21dda18e3b77670de\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A0N revision=01,10,11,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    The Combatribes\n"
+    "    name:     Combatribes, The\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A0N-01\n"
+    "    serial:   SNS-CR-USA\n"
+    "    sha256:   c88a882ad72dfa07a9b1eb8a2183aa10057d60877a02edf90cf2cd8c78abe65e\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J3M revision=01,11,20\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "    map id=ram address=20-3f,a0-bf:6000-7fff mask=0xe000\n"
+    "  information\n"
+    "    title:    Madden NFL '98\n"
+    "    name:     Madden NFL '98\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    EA-1J3M-20/P10018\n"
+    "    serial:   SNS-A8NE-USA\n"
+    "    sha256:   e3c62c9fe55d2311aa6a264f41b45d6cbc7b1b069ed3aa82ee57d381c062547d\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=BJ0N revision=01,20\n"
+    "    rom name=program.rom size=0x280000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Power Instinct\n"
+    "    name:     Power Instinct\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-BJ0N-20\n"
+    "    serial:   SNS-AGKE-USA\n"
+    "    sha256:   06c8fc466805f97c9147711b2d8370d4f4d05d9fa3a916f17aa1682f73c9a63b\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x280000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Demon's Crest\n"
+    "    name:     Demon's Crest\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-3Z-USA\n"
+    "    sha256:   18d40a807d5f88c5b6a1ad849eec7e0f189225d9a1586037c850f6680b5844de\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Relief Pitcher\n"
+    "    name:     Relief Pitcher\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-5R-USA\n"
+    "    sha256:   b2221d0a59a399e437710e1191a37071d0a59c72d8e62427cd499de8d8fd7b61\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A1M revision=01\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    ram name=save.ram size=0x800\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Cannondale Cup\n"
+    "    name:     Cannondale Cup\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A1M-01\n"
+    "    serial:   SNS-ASCE-USA\n"
+    "    sha256:   6cdec3cb9c91aa23feb13005f874bda580c2f548302874491a31951031c9dbbd\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "      ram name=save.ram size=0x800\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super Star Wars: A New Hope\n"
+    "    name:     Super Star Wars - A New Hope\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-V4-USA\n"
+    "    sha256:   c6bd7239cb2074ff1c471d14535bead6290bba2d7c75b4f03209cb114877b4c8\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A5M revision=01,11,20\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x8000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    SimAnt: The Electronic Ant Colony\n"
+    "    name:     SimAnt - The Electronic Ant Colony\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A5M-01\n"
+    "    serial:   SNS-AN-USA\n"
+    "    sha256:   c0bd1b378337c32047a6b7122a3813beb646e496fbdb1fa5c87ab9856271e4c5\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x8000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super Soccer\n"
+    "    name:     Super Soccer\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-01\n"
+    "    serial:   SNS-FS-USA\n"
+    "    sha256:   694ad2b34ab808bd8a1aa9dda359594cfd3a5fd9d95d4cf262ccaa0eb57eef67\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    King of the Monsters\n"
+    "    name:     King of the Monsters\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-KM-USA\n"
+    "    sha256:   1135858a1ce686a0a163bb0e6f3a4d7cd71c0cd56efbc79677372f2624cf2306\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Kendo Rage\n"
+    "    name:     Kendo Rage\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-M7-USA\n"
+    "    sha256:   b16661d5151d73cea5ac46d7c899531c7b2cdee2558092c23a5460c8092b80b8\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    The Ren & Stimpy Show: Veediots!\n"
+    "    name:     Ren & Stimpy Show - Veediots!, The\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-V8-USA\n"
+    "    sha256:   ba54d715abf100b94fee801351986fa818e4309730cefbacf9b4fad36e284c1c\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A0N revision=01,10,11,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Mega Man X\n"
+    "    name:     Mega Man X\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A0N-01\n"
+    "    serial:   SNS-RX-USA\n"
+    "    sha256:   3e1209f473bff8cd4bcbf71d071e7f8df17a2d564e9a5c4c427ee8198cebb615\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super James Pond\n"
+    "    name:     Super James Pond\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-J5-USA\n"
+    "    sha256:   3f8efb19eae68f24feb42c018b7dc7a819bfd8d993ab36899681caa7ee94b06e\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Hurricanes\n"
+    "    name:     Hurricanes\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-AHUE-USA\n"
+    "    sha256:   41cc900d2461a8dc4706640e493885ddf85db04d8dffceebf7a0ed89cc983d8d\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    The Flintstones: The Movie\n"
+    "    name:     Flintstones - The Movie, The\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   SNS-AFNE-USA\n"
+    "    sha256:   ff09d72d6241b331dc429d1cf27c04c26546f23312a22c7a14e6a4bf41ed1069\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Brutal: Paws of Fury\n"
+    "    name:     Brutal - Paws of Fury\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-ABLE-USA\n"
+    "    sha256:   9e3ad5e521e759a2e2260ea8072eb3314b6fcf67a3b7247357a5de9bcb24eeaa\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1C0N5S revision=01\n"
+    "    superfx revision=1\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x8000\n"
+    "      map id=io address=00-3f,80-bf:3000-34ff\n"
+    "      map id=rom address=00-1f,80-9f:8000-ffff mask=0x8000\n"
+    "      map id=ram address=60-7d,e0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Star Fox\n"
+    "    name:     Star Fox\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1C0N5S-01\n"
+    "    serial:   SNS-FO-USA\n"
+    "    sha256:   3857b5294ea8f7468849437bb2d8271564e8a0ff30774622e9c872bcbd53a84d\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x8000\n"
+    "      superfx revision=1\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3B revision=11,12,13\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-1f,80-9f:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Wanderers from Ys III\n"
+    "    name:     Wanderers from Ys III\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3B-12\n"
+    "    serial:   SNS-YS-USA\n"
+    "    sha256:   b0e74f0fe8d1e7fe2fe404341fea7c68e28f3a0ab78552d5092d413f2ecec417\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2J3M revision=01,11,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "    map id=ram address=10-1f,30-3f:6000-7fff mask=0xe000\n"
+    "    map id=ram address=90-9f,b0-bf:6000-7fff mask=0xe000\n"
+    "  information\n"
+    "    title:    Super Adventure Island II\n"
+    "    name:     Super Adventure Island II\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2J3M-11\n"
+    "    serial:   SNS-E4-USA\n"
+    "    sha256:   eaf1b83e95d8a04f9a84d4960cf87cc182fc60ef07be35eb8929c4033d6fef67\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A0N revision=01,10,11,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Metal Morph\n"
+    "    name:     Metal Morph\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A0N-11\n"
+    "    serial:   SNS-AMHE-USA\n"
+    "    sha256:   057484558ebd18165f98e556b994080535e31cefdd98b5edb190516f7040fc9d\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Football Fury\n"
+    "    name:     Football Fury\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-UF-USA\n"
+    "    sha256:   40b55ee44bc6f1c83daac3e1806dcf7ecd5b35280cdb6a63c7a5e52fbd2115e6\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Hal's Hole in One Golf\n"
+    "    name:     Hal's Hole in One Golf\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-01\n"
+    "    serial:   SNS-JO-USA\n"
+    "    sha256:   de1cf1512e48473b03adb87b7504f394e8b330b346bac24044f833d83609799a\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=BJ0N revision=01,20\n"
+    "    rom name=program.rom size=0x280000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Fatal Fury 2\n"
+    "    name:     Fatal Fury 2\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-BJ0N-01\n"
+    "    serial:   SNS-DJ-USA\n"
+    "    sha256:   a0c554d46034caef231c36dd6849828ca39703678fb7fdd15a11f292b93bcd6b\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x280000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Axelay\n"
+    "    name:     Axelay\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-02\n"
+    "    serial:   SNS-AX-USA\n"
+    "    sha256:   2431f8dc067ba27c6c3a846929f3deac6a45aa53a9a9ac20ede8ec5ca6854ea2\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3B revision=11,12,13\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-1f,80-9f:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    ActRaiser\n"
+    "    name:     ActRaiser\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3B-11\n"
+    "    serial:   SNS-AR-USA\n"
+    "    sha256:   b8055844825653210d252d29a2229f9a3e7e512004e83940620173c57d8723f0\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Gradius III\n"
+    "    name:     Gradius III\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-01\n"
+    "    serial:   SNS-G3-USA\n"
+    "    sha256:   93da752a0c76167d0907efa832367e5d14aab8e835b864f345c386071a9af718\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2J0N revision=01,10,11\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    World Heroes\n"
+    "    name:     World Heroes\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2J0N-10\n"
+    "    serial:   SNS-WZ-USA\n"
+    "    sha256:   ea76cfdbb2a555a7b6eff8b466a879f9a9189639416e8c2fb45bf074e695105f\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    The Wizard of Oz\n"
+    "    name:     Wizard of Oz, The\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-W6-USA\n"
+    "    sha256:   025dd3047c474d879e69b91a3918add9cdabedf4182e1c1e10e5f0c13a124bf9\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3M revision=10,20,21,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Emmitt Smith Football\n"
+    "    name:     Emmitt Smith Football\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3M-30\n"
+    "    serial:   M/SNS-AESE-USA\n"
+    "    sha256:   f14e30ee452ec930a6d08094094b287d0c40c8108f2017c418015242987649b3\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1B0N revision=02,03\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-1f,80-9f:8000-ffff mask=0x8000\n"
+    "    necdsp model=uPD7725 frequency=8000000\n"
+    "      rom name=dsp4.program.rom size=0x1800\n"
+    "      rom name=dsp4.data.rom size=0x800\n"
+    "      ram size=0x200\n"
+    "      map id=io address=30-3f,b0-bf:8000-ffff select=0x4000\n"
+    "  information\n"
+    "    title:    Top Gear 3000\n"
+    "    name:     Top Gear 3000\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1B0N-03\n"
+    "    serial:   SNS-A3TE-USA\n"
+    "    sha256:   ede60f0d283b6ea3a45308981d99e7c422a0296e5fadde51c6bafd4dcc789ca2\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      rom name=dsp4.program.rom size=0x1800\n"
+    "      rom name=dsp4.data.rom size=0x800\n"
+    "      ram name=dsp4.data.ram size=0x200\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super Slap Shot\n"
+    "    name:     Super Slap Shot\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-ZX-USA\n"
+    "    sha256:   c39ebf88af138e87ca5d963ed71a8b7defba3e2bc271d72186d00056e8225721\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A0N revision=01,10,11,20\n"
+    "    rom name=program.rom size=0x140000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Final Fight 2\n"
+    "    name:     Final Fight 2\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A0N-01\n"
+    "    serial:   SNS-F2-USA\n"
+    "    sha256:   744d1a16c3f99970283597ae8f43b7c3621c5f995c4566ef24b8d70b0692007b\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x140000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    The Adventures of Dr. Franken\n"
+    "    name:     Adventures of Dr. Franken, The\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-6F-USA\n"
+    "    sha256:   ecd964ae44e61203bc8759cfc6441365bf0c6e7bae6ad2a0fd553d4c7efab71e\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Kid Klown in Crazy Chase\n"
+    "    name:     Kid Klown in Crazy Chase\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-ZI-USA\n"
+    "    sha256:   914652f72d6ceb83b8b43414d6c42581ec12e9b3f45259b8b2768d26b8d4f073\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super Star Wars II: The Empire Strikes Back\n"
+    "    name:     Super Star Wars II - The Empire Strikes Back\n"
+    "    region:   NA\n"
+    "    revision: 1.1\n"
+    "    board:    MAXI-1A0N-30-2\n"
+    "    serial:   SNS-E5-USA\n"
+    "    sha256:   46370b3bd6ff9ee04c425eef0f482f521f3b61bd4b058f2f4e9d322253d7b5de\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    An American Tail: Fievel Goes West\n"
+    "    name:     American Tail - Fievel Goes West, An\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-10\n"
+    "    serial:   SNS-9W-USA\n"
+    "    sha256:   6931a3eacb7ab3c2f2fb57ba7d59c6da56fe6c7d60484cebec9332e6caca3ae9\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1L5B revision=11,20\n"
+    "    sa1\n"
+    "      rom name=program.rom size=0x400000\n"
+    "      ram name=save.ram size=0x8000\n"
+    "      ram size=0x800\n"
+    "      map id=io address=00-3f,80-bf:2200-23ff\n"
+    "      map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "      map id=rom address=c0-ff:0000-ffff\n"
+    "      map id=bwram address=00-3f,80-bf:6000-7fff\n"
+    "      map id=bwram address=40-4f:0000-ffff\n"
+    "      map id=iram address=00-3f,80-bf:3000-37ff\n"
+    "  information\n"
+    "    title:    Kirby's Dream Land 3\n"
+    "    name:     Kirby's Dream Land 3\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1L5B-20\n"
+    "    serial:   SNS-AFJE-USA\n"
+    "    sha256:   b50bf9d95485e8aeb7a6730e9f9f9c9c4ec23a85b336a4fb2e3b63034531e36f\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x400000\n"
+    "      ram name=save.ram size=0x8000\n"
+    "      ram size=0x800\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Space Football: One on One\n"
+    "    name:     Space Football - One on One\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-02\n"
+    "    serial:   SNS-FL-USA\n"
+    "    sha256:   24f3f22949f36ebf8ab4beaa8cba22db107efe7a7585f749343f2860bf041fe1\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Wild Snake\n"
+    "    name:     Wild Snake\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-AWSE-USA\n"
+    "    sha256:   39bb99eddb224de5f0789f807ffef06b9efa2efb7962dced31fb272f986699cd\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Family Dog\n"
+    "    name:     Family Dog\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-D8-USA\n"
+    "    sha256:   2891f1eab285133364ecc379a5c9e1d0026d60f425f1a458d149014f386cfa50\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    On the Ball\n"
+    "    name:     On the Ball\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-CT-USA\n"
+    "    sha256:   e153195de7b59dd5b9854952cccca6bb93164e5fdff8292124bee6bbe5dbf16f\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A1B revision=04,05,06\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x800\n"
+    "    map id=rom address=00-1f,80-9f:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    NCAA Basketball\n"
+    "    name:     NCAA Basketball\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A1B-06\n"
+    "    serial:   SNS-DU-USA\n"
+    "    sha256:   351587366eca8aeb38236e4ad6cbd4a1b6e37b8cc592725a79249c3a054fa3a7\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x800\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A1B revision=04,05,06\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x800\n"
+    "    map id=rom address=00-1f,80-9f:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Vegas Stakes\n"
+    "    name:     Vegas Stakes\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A1B-06\n"
+    "    serial:   SNS-VS-USA\n"
+    "    sha256:   78bf9d79fb2ff3f9d03ecc1176d070e53ddaca2c6b0cda69e74c19a4e50b195b\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x800\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Zoop\n"
+    "    name:     Zoop\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-20\n"
+    "    serial:   M/SNS-AZPE-USA\n"
+    "    sha256:   a3f1abf2740ff64042d82f7a940fb4269ece57d7c6967571549d8b60b20f305a\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3M revision=10,20,21,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Lufia & The Fortress of Doom\n"
+    "    name:     Lufia & The Fortress of Doom\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3M-20\n"
+    "    serial:   SNS-ES-USA\n"
+    "    sha256:   73731a5a7932965de02a9e98055dcf88b4d17b8f710a6ecfde3e36a1f248773b\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=BJ0N revision=01,20\n"
+    "    rom name=program.rom size=0x280000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    King Arthur & The Knights of Justice\n"
+    "    name:     King Arthur & The Knights of Justice\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-BJ0N-20\n"
+    "    serial:   M/SNS-AAKE-USA\n"
+    "    sha256:   1b58d0aed4510811c73d267244a7e915aa0b334c86e68f3fa5883f5cb534e4d7\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x280000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super High Impact\n"
+    "    name:     Super High Impact\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-HX-USA\n"
+    "    sha256:   d78ff42efdbb0e180777d17b5f7a96e08530ab77f15a99237f60714f7cfe2b74\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J1M revision=11,20\n"
+    "    rom name=program.rom size=0x400000\n"
+    "    ram name=save.ram size=0x800\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "    map id=ram address=20-3f,a0-bf:6000-7fff mask=0xe000\n"
+    "  information\n"
+    "    title:    Donkey Kong Country 3: Dixie Kong's Double Trouble\n"
+    "    name:     Donkey Kong Country 3 - Dixie Kong's Double Trouble\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J1M-20\n"
+    "    serial:   M/SNS-A3CE-USA\n"
+    "    sha256:   2277a2d8dddb01fe5cb0ae9a0fa225d42b3a11adccaeafa18e3c339b3794a32b\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x400000\n"
+    "      ram name=save.ram size=0x800\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    The Adventures of Batman & Robin\n"
+    "    name:     Adventures of Batman & Robin, The\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-ABTE-USA\n"
+    "    sha256:   8083307f3f4b7df9e5bf53d5f25877c2e548f0f677540d4ee62d60ccca3098f8\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1K1B revision=01\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    ram name=save.ram size=0x800\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "    map id=ram address=20-3f,a0-bf:6000-7fff mask=0xe000\n"
+    "    necdsp model=uPD7725 frequency=8000000\n"
+    "      rom name=dsp1.program.rom size=0x1800\n"
+    "      rom name=dsp1.data.rom size=0x800\n"
+    "      ram size=0x200\n"
+    "      map id=io address=00-1f,80-9f:6000-7fff select=0x1000\n"
+    "  information\n"
+    "    title:    Super Mario Kart\n"
+    "    name:     Super Mario Kart\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1K1B-01\n"
+    "    serial:   SNS-MK-USA\n"
+    "    sha256:   89ad4ba02a2518ca792cf96b61b36613f86baac92344c9c10d7fab5433bebc16\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "      ram name=save.ram size=0x800\n"
+    "      rom name=dsp1.program.rom size=0x1800\n"
+    "      rom name=dsp1.data.rom size=0x800\n"
+    "      ram name=dsp1.data.ram size=0x200\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1L5B revision=11,20\n"
+    "    sa1\n"
+    "      rom name=program.rom size=0x400000\n"
+    "      ram name=save.ram size=0x8000\n"
+    "      ram size=0x800\n"
+    "      map id=io address=00-3f,80-bf:2200-23ff\n"
+    "      map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "      map id=rom address=c0-ff:0000-ffff\n"
+    "      map id=bwram address=00-3f,80-bf:6000-7fff\n"
+    "      map id=bwram address=40-4f:0000-ffff\n"
+    "      map id=iram address=00-3f,80-bf:3000-37ff\n"
+    "  information\n"
+    "    title:    Super Mario RPG: Legend of the Seven Stars\n"
+    "    name:     Super Mario RPG - Legend of the Seven Stars\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1L5B-11\n"
+    "    serial:   SNS-ARWE-USA\n"
+    "    sha256:   740646f3535bfb365ca44e70d46ab433467b142bd84010393070bd0b141af853\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x400000\n"
+    "      ram name=save.ram size=0x8000\n"
+    "      ram name=internal.ram size=0x800\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A1M revision=01,11,20\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    ram name=save.ram size=0x800\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Chavez\n"
+    "    name:     Chavez\n"
+    "    region:   MX\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A1M-01\n"
+    "    serial:   SNS-ZV-USA\n"
+    "    sha256:   aa69d4e19c2eb206fe88eba65994c830256c220e5506f59824aefa0a75dd44d5\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "      ram name=save.ram size=0x800\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3M revision=10,20,21,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Bassin's Black Bass\n"
+    "    name:     Bassin's Black Bass\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3M-21\n"
+    "    serial:   SNS-AB2E-USA\n"
+    "    sha256:   e2be173c77bd1957787be36d13334f655e14d32dad99cacb0fd5e5fc65d96fa1\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=BJ0N revision=01,20\n"
+    "    rom name=program.rom size=0x400000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Rise of the Robots\n"
+    "    name:     Rise of the Robots\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-BJ0N-01\n"
+    "    serial:   SNS-AROE-USA\n"
+    "    sha256:   38be8013bbe07b2020ba30031fb0a2c77bad8a3eb61fac8217adfe82d6c402af\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x400000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Hard Ball III\n"
+    "    name:     Hard Ball III\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-10\n"
+    "    serial:   SNS-3Y-USA\n"
+    "    sha256:   4fb9b010e4b1dc166ab7995a6f9491114063b68aac344004b1edfc555951d959\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Tommy Moe's Winter Extreme: Skiing and Snowboarding\n"
+    "    name:     Tommy Moe's Winter Extreme - Skiing and Snowboarding\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-XS-USA\n"
+    "    sha256:   d99008d2181986dc7f65228696d940b5d31be8471f166d1ab9b1c14f1503bcfb\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    DinoCity\n"
+    "    name:     DinoCity\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-02\n"
+    "    serial:   SNS-DW-USA\n"
+    "    sha256:   7dbfc44d28a46e6d399628e43086aa9fd0b2abeda4c108751a5ad91c102c3aaf\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Williams Arcade's Greatest Hits\n"
+    "    name:     Williams Arcade's Greatest Hits\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    MAXI-1A0N-30-2\n"
+    "    serial:   SNS-AW8E-USA\n"
+    "    sha256:   60d01a3f499463156546ecdee18ee3e946b95302ee0b1569decb97f52372d2eb\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A5B revision=02,04\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x800\n"
+    "    map id=rom address=00-1f,80-9f:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Romance of the Three Kingdoms II\n"
+    "    name:     Romance of the Three Kingdoms II\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A5B-04\n"
+    "    serial:   SNS-XL-USA\n"
+    "    sha256:   815bfcf4fd6eb23a20c2e50dde023c210b273ffb6cd86a93909d803c3643ce46\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x800\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board id:Sufami Turbo\n"
+    "    rom name=program.rom size=0x40000\n"
+    "    map id=rom address=00-1f,80-9f:8000-ffff mask=0x8000\n"
+    "    sufamiturbo\n"
+    "      map id=rom address=20-3f,a0-bf:8000-ffff mask=0x8000\n"
+    "      map id=ram address=60-6f,e0-ef:0000-ffff\n"
+    "    sufamiturbo\n"
+    "      map id=rom address=40-5f,c0-df:0000-7fff mask=0x8000\n"
+    "      map id=rom address=40-5f,c0-df:8000-ffff mask=0x8000\n"
+    "      map id=ram address=70-7d,f0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    スーファミターボ\n"
+    "    name:     Sufami Turbo\n"
+    "    region:   JP\n"
+    "    revision: 1.0\n"
+    "    board:    Sufami Turbo\n"
+    "    serial:   SFT-0100-JPN\n"
+    "    sha256:   edacb453da14f825f05d1134d6035f4bf034e55f7cfb97c70c4ee107eabc7342\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x40000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J3M revision=01,11,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "    map id=ram address=20-3f,a0-bf:6000-7fff mask=0xe000\n"
+    "  information\n"
+    "    title:    Madden NFL '96\n"
+    "    name:     Madden NFL '96\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J3M-20\n"
+    "    serial:   M/SNS-A6FE-USA\n"
+    "    sha256:   3059d86cdc383985c564a7a891fe18e08f5222ead7ede9fa309159d60cde13a1\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Daffy Duck: The Marvin Missions\n"
+    "    name:     Daffy Duck - The Marvin Missions\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-YF-USA\n"
+    "    sha256:   4068add412571bd85adac32dff9835e4a4886077d752adb104fee3908e42b7ef\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Family Feud\n"
+    "    name:     Family Feud\n"
+    "    region:   NA\n"
+    "    revision: 1.1\n"
+    "    board:    MAXI-1A0N-30\n"
+    "    serial:   SNS-FN-USA\n"
+    "    sha256:   d5c651d726dd957b80d03ab6fdbed4cdd26a3cccf5ec9d91af67251b3ec26a3c\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Incantation\n"
+    "    name:     Incantation\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-AIYE-USA\n"
+    "    sha256:   c41150c0e84055801377fb7cb273cc51ca442b269ca6287cadf514f553e34750\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Micro Machines\n"
+    "    name:     Micro Machines\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-AH3E-USA\n"
+    "    sha256:   a2adeb4bf0e7cc943611ac726e5578da404373a79e91436c9bbd15480688b15c\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    The Pagemaster\n"
+    "    name:     Pagemaster, The\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-APME-USA\n"
+    "    sha256:   ecaf51852e111512385c5f209d51578e65b45fcaa17b295ca06120c8d1464520\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x40000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Mr. Do!\n"
+    "    name:     Mr. Do!\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-AUNE-USA\n"
+    "    sha256:   340293c06536d7b6981ad7c681e404f4390ff6c62340f844a4558877c1b82af0\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x40000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3B revision=11,12,13\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-1f,80-9f:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Gemfire\n"
+    "    name:     Gemfire\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3B-13\n"
+    "    serial:   SNS-RL-USA\n"
+    "    sha256:   78e2b8210d8dd8776ee23153eb3dce2cbf7d8ddc3e8a5d25b580428f59d98bdb\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super Troll Islands\n"
+    "    name:     Super Troll Islands\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-5L-USA\n"
+    "    sha256:   02cb7f1ed21ed6bfb9eaa0e91df2adb063a9bf4cbd6feb6cd024d676829e227e\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2J3M revision=01,11,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "    map id=ram address=10-1f,30-3f:6000-7fff mask=0xe000\n"
+    "    map id=ram address=90-9f,b0-bf:6000-7fff mask=0xe000\n"
+    "  information\n"
+    "    title:    Robotrek\n"
+    "    name:     Robotrek\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2J3M-11\n"
+    "    serial:   SNS-E9-USA\n"
+    "    sha256:   1e2ded7b1e350449b7a99b7ec414525e4b9b086c416deeee5eb3e48e032c46bd\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Star Trek: Starfleet Academy - Starship Bridge Simulator\n"
+    "    name:     Star Trek - Starfleet Academy - Starship Bridge Simulator\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-ASTE-USA\n"
+    "    sha256:   b4d0b4a3fd73469f5469dfcc2316e50848ebf0630a225df2969c740759e321f4\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3B revision=11,12,13\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-1f,80-9f:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Super Play Action Football\n"
+    "    name:     Super Play Action Football\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3B-13\n"
+    "    serial:   SNS-SF-USA\n"
+    "    sha256:   5a4b0c89606f71182fa5552ac476cc3bbda5ddc7d44e33f9184114aaea38020d\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A0N revision=01,10,11,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Pac-Man 2: The New Adventures\n"
+    "    name:     Pac-Man 2 - The New Adventures\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A0N-11\n"
+    "    serial:   SNS-25-USA\n"
+    "    sha256:   4cb52ba751c42d9e12ca429e5d657622a370b608002880a997f64de453f0de20\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    NHLPA Hockey '93\n"
+    "    name:     NHLPA Hockey '93\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-HY-USA-1\n"
+    "    sha256:   55f3432a130085c112d65aa6443c41eb7a8aeec59aad2c2b4b2ac536b604b449\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Roger Clemens' MVP Baseball\n"
+    "    name:     Roger Clemens' MVP Baseball\n"
+    "    region:   NA\n"
+    "    revision: 1.1\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-VP-USA\n"
+    "    sha256:   f7e3c3012af2dbad350646b6ef3470f0b4c42e4a2873109f7aa6c81d7157c887\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    X-Zone\n"
+    "    name:     X-Zone\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-XZ-USA\n"
+    "    sha256:   93272180090e8418582f69b79c5cee6b28638b9a93192cc4bcd96291a4fca02d\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3B revision=11,12,13\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-1f,80-9f:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Nolan Ryan's Baseball\n"
+    "    name:     Nolan Ryan's Baseball\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3B-12\n"
+    "    serial:   SNS-NR-USA\n"
+    "    sha256:   7f3d0ebac6ecfb99cfd1d5b13210e989df9e8b2f2319a63c42faef8ad115a964\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Legend\n"
+    "    name:     Legend\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-6L-USA\n"
+    "    sha256:   c7814cee0fc95d6422cf19a3dc8c9a65b60f6f56da75f09cebea02cc5f99261b\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Monopoly\n"
+    "    name:     Monopoly\n"
+    "    region:   NA\n"
+    "    revision: 1.1\n"
+    "    board:    MAXI-1A0N-30-2\n"
+    "    serial:   SNS-ML-USA\n"
+    "    sha256:   6b0ac4d52d24536cdb7d9d0dc7d19ee30d08ac34363983290c5912ccc850fa0d\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Speedy Gonzales: Los Gatos Bandidos\n"
+    "    name:     Speedy Gonzales - Los Gatos Bandidos\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   SNS-ASSE-USA\n"
+    "    sha256:   df02d0f4f40e2732138309d38e91b48aef482490979007ecb63359a35115dfd4\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2B3B revision=01\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "    necdsp model=uPD7725 frequency=8000000\n"
+    "      rom name=dsp1.program.rom size=0x1800\n"
+    "      rom name=dsp1.data.rom size=0x800\n"
+    "      ram size=0x200\n"
+    "      map id=io address=60-6f,e0-ef:0000-7fff select=0x4000\n"
+    "  information\n"
+    "    title:    Super Bases Loaded 2\n"
+    "    name:     Super Bases Loaded 2\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2B3B-01\n"
+    "    serial:   SNS-3D-USA\n"
+    "    sha256:   327745aceb708d82419c3d2cffdffa78f55df0878bb1786e1b7fc294385f20ba\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "      rom name=dsp1.program.rom size=0x1800\n"
+    "      rom name=dsp1.data.rom size=0x800\n"
+    "      ram name=dsp1.data.ram size=0x200\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Snow White in Happily Ever After\n"
+    "    name:     Snow White in Happily Ever After\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-ASHE-USA\n"
+    "    sha256:   f653b8308b617e1cba1caf004e5a670088b882e320fa6afcc7a29dd3b2dd0ea0\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Flashback: The Quest for Identity\n"
+    "    name:     Flashback - The Quest for Identity\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-10\n"
+    "    serial:   SNS-5F-USA\n"
+    "    sha256:   064a880a8dfcf576f74ae8a17c3ec7b0a27e8cb0300a5e5959452fcc30422f14\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    BreakThru!\n"
+    "    name:     BreakThru!\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-ABXE-USA\n"
+    "    sha256:   aad8c9be1b7a9662256b0c3d76f5b7a273bcd497aa838232d307e9f2e80cf699\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Shien's Revenge\n"
+    "    name:     Shien's Revenge\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-OO-USA\n"
+    "    sha256:   454c580498a7d317ed61cb5863b1999eff57ad440ecd30ebb76e193c9c52f3ac\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Wolfenstein 3D\n"
+    "    name:     Wolfenstein 3D\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-10\n"
+    "    serial:   SNS-6W-USA\n"
+    "    sha256:   9c2b458e8fda5cb437a4c6d28fb430e45c4cfef98420c40546b8e08563a4fc7d\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1L3B revision=02,11\n"
+    "    sa1\n"
+    "      rom name=program.rom size=0x200000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "      ram size=0x800\n"
+    "      map id=io address=00-3f,80-bf:2200-23ff\n"
+    "      map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "      map id=rom address=c0-ff:0000-ffff\n"
+    "      map id=bwram address=00-3f,80-bf:6000-7fff\n"
+    "      map id=bwram address=40-4f:0000-ffff\n"
+    "      map id=iram address=00-3f,80-bf:3000-37ff\n"
+    "  information\n"
+    "    title:    PGA Tour '96\n"
+    "    name:     PGA Tour '96\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1L3B-02\n"
+    "    serial:   SNS-A3GE-USA\n"
+    "    sha256:   571d3129350bfb7cca2285499cf31dda48d1047cf9eaef122c8c33dffa9ad296\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "      ram name=internal.ram size=0x800\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Elite Soccer\n"
+    "    name:     Elite Soccer\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-10\n"
+    "    serial:   SNS-L7-USA\n"
+    "    sha256:   b296054effb1948039635044bc905fdf8ff53e7a73038fd5d8436a913ea5ad8a\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Hyper V-Ball\n"
+    "    name:     Hyper V-Ball\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-HQ-USA\n"
+    "    sha256:   db57f45e113127b7148c1b0add2da888e16e16b3e46749f95973b3ef497ae90b\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    NFL Football\n"
+    "    name:     NFL Football\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-NF-USA\n"
+    "    sha256:   f651a42bb351f7691b880827178c36fcf6c265c7833c6de1d94f7ed69bac0517\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Mario's Early Years: Fun with Letters\n"
+    "    name:     Mario's Early Years - Fun with Letters\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-10\n"
+    "    serial:   SNS-AMYE-USA\n"
+    "    sha256:   22b21fb39d40447846f6ff77a07f7b4aba2a7473941ba50c787aae6153b1fb5e\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=YA0N revision=01\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Dennis the Menace\n"
+    "    name:     Dennis the Menace\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-YA0N-01\n"
+    "    serial:   SNS-4D-USA\n"
+    "    sha256:   a362033d0d7e754d79202b255679186ad799b9e784719614b913ec8c9857ae33\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3M revision=10,20,21,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Air Strike Patrol\n"
+    "    name:     Air Strike Patrol\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3M-21\n"
+    "    serial:   SNS-4A-USA\n"
+    "    sha256:   69c5805ad0494703e7d636d3d40d615d33e79bebef9d2cdb4a23b73d44c7b6f9\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Beethoven: The Ultimate Canine Caper!\n"
+    "    name:     Beethoven - The Ultimate Canine Caper!\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-2V-USA\n"
+    "    sha256:   4d22279e534848012e0f1595468687742ae18cabc3fe44eeef938bc3a4dd08bf\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    ヨッシーのクッキー クルッポンオーブンでクッキー\n"
+    "    name:     Yoshi no Cookie - Kuruppon Oven de Cookie\n"
+    "    region:   JP\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SHVC-YO\n"
+    "    sha256:   2b2fe61ac7a79c3cfaa0bc16f1b1f4da544fcc37cfdf3c18879d31b8b9f87941\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    The Flintstones: The Treasure of Sierra Madrock\n"
+    "    name:     Flintstones - The Treasure of Sierra Madrock, The\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-9F-USA\n"
+    "    sha256:   3d5bbc06e7e9797d937c803610c40b262c14c3f0a39e8048dd6b0b052a040fc1\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A0N revision=01,10,11,20\n"
+    "    rom name=program.rom size=0x140000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Chester Cheetah: Wild, Wild Quest\n"
+    "    name:     Chester Cheetah - Wild, Wild Quest\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A0N-11\n"
+    "    serial:   SNS-7C-USA\n"
+    "    sha256:   21a2aa488cb8140ca318f7d1f513103d14e758181aa336a594097d32ba0a7587\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x140000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Mickey Mania: The Timeless Adventures of Mickey Mouse\n"
+    "    name:     Mickey Mania - The Timeless Adventures of Mickey Mouse\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-AMIE-USA\n"
+    "    sha256:   0773eb741ce28f963f767fc7dd44678eb3d37ed4dc7fc82bb9cce7d55f1cfc64\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1B5B revision=02\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x8000\n"
+    "    map id=rom address=00-1f,80-9f:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-ffff\n"
+    "    necdsp model=uPD7725 frequency=8000000\n"
+    "      rom name=dsp2.program.rom size=0x1800\n"
+    "      rom name=dsp2.data.rom size=0x800\n"
+    "      ram size=0x200\n"
+    "      map id=io address=20-3f,a0-bf:8000-ffff select=0x4000\n"
+    "  information\n"
+    "    title:    Dungeon Master\n"
+    "    name:     Dungeon Master\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1B5B-02\n"
+    "    serial:   SNS-V2-USA\n"
+    "    sha256:   03d25227fb88899d0f3234c4a3f76f1dbe8d582cb6429454fd6f1c4cf14d5c6e\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x8000\n"
+    "      rom name=dsp2.program.rom size=0x1800\n"
+    "      rom name=dsp2.data.rom size=0x800\n"
+    "      ram name=dsp2.data.ram size=0x200\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Packy & Marlon\n"
+    "    name:     Packy & Marlon\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-APYE-USA\n"
+    "    sha256:   b1586c8ece4da9697f0602a684d7a9108027247a34652c3771831d31f82ee078\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super Tennis\n"
+    "    name:     Super Tennis\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-01\n"
+    "    serial:   SNS-ST-USA\n"
+    "    sha256:   6e45a80ea148654514cb4e8604a0ffcbc726946e70f9e0b9860e36c0f3fa4877\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Bram Stoker's Dracula\n"
+    "    name:     Bram Stoker's Dracula\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-5D-USA\n"
+    "    sha256:   bbde8b46c7262f9d4a5b3926a00850cb00b4f7711f6421f0adf4e2b0c847a5d6\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Jack Nicklaus Golf\n"
+    "    name:     Jack Nicklaus Golf\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-02\n"
+    "    serial:   SNS-JN-USA\n"
+    "    sha256:   3ffbb6e0ccf8e9f5e4c72d9fe526a16371e562b71a91d6430e562bf358a5126b\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Where in the World is Carmen Sandiego\?\n"
+    "    name:     Where in the World is Carmen Sandiego\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-WX-USA\n"
+    "    sha256:   1bd3af0125743bf9bbbac6e7dc215fe32c4ff7043a2ee034d56b627e3f6875f0\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x300000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Spider-Man & Venom: Separation Anxiety\n"
+    "    name:     Spider-Man & Venom - Separation Anxiety\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   SNS-A2CE-USA\n"
+    "    sha256:   b72fbbfe737eff49f59dcef9f13b963e50c5bc322d7eb0e7b4c25f3a71aa0815\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x300000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    R-Type III: The Third Lightning\n"
+    "    name:     R-Type III - The Third Lightning\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-ER-USA\n"
+    "    sha256:   4d6c7d6d2693d8d43bafaff7582f9a94885362dadd9ee4012bbbdce1ba10c30e\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Mega Man 7\n"
+    "    name:     Mega Man 7\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-20\n"
+    "    serial:   M/SNS-A7RE-USA\n"
+    "    sha256:   a255fec32453739903a1954149f19bc9658f4a415600b44badf1d4e5e13a16f9\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    California Games II\n"
+    "    name:     California Games II\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-C2-USA\n"
+    "    sha256:   19f4a1f08aa55ff3cc8ff7ae60ffe03f0e436e8d8901455f1311f2276497a492\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x400000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Fatal Fury Special\n"
+    "    name:     Fatal Fury Special\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-20\n"
+    "    serial:   M/SNS-3R-USA\n"
+    "    sha256:   410e90db3d38507ccc85ad3bca6b27a080123fd5160e82b5de4d914d4b6d6e61\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x400000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Tiny Toon Adventures: Buster Busts Loose!\n"
+    "    name:     Tiny Toon Adventures - Buster Busts Loose!\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-TA-USA-1\n"
+    "    sha256:   ba679a11264e9695895a6c17358a41e8459be06166d056811df9c2738fef3d0d\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    The Great Waldo Search\n"
+    "    name:     Great Waldo Search, The\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-GW-USA\n"
+    "    sha256:   3ab1ca181000f10cb7c2ae8dc9fafeecd5d77314ee92960e26dff0d6a1fd11ee\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super R.B.I Baseball\n"
+    "    name:     Super RBI Baseball\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-ARLE-USA\n"
+    "    sha256:   607bfa0f74e57298f59ebe237c2e7b59364024d844534f3befb9ad1301bbedf8\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Joe & Mac 2: Lost in the Tropics\n"
+    "    name:     Joe & Mac 2 - Lost in the Tropics\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-J3-USA\n"
+    "    sha256:   c9889799a9ae8558f26d66ae546db930c99acb78d921b4395afbbc38da6272aa\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    The Simpsons: Bart's Nightmare\n"
+    "    name:     Simpsons - Bart's Nightmare, The\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-02\n"
+    "    serial:   SNS-BN-USA\n"
+    "    sha256:   f0d98e9061d0f6a193bb856de8a592f336dada97c41966e8d03119ba97465413\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=LDH3C revision=01\n"
+    "    spc7110\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      rom name=data.rom size=0x400000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "      map id=io address=00-3f,80-bf:4800-483f\n"
+    "      map id=io address=50,58:0000-ffff\n"
+    "      map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "      map id=rom address=c0-ff:0000-ffff\n"
+    "      map id=ram address=00-3f,80-bf:6000-7fff mask=0xe000\n"
+    "    epsonrtc\n"
+    "      ram name=rtc.ram size=0x10\n"
+    "      map id=io address=00-3f,80-bf:4840-4842\n"
+    "  information\n"
+    "    title:    Far East of Eden 天外魔境 Zero\n"
+    "    name:     Far East of Eden - Tengai Makyou Zero\n"
+    "    region:   JP\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-LDH3C-01\n"
+    "    serial:   SHVC-AZRJ-JPN\n"
+    "    sha256:   8620203da71d32d017bb21f542864c1d90705b87eb67815d06b43f09120318aa\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      rom name=data.rom size=0x400000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "      ram name=rtc.ram size=0x10\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J3M revision=01,11,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "    map id=ram address=20-3f,a0-bf:6000-7fff mask=0xe000\n"
+    "  information\n"
+    "    title:    NHL '97\n"
+    "    name:     NHL '97\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J3M-20\n"
+    "    serial:   M/SNS-AH7E-USA\n"
+    "    sha256:   2a2dc2ef84efd9a773d1e8231b7e3e57f0de7e4528968670963f2f1f358eef39\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A1M revision=01,11,20\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    ram name=save.ram size=0x800\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Tin Star\n"
+    "    name:     Tin Star\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A1M-11\n"
+    "    serial:   SNS-9N-USA\n"
+    "    sha256:   0503cd93b4d211a825acd47ff3813668b4ce68890c8be2fbfe5ac2b46882dfcf\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "      ram name=save.ram size=0x800\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    The Peace Keepers\n"
+    "    name:     Peace Keepers, The\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-10\n"
+    "    serial:   SNS-R6-USA\n"
+    "    sha256:   c414a4084b3d03aba19496d2efdd68fcf826194d8f1308f5c98e3a7af2fcc063\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x300000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Boogerman: A Pick and Flick Adventure\n"
+    "    name:     Boogerman - A Pick and Flick Adventure\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-20\n"
+    "    serial:   M/SNS-AB4E-USA\n"
+    "    sha256:   8f131182b286bd87f12cf4f00453336538ce690d0e1f0972ac0be98df4d48987\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x300000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Wayne's World\n"
+    "    name:     Wayne's World\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-WW-USA\n"
+    "    sha256:   56ba3d585bf6b701e342d86a0bd164ab0a97dfbd5df46b3a964506842633459c\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Mario is Missing!\n"
+    "    name:     Mario is Missing!\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-MU-USA\n"
+    "    sha256:   8267e2f092c86d5a29c9a826db82c7473638e28e2507cdaf5c86981f07cd0bef\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=BJ0N revision=01,20\n"
+    "    rom name=program.rom size=0x400000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Samurai Shodown\n"
+    "    name:     Samurai Shodown\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-BJ0N-01\n"
+    "    serial:   SNS-A7SE-USA\n"
+    "    sha256:   5db804171fca42486485ed85e4afe45b29e6d01304bdf75d520bfc42429739e3\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x400000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Star Trek: The Next Generation - Future's Past\n"
+    "    name:     Star Trek - The Next Generation - Future's Past\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-XN-USA\n"
+    "    sha256:   22c907b56ac6f414365801ed375c3fbf75696ce7f34ec89e1724628dc5622957\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A0N revision=01,10,11,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Rocko's Modern Life: Spunky's Dangerous Day\n"
+    "    name:     Rocko's Modern Life - Spunky's Dangerous Day\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A0N-11\n"
+    "    serial:   SNS-8D-USA\n"
+    "    sha256:   cde8876b99c337ff932322506ceef05519e5882b853c54bb8c650d9500cd5957\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Jim Lee's Wild Covert Action Teams\n"
+    "    name:     Jim Lee's Wild Covert Action Teams\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   SNS-AWIE-USA\n"
+    "    sha256:   a314583b11d594b8245b5177aa64a4d3b7497d096edabbea7c1842c57aa2ad2b\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    X-Kaliber 2097\n"
+    "    name:     X-Kaliber 2097\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-X7-USA\n"
+    "    sha256:   dc3792e9fe7ef7aaea4ac675a48ad06129dd3ebdd4b96a513bc8241549cbd579\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Chavez II\n"
+    "    name:     Chavez II\n"
+    "    region:   MX\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-AC2E-USA\n"
+    "    sha256:   39de64101cf7f25863ce55e03a27d13422ea572ee996746578b5936fea80228b\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=BJ0N revision=01,20\n"
+    "    rom name=program.rom size=0x300000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Clay Fighter 2: Judgment Clay\n"
+    "    name:     Clay Fighter 2 - Judgment Clay\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-BJ0N-20\n"
+    "    serial:   SNS-ACZE-USA\n"
+    "    sha256:   2d40c86bc19d85555bf2672acf515b04dbf56a6a59b29ad503e672310b0fae3b\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x300000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=BJ0N revision=01,20\n"
+    "    rom name=program.rom size=0x300000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Clay Fighter: Tournament Edition\n"
+    "    name:     Clay Fighter - Tournament Edition\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-BJ0N-01\n"
+    "    serial:   SNS-7E-USA\n"
+    "    sha256:   ea52b39a8e1ea15bfad6b92883c9a5fe744cecd7c0e175aa3bd40280cf7a966e\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x300000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x300000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Final Fight 3\n"
+    "    name:     Final Fight 3\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-20\n"
+    "    serial:   SNS-AFZE-USA\n"
+    "    sha256:   f9dac709b2c2859f828103a0dd980716817e2bde3b9d7e2fdea36e9bb9bed7f2\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x300000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3M revision=10,20,21,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Super Bases Loaded 3: License to Steal\n"
+    "    name:     Super Bases Loaded 3 - License to Steal\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3M-30\n"
+    "    serial:   SNS-AB3E-USA\n"
+    "    sha256:   b21a161fed748920e54cd72c54095416b1d999636e0388d7d147884779c52833\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Best of the Best: Championship Karate\n"
+    "    name:     Best of the Best - Championship Karate\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-BE-USA\n"
+    "    sha256:   e4e9beaeeb3e968af772d1c4c9e4c1b4dfdba4e47c0205b458e1ab3a62a96060\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Arcade's Greatest Hits: The Atari Collection 1\n"
+    "    name:     Arcade's Greatest Hits - The Atari Collection 1\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    MAXI-1A0N-30-2\n"
+    "    serial:   SNS-AW7E-USA\n"
+    "    sha256:   31569bef662bc438194726967970bf19f504101060763cbd649350362fb6ef2f\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    The Rocketeer\n"
+    "    name:     Rocketeer, The\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-02\n"
+    "    serial:   SNS-RK-USA\n"
+    "    sha256:   b072fd9b08042e3262446fdf418a41848251072a32bd7f8335cc03543c4ae6c8\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Magic Sword\n"
+    "    name:     Magic Sword\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-02\n"
+    "    serial:   SNS-MD-USA\n"
+    "    sha256:   1d3cceaa05e054b002caeb09fd5fb9e718ec446764f4169d97bc185da76fdf4d\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Raiden Trad\n"
+    "    name:     Raiden Trad\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-02\n"
+    "    serial:   SNS-RD-USA\n"
+    "    sha256:   5fd7666e509f9d3cf1fd6b209dc22f2f3848f74eae7b83239d1090e031fc6df2\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Demolition Man\n"
+    "    name:     Demolition Man\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   SNS-AD6E-USA\n"
+    "    sha256:   752d24fab240f4dd1dfbfea5ec83438998316806ad44488bf8c84430ca5a2cd0\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J3M revision=01,11,20\n"
+    "    rom name=program.rom size=0x300000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "    map id=ram address=20-3f,a0-bf:6000-7fff mask=0xe000\n"
+    "  information\n"
+    "    title:    Breath of Fire II\n"
+    "    name:     Breath of Fire II\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J3M-20\n"
+    "    serial:   M/SNS-AF2E-USA\n"
+    "    sha256:   fede9d4aec8c35ed11e2868c3c517bce53ee3e6af724085c92500e99e43e63de\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x300000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    GunForce\n"
+    "    name:     GunForce\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-GU-USA\n"
+    "    sha256:   f921297c361f16ad3f1257e91829638fc795f9323172015d7237ed648c8f7515\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3B revision=20\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    SimEarth: The Living Planet\n"
+    "    name:     SimEarth - The Living Planet\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3B-20\n"
+    "    serial:   SNS-SE-USA\n"
+    "    sha256:   446a1036d036986fdea7906c83832d3ba79ef63a6ed8c4e88b89ab9cb25daded\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A5M revision=01,11,20\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x8000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    ACME Animation Factory\n"
+    "    name:     ACME Animation Factory\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A5M-11\n"
+    "    serial:   SNS-ACME-USA\n"
+    "    sha256:   d07e8802a6d9c777247874e05ec08fce7e0fa1bf122cc1ab9913f7d828e4072b\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x8000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A3B revision=01\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Tecmo Super Bowl\n"
+    "    name:     Tecmo Super Bowl\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A3B-01\n"
+    "    serial:   SNS-7T-USA\n"
+    "    sha256:   35dd020cf57fc402417ab6e4a6c49866c5a86bba25218c0aaf7ce85cb134bcf8\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Nosferatu\n"
+    "    name:     Nosferatu\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-NS-USA\n"
+    "    sha256:   9712829b38f23229d4e3d65da78237659c790235f425c6b12487e4d9e9a37ae9\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Oscar\n"
+    "    name:     Oscar\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-AOZE-USA\n"
+    "    sha256:   0c08e6b817e4d0b333acb910a0bde3d79bd2dc188defc5df9a7c1233fa81c98d\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Syndicate\n"
+    "    name:     Syndicate\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-AFYE-USA\n"
+    "    sha256:   c2015d03dd3db08069b2a6ea1ed6b3e1ac1e3a5f804b02295c3cd3717add91ef\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    True Lies\n"
+    "    name:     True Lies\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   SNS-ATLE-USA\n"
+    "    sha256:   47dd8ea2d12a6bb2a9774de1d492259fc4fb9f8ec7976383bbfd922532671f6b\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Head-On Soccer\n"
+    "    name:     Head-On Soccer\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-AVSE-USA\n"
+    "    sha256:   9ff6bbcce7dc1f3bded96860a86698cab161d13ee167c57b5b114ac646eea0ea\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Super Nova\n"
+    "    name:     Super Nova\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-01\n"
+    "    serial:   SNS-DH-USA\n"
+    "    sha256:   a8acbbd6f8afbf289a6b837da6cd8bd109a00cd38625c956ab8ff739732d9e4f\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3B revision=11,12,13\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-1f,80-9f:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    The Legend of Zelda: A Link to the Past\n"
+    "    name:     Legend of Zelda - A Link to the Past, The\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3B-12\n"
+    "    serial:   SNS-ZL-USA\n"
+    "    sha256:   66871d66be19ad2c34c927d6b14cd8eb6fc3181965b6e517cb361f7316009cfb\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3M revision=10,20,21,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Ultima VII: The Black Gate\n"
+    "    name:     Ultima VII - The Black Gate\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3M-21\n"
+    "    serial:   SNS-7I-USA\n"
+    "    sha256:   a31af0e39afb55bbc92a5543b504327fbe7e8cd0a5e08626976bed7b65376737\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Marvel Super Heroes in War of the Gems\n"
+    "    name:     Marvel Super Heroes in War of the Gems\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-20\n"
+    "    serial:   M/SNS-AHZE-USA\n"
+    "    sha256:   49dd77b310b476c875633335243553be59ecfb0bffae62e46f2e53ff05c20fcd\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Battle Clash\n"
+    "    name:     Battle Clash\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-02\n"
+    "    serial:   SNS-BT-USA\n"
+    "    sha256:   32f42fda0667d9435a2de84c7ce7b067bcbab1164f8f6d837992ad6cfac4f8de\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Rock n' Roll Racing\n"
+    "    name:     Rock & Roll Racing\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-RN-USA\n"
+    "    sha256:   9d721753301278325c851f1843d669a697aed757dcf6495a31fc31ddf664b182\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    James Bond Jr.\n"
+    "    name:     James Bond Jr.\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-02\n"
+    "    serial:   SNS-JJ-USA\n"
+    "    sha256:   9cf82dd9a851cdc38bf2afc286c077ff18a0a5d3bb301eba606cc52db62f8965\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x300000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Pinocchio\n"
+    "    name:     Pinocchio\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-20\n"
+    "    serial:   M/SNS-ACGE-USA\n"
+    "    sha256:   98c51c3bb577600fe79577c323333a791baa30904f37c695890e6e380b75e3c8\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x300000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A1B revision=04,05,06\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    ram name=save.ram size=0x800\n"
+    "    map id=rom address=00-1f,80-9f:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Super Mario World\n"
+    "    name:     Super Mario World\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A1B-06\n"
+    "    serial:   SNS-MW-USA-1\n"
+    "    sha256:   0838e531fe22c077528febe14cb3ff7c492f1f5fa8de354192bdff7137c27f5b\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "      ram name=save.ram size=0x800\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=YA0N revision=01\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Wing Commander: The Secret Missions\n"
+    "    name:     Wing Commander - The Secret Missions\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-YA0N-01\n"
+    "    serial:   SNS-2W-USA\n"
+    "    sha256:   132ca0b6a4888edf7de785d48f4417fac28522646e6c7514f80c5e9ff1438d5f\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1K0N revision=01\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "    necdsp model=uPD7725 frequency=8000000\n"
+    "      rom name=dsp1.program.rom size=0x1800\n"
+    "      rom name=dsp1.data.rom size=0x800\n"
+    "      ram size=0x200\n"
+    "      map id=io address=00-1f,80-9f:6000-7fff select=0x1000\n"
+    "  information\n"
+    "    title:    Michael Andretti's Indy Car Challenge\n"
+    "    name:     Michael Andretti's Indy Car Challenge\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1K0N-01\n"
+    "    serial:   SNS-AMAE-USA\n"
+    "    sha256:   88545d24c60c18c695cc3fce8c4074f46ad1bac905e8a39a61d8a6ae6b608621\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      rom name=dsp1.program.rom size=0x1800\n"
+    "      rom name=dsp1.data.rom size=0x800\n"
+    "      ram name=dsp1.data.ram size=0x200\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Mighty Morphin Power Rangers\n"
+    "    name:     Mighty Morphin Power Rangers\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-52-USA\n"
+    "    sha256:   624a66607caef2ca34920ea15b84b28cdd1916ee089d496cec4f1d43621fdbb3\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    First Samurai\n"
+    "    name:     First Samurai\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-FK-USA\n"
+    "    sha256:   4c1354337efa788169387458fa6bdbcf4be0c98369920af2bd876ad98d29070f\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J5M revision=11,20\n"
+    "    rom name=program.rom size=0x300000\n"
+    "    ram name=save.ram size=0x8000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "    map id=ram address=20-3f,a0-bf:6000-7fff mask=0xe000\n"
+    "  information\n"
+    "    title:    P.T.O. II: Pacific Theater of Operations\n"
+    "    name:     Pacific Theater of Operations II\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J5M-20\n"
+    "    serial:   M/SNS-ATEE-USA\n"
+    "    sha256:   2c6119fbe40d23576adde568d60ffae793bbf6b512f8fea8dcd0b1cd2623ef02\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x300000\n"
+    "      ram name=save.ram size=0x8000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Porky Pig's Haunted Holiday\n"
+    "    name:     Porky Pig's Haunted Holiday\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    MAXI-1A0N-30-2\n"
+    "    serial:   SNS-KX-USA\n"
+    "    sha256:   ee9759fdb590ba908f569c2bb8a63703d282b58b84bd1fe0a472ea47685acdc5\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J3M revision=01,11,20\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "    map id=ram address=20-3f,a0-bf:6000-7fff mask=0xe000\n"
+    "  information\n"
+    "    title:    NHL '95\n"
+    "    name:     NHL '95\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J3M-11\n"
+    "    serial:   SNS-ANHE-USA\n"
+    "    sha256:   01c0b58d5fd5d5484fea988455a55a71ed9e606538d2b3ce3f216159cc6929b0\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Lethal Enforcers\n"
+    "    name:     Lethal Enforcers\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-LK-USA\n"
+    "    sha256:   3bc5f296c3dbee012e93a5cf25568f9288ce87b34d74085401a560350eaca03f\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Thomas the Tank Engine & Friends\n"
+    "    name:     Thomas the Tank Engine & Friends\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-6T-USA\n"
+    "    sha256:   1121df3f05dd9dbb749f6b785eb9b3eb69968004f9d6ceffa6f84757af2f3702\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A3M revision=01,11,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    NBA Live '96\n"
+    "    name:     NBA Live '96\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A3M-20\n"
+    "    serial:   M/SNS-A6BE-USA\n"
+    "    sha256:   2d6fc4214245684a8f8f9bb553de637b7c660919ec775bfe3baaf74060c9157e\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    We're Back!: A Dinosaur's Story\n"
+    "    name:     We're Back! - A Dinosaur's Story\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-6D-USA\n"
+    "    sha256:   e931c3c08f20f78e3a43ad92d16eb472be619abaa17c2d8e2b0fcd5d05dbd74d\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3M revision=10,20,21,30\n"
+    "    rom name=program.rom size=0x300000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Frank Thomas' Big Hurt Baseball\n"
+    "    name:     Frank Thomas' Big Hurt Baseball\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3M-30\n"
+    "    serial:   SNS-AFKE-USA\n"
+    "    sha256:   ba93721bdb0f19506e722bc580d0b4dad6e8648dddbc52e3ce45dd75ea165f72\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x300000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2J0N revision=01,10,11\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    The Great Circus Mystery: Starring Micky & Minnie\n"
+    "    name:     Great Circus Mystery - Starring Micky & Minnie, The\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2J0N-11\n"
+    "    serial:   SNS-4C-USA\n"
+    "    sha256:   b5492aea296ee4bfcd2c677fbec5153fd4c4db758c835b372ef750cf2399649b\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Wings 2: Aces High\n"
+    "    name:     Wings 2 - Aces High\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-02\n"
+    "    serial:   SNS-WG-USA\n"
+    "    sha256:   c3bcd5c716f96e6359ebcfd85c3e9b07b46c5124bf4010d89ceef5b6f2f868f6\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super Godzilla\n"
+    "    name:     Super Godzilla\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    MAXI-1A0N-30-2\n"
+    "    serial:   SNS-7G-USA\n"
+    "    sha256:   33dda5838264c93341ef865512e4b86e16fd4a0387eda04e331517bfaecf1c0b\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super Smash T.V.\n"
+    "    name:     Super Smash TV\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-01\n"
+    "    serial:   SNS-TV-USA\n"
+    "    sha256:   8b75ab4bb1b63c45a56e7a4c5a37c0864f14375ab3131edc33489764426ad888\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2J5M revision=01\n"
+    "    rom name=program.rom size=0x140000\n"
+    "    ram name=save.ram size=0x8000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "    map id=ram address=10-1f,90-9f:6000-7fff mask=0xe000\n"
+    "    map id=ram address=30-3f,b0-bf:6000-7fff mask=0xe000\n"
+    "  information\n"
+    "    title:    Operation Europe: Path to Victory 1939-45\n"
+    "    name:     Operation Europe - Path to Victory 1939-45\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2J5M-01\n"
+    "    serial:   SNS-YP-USA\n"
+    "    sha256:   9e1a39aaf3585af0d6a5d79de3c35fcfe030c34bd4b09606a6fb8c7def19340b\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x140000\n"
+    "      ram name=save.ram size=0x8000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J3M revision=01,11,20\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "    map id=ram address=20-3f,a0-bf:6000-7fff mask=0xe000\n"
+    "  information\n"
+    "    title:    Nobunga's Ambition\n"
+    "    name:     Nobunga's Ambition\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J3M-01\n"
+    "    serial:   SNS-NZ-USA\n"
+    "    sha256:   437ea48711d54c2275286170a17948cb57ba9d961ba475715c0dba5fbd61a2db\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3B revision=11,12,13\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-1f,80-9f:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Drakkhen\n"
+    "    name:     Drakkhen\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3B-11\n"
+    "    serial:   SNS-DK-USA\n"
+    "    sha256:   74910ce01d19d25cb97a243a51f21c3d522f02fb116682f60440da3292bb14f7\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Arkanoid: Doh It Again!\n"
+    "    name:     Arkanoid - Doh It Again!\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   SNS-A6-USA\n"
+    "    sha256:   14d3ece30898587eda20c661a4a55ec595ba6352ca1f0bfc177542aa0eef0039\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A5M revision=01,11,20\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x8000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Mario Paint\n"
+    "    name:     Mario Paint\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A5M-20\n"
+    "    serial:   SNS-MP-USA-1\n"
+    "    sha256:   e842cac1a4301be196f1e137fbd1a16866d5c913f24dbca313f4dd8bd7472f45\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x8000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Contra III: The Alien Wars\n"
+    "    name:     Contra III - The Alien Wars\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-CS-USA\n"
+    "    sha256:   a93ea87fc835c530b5135c5294433d15eef6dbf656144b387e89ac19cf864996\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Road Runner's Death Valley Rally\n"
+    "    name:     Road Runner's Death Valley Rally\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-DV-USA\n"
+    "    sha256:   2e8203e421f97cf165f03a5d4f69dadf0bcca18c42c6a1dfe79c8705c522cc54\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Adventures of Yogi Bear\n"
+    "    name:     Adventures of Yogi Bear\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-Y8-USA\n"
+    "    sha256:   8049175767eddbc3e21ca5b94ee23fc225f834ccfab4ded30d2e981b0ef73ab6\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super Black Bass\n"
+    "    name:     Super Black Bass\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    MAXI-1A0N-30-2\n"
+    "    serial:   SNS-BQ-USA\n"
+    "    sha256:   f0913358cb0870c3dcc7f0c0d2d69704874c31a113150eda668c95024c0d6fd9\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=BA0N revision=01,10\n"
+    "    rom name=program.rom size=0x300000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    World Heroes 2\n"
+    "    name:     World Heroes 2\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-BA0N-01\n"
+    "    serial:   SNS-JI-USA\n"
+    "    sha256:   159d5341d13d6801324e8271f7191c0223617c9d30984676319b2df7937c78c0\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x300000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A0N revision=01,10,11,20\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Brett Hull Hockey\n"
+    "    name:     Brett Hull Hockey '94\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A0N-01\n"
+    "    serial:   SNS-5Y-USA\n"
+    "    sha256:   99450b45ccc70a1ed387f968c8f863a3c7f6a4b86809e841c25a71e1e904ac61\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Wolf Child\n"
+    "    name:     Wolf Child\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-WH-USA\n"
+    "    sha256:   e0165bafeb8d65be08a5a4079f8651104471f450c60794b761b1255853ca2d98\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A0N revision=01,10,11,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Capcom's Soccer Shootout\n"
+    "    name:     Capcom's Soccer Shootout\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A0N-11\n"
+    "    serial:   SNS-JL-USA\n"
+    "    sha256:   fd5761f9dd1f2b87ad11df6085046d0dfcdc3a79139263e47b0cff707966ba51\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Bonkers\n"
+    "    name:     Bonkers\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-ABNE-USA\n"
+    "    sha256:   854d2492d1cb059749bb0904ca5f92a5eeec09167abf84f7cca4023b1819e4f0\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Musya: The Classic Japanese Tale of Horror\n"
+    "    name:     Musya - The Classic Japanese Tale of Horror\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-MY-USA\n"
+    "    sha256:   f292598ac462fdfcd32ad9b6b35ac01d4bab020391dff92bfe94780ec604289a\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Battletoads & Double Dragon\n"
+    "    name:     Battletoads & Double Dragon\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    MAXI-1A0N-30-1\n"
+    "    serial:   SNS-UL-USA\n"
+    "    sha256:   c7f0269498d190e4fd0f6f880a148fbe3713cd3a632083bac1e5bd18f8172371\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Desert Strike: Return to the Gulf\n"
+    "    name:     Desert Strike - Return to the Gulf\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-RG-USA\n"
+    "    sha256:   606abf536440173ae36466db360c7db6b474beb7a105c8a62bc74a54cbe1c38b\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Math Blaster: Episode One\n"
+    "    name:     Math Blaster - Episode One\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-AMME-USA\n"
+    "    sha256:   22453182d44380f08004a12c6492a0c4b2e1f584e268dcc3296a03ea03ae0909\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x300000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Foreman For Real\n"
+    "    name:     Foreman For Real\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   SNS-AFEE-USA\n"
+    "    sha256:   bc6b0344a434644c391ac69a53c7720c51e2d3c5c082b8d78598ae4df100c464\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x300000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Wheel of Fortune\n"
+    "    name:     Wheel of Fortune\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-WL-USA\n"
+    "    sha256:   12abf1ba063c120c1a98495a1c85e67a0007aff771ef92adcb94b4a0a2fd5adb\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J3M revision=01,11,20\n"
+    "    rom name=program.rom size=0x400000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "    map id=ram address=20-3f,a0-bf:6000-7fff mask=0xe000\n"
+    "  information\n"
+    "    title:    Chrono Trigger\n"
+    "    name:     Chrono Trigger\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J3M-20\n"
+    "    serial:   M/SNS-ACTE-USA\n"
+    "    sha256:   06d1c2b06b716052c5596aaa0c2e5632a027fee1a9a28439e509f813c30829a9\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x400000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Toys: Let the Toy Wars Begin!\n"
+    "    name:     Toys - Let the Toy Wars Begin!\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-YT-USA\n"
+    "    sha256:   7a6e5da46b026900fba4584a32ad40d940b9ecf9fccfb11f96a205a914014784\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    The Legend of the Mystical Ninja\n"
+    "    name:     Legend of the Mystical Ninja, The\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-01\n"
+    "    serial:   SNS-GG-USA\n"
+    "    sha256:   c865fb17e8c59a21d32b9a605319241fa74ec732e3f0ee58f5d7fcbd8ee57c6b\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Mohawk & Headphone Jack\n"
+    "    name:     Mohawk & Headphone Jack\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-AJYE-USA\n"
+    "    sha256:   8715a641f2e4dd8b6066be7f2683d9129fff3fcccaf0a09cc8bdd2aa56460764\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3B revision=11,12,13\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-1f,80-9f:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Goal!\n"
+    "    name:     Goal!\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3B-13\n"
+    "    serial:   SNS-SU-USA\n"
+    "    sha256:   feff03cfa195512ad87dc876012d70520cf192e2874c518b6dbdf3d876ea60c4\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Clue\n"
+    "    name:     Clue\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-CL-USA\n"
+    "    sha256:   03f6c69aef92d36b5ea25a6023368da0e1da9fa160e8316ebd533d4f358ffacf\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Hagane\n"
+    "    name:     Hagane\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-20\n"
+    "    serial:   M/SNS-AHGE-USA\n"
+    "    sha256:   5a6deb5617e86a9f4b981031e939510e30c5c8ad047f5f012e40442113fd28c2\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A0N revision=01,10,11,20\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Mortal Kombat\n"
+    "    name:     Mortal Kombat\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A0N-10\n"
+    "    serial:   SNS-KX-USA\n"
+    "    sha256:   3c6d3e4a9c9af160f1c1cf11ce4ead531d9500c1f58f1cbe682c90a5eaa3efb2\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A1B revision=04,05,06\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x800\n"
+    "    map id=rom address=00-1f,80-9f:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Super Conflict\n"
+    "    name:     Super Conflict\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A1B-06\n"
+    "    serial:   SNS-CN-USA\n"
+    "    sha256:   6cbc4db85cb8420020f9edbfd290c0f435b313a59577aca65314d31f8b816620\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x800\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Battle Grand Prix\n"
+    "    name:     Battle Grand Prix\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-BG-USA\n"
+    "    sha256:   6e436020d967d35a0f7ce43e38e83a616b70696ae7d35b37cd56601cfb3822ba\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J5M revision=11,20\n"
+    "    rom name=program.rom size=0x300000\n"
+    "    ram name=save.ram size=0x8000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "    map id=ram address=20-3f,a0-bf:6000-7fff mask=0xe000\n"
+    "  information\n"
+    "    title:    Romance of the Three Kingdoms IV: Wall of Fire\n"
+    "    name:     Romance of the Three Kingdoms IV - Wall of Fire\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J5M-20\n"
+    "    serial:   M/SNS-AS4E-USA\n"
+    "    sha256:   9670c67eeeb5581fa5345025a2e2ee875179e0da9f5be4bf78641e477d785f17\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x300000\n"
+    "      ram name=save.ram size=0x8000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super Double Dragon\n"
+    "    name:     Super Double Dragon\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-02\n"
+    "    serial:   SNS-WD-USA\n"
+    "    sha256:   bcced1be76ef920b562a555696bcb4583d1c8cea4d4b057cab6e0e09be8ef8c4\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super Turrican 2\n"
+    "    name:     Super Turrican 2\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-A2TE-USA\n"
+    "    sha256:   96da3512a1aa05a40f1e5d61c48932b0d55d9f136d6418b848153a9fecab06de\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Out of This World\n"
+    "    name:     Out of This World\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-TW-USA\n"
+    "    sha256:   582548dc86598a3557e9e3c27285c81964b006a954affe5c73948da5375ea11c\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J5M revision=11,20\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    ram name=save.ram size=0x8000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "    map id=ram address=20-3f,a0-bf:6000-7fff mask=0xe000\n"
+    "  information\n"
+    "    title:    NHL '98\n"
+    "    name:     NHL '98\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J5M-20\n"
+    "    serial:   SNS-A8HE-USA\n"
+    "    sha256:   8113c2cedafc8fd5a56c8638ae340fb275f263ff5c5e18d04dc6c3ebc5cfffee\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "      ram name=save.ram size=0x8000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Frantic Flea\n"
+    "    name:     Frantic Flea\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-AF8E-USA\n"
+    "    sha256:   25b380f529f5a9295df7c0adcc5213d67f131f552d078a3d8f545f988047c90a\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Boxing Legends of the Ring\n"
+    "    name:     Boxing Legends of the Ring\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-LL-USA\n"
+    "    sha256:   e67940a2106c1507f3a8d38790f263bbbf814578ebf3dbc4e3eb6007d310793c\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super Pinball: Behind the Mask\n"
+    "    name:     Super Pinball - Behind the Mask\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-XP-USA\n"
+    "    sha256:   6bf0e7a7b95613b9d0e5c8cc98eee5d0ac200e88b5d4444ad5cf93d3e8265118\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A0N revision=01,10,11,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Knights of the Round\n"
+    "    name:     Knights of the Round\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A0N-11\n"
+    "    serial:   SNS-LO-USA\n"
+    "    sha256:   fb601ead645edce139b0483d3155b4e3d7ab245bf87a3a66cb88c0a617c0a526\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    The Ren & Stimpy Show: Fire Dogs\n"
+    "    name:     Ren & Stimpy Show - Fire Dogs, The\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-6Y-USA\n"
+    "    sha256:   71e7083cfcf32b738f60f5eeffd4f9d1fd9250afbde0c56e22a4b97abac377a1\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    NBA All-Star Challenge\n"
+    "    name:     NBA All-Star Challenge\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-NB-USA\n"
+    "    sha256:   c70b812a9d2df7f95b279e4050e03a4b8a68588a370816e645f378296b84e5d1\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Home Alone\n"
+    "    name:     Home Alone\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-01\n"
+    "    serial:   SNS-HA-USA\n"
+    "    sha256:   7c34908526db2a634216fab0276c42a8e4e22d59c728cd586200142a12dd2c2c\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J3M revision=01,11,20\n"
+    "    rom name=program.rom size=0x300000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "    map id=ram address=20-3f,a0-bf:6000-7fff mask=0xe000\n"
+    "  information\n"
+    "    title:    NBA Hang Time\n"
+    "    name:     NBA Hang Time\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J3M-20\n"
+    "    serial:   SNS-AXGE-USA\n"
+    "    sha256:   af2fe0627de2bb2672f4f65dcbdaaee22b211275f679f123d5fa5d37fd699363\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x300000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Cyber Spin\n"
+    "    name:     Cyber Spin\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-CF-USA\n"
+    "    sha256:   c4ae2797fac2586b8640064be6398f2b4f2b3158a07f26c66912b29f7fd197de\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x300000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Kyle Petty's No Fear Racing\n"
+    "    name:     Kyle Petty's No Fear Racing\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-20\n"
+    "    serial:   M/SNS-AKPE-USA\n"
+    "    sha256:   daf3e45bafbec81ffa5911b94810b2cd267574de717292360f9940f41fb2a6a9\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x300000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Brunswick World Tournament of Champions\n"
+    "    name:     Brunswick World Tournament of Champions\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-20\n"
+    "    serial:   SNS-AWUE-USA\n"
+    "    sha256:   ee00c57ddfa9b967d1857acb518df039ba73055bdebe78db014de0f5da262fd9\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Speed Racer in My Most Dangerous Adventures\n"
+    "    name:     Speed Racer in My Most Dangerous Adventures\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   SNS-9S-USA\n"
+    "    sha256:   54046ec1fc57f6165ad33080502f72809d1b06b438a5a0d0a80ffa2bb3df8b0b\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Kirby's Avalanche\n"
+    "    name:     Kirby's Avalanche\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-PQ-USA\n"
+    "    sha256:   67937dd7a29a93b1aaabb6df89f0748369ff47f3f6c655a402c00d5657973140\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    No Escape\n"
+    "    name:     No Escape\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-ANOE-USA\n"
+    "    sha256:   f099937ac4c8afb38c517c5d85475224985fb8f345dacb44994a617ea05bf4e5\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Madden NFL '94\n"
+    "    name:     Madden NFL '94\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-01\n"
+    "    serial:   SNS-9M-USA\n"
+    "    sha256:   7e77e196db47e87a5b297e60f0dfa7ce41df8d2d1fdd9152e06628d0b0e586af\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A0N revision=01,10,11,20\n"
+    "    rom name=program.rom size=0x140000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Aero Fighters\n"
+    "    name:     Aero Fighters\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A0N-11\n"
+    "    serial:   SNS-AERE-USA\n"
+    "    sha256:   b737de81315eef8ded7cfd5df6b37aba01d9e6e14566486db7ec83eb0c1aa85e\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x140000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=YA0N revision=01\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Run Saber\n"
+    "    name:     Run Saber\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-YA0N-01\n"
+    "    serial:   SNS-RU-USA\n"
+    "    sha256:   4158e3e8890a52f0b12dc9ad5a29276058a247ff41e9f1d22897ebde1eb11269\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A3B revision=01\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Super Mario All-Stars\n"
+    "    name:     Super Mario All-Stars\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A3B-01\n"
+    "    serial:   SNS-4M-USA\n"
+    "    sha256:   a9e3e57d591e995e8e0dd228b619b6aed42205eaf55316fa8ff33f236b3a32b3\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3B revision=11,12,13\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-1f,80-9f:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Xardion\n"
+    "    name:     Xardion\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3B-12\n"
+    "    serial:   SNS-XA-USA\n"
+    "    sha256:   71b69490c78d0bbaf47da25217c5dae295190311aa5df75653c3fac0a1b45358\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Timon & Pumbaa's Jungle Games\n"
+    "    name:     Timon & Pumbaa's Jungle Games\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-20\n"
+    "    serial:   SNS-AJ9E-USA\n"
+    "    sha256:   271a67b32b3bb00ceb0f4e7d81494888d0d821635f0f936d481dfbe671567c08\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2P3B revision=01\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-0f,80-8f:8000-ffff\n"
+    "    map id=rom address=40-4f,c0-cf:0000-ffff\n"
+    "  information\n"
+    "    title:    くにおくんのドッジボールだよ 全員集合! トーナメント スペシャル\n"
+    "    name:     Kunio-kun no Dodge Ball da yo - Zen'in Shuugou! Tournament Special\n"
+    "    region:   JP\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2P3B-01\n"
+    "    serial:   N/A\n"
+    "    sha256:   bcba4ca39f0279f7a52657bccbffa84564eaea455e2565597b93942ec245fdb1\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2J3M revision=01,11,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "    map id=ram address=10-1f,30-3f:6000-7fff mask=0xe000\n"
+    "    map id=ram address=90-9f,b0-bf:6000-7fff mask=0xe000\n"
+    "  information\n"
+    "    title:    TNN Bass Tournament of Champions\n"
+    "    name:     TNN Bass Tournament of Champions\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2J3M-20\n"
+    "    serial:   M/SNS-ATNE-USA\n"
+    "    sha256:   ced8c0bc2791ffe47cb9eec03db67567945af8c58b5330326722f1cfca41bf51\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    The Adventures of Mighty Max\n"
+    "    name:     Adventures of Mighty Max, The\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-AMOE-USA\n"
+    "    sha256:   889beb58d2a48a05a6230cabda14555cb030e2e986c0293bdf396e85af5c6798\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Final Fight Guy\n"
+    "    name:     Final Fight Guy\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-FY-USA\n"
+    "    sha256:   8c47f9dc79748c0ae6c648f8480614d22eaefade065612ad1fe749fc3db4d1bc\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    The Lord of the Rings: Volume 1\n"
+    "    name:     Lord of the Rings - Volume 1, The\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-64-USA\n"
+    "    sha256:   62557ee2a3fc3b5a3f59431f966eb61bb380ba983ef6c7742cb55cf075f15f6c\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Lamborghini American Challenge\n"
+    "    name:     Lamborghini American Challenge\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-L8-USA\n"
+    "    sha256:   48cd9476fef1ed685b9c30dd1669b46048f7295cbbb2abcfa5b1a48699346ea3\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Jammit\n"
+    "    name:     Jammit\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-J6-USA\n"
+    "    sha256:   8b7b33f3d2edb844f1d43cfdd595b8c2cb6fc005d59acb899a1afda999e47638\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Jurassic Park\n"
+    "    name:     Jurassic Park\n"
+    "    region:   NA\n"
+    "    revision: 1.1\n"
+    "    board:    MAXI-1A0N-30-1\n"
+    "    serial:   SNS-J8-USA\n"
+    "    sha256:   0a4e9d6fa2ac16aa51da5538d93280734de480e44c430173ed14826c84553c7d\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x400000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Ultimate Mortal Kombat 3\n"
+    "    name:     Ultimate Mortal Kombat 3\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-20\n"
+    "    serial:   SNS-A3ZE-USA\n"
+    "    sha256:   cb2fdfce61858063bf4c9da4228381c3ec3abe423f4d378cddd174ae4adb261e\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x400000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Eek! The Cat\n"
+    "    name:     Eek! The Cat\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-E7-USA\n"
+    "    sha256:   5d658b63d35e2e0baf48ae3bb04ea5e1553855b34bb39fc2c7ca41fbd3894d52\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Time Slip\n"
+    "    name:     Time Slip\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-XT-USA\n"
+    "    sha256:   8e82f98d2e62bc1e5fcf2386c2b5ca54998398220efcedd67858aaaa92289a42\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=BJ0N revision=01,20\n"
+    "    rom name=program.rom size=0x300000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Street Hockey '95\n"
+    "    name:     Street Hockey '95\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-BJ0N-01\n"
+    "    serial:   SNS-AHYE-USA\n"
+    "    sha256:   6756f92fe8e066be4b204cfdc94c1615ba6ece7e78fb5d2c77c81a9d298aa744\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x300000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Family Feud\n"
+    "    name:     Family Feud\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-FN-USA\n"
+    "    sha256:   4f43ce12e1d8cd195468d7048494ad2930721e5bf9e69bfd86eeee707ffc634b\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=YA0N revision=01\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Zombies Ate My Neighbors\n"
+    "    name:     Zombies Ate My Neighbors\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-YA0N-01\n"
+    "    serial:   SNS-ZA-USA\n"
+    "    sha256:   b27e2e957fa760f4f483e2af30e03062034a6c0066984f2e284cc2cb430b2059\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Firestriker\n"
+    "    name:     Firestriker\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-3S-USA\n"
+    "    sha256:   6f32355bef68d4ad58822f50074b46bcc9a68357cd2c6a5470c96bf5344f84d8\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    WWF Super Wrestlemania\n"
+    "    name:     WWF Super Wrestlemania\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    MAXI-1A0N-30-2\n"
+    "    serial:   SNS-WF-USA\n"
+    "    sha256:   0b9abf2fc25a5f07c71f9d8efbb0d0e616c1494060138fbb63f7398e9c26198e\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Paperboy 2\n"
+    "    name:     Paperboy 2\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-01\n"
+    "    serial:   SNS-P2-USA\n"
+    "    sha256:   7cec4ffc3eda0441561717cf55927901b5fbbd669c254079f78ca74c67c4a17b\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Aaahh!!! Real Monsters\n"
+    "    name:     Aaahh!!! Real Monsters\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    MAXI-1A0N-30-2\n"
+    "    serial:   SNS-ANNE-USA\n"
+    "    sha256:   ce164872c4f5814bce04cf0565edcdb5b7969ae95a3b5cd515cfb626b5cde7b3\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super Caesers Palace\n"
+    "    name:     Super Caesers Palace\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-C6-USA\n"
+    "    sha256:   d42f8c7969b4c434f9ca04ce0080d897877a5e71c2926d309ef5dae93ba25548\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A0N revision=01,10,11,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Ultimate Fighter\n"
+    "    name:     Ultimate Fighter\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A0N-11\n"
+    "    serial:   SNS-HP-USA\n"
+    "    sha256:   78bf82963cded9162e25035053c8b1a9f760748ff0beacc230d005204992737d\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3M revision=10,20,21,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Wario's Woods\n"
+    "    name:     Wario's Woods\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3M-21\n"
+    "    serial:   SNS-65-USA\n"
+    "    sha256:   be420715152394e0e4a25ab10931b67f92f910cfcf7793e31dfee1c6334808e5\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Cacoma Knight in Bizyland\n"
+    "    name:     Cacoma Knight in Bizyland\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-CC-USA\n"
+    "    sha256:   a8294d449bbb8370816efe0374704e8af20dbbde9c19afe969d898528bc293d0\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    The Pirates of Dark Water\n"
+    "    name:     Pirates of Dark Water, The\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-8P-USA\n"
+    "    sha256:   447dfa710e69479159e9d407474fbf5f67d3a3330ab0c7627afd123ded3fdb3a\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Firepower 2000\n"
+    "    name:     Firepower 2000\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-FW-USA\n"
+    "    sha256:   003dba0193acc5336840307194643ca3b1f848dcfc77580b4e17c605105b27f5\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Terminator 2: The Arcade Game\n"
+    "    name:     Terminator 2 - The Arcade Game\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    MAXI-1A0N-30-2\n"
+    "    serial:   SNS-XV-USA\n"
+    "    sha256:   365f10f9d9f68cc59e769eeb451c417e1ff7415022a625de9976a3b924c0bd61\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=BJ0N revision=01,20\n"
+    "    rom name=program.rom size=0x400000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Saturday Night Slam Masters\n"
+    "    name:     Saturday Night Slam Masters\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-BJ0N-01\n"
+    "    serial:   SNS-ZW-USA\n"
+    "    sha256:   34e1af0642c85148c5a3dc3c7ab4bcbda13a9fea190934b5526c555fff035651\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x400000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Hit the Ice\n"
+    "    name:     Hit the Ice\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-HC-USA\n"
+    "    sha256:   fa418618787145291201b3d9247048b2d7dfba37f6556dcb1d40db499124dd60\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Magic Boy\n"
+    "    name:     Magic Boy\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-YG-USA\n"
+    "    sha256:   c01fb8989d391d3e343003934937f02bd8ef9aacdad68c32c3d3f56feb72f5b0\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super Batter Up\n"
+    "    name:     Super Batter Up\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-02\n"
+    "    serial:   SNS-FA-USA\n"
+    "    sha256:   165938810948f3226f7446978fa36ae8bc781616d95b39cd126d5c8afbf6e2ee\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super Off Road\n"
+    "    name:     Super Off Road\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-01\n"
+    "    serial:   SNS-OR-USA\n"
+    "    sha256:   24b687f95bb9737d223738f13c00aeaa7d697fa9e2fd50597b81d0cfa2160daa\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A3M revision=01,11,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Tecmo Secret of the Stars\n"
+    "    name:     Tecmo Secret of the Stars\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A3M-20\n"
+    "    serial:   M/SNS-AQ-USA\n"
+    "    sha256:   7da4a3cfa5de4bb4722a6e2a42c26aae322b5e668f1645d8c870fb99e6080600\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3M revision=10,20,21,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    NBA Live '98\n"
+    "    name:     NBA Live '98\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    EA-1A3M-30/P10019\n"
+    "    serial:   SNS-A8LE-USA\n"
+    "    sha256:   1d1b257dcf859cc412d3a9521fc58dc876a5917e6a69cd1d960a8e9840454bb4\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Mary Shelley's Frankenstein\n"
+    "    name:     Mary Shelley's Frankenstein\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-AFRE-USA\n"
+    "    sha256:   2731f0bd1c87e75121f41d1ed5cc9fbf177f414b8bf831c76fd9c4b58c86ed08\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=BJ0N revision=01,20\n"
+    "    rom name=program.rom size=0x280000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Fighter's History\n"
+    "    name:     Fighter's History\n"
+    "    region:   NA\n"
+    "    revision: 1.1\n"
+    "    board:    SHVC-BJ0N-01\n"
+    "    serial:   SNS-YH-USA\n"
+    "    sha256:   b9594d588816ae570ea5fea14577ed47de4db9ac9a40a116c84e0ad7a2ce58f8\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x280000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Spanky's Quest\n"
+    "    name:     Spanky's Quest\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-02\n"
+    "    serial:   SNS-HJ-USA\n"
+    "    sha256:   14dc44687c8da35aec63b9edadbaac21bf7293f5171646f614139192e82ab071\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Bass Masters Classic: Pro Edition\n"
+    "    name:     Bass Masters Classic - Pro Edition\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-A9BE-USA\n"
+    "    sha256:   db1ac03cc8b7daaa812da239029bcf999b30b2afe1c03d51f7ae849a796617ea\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A0N revision=01,10,11,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Bass Masters Classic\n"
+    "    name:     Bass Masters Classic\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A0N-20\n"
+    "    serial:   M/SNS-ABAE-USA\n"
+    "    sha256:   c670e16c076f6d92ba581b78769b604e79ad567c04c647dac557f45a48c3448f\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Captain Novolin\n"
+    "    name:     Captain Novolin\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-CP-USA\n"
+    "    sha256:   8784614896e2b3e8d98c8166613ca5d2329643795a4dc107791c58c6c51e1268\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Street Fighter II: The World Warrior\n"
+    "    name:     Street Fighter II - The World Warrior\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-S2-USA\n"
+    "    sha256:   2b34161e96ef3f0f48cecd67e531a9bb94310652d8686f301bac426e4ab97e77\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Pro Quarterback\n"
+    "    name:     Pro Quarterback\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-QB-USA\n"
+    "    sha256:   85e2e58e1f99fce366c85d49f77446395584ca4959ef772a707fe454ed46c68f\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Bio Metal\n"
+    "    name:     Bio Metal\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-BV-USA\n"
+    "    sha256:   de1de85ad549a6aaf0431cceb47cbd07e1f6e81f9e16fd62575305e2c1f06240\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=BA3M revision=01\n"
+    "    rom name=program.rom size=0x280000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Super Mario All-Stars + Super Mario World\n"
+    "    name:     Super Mario All-Stars + Super Mario World\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-BA3M-01\n"
+    "    serial:   SNS-5M-USA\n"
+    "    sha256:   a8806bfe07cd3c9945d9fd3fcea932ae1cd671cab5cae12bb7a2ae726cbf9175\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x280000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3M revision=10,20,21,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    ESPN National Hockey Night\n"
+    "    name:     ESPN National Hockey Night\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3M-21\n"
+    "    serial:   SNS-AEHE-USA\n"
+    "    sha256:   3326061160ad12c7aef5176544ec1c8ef2f534a51960ca882dbc7fcb9b1a7384\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A5M revision=01,11,20\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    ram name=save.ram size=0x8000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Tecmo Super Bowl III: Final Edition\n"
+    "    name:     Tecmo Super Bowl III - Final Edition\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A5M-20\n"
+    "    serial:   M/SNS-AW4E-USA\n"
+    "    sha256:   8cfd4c5525f4bd4bba5af7e2323f1e61f27ce97c6d5617cfa685c9276fbf6407\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "      ram name=save.ram size=0x8000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3M revision=10,20,21,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    ESPN Sunday Night NFL\n"
+    "    name:     ESPN Sunday Night NFL\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3M-21\n"
+    "    serial:   SNS-ASNE-USA\n"
+    "    sha256:   faf595b4671f005fa9367ba3fcd30dbff371bc7a9ca8bbfbc0ebfcc5826b60f8\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Pinball Fantasies\n"
+    "    name:     Pinball Fantasies\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   SNS-APFE-USA\n"
+    "    sha256:   0888d20ab2f834c77b0a2dc2162c43890a1640adc78c6b0bb5892ca8d5008ad3\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    NHL '94\n"
+    "    name:     NHL '94\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-4H-USA\n"
+    "    sha256:   5132e1c0d466963e6adc09e8a608ebd90619ab94f7fc908d626bbaf6a99dfa19\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board id:BSC-1J3M-01\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-1f,80-9f:8000-ffff\n"
+    "    map id=rom address=40-5f,c0-df:0000-ffff\n"
+    "    map id=ram address=20-3f,a0-bf:6000-7fff mask=0xe000\n"
+    "    satellaview\n"
+    "      map id=rom address=20-3f,a0-bf:8000-ffff\n"
+    "      map id=rom address=60-7d,e0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    鮫亀\n"
+    "    name:     Same Game\n"
+    "    region:   JP\n"
+    "    revision: 1.0\n"
+    "    board:    BSC-1J3M-01\n"
+    "    serial:   SHVC-ZS5J-JPN\n"
+    "    sha256:   3a709383208d8258dceb20a5e566903326515ba42931bf97fd389a415a13a72d\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Lemmings\n"
+    "    name:     Lemmings\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-01\n"
+    "    serial:   SNS-LE-USA\n"
+    "    sha256:   4b28d2ddab405976bb56e41a40ec1ea11d7362a8f398d5f8c117d715a15719ca\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3B revision=11,12,13\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-1f,80-9f:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Aerobiz\n"
+    "    name:     Aerobiz\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3B-13\n"
+    "    serial:   SNS-AL-USA\n"
+    "    sha256:   d5f0fbeed3774bbccbd769698fc4051487a0a5eb699790a8a094451595600f60\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Ninja Gaiden Trilogy\n"
+    "    name:     Ninja Gaiden Trilogy\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-ANRE-USA\n"
+    "    sha256:   fccc96af24a2463b1c53253e1c5c8ef63641355fae53c0fb410427f29743262b\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3M revision=10,20,21,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Shadowrun\n"
+    "    name:     Shadowrun\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3M-10\n"
+    "    serial:   SNS-WR-USA\n"
+    "    sha256:   e6bc0a595d5c7c4bc0bbb61ffe35a70288a77eb78544ed74682d489a9e6f07f4\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Bubsy II\n"
+    "    name:     Bubsy II\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-10\n"
+    "    serial:   SNS-ABBE-USA\n"
+    "    sha256:   2357d344af77d25dda030520ce203045fd9060f83e3b9609a228dba859d9017b\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Art of Fighting\n"
+    "    name:     Art of Fighting\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-01\n"
+    "    serial:   SNS-RW-USA\n"
+    "    sha256:   55e57c5e012583ff0fafd1aee16b3f8269ee2b34fe10f10b93ba0dde72f2b78d\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    The Untouchables\n"
+    "    name:     Untouchables, The\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-UC-USA\n"
+    "    sha256:   ecefb4117a6aae117e033c8cc07f0db2797d6be93dd5cdcefc23692a21fae02e\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A0N revision=01,10,11,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Bugs Bunny: Rabbit Rampage\n"
+    "    name:     Bugs Bunny - Rabbit Rampage\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A0N-11\n"
+    "    serial:   SNS-R7-USA\n"
+    "    sha256:   49020695a017acc3dfadea97a60e28609e583571f69c5abeb3c6b1c2db8113fa\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Aero the Acro-Bat\n"
+    "    name:     Aero the Acro-Bat\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-XB-USA\n"
+    "    sha256:   18a553dafd4980cc2869180b05f9fdf6e980bf092cc683e498ec6373c9701c6e\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A1B revision=04,05,06\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x800\n"
+    "    map id=rom address=00-1f,80-9f:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    NCAA Basketball\n"
+    "    name:     NCAA Basketball\n"
+    "    region:   NA\n"
+    "    revision: 1.1\n"
+    "    board:    SHVC-1A1B-06\n"
+    "    serial:   SNS-DU-USA\n"
+    "    sha256:   8ef5d5c50ffeca1e62e88e4fe2909eaf191e28fbb5a9faf98b7b10bea72c9ed9\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x800\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Mickey's Ultimate Challenge\n"
+    "    name:     Mickey's Ultimate Challenge\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-6U-USA\n"
+    "    sha256:   add082caffe707df2c0259489c3e272d6557ab07ba3ff856cbc0adba0d7db6a5\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J3M revision=01,11,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "    map id=ram address=20-3f,a0-bf:6000-7fff mask=0xe000\n"
+    "  information\n"
+    "    title:    NHL '96\n"
+    "    name:     NHL '96\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J3M-20\n"
+    "    serial:   M/SNS-A6HE-USA\n"
+    "    sha256:   d24c0175ee4eafed88e277691c5f5dafd4e197723097e2eb68aa6b40f449fff2\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    X-Men: Mutant Apocalypse\n"
+    "    name:     X-Men - Mutant Apocalypse\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    MAXI-1J0N-20-1\n"
+    "    serial:   SNS-AXME-USA\n"
+    "    sha256:   65fe17fd6b297f52df6ce9812ecb02c3bb1bfda3ebc05a19c4a8decbf9a446ae\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3M revision=10,20,21,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Wizardry V: Heart of the Maelstrom\n"
+    "    name:     Wizardry V - Heart of the Maelstrom\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3M-20\n"
+    "    serial:   SNS-W5-USA\n"
+    "    sha256:   bc68f40075f9983f5027fe264c3037d1a831e8e76a6c9adb60d10226f6ef005b\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J1M revision=11,20\n"
+    "    rom name=program.rom size=0x400000\n"
+    "    ram name=save.ram size=0x800\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "    map id=ram address=20-3f,a0-bf:6000-7fff mask=0xe000\n"
+    "  information\n"
+    "    title:    Donkey Kong Country\n"
+    "    name:     Donkey Kong Country\n"
+    "    region:   NA\n"
+    "    revision: 1.1\n"
+    "    board:    SHVC-1J1M-11\n"
+    "    serial:   SNS-8X-USA\n"
+    "    sha256:   df2644d435330192a13768cc1f79c5aa3084a64217a5250c6dd4ffdbe2175be4\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x400000\n"
+    "      ram name=save.ram size=0x800\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Tetris 2\n"
+    "    name:     Tetris 2\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-27-USA\n"
+    "    sha256:   accc836c3adabadc810fbe35702c6a64d50a09f4c672d2734fa58b251d7a20aa\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2DC0N revision=01\n"
+    "    hitachidsp model=HG51B169 frequency=20000000\n"
+    "      rom name=program.rom size=0x180000\n"
+    "      ram size=0\n"
+    "      rom name=cx4.data.rom size=0xc00\n"
+    "      ram size=0xc00\n"
+    "      map id=io address=00-3f,80-bf:6000-7fff\n"
+    "      map id=rom address=00-3f,80-bf:8000-ffff mask=0x8000\n"
+    "      map id=ram address=70-77:0000-7fff\n"
+    "  information\n"
+    "    title:    Mega Man X2\n"
+    "    name:     Mega Man X2\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2DC0N-01\n"
+    "    serial:   SNS-ARXE-USA\n"
+    "    sha256:   da484f2a636b8d692840f40e5468e992c5f2af26d365c69fbc12ef2923588d23\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "      rom name=cx4.data.rom size=0xc00\n"
+    "      ram name=cx4.data.ram size=0xc00\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super Widget\n"
+    "    name:     Super Widget\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-WI-USA\n"
+    "    sha256:   62d3d650e956f23f3b221f83c5c5bd204afd0e4f4d9c47a3251962323de96089\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Faceball 2000\n"
+    "    name:     Faceball 2000\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-02\n"
+    "    serial:   SNS-2F-USA\n"
+    "    sha256:   d689392884df91c2bb84b1411a96f3919b6c9cc8a583dff901a98f0d86d31c30\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3M revision=10,20,21,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Obitus\n"
+    "    name:     Obitus\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3M-21\n"
+    "    serial:   SNS-7B-USA\n"
+    "    sha256:   31bc862ab0a8eabf23b5124e13940cb3501e7ecdd3f15e34142248ceb4aa139a\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Young Merlin\n"
+    "    name:     Young Merlin\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-Y6-USA\n"
+    "    sha256:   fbe8926fc0149d3e8e2aec20f15640ea6814f4f4b01c3960f3c477f5f17e890f\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Bulls vs. Blazers and the NBA Playoffs\n"
+    "    name:     Bulls vs. Blazers and the NBA Playoffs\n"
+    "    region:   NA\n"
+    "    revision: 1.1\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-BU-USA-1\n"
+    "    sha256:   d8b3d9267470adb8ef2d197ade44476e504c0823f8fe9d2cf2883a03aa75bd49\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=LDH3C revision=01\n"
+    "    spc7110\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      rom name=data.rom size=0x400000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "      map id=io address=00-3f,80-bf:4800-483f\n"
+    "      map id=io address=50,58:0000-ffff\n"
+    "      map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "      map id=rom address=c0-ff:0000-ffff\n"
+    "      map id=ram address=00-3f,80-bf:6000-7fff mask=0xe000\n"
+    "    epsonrtc\n"
+    "      ram name=rtc.ram size=0x10\n"
+    "      map id=io address=00-3f,80-bf:4840-4842\n"
+    "  information\n"
+    "    title:    Far East of Eden 天外魔境 Zero 少年ジャンプの章\n"
+    "    name:     Far East of Eden - Tengai Makyou Zero - Shounen Jump no Shou\n"
+    "    region:   JP\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-LDH3C-01\n"
+    "    serial:   SHVC-AZQJ-JPN\n"
+    "    sha256:   69d06a3f3a4f3ba769541fe94e92b42142e423e9f0924eab97865b2d826ec82d\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      rom name=data.rom size=0x400000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "      ram name=rtc.ram size=0x10\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Stargate\n"
+    "    name:     Stargate\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-AGTE-USA\n"
+    "    sha256:   9ffd95486904804aca1f7068c99f1c9e91c2c0e5474ec758df1a913393571cc7\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3B revision=11,12,13\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-1f,80-9f:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Bill Laimbeer's Combat Basketball\n"
+    "    name:     Bill Laimbeer's Combat Basketball\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3B-12\n"
+    "    serial:   SNS-C8-USA\n"
+    "    sha256:   6fa6b8a8804ff6544bdedf94339a86ba64ce0b6dbf059605abb1cd6f102d3483\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    NBA Give 'n Go\n"
+    "    name:     NBA Give & Go\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   SNS-ANJE-USA\n"
+    "    sha256:   5874b942f974bb906d8cbc33b601a1faf8f14aee8d0995124c8dc84bb4973808\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x300000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    WeaponLord\n"
+    "    name:     WeaponLord\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-20\n"
+    "    serial:   M/SNS-AWDE-USA\n"
+    "    sha256:   0b1ba31ae95b61d7d9a0f5509b5836fff84f60915802e3b3ba1170a5c50a4b71\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x300000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    The Lawnmower Man\n"
+    "    name:     Lawnmower Man, The\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-LW-USA\n"
+    "    sha256:   a179a1188220b59787c49a78a0dde79b89380e3a8a8a0ab558f0102c5796f873\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    S.O.S.: Sink or Swim\n"
+    "    name:     Sink or Swim\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-9J-USA\n"
+    "    sha256:   70008efe51185eb0a2f8d8d8ac2bdbb99bd3dfcc169dcc474962f82692998051\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Rampart\n"
+    "    name:     Rampart\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-02\n"
+    "    serial:   SNS-RM-USA\n"
+    "    sha256:   e19f7d8d5c3e4cefeff5889380d8780495e01f0553d13be4182a15a5d4b615bb\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A0N revision=01,10,11,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Fatal Fury\n"
+    "    name:     Fatal Fury\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A0N-01\n"
+    "    serial:   SNS-GN-USA\n"
+    "    sha256:   c92f389d25870aada3002775838ec9f69a988120c0238af885fd08d46bd94930\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Speedy Gonzales: Los Gatos Bandidos\n"
+    "    name:     Speedy Gonzales - Los Gatos Bandidos\n"
+    "    region:   NA\n"
+    "    revision: 1.1\n"
+    "    board:    MAXI-1A0N-30-2\n"
+    "    serial:   SNS-ASEE-USA\n"
+    "    sha256:   68a51b7a06b6a9e7100a89521e52b5c467c46c828c0f6504bee677beac2aa6fd\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2J0N revision=01,10,11\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Super Bonk\n"
+    "    name:     Super Bonk\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2J0N-11\n"
+    "    serial:   SNS-ANKE-USA\n"
+    "    sha256:   21d4a72461d8680cf75cf3b8eba42e13127815bc17b6249d89a5e39beb3f1406\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A3M revision=01,11,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Wayne Gretzky and the NHLPA All-Stars\n"
+    "    name:     Wayne Gretzky and the NHLPA All-Stars\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A3M-20\n"
+    "    serial:   M/SNS-AWZE-USA\n"
+    "    sha256:   dd73690dd3165a16580e191c92a497102758f312c759353f685e371755c663a8\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Turn and Burn: No-Fly Zone\n"
+    "    name:     Turn and Burn - No-Fly Zone\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-ZN-USA\n"
+    "    sha256:   e4343c0fadc00ffdc3dc31345068d751eea5d639f826731f08cb81673d508c40\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Out to Lunch\n"
+    "    name:     Out to Lunch\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-P8-USA\n"
+    "    sha256:   54b2f03393109ac7fd36d8c7752f15a44d9607ab0187a371b853191db3592c01\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0xe0000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Spectre\n"
+    "    name:     Spectre\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-7Q-USA\n"
+    "    sha256:   22d0b7687d66436abaf447bb29558e43f562283ec4dbe744df7d79a3e27a2577\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0xe0000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3M revision=10,20,21,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    True Golf: Wicked 18\n"
+    "    name:     True Golf - Wicked 18\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3M-10\n"
+    "    serial:   SNS-W8-USA\n"
+    "    sha256:   dd96a8f4f9c8988301ff710a4c70ebe3bf7914901f3547abe1d5f0dd5c0b921b\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    BlaZeon: The Bio-Cyborg Challenge\n"
+    "    name:     BlaZeon - The Bio-Cyborg Challenge\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-BL-USA\n"
+    "    sha256:   0d4e0d134396bd1c7254cdc1da356eb944ca14910b6690f484a75a9c3a8106e7\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=BJ0N revision=01,20\n"
+    "    rom name=program.rom size=0x400000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Super Street Fighter II: The New Challengers\n"
+    "    name:     Super Street Fighter II - The New Challengers\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-BJ0N-01\n"
+    "    serial:   SNS-XW-USA\n"
+    "    sha256:   d17cb5c73174060fcbd9cba6c705643f19c3b8be24d0f7ee43aee674ff1ea38e\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x400000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=YA0N revision=01\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Barbie Super Star\n"
+    "    name:     Barbie Super Star\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-YA0N-01\n"
+    "    serial:   SNS-8L-USA\n"
+    "    sha256:   865919b25a9d241c907bcda18b380e3c704f33f4997ad44559046f0f08c4968b\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Cool World\n"
+    "    name:     Cool World\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-CD-USA\n"
+    "    sha256:   9674cc269d89a52d1719a487b44acf004fb777cbd58d76b19a2cd25749728215\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3B revision=11,12,13\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-1f,80-9f:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Final Fantasy: Mystic Quest\n"
+    "    name:     Final Fantasy - Mystic Quest\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3B-13\n"
+    "    serial:   SNS-MQ-USA\n"
+    "    sha256:   6151389f33ce2e53db3cd99592440c0020f5f4668f581ce3bd615bc92077f255\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Batman Returns\n"
+    "    name:     Batman Returns\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-BJ-USA\n"
+    "    sha256:   f8d5c51f74df33edc827fbf8df7aab70160770ab0a896db6e59438ad9208cc6e\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Wheel of Fortune: Deluxe Edition\n"
+    "    name:     Wheel of Fortune - Deluxe Edition\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    MAXI-1A0N-30\n"
+    "    serial:   SNS-XF-USA\n"
+    "    sha256:   c7af9e7f3243ba1b5dd81f32f710e60c2ae1d443ecaf7140bf42d71a1b69d8a2\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Race Drivin'\n"
+    "    name:     Race Drivin'\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-02\n"
+    "    serial:   SNS-RV-USA\n"
+    "    sha256:   dd0feb78e2d5d81f59241baf3bca5e2edaebbe98f0ac860a4eb6d448718f1ca5\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3M revision=10,20,21,30\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Jimmy Houston's Bass Tournament, U.S.A.\n"
+    "    name:     Jimmy Houston's Bass Tournament, USA\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3M-30\n"
+    "    serial:   M/SNS-AFUE-USA\n"
+    "    sha256:   6abe908b4005a68d1f6e9a54339c94a33db41801890d8c058ce974fdab3d0bcd\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J3M revision=01,11,20\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "    map id=ram address=20-3f,a0-bf:6000-7fff mask=0xe000\n"
+    "  information\n"
+    "    title:    Mark Davis' The Fishing Master\n"
+    "    name:     Mark Davis' The Fishing Master\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J3M-20\n"
+    "    serial:   M/SNS-AOAE-USA\n"
+    "    sha256:   908440f96fd0df14602fc6d1daee8519fc31f765ad00bf64aaba35c2c6ef0b56\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Full Throttle: All-American Racing\n"
+    "    name:     Full Throttle - All-American Racing\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-AFTE-USA\n"
+    "    sha256:   3db8a496a49d47b1ac2a893feaf682722765b2cde63c22af3aa68212dcfa975f\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Street Combat\n"
+    "    name:     Street Combat\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-RA-USA\n"
+    "    sha256:   b4626cf0c876a124b50f9421c48a7d762e9ed808ad336c799d543d60b484897c\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Spindizzy Worlds\n"
+    "    name:     Spindizzy Worlds\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-SX-USA\n"
+    "    sha256:   fe10238ae42ed9eb4d906a81dd50ebe585140982cdfe266308ce1f16e78e6903\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2J0N revision=01,10,11\n"
+    "    rom name=program.rom size=0x140000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Operation Thunderbolt\n"
+    "    name:     Operation Thunderbolt\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2J0N-11\n"
+    "    serial:   SNS-36-USA\n"
+    "    sha256:   5cbed0401734142184166917427d24f9e5f107a7adea665e2f4b4101491ad54b\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x140000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1L3B revision=02,11\n"
+    "    sa1\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "      ram size=0x800\n"
+    "      map id=io address=00-3f,80-bf:2200-23ff\n"
+    "      map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "      map id=rom address=c0-ff:0000-ffff\n"
+    "      map id=bwram address=00-3f,80-bf:6000-7fff\n"
+    "      map id=bwram address=40-4f:0000-ffff\n"
+    "      map id=iram address=00-3f,80-bf:3000-37ff\n"
+    "  information\n"
+    "    title:    Power Rangers Zeo: Battle Racers\n"
+    "    name:     Power Rangers Zero - Battle Racers\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1L3B-11\n"
+    "    serial:   M/SNS-A4RE-USA\n"
+    "    sha256:   2e2a8c0da7f6def617077a25b222062f6988ef14b36b2edfe10d47c6a942d023\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "      ram name=internal.ram size=0x800\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Clay Fighter\n"
+    "    name:     Clay Fighter\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-01\n"
+    "    serial:   SNS-8C-USA\n"
+    "    sha256:   8b7525b2aa30cbea9e3deee601dd26e0100b8169c1948f19866be15cae0ac00d\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super Solitaire\n"
+    "    name:     Super Solitaire\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-LT-USA\n"
+    "    sha256:   5985cdad45958a5b8c5967ad39efe51569f560bf237a4e9864f21111082a8500\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    The Magical Quest Starring Mickey Mouse\n"
+    "    name:     Magical Quest Starring Mickey Mouse, The\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-MI-USA\n"
+    "    sha256:   f301bb8ea867e530ecb64e8eff504ed5b9697cf076c70e2036ecf2ffbe6c487a\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Jungle Strike\n"
+    "    name:     Jungle Strike\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    MJSC-1A0N-30-2\n"
+    "    serial:   M/SNS-AJGE-USA\n"
+    "    sha256:   8d812ea4fa897274116f7f43bc689e110f1cfbd3f7eb3a1737c2a85d36369159\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Warlock\n"
+    "    name:     Warlock\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-AWKE-USA\n"
+    "    sha256:   8579dd352d20589072ed5c026bde7adadd6229d18a022e7cb47cf5602b54015e\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A0N revision=01,10,11,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Ninja Warriors\n"
+    "    name:     Ninja Warriors\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A0N-11\n"
+    "    serial:   SNS-NI-USA\n"
+    "    sha256:   3c109e50b91ec6df3bb8509778ae544c99433fb40dda9b801178dfe513053618\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    International Tennis Tour\n"
+    "    name:     International Tennis Tour\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-IT-USA\n"
+    "    sha256:   4e8044b1e7a779685d6751351eef2391272ac8b2bd909edeecfc3d3c5a594bef\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    GP-1\n"
+    "    name:     GP-1\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-G7-USA\n"
+    "    sha256:   342ddf438aec3f0696de8f2cd74bb7f48a956f488f1246eeccaff5ef246ca50b\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    D-Force\n"
+    "    name:     D-Force\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-01\n"
+    "    serial:   SNS-DF-USA\n"
+    "    sha256:   337e643d3e63915de06429992f306e8d2b73aed6849b795f9c855c2d03c18180\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    World Soccer '94: Road to Glory\n"
+    "    name:     World Soccer '94 - Road to Glory\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-WO-USA\n"
+    "    sha256:   2143bbd87ea1c5cfe5eaf46ae39e3ebb11a2e929d05cbb929904037f4d72acfe\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x300000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Maui Mallard in Cold Shadow\n"
+    "    name:     Maui Mallard in Cold Shadow\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-AZBE-USA\n"
+    "    sha256:   a203a13870eaec92095daef1196a0c9fe8416e600504d55dd0dc724d4f5f5cb0\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x300000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A3M revision=01,11,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Tecmo Super Baseball\n"
+    "    name:     Tecmo Super Baseball\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A3M-11\n"
+    "    serial:   SNS-ATBE-USA\n"
+    "    sha256:   c3cb1d2fd9775aa9d15b7eedd45ad82519b73d47ca166737ed398c748717bcc4\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Izzy's Quest for the Olympic Rings\n"
+    "    name:     Izzy's Quest for the Olympic Rings\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   SNS-AIZE-USA\n"
+    "    sha256:   183af7d642b55d52cd594786ec2f031d033cc6c8c1a2a84a834e4ada04301b26\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super Bases Loaded\n"
+    "    name:     Super Bases Loaded\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-01\n"
+    "    serial:   SNS-SP-USA\n"
+    "    sha256:   a8239355631d303ecebfd43fc14e80f148e4ac9937234e29cc87d6f939b033a0\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Congo's Caper\n"
+    "    name:     Congo's Caper\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-J2-USA\n"
+    "    sha256:   26e09f5bc2bde28d57aeca0bf5be7f7fb8e3b3887af975bcbf2e6f29b07df56f\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A3M revision=01,11,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Troy Aikman Football\n"
+    "    name:     Troy Aikman Football\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A3M-11\n"
+    "    serial:   SNS-YQ-USA\n"
+    "    sha256:   46fcca4ce29f472afa8519958d256eec347c2dc2da154c95f263a051c5c02dbb\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Super Bomberman\n"
+    "    name:     Super Bomberman\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-10\n"
+    "    serial:   SNS-H6-USA\n"
+    "    sha256:   4efab3f49cbe91ec77b6cba747ddfedfdc0b080c755a8b6ba51234f0676c000f\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Scooby-Doo Mystery\n"
+    "    name:     Scooby-Doo Mystery\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   SNS-AXDE-USA\n"
+    "    sha256:   7fb5236d10852125f0f37c2188b907d636647400a57bccbdb2f63098ffae8b2d\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Newman-Haas IndyCar featuring Nigel Mansell\n"
+    "    name:     Newman-Haas IndyCar featuring Nigel Mansell\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-ANME-USA\n"
+    "    sha256:   489d6d704d3d917d9b46ce382230700419983a8d0d61a98fe07e08c935522dde\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Casper\n"
+    "    name:     Casper\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-AXCE-USA\n"
+    "    sha256:   b9b982cd8f91c51089d49b550f11882b1ee785ebddcb7355cfc465916d61a042\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A1M revision=01,11,20\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    ram name=save.ram size=0x800\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Lemmings 2: The Tribes\n"
+    "    name:     Lemmings 2 - The Tribes\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A1M-11\n"
+    "    serial:   SNS-L2-USA\n"
+    "    sha256:   63ecdca7f89b2432ccd57bdb81c0875f6336353f5897f756ef162ab2ec2ee707\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "      ram name=save.ram size=0x800\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A0N revision=01,10,11,20\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Revolution X: Music is the Weapon\n"
+    "    name:     Revolution X - Music is the Weapon\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A0N-20\n"
+    "    serial:   M/SNS-AXRE-USA\n"
+    "    sha256:   5fb072c3c2e9d8e7f84bea9c4bf2253e6868eb2b1f13e35a7d75fdf05896d873\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    The Incredible Crash Dummies\n"
+    "    name:     Incredible Crash Dummies, The\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-C7-USA\n"
+    "    sha256:   0415adfe80977485f84cdffaaa79f18c91c004c7dba202b4cf9a94eb11adeada\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Brett Hull Hockey '95\n"
+    "    name:     Brett Hull Hockey '95\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-ABHE-USA\n"
+    "    sha256:   a427db4860cb5140935f263ba872fe14949c3548db644fed46b2edf3dff3d4a8\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Castlevania: Dracula X\n"
+    "    name:     Castlevania - Dracula X\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-ADZE-USA\n"
+    "    sha256:   367725a149a471411e4f72ad77603b61fb101c9cab4521be5647e13708cc97ba\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3M revision=10,20,21,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    NBA Live '97\n"
+    "    name:     NBA Live '97\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    EA-1A3M-30/P10019\n"
+    "    serial:   SNS-A7LE-USA\n"
+    "    sha256:   4b945493d28653d5d047a375136ec9792f27e652be4af00e2c03c40369bd6ecf\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J3M revision=01,11,20\n"
+    "    rom name=program.rom size=0x300000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "    map id=ram address=20-3f,a0-bf:6000-7fff mask=0xe000\n"
+    "  information\n"
+    "    title:    Secret of Evermore\n"
+    "    name:     Secret of Evermore\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J3M-20\n"
+    "    serial:   M/SNS-AEOE-USA\n"
+    "    sha256:   17c864a76d498feb6479eee8e7d6807b951c66225033228622bb66754baab1db\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x300000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    The Lost Vikings\n"
+    "    name:     Lost Vikings\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-LV-USA-1\n"
+    "    sha256:   9f7782a92fda789f9d119b1f0a2f7da0f35606357556a48eca9487797ee1a888\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super Scope 6\n"
+    "    name:     Super Scope 6\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-01\n"
+    "    serial:   SNS-LR-USA\n"
+    "    sha256:   7a8ffaf8bb549b400ec2f0bda9f3c0dbf5852c38618cdb21cd783c368383e2c7\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3M revision=10,20,21,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    ABC Monday Night Football\n"
+    "    name:     ABC Monday Night Football\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3M-10\n"
+    "    serial:   SNS-N5-USA\n"
+    "    sha256:   bb83f982961c33b81fefc1f545e18ab572d1c43cf6c241948544f05a1a71f2ba\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3B revision=11,12,13\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-1f,80-9f:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    La Legende de Zelda: La Triforce des Dieux\n"
+    "    name:     Legende de Zelda - La Triforce des Dieux, La\n"
+    "    region:   QC\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3B-13\n"
+    "    serial:   SNS-ZF-CAN\n"
+    "    sha256:   dd499445275fca6692c0487a8bd70a23f6c8e78e766df0e3c58fbbe53f8adb06\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Power Piggs of the Dark Age\n"
+    "    name:     Power Piggs of the Dark Age\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-AOTE-USA\n"
+    "    sha256:   0288ec049723cd0c7f1148cdc1aef0b6922b8a756affe373c99d5690e0dfceaa\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Last Action Hero\n"
+    "    name:     Last Action Hero\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-L5-USA\n"
+    "    sha256:   314d53f409b66ba3f4426a6f1bb7c69f6779aeed277ce2e19535f94d7c8ca586\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    International Superstar Soccer Deluxe\n"
+    "    name:     International Superstar Soccer Deluxe\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   SNS-AWJE-USA\n"
+    "    sha256:   d2fe66c1ce66c65ce14e478c94be2e616f9e2cad374b5783a6a64d3c1a99cfa9\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    U.N. Squadron\n"
+    "    name:     UN Squadron\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-01\n"
+    "    serial:   SNS-E8-USA\n"
+    "    sha256:   0b155a54b6134601fc0791252a63ca73efd522667c3d6fd7a44f5b3c500039d7\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Dragon: The Bruce Lee Story\n"
+    "    name:     Dragon - The Bruce Lee Story\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-20\n"
+    "    serial:   M/SNS-AD5E-USA\n"
+    "    sha256:   d98d7da1e7636e067563e2e480d7dfbc013b7e9bdf1329fd61c5cacac0293e1d\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Metal Warriors\n"
+    "    name:     Metal Warriors\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-AWME-USA\n"
+    "    sha256:   0d7f875877fe856066cfb39b4ecdbbe7d48393a75770720876c94419f809bb1c\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Rap Jam: Volume One\n"
+    "    name:     Rap Jam - Volume One\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   SNS-ARVE-USA\n"
+    "    sha256:   920bbaaf6a32cab5feabb5bc8b2b427dccd53bfd31d0da8acb7ea4e819139e4f\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super Adventure Island\n"
+    "    name:     Super Adventure Island\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-01\n"
+    "    serial:   SNS-H2-USA\n"
+    "    sha256:   190999122aacc2cff20c5677b3f60ed938d8a36b696d16cc1bf416705efe151e\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Wing Commander\n"
+    "    name:     Wing Commander\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-WC-USA\n"
+    "    sha256:   2167fc7c5447b2287668d2f3e4ef1a285361b2292ecc8a4cbd9f966a460ad7a2\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1L3B revision=02,11\n"
+    "    sa1\n"
+    "      rom name=program.rom size=0x400000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "      ram size=0x800\n"
+    "      map id=io address=00-3f,80-bf:2200-23ff\n"
+    "      map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "      map id=rom address=c0-ff:0000-ffff\n"
+    "      map id=bwram address=00-3f,80-bf:6000-7fff\n"
+    "      map id=bwram address=40-4f:0000-ffff\n"
+    "      map id=iram address=00-3f,80-bf:3000-37ff\n"
+    "  information\n"
+    "    title:    Kirby Super Star\n"
+    "    name:     Kirby Super Star\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1L3B-11\n"
+    "    serial:   SNS-AKFE-USA\n"
+    "    sha256:   4e095fbbdec4a16b075d7140385ff68b259870ca9e3357f076dfff7f3d1c4a62\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x400000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "      ram size=0x800\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1CB0N7S revision=01\n"
+    "    superfx revision=4\n"
+    "      rom name=program.rom size=0x200000\n"
+    "      ram name=save.ram size=0x10000\n"
+    "      map id=io address=00-3f,80-bf:3000-34ff\n"
+    "      map id=rom address=00-3f:8000-ffff mask=0x8000\n"
+    "      map id=rom address=40-5f:0000-ffff\n"
+    "      map id=ram address=00-3f,80-bf:6000-7fff size=0x2000\n"
+    "      map id=ram address=70-71:0000-ffff\n"
+    "  information\n"
+    "    title:    Doom\n"
+    "    name:     Doom\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1CB0N7S-01\n"
+    "    serial:   SNS-AD8E-USA\n"
+    "    sha256:   d45e26eb10c323ecd480e5f2326b223e29264c3adde67f48f0d2791128e519e8\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "      ram name=save.ram size=0x10000\n"
+    "      superfx revision=4\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super Chase H.Q.\n"
+    "    name:     Super Chase HQ\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-QT-USA\n"
+    "    sha256:   b839253b878821ff00847491d11452e933baaf303f49dd39d22e3a524ea1ff81\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Ardy Light Foot\n"
+    "    name:     Ardy Light Foot\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-A9-USA\n"
+    "    sha256:   0f474dafe5a26f3dea491d18073dd490d2f1f91313a7e91086565510d38d9a09\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A1B revision=04,05,06\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x800\n"
+    "    map id=rom address=00-1f,80-9f:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    MechWarrior\n"
+    "    name:     MechWarrior\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A1B-06\n"
+    "    serial:   SNS-WM-USA\n"
+    "    sha256:   2a08704748f5ef6488348c4099729feca600412d331bda3756e51efd8b94e113\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x800\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Pit-Fighter\n"
+    "    name:     Pit-Fighter\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-01\n"
+    "    serial:   SNS-PF-USA\n"
+    "    sha256:   c2a1a66648a0a0bfe2f201cf4f926d138e410fbf85ecf436ccb9aac70c0df3de\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A5M revision=01,11,20\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    ram name=save.ram size=0x8000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Tecmo Super Bowl II: Special Edition\n"
+    "    name:     Tecmo Super Bowl II - Special Edition\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A5M-11\n"
+    "    serial:   SNS-ASBE-USA\n"
+    "    sha256:   2972057a0087f8239d2523eaa995405f06e5d5ba3a3203b6b50d401379c8ebde\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "      ram name=save.ram size=0x8000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3M revision=10,20,21,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Utopia: The Creation of a Nation\n"
+    "    name:     Utopia - The Creation of a Nation\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3M-10\n"
+    "    serial:   SNS-UP-USA\n"
+    "    sha256:   2500d6c846c78bcb729f15535bf2b852a120411891cabaaaa6fc407906d0214e\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    The Super Aquatic Games starring the Aquabats\n"
+    "    name:     Super Aquatic Games starring the Aquabats, The\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-AU-USA\n"
+    "    sha256:   b64f9f95fb244feddb3ff50bf0972af88f5d006e9b09050b930374fef8b37862\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A3M revision=01,11,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Might & Magic III: Isles of Terra\n"
+    "    name:     Might & Magic III - Isles of Terra\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A3M-20\n"
+    "    serial:   SNS-3H-USA\n"
+    "    sha256:   835ded9479f0e7babae00405d85233d767e82fa247aa1a9cdc14fd1f147b62ef\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2J3M revision=01,11,20\n"
+    "    rom name=program.rom size=0x140000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "    map id=ram address=10-1f,30-3f:6000-7fff mask=0xe000\n"
+    "    map id=ram address=90-9f,b0-bf:6000-7fff mask=0xe000\n"
+    "  information\n"
+    "    title:    Liberty or Death\n"
+    "    name:     Liberty or Death\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2J3M-01\n"
+    "    serial:   SNS-7L-USA\n"
+    "    sha256:   8fcb9c34aea863d49ff08a0ace3f83d301b81f01e2ede28bee7e6d778878d0cc\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x140000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Jeopardy! Deluxe Edition\n"
+    "    name:     Jeopardy! Deluxe Edition\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-7J-USA\n"
+    "    sha256:   76d760da59aa7fc2fd4426c1d1aec57412703ab901b9df60ac2be16ede80b0e7\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    SeaQuest DSV\n"
+    "    name:     SeaQuest DSV\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-ASQE-USA\n"
+    "    sha256:   a4ab8cfad2f236675b1c0124f8484688e149f38e8628a3b38e9ec14d491ec07e\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Sonic Blast Man\n"
+    "    name:     Sonic Blast Man\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-SK-USA\n"
+    "    sha256:   75a7b5b8ad0329dc828d3201089e125fd55fdfc99d4cec704ffcd7e3036c2410\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x300000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Primal Rage\n"
+    "    name:     Primal Rage\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-20\n"
+    "    serial:   M/SNS-AR9E-USA\n"
+    "    sha256:   55376715f243b1bacd9aeecf1092bbc7837fe512592a2c1703d24b0829fc1934\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x300000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Krusty's Super Fun House\n"
+    "    name:     Krusty's Super Fun House\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-02\n"
+    "    serial:   SNS-FH-USA\n"
+    "    sha256:   bed18c968aee0eb0c866c1964c28135364cd6d65fff7bcb5873342c04e63750d\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Olympic Summer Games\n"
+    "    name:     Olympic Summer Games\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-20\n"
+    "    serial:   M/SNS-AO9E-USA\n"
+    "    sha256:   a137f4fc1c635f706d10e0c7927e71f52da171ce2d27394ce0deb451b5bed8ae\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2J0N revision=01,10,11\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    ActRaiser 2\n"
+    "    name:     ActRaiser 2\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2J0N-01\n"
+    "    serial:   SNS-A8-USA\n"
+    "    sha256:   71bdd448a30b88725864e55594ebb67a118b1f197a3f9e5dd39dbf23399efa15\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Mr. Nutz\n"
+    "    name:     Mr. Nutz\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-N8-USA\n"
+    "    sha256:   3472dd574b50aed2fa998f464398db4fbb00f5a300a672c3737ee9336a008a16\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1K0N revision=01\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "    necdsp model=uPD7725 frequency=8000000\n"
+    "      rom name=dsp1.program.rom size=0x1800\n"
+    "      rom name=dsp1.data.rom size=0x800\n"
+    "      ram size=0x200\n"
+    "      map id=io address=00-1f,80-9f:6000-7fff select=0x1000\n"
+    "  information\n"
+    "    title:    Lock On\n"
+    "    name:     Lock On\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1K0N-01\n"
+    "    serial:   SNS-AZ-USA\n"
+    "    sha256:   0e2ba574ff73587f211c8f818d444631584832e9240548f003171c11b898ad62\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "      rom name=dsp1.program.rom size=0x1800\n"
+    "      rom name=dsp1.data.rom size=0x800\n"
+    "      ram name=dsp1.data.ram size=0x200\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x400000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Mortal Kombat 3\n"
+    "    name:     Mortal Kombat 3\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-20\n"
+    "    serial:   SNS-A3ME-USA\n"
+    "    sha256:   417874aa57856fe93eefdb24066fa1a9ca3f23c72c09d5247ae2b3ab4b3d09d1\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x400000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    John Madden Football '93\n"
+    "    name:     Madden NFL '93\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-MF-USA-1\n"
+    "    sha256:   3e62872bf69ea90dd7093608268f8defa2c6016adb1011745dab3c2af45d69b7\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super Turrican\n"
+    "    name:     Super Turrican\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-TU-USA\n"
+    "    sha256:   056ac8160363d577e3ffc2f593801b8bb3d024fe4f3a3331b711dc556204949d\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Space Megaforce\n"
+    "    name:     Space Megaforce\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-AT-USA\n"
+    "    sha256:   f5b7418c00ccac44615cfc57c7e17d57533837056886f6d733e6b714c36dec1f\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Sterling Sharpe: End 2 End\n"
+    "    name:     Sterling Sharpe - End 2 End\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-AS2E-USA\n"
+    "    sha256:   e3b07a59f969ced91c4579bb459f2c747a6c3f12c45ae4776483ef4830f5f00f\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Choplifter III\n"
+    "    name:     Choplifter III\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   SNS-3C-USA-1\n"
+    "    sha256:   9a064b67f522b75b82d0857519c0e33b4dbbe494c2ef79a44fdc913d605d0b26\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A3M revision=01,11,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Breath of Fire\n"
+    "    name:     Breath of Fire\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A3M-11\n"
+    "    serial:   SNS-BF-USA\n"
+    "    sha256:   cbc496a7879ba78f32c51c3df4ba1a1a42f17d78d48a39ea9c709d1ad18cb8df\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2J0N revision=01,10,11\n"
+    "    rom name=program.rom size=0x140000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Michael Jordan: Chaos in the Windy City\n"
+    "    name:     Michael Jordan - Chaos in the Windy City\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2J0N-11\n"
+    "    serial:   SNS-AWCE-USA\n"
+    "    sha256:   1b425ea5a883b7464637b74c2937fde699ffff52b53ad6940a66285e0663194a\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x140000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3B revision=11,12,13\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-1f,80-9f:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Tecmo Super NBA Basketball\n"
+    "    name:     Tecmo Super NBA Basketball\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3B-13\n"
+    "    serial:   SNS-XM-USA\n"
+    "    sha256:   14bce564f976d1431127259edbcb23c52c79361fed9814d307d627c4650e800e\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Al Unser Jr.'s Road to the Top\n"
+    "    name:     Al Unser Jr.'s Road to the Top\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-AUJE-USA\n"
+    "    sha256:   0099bdb56e4190f81440c8c29395ecc15d78eeabfc38a93dca4773817d6f720f\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Tetris Attack\n"
+    "    name:     Tetris Attack\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   SNS-AYLE-USA-1\n"
+    "    sha256:   579bf1a1988d4af06a69cc1d82a2478ebe51940c5ced7f97e83029a24e6aa778\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super Ghouls 'n Ghosts\n"
+    "    name:     Super Ghouls & Ghosts\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-01\n"
+    "    serial:   SNS-CM-USA\n"
+    "    sha256:   7468c271d7240cf4e0d08c16e9969a1b1b1caf5adc0e5adc568d93c92651a057\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=BJ0N revision=01,20\n"
+    "    rom name=program.rom size=0x400000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Toy Story\n"
+    "    name:     Toy Story\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-BJ0N-20\n"
+    "    serial:   SNS-AQHE-USA\n"
+    "    sha256:   345e795000e74f51704774edfc8049473461761a65eb47cab710caa29e09897b\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x400000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    ESPN Baseball Tonight\n"
+    "    name:     ESPN Baseball Tonight\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-EV-USA\n"
+    "    sha256:   c702c3860e9dffdaa1917d013ecbcefdd2c47f89726992f7f810d879772dcc4d\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Aero the Acro-Bat 2\n"
+    "    name:     Aero the Acro-Bat 2\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-AE2E-USA\n"
+    "    sha256:   fc5df5db0a96d39d3df651f63993adf0f5cb5a6b92a36211f3a05d460d92c72d\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2J5M revision=01\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    ram name=save.ram size=0x8000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "    map id=ram address=10-1f,90-9f:6000-7fff mask=0xe000\n"
+    "    map id=ram address=30-3f,b0-bf:6000-7fff mask=0xe000\n"
+    "  information\n"
+    "    title:    Romance of the Three Kingdoms III: Dragon of Destiny\n"
+    "    name:     Romance of the Three Kingdoms III - Dragon of Destiny\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2J5M-01\n"
+    "    serial:   SNS-S3-USA\n"
+    "    sha256:   88fa0a78ca98c6386e086c7fa9e81a2625bdecc55115dde6c6f4770b0670aa40\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "      ram name=save.ram size=0x8000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Air Cavalry\n"
+    "    name:     Air Cavalry\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-ACCE-USA\n"
+    "    sha256:   1f5738552c51de25ffe8aa44ff396c1ab238435296f1e8f99f8cf335483c03d5\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Champions World Class Soccer\n"
+    "    name:     Champions World Class Soccer\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-8W-USA\n"
+    "    sha256:   32008c429eafe7eb59aff7a89f77e1a267f02f9061ff8830ade7b99081e27f7c\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Teenage Mutant Ninja Turtles IV: Turtles in Time\n"
+    "    name:     Teenage Mutant Ninja Turtles IV - Turtles in Time\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-02\n"
+    "    serial:   SNS-TM-USA\n"
+    "    sha256:   5b82cdd6f2da56f43680d6a5021faebe2e06036d30602c1a7917aa414cf8b5f4\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Looney Tunes B-Ball\n"
+    "    name:     Looney Tunes B-Ball\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-ALTE-USA\n"
+    "    sha256:   76ba0fc1f5c1f39354bb3173a600f23915f1191f400f7d525d220b4b3c8d958d\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J3M revision=01,11,20\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "    map id=ram address=20-3f,a0-bf:6000-7fff mask=0xe000\n"
+    "  information\n"
+    "    title:    Secret of Mana\n"
+    "    name:     Secret of Mana\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J3M-01\n"
+    "    serial:   SNS-K2-USA\n"
+    "    sha256:   4c15013131351e694e05f22e38bb1b3e4031dedac77ec75abecebe8520d82d5f\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super Pinball: Behind the Mask\n"
+    "    name:     Super Pinball - Behind the Mask\n"
+    "    region:   NA\n"
+    "    revision: 1.1\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-XP-USA-1\n"
+    "    sha256:   65aff1403838c938d7c6170f3044a2b0317cd2ee13ad79353a4cdd2aa82f4e87\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super R-Type\n"
+    "    name:     Super R-Type\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-01\n"
+    "    serial:   SNS-SR-USA\n"
+    "    sha256:   05c7f6461209020785fba33007e1830820aa44ada4b1a6f991d936bf2335b15b\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J5M revision=11,20\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    ram name=save.ram size=0x8000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "    map id=ram address=20-3f,a0-bf:6000-7fff mask=0xe000\n"
+    "  information\n"
+    "    title:    Uncharted Waters: New Horizons\n"
+    "    name:     Uncharted Waters - New Horizons\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J5M-11\n"
+    "    serial:   SNS-QL-USA\n"
+    "    sha256:   64bc4707f422661a66618088887e2363a5f896ea683c58984fffd96dd21ab5f0\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "      ram name=save.ram size=0x8000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2J0N revision=01,10,11\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    GP-1: Part II\n"
+    "    name:     GP-1 - Part II\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2J0N-11\n"
+    "    serial:   SNS-AGRE-USA\n"
+    "    sha256:   2e478569949c3935529c956448947ef90bae64abaf3d523bd89e7f4cf5e83702\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J1M revision=11,20\n"
+    "    rom name=program.rom size=0x400000\n"
+    "    ram name=save.ram size=0x800\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "    map id=ram address=20-3f,a0-bf:6000-7fff mask=0xe000\n"
+    "  information\n"
+    "    title:    Donkey Kong Country 2: Diddy's Kong Quest\n"
+    "    name:     Donkey Kong Country 2 - Diddy's Kong Quest\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J1M-20\n"
+    "    serial:   SNS-ADNE-USA\n"
+    "    sha256:   35421a9af9dd011b40b91f792192af9f99c93201d8d394026bdfb42cbf2d8633\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x400000\n"
+    "      ram name=save.ram size=0x800\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    fun 'n games\n"
+    "    name:     Fun & Games\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-7N-USA\n"
+    "    sha256:   dcceb5be536c9b91bf34f65e7fcec4b55a78af0192323cf86f3b9555072037ee\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3B revision=11,12,13\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-1f,80-9f:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Inindo: Way of the Ninja\n"
+    "    name:     Inindo - Way of the Ninja\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3B-13\n"
+    "    serial:   SNS-IN-USA\n"
+    "    sha256:   5e5cac64fdcf09a52a9c0ab1ebc8bd309dcb1256faf1405284443569b5284fe5\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Monopoly\n"
+    "    name:     Monopoly\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-ML-USA\n"
+    "    sha256:   480ae7186fd5b28200cd88e136b9cd3b6600d32508e280a0bc27ea0ed8d3c0bb\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    SOS\n"
+    "    name:     SOS\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-TT-USA\n"
+    "    sha256:   8f0a7670fe53d30f721784e5fff78349eb157a9f0eb2246206f9d7db478b7c56\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Whizz\n"
+    "    name:     Whizz\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-AZWE-USA\n"
+    "    sha256:   0a52dc1e7820f5541f53ce0e1e96144fe079af0efe3dae5c2c89d86365feb8b1\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Jurassic Park\n"
+    "    name:     Jurassic Park\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-J8-USA\n"
+    "    sha256:   fe91d45201753ae9655d5ce38838e352f478b26b2d933c1bcb5bd8330121f9ff\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Spider-Man & Venom: Maximum Carnage\n"
+    "    name:     Spider-Man & Venom - Maximum Carnage\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-AMCE-USA\n"
+    "    sha256:   964d21996e385e032b5d18baf716692ba1db780245cd71956c212045c1b8eb9a\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super Battletank: War in the Gulf\n"
+    "    name:     Super Battletank - War in the Gulf\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-02\n"
+    "    serial:   SNS-SB-USA\n"
+    "    sha256:   94496e73fc7fdf2f72f16bf2becb0c3935db2ebd97555eac73b63400acbceec6\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A5M revision=01\n"
+    "    rom name=program.rom size=0x140000\n"
+    "    ram name=save.ram size=0x8000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    P.T.O.: Pacific Theater of Operations\n"
+    "    name:     Pacific Theater of Operations\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A5M-01\n"
+    "    serial:   SNS-TK-USA\n"
+    "    sha256:   83727f6954bce024edac7f3fd18a6fbf63d05b580f692d96faa37e60893c91cd\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x140000\n"
+    "      ram name=save.ram size=0x8000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Prince of Persia\n"
+    "    name:     Prince of Persia\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-PR-USA\n"
+    "    sha256:   494190cd6d7fd68882cbe255a6e237d9c4bdaf3988615ede0297a5e285ad5dd9\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2J3M revision=01,11,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "    map id=ram address=10-1f,30-3f:6000-7fff mask=0xe000\n"
+    "    map id=ram address=90-9f,b0-bf:6000-7fff mask=0xe000\n"
+    "  information\n"
+    "    title:    World Cup USA '94\n"
+    "    name:     World Cup USA '94\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2J3M-11\n"
+    "    serial:   SNS-U4-USA\n"
+    "    sha256:   86e9d76a8834732e511253d8092727bdbfb409b3d0ff1c06b6b6e481c9a039ef\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1DC0N revision=01\n"
+    "    hitachidsp model=HG51B169 frequency=20000000\n"
+    "      rom name=program.rom size=0x200000\n"
+    "      ram size=0\n"
+    "      rom name=cx4.data.rom size=0xc00\n"
+    "      ram size=0xc00\n"
+    "      map id=io address=00-3f,80-bf:6000-7fff\n"
+    "      map id=rom address=00-3f,80-bf:8000-ffff mask=0x8000\n"
+    "      map id=ram address=70-77:0000-7fff\n"
+    "  information\n"
+    "    title:    Mega Man X3\n"
+    "    name:     Mega Man X3\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1DC0N-01\n"
+    "    serial:   SNS-AR3E-USA\n"
+    "    sha256:   b2aa2c0a621dfbed3b528de93282fc91abb16325d358680d34753d43629263cf\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "      rom name=cx4.data.rom size=0xc00\n"
+    "      ram name=cx4.data.ram size=0xc00\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1DE3B revision=01\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-1f,80-9f:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-5f,c0-df:0000-ffff mask=0x8000\n"
+    "    map id=ram address=60-7d,e0-ff:0000-ffff\n"
+    "    armdsp frequency=21477272\n"
+    "      rom name=st018.program.rom size=0x20000\n"
+    "      rom name=st018.data.rom size=0x8000\n"
+    "      ram size=0x4000\n"
+    "      map id=io address=00-3f,80-bf:3800-38ff\n"
+    "  information\n"
+    "    title:    早指し二段森田将棋2\n"
+    "    name:     Hayazashi Nidan Morita Shougi 2\n"
+    "    region:   JP\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1DE3B-01\n"
+    "    serial:   SHVC-A2MJ-JPN\n"
+    "    sha256:   3dd659d048aba8fc7d07b6ab726c9f711c948141e99e393685ae6cc311a83dc5\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "      rom name=st018.program.rom size=0x20000\n"
+    "      rom name=st018.data.rom size=0x8000\n"
+    "      ram name=st018.program.ram size=0x4000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Realm\n"
+    "    name:     Realm\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-ARQE-USA\n"
+    "    sha256:   097cbe9720903bc14599158b80e0cc314ef2fe8a585d6d0a8962eb1626031492\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Frogger\n"
+    "    name:     Frogger\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    MAXI-1A0N-30-2\n"
+    "    serial:   SNS-AF7E-USA\n"
+    "    sha256:   1ce72767795f41049a1f4d2829e837a8885eb91e1c14faf1ca62d05839ebe3c9\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Indiana Jones' Greatest Adventures\n"
+    "    name:     Indiana Jones' Greatest Adventures\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-AIJE-USA\n"
+    "    sha256:   cf611b40f9570e8fcfdc21db623965da62561e8ca82ded59e432ba6fb0bfb562\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Test Drive II: The Duel\n"
+    "    name:     Test Drive II - The Duel\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-DL-USA\n"
+    "    sha256:   c9563cb57314588aa3db22b76dc8acfba3e73733dd3538edd90af5a15595830e\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Tom and Jerry\n"
+    "    name:     Tom and Jerry\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-TJ-USA\n"
+    "    sha256:   4f500da19dbb1557a7bc0ce14437098c1402478d573fb569303b81c011f86fbf\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Push-Over\n"
+    "    name:     Push-Over\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-PV-USA\n"
+    "    sha256:   475c9baa1c2b76a6b3119e47d32814dc1c08e84e23250ae015bb0bccea915637\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    War 2410\n"
+    "    name:     War 2410\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-A2AE-USA\n"
+    "    sha256:   82bba8ae2bb4dbc74a18af31aaec19c368576e4369dd70b396caa5e8729540bb\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A5M revision=01,11,20\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x8000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Eye of the Beholder\n"
+    "    name:     Eye of the Beholder\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A5M-01\n"
+    "    serial:   SNS-IB-USA\n"
+    "    sha256:   0a8cd5101f849ccd4e40d55fdc4edce914b2825b69eb76ec31cf53b59719e79e\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x8000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A1M revision=01,11,20\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x800\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    F1 Pole Position\n"
+    "    name:     F1 Pole Position\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A1M-01\n"
+    "    serial:   SNS-6P-USA\n"
+    "    sha256:   55c33efb514568c9946c4b866c160ed190fe436faee265ee2fb107f7fe94d524\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x800\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Mario's Time Machine\n"
+    "    name:     Mario's Time Machine\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-8M-USA\n"
+    "    sha256:   4b69d4958e099c3b3f6ae45e153ced9b24755d8c161dfee06c9f67886a7c0f09\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3M revision=10,20,21,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Pro Sport Hockey\n"
+    "    name:     Pro Sport Hockey\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3M-20\n"
+    "    serial:   SNS-UI-USA\n"
+    "    sha256:   00b5b3d3febd1a6f28ceb49e39cdd9476a944fe62ea3850808cdeafaaaa63040\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Addams Family Values\n"
+    "    name:     Addams Family Values\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-VY-USA\n"
+    "    sha256:   f59a0a8ed11ea2ba6217b1640e74bab8d8d8161a4585f5ae4a02edd7958ad9a3\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3M revision=10,20,21,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    ESPN Speed World\n"
+    "    name:     ESPN Speed World\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3M-21\n"
+    "    serial:   SNS-ASWE-USA\n"
+    "    sha256:   7b2fdab972e393395f5379d7fb13e40464db152f6acf58b2d2a6a18f81cefecb\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3B revision=11,12,13\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-1f,80-9f:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Final Fantasy II\n"
+    "    name:     Final Fantasy II\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3B-12\n"
+    "    serial:   SNS-F4-USA\n"
+    "    sha256:   680535dc1c4196c53b40dc9c2c9bc159a77802ab8d4b474bef5dc0281c15ad06\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Wordtris\n"
+    "    name:     Wordtris\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-WT-USA\n"
+    "    sha256:   82e2b636e66c4edbae27a5be91a61194ef2881ec93f40d1de93a6153617b12f2\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    The Itchy & Scratchy Game\n"
+    "    name:     Itchy & Scratchy Game, The\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-AISE-USA\n"
+    "    sha256:   39bfe828571cdb23e7c85c23cf5b175979dcc2042c5841add58f5ae6492168a9\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Earth Defense Force\n"
+    "    name:     Earth Defense Force\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-01\n"
+    "    serial:   SNS-ED-USA\n"
+    "    sha256:   0408e3d9f2259044344a3bfbd7a7ca3c3427f82108fbecd6e5c4c41e80cd303b\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Troddlers\n"
+    "    name:     Troddlers\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-TX-USA\n"
+    "    sha256:   4070a7702dc506a1ceb6f65b5c330b3a162df6f01735c8f206934fd47b810ed4\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Tiny Toon Adventures: Wacky Sports Challenge\n"
+    "    name:     Tiny Toon Adventures - Wacky Sports Challenge\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-5Z-USA\n"
+    "    sha256:   f753de4a38bd83f7d937fc7bf5565a3c351a794c113dead8fdee6d86c85633e8\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Outlander\n"
+    "    name:     Outlander\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-LD-USA\n"
+    "    sha256:   db44f8b58a31b640a47aa4390101c3c6a5f613e4e49c636d44786278033dec19\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Imperium\n"
+    "    name:     Imperium\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-DN-USA\n"
+    "    sha256:   4dc2b5de98e9109583d9b61b38d26a8216af4dba246ef71350122213630562d0\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=BJ0N revision=01,20\n"
+    "    rom name=program.rom size=0x300000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    WWF Raw\n"
+    "    name:     WWF Raw\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-BJ0N-01\n"
+    "    serial:   SNS-AWFE-USA\n"
+    "    sha256:   0af7b0d3022acd24a1fb15865a076519f7f56e7a4b33f12b6d851b3a91e5388c\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x300000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Stone Protectors\n"
+    "    name:     Stone Protectors\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-ASOE-USA\n"
+    "    sha256:   dad9c116283322d5a13fd659874c681582abdff3df182cc4c90511d33fb7110a\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=BJ0N revision=01,20\n"
+    "    rom name=program.rom size=0x300000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Mortal Kombat II\n"
+    "    name:     Mortal Kombat 2\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-BJ0N-01\n"
+    "    serial:   SNS-28-USA\n"
+    "    sha256:   43e36a74fb73a7efc46b380599e269b1fff8f55ecf80f5cf50c34d02ceda041a\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x300000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x300000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Earthworm Jim 2\n"
+    "    name:     Earthworm Jim 2\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    MJSC-1J0N-20-2\n"
+    "    serial:   SNS-A2EE-USA\n"
+    "    sha256:   10eadaab168707829418702386e1bcedd2619d9bbefc37cf31c4118313bcf6de\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x300000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Lester the Unlikely\n"
+    "    name:     Lester the Unlikely\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-01\n"
+    "    serial:   SNS-LY-USA\n"
+    "    sha256:   a2c1970670e2831e47e24ced01bf4ba5aba05cac3773bf524c62d689c35687e1\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3M revision=10,20,21,30\n"
+    "    rom name=program.rom size=0x280000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Lufia II: Rise of the Sinistrals\n"
+    "    name:     Lufia II - Rise of the Sinistrals\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3M-30\n"
+    "    serial:   M/SNS-ANIE-USA\n"
+    "    sha256:   7c34ecb16c10f551120ed7b86cfbc947042f479b52ee74bb3c40e92fdd192b3a\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x280000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    The Blues Brothers\n"
+    "    name:     Blues Brothers, The\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-B6-USA\n"
+    "    sha256:   99f40f06fa4dbeeea4fe67d2de5b4c1bf301bedac1958ba1c239dcaf39b0a998\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Pink Goes to Hollywood\n"
+    "    name:     Pink Goes to Hollywood\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-YW-USA\n"
+    "    sha256:   d0f4a5040ecf96dc49aa0084160e291a38f2ee75319750db4d6687ab36828da9\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    The Adventures of Rocky and Bullwinkle and Friends\n"
+    "    name:     Adventures of Rocky and Bullwinkle and Friends, The\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-RZ-USA\n"
+    "    sha256:   b70099186d3774355ac5db370240e370c73f9ce5341f6c805cf9f771374b43ae\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Warp Speed\n"
+    "    name:     Warp Speed\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-WP-USA\n"
+    "    sha256:   36ec2f409f08a08f8327570eadcd8960b6a47bf5797441c2df05fcc50c5b762b\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Ultraman: Towards the Future\n"
+    "    name:     Ultraman - Towards the Future\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-01\n"
+    "    serial:   SNS-UM-USA\n"
+    "    sha256:   e9fae4c2e171a1fc4f2bd800abd9e42750aaf7a4db9e40c5b9142e15029500bd\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3M revision=10,20,21,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Ultima VI: The False Prophet\n"
+    "    name:     Ultima VI - The False Prophet\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3M-20\n"
+    "    serial:   SNS-U6-USA\n"
+    "    sha256:   11659bd8dd620d50400d16042aeb2d0ddb00c7183fc1ecb95b1a34f07db0431b\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x40000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Space Invaders\n"
+    "    name:     Space Invaders\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   SNS-IC-USA\n"
+    "    sha256:   dc5353ddc350816619230f25f8c51bddabf7438e6dfba21662eb1c4794856735\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x40000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A0N revision=01,10,11,20\n"
+    "    rom name=program.rom size=0x140000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    The Adventures of Kid Kleets\n"
+    "    name:     Adventure of Kid Kleets, The\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A0N-11\n"
+    "    serial:   SNS-YK-USA\n"
+    "    sha256:   670d898bdcf97d7ca3aab6c2dd1641f1270fcc2a070bbd3028ab413aef2b2ecc\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x140000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x400000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Killer Instinct\n"
+    "    name:     Killer Instinct\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-20\n"
+    "    serial:   SNS-AKLE-USA\n"
+    "    sha256:   618a23636e07110e094277ec1d1e60c3620a6e9a5f386292808267593fa803ad\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x400000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Roger Clemens' MVP Baseball\n"
+    "    name:     Roger Clemens' MVP Baseball\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-02\n"
+    "    serial:   SNS-VP-USA\n"
+    "    sha256:   e21300c8c4170e084fd83ce4c842dd73f939fbd10ddfe47c9a49b6e291dcd52d\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Tetris 2\n"
+    "    name:     Tetris 2\n"
+    "    region:   NA\n"
+    "    revision: 1.1\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   SNS-27-USA-1\n"
+    "    sha256:   70dea29a928c1625def31c862dc74960e39e587e416b45829efc21f13ebd9630\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3B revision=11,12,13\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-1f,80-9f:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Mecarobot Golf\n"
+    "    name:     Mecarobot Golf\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3B-13\n"
+    "    serial:   SNS-TS-USA\n"
+    "    sha256:   c3c4afdeb67136619c643bd9a9f3fe90337541a40745503b5d4eb9b9e6e64b67\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x300000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    The Lion King\n"
+    "    name:     Lion King, The\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    MJSC-1J0N-20-2\n"
+    "    serial:   SNS-ALKE-USA\n"
+    "    sha256:   457abe634e0a8be03e29513a3dca8f3e9d0ddc6bf97d8931f2316094260f3712\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x300000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board id:Super Game Boy\n"
+    "    rom name=program.rom size=0x40000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "    icd2 revision=1\n"
+    "      rom name=sgb.boot.rom size=0x100\n"
+    "      map id=io address=00-3f,80-bf:6000-67ff\n"
+    "      map id=io address=00-3f,80-bf:7000-7fff\n"
+    "  information\n"
+    "    title:    Super Game Boy\n"
+    "    name:     Super Game Boy\n"
+    "    region:   NA\n"
+    "    revision: 1.2\n"
+    "    board:    Super Game Boy\n"
+    "    serial:   N/A\n"
+    "    sha256:   4d7fc331a811b8dc630b469262fd6f45e289243cef83101f32038158967d1b28\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x40000\n"
+    "      rom name=sgb.boot.rom size=0x100\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Shanghai II: Dragon's Eye\n"
+    "    name:     Shanghai II - Dragon's Eye\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-DE-USA\n"
+    "    sha256:   bdbcc53b266159b5a08e307e5b60fdb0cb5a1ba8f8c1c6c7f89d81eaf5133e85\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Dragon's Lair\n"
+    "    name:     Dragon's Lair\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-DI-USA\n"
+    "    sha256:   49a1f9f5e6084b3daa1b13ab5a37ebe8bd3cf20e1c7429fbf722298092893e81\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Hook\n"
+    "    name:     Hook\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-HO-USA\n"
+    "    sha256:   acad4c594f156e0f30dec2532b35fcb3bab800e08263377634e2d96dfd055f3e\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1DS0B revision=10,20\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    necdsp model=uPD96050 frequency=11000000\n"
+    "      rom name=st010.program.rom size=0xc000\n"
+    "      rom name=st010.data.rom size=0x1000\n"
+    "      ram name=save.ram size=0x1000\n"
+    "      map id=io address=60-67,e0-e7:0000-3fff select=0x0001\n"
+    "      map id=ram address=68-6f,e8-ef:0000-7fff\n"
+    "  information\n"
+    "    title:    F1 Race of Champions II\n"
+    "    name:     F1 Race of Champions II\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1DS0B-20\n"
+    "    serial:   SNS-E2-USA\n"
+    "    sha256:   3ae7bfd38a3dc273f4d387af3b15621beefebf5056731af06e3822f5e57db5c5\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      rom name=st010.program.rom size=0xc000\n"
+    "      rom name=st010.data.rom size=0x1000\n"
+    "      ram name=save.ram size=0x1000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Animaniacs\n"
+    "    name:     Animaniacs\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    MJSC-1A0N-30-2\n"
+    "    serial:   SNS-ANCE-USA\n"
+    "    sha256:   626f1fe52b0df0f8ede23f0062cd842321c8dabf14aefdca12e526876ecf383a\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Power Moves\n"
+    "    name:     Power Moves\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-P3-USA\n"
+    "    sha256:   42ee7829d3db0213b718168c29674879bb4532573e9fb3450a5b417174a16ed0\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    The Jungle Book\n"
+    "    name:     Jungle Book, The\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    MAXI-1A0N-30-2\n"
+    "    serial:   SNS-7K-USA\n"
+    "    sha256:   771a0322d9f5f8e13a52d01e80257a1f75cc693cf4abf74793520eb5f8b5580e\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super Valis IV\n"
+    "    name:     Super Valis IV\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-VA-USA\n"
+    "    sha256:   792e615a34ceae5a1b9a4f54c5a5d9b53e39299332fece83e4bceca2c22efb21\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3M revision=10,20,21,30\n"
+    "    rom name=program.rom size=0x1e0000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    FIFA Soccer '97\n"
+    "    name:     FIFA Soccer '97\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    EA-1A3M-30/P10019\n"
+    "    serial:   SNS-A7IE-USA\n"
+    "    sha256:   c514f855ad377242582952eee95513a2152ebbf6bb5b06bdf9f031fc5ac748ab\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x1e0000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=BA0N revision=01,10\n"
+    "    rom name=program.rom size=0x280000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Justice League Task Force\n"
+    "    name:     Justice League Task Force\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-BA0N-10\n"
+    "    serial:   M/SNS-AJLE-USA\n"
+    "    sha256:   7f05959f423bc656091ea3bddfbc89c877ae243dca346f63233e27973f34e0eb\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x280000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x300000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    WWF Wrestlemania: The Arcade Game\n"
+    "    name:     WWF Wrestlemania - The Arcade Game\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-20\n"
+    "    serial:   SNS-AWVE-USA\n"
+    "    sha256:   67faa6ed3406a5ab0d7224b811c0960bb36560040ee959bb3304c9293ceaa093\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x300000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Prehistorik Man\n"
+    "    name:     Prehistorik Man\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-APUE-USA\n"
+    "    sha256:   8f387d083de1399bb79e5312c31a6f1757f2a536bfa25cecf1aea77bfd77058b\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Tony Meola's Sidekicks Soccer\n"
+    "    name:     Tony Meola's Sidekicks Soccer\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-6K-USA\n"
+    "    sha256:   e0fbf731550266d79a0b6ca460afd04c8c312f7023b2c9882c4fc3acc3e7932f\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A1M revision=01,11,20\n"
+    "    rom name=program.rom size=0x300000\n"
+    "    ram name=save.ram size=0x800\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    NFL Quarterback Club\n"
+    "    name:     NFL Quarterback Club '95\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A1M-11\n"
+    "    serial:   SNS-Q9-USA\n"
+    "    sha256:   6a59115a9958d4a9fa167095505a2ddf222ca6291209d07618319e39a2be8b61\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x300000\n"
+    "      ram name=save.ram size=0x800\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Blackthorne\n"
+    "    name:     Blackthorne\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-6Z-USA\n"
+    "    sha256:   328c8f57e2ea371f6fd5b8a9834c56e35eb3bfe710502dd80f370739f9ccb7e1\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    NBA Jam\n"
+    "    name:     NBA Jam\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-8N-USA\n"
+    "    sha256:   0f18c496426bb97fe5e8b91ad5299f0b1c3898ac17047b745c86b167c212ab7a\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Winter Olympic Games: Lillehammer '94\n"
+    "    name:     Winter Olympic Games - Lillehammer '94\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-10\n"
+    "    serial:   SNS-W4-USA\n"
+    "    sha256:   0e834647669783c2b79cc1120c057c870c541079a7abd1eee3f787d59dc3c3eb\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A5M revision=01,11,20\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x8000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Nobunga's Ambition: Lord of Darkness\n"
+    "    name:     Nobunga's Ambition - Lord of Darkness\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A5M-11\n"
+    "    serial:   SNS-IZ-USA\n"
+    "    sha256:   ae572a51ebe429cfc06a3b75d7db9581f2884f9adc78827dc162b4c4ddc6ce2d\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x8000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3M revision=10,20,21,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Equinox\n"
+    "    name:     Equinox\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3M-20\n"
+    "    serial:   SNS-EX-USA\n"
+    "    sha256:   cfd666f0bbabec59613d9fe189db7d0a060a78047bc084c0c365840769047bf2\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J3M revision=01,11,20\n"
+    "    rom name=program.rom size=0x300000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "    map id=ram address=20-3f,a0-bf:6000-7fff mask=0xe000\n"
+    "  information\n"
+    "    title:    EarthBound\n"
+    "    name:     EarthBound\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J3M-20\n"
+    "    serial:   SNS-MB-USA\n"
+    "    sha256:   a8fe2226728002786d68c27ddddf0b90a894db52e4dfe268fdf72a68cae5f02e\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x300000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super Buster Brothers\n"
+    "    name:     Super Buster Brothers\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-SN-USA\n"
+    "    sha256:   5965bde449ff775c1a0d9fd3cf2fb8c51a86b44ad1942dfb5c14a91f103be030\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A0N revision=01,10,11,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Metal Marines\n"
+    "    name:     Metal Marines\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A0N-01\n"
+    "    serial:   SNS-6M-USA\n"
+    "    sha256:   0a9609a505dd1555006b16f53d961b3ce50c518aa1597a77dcd46e55ecc716ff\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super Star Wars III: Return of the Jedi\n"
+    "    name:     Super Star Wars III - Return of the Jedi\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-ARJE-USA\n"
+    "    sha256:   c49be867cdd276703a3ae46a6b17673b9e359af4f9af2329c8eb747120245817\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J5M revision=11,20\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    ram name=save.ram size=0x8000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "    map id=ram address=20-3f,a0-bf:6000-7fff mask=0xe000\n"
+    "  information\n"
+    "    title:    SimCity 2000\n"
+    "    name:     SimCity 2000\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J5M-20\n"
+    "    serial:   M/SNS-AWWE-USA\n"
+    "    sha256:   bf74c58e4190faca2f3a967dc190fe529d13887d1262b72e057b5353e43cf67f\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "      ram name=save.ram size=0x8000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    MLBPA Baseball\n"
+    "    name:     MLBPA Baseball\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-XH-USA\n"
+    "    sha256:   d32f194e27d177e64bf3bda046889b8198276fca2e8772e4b02a17152e9273e4\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Mario's Early Years: Preschool Fun\n"
+    "    name:     Mario's Early Years - Preschool Fun\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-10\n"
+    "    serial:   SNS-AMEE-USA\n"
+    "    sha256:   c646b1e60e2cd5a2741915f5d3dfe3c17f45ff7283f8052e840bd4354b0990e1\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    CutThroat Island\n"
+    "    name:     CutThroat Island\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-AC8E-USA\n"
+    "    sha256:   7c722f9941957630467c1784d0eb3f92fbfc0a2a1da3c8f5c27f593eca2a5a04\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    FIFA International Soccer\n"
+    "    name:     FIFA International Soccer\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-84-USA\n"
+    "    sha256:   1f454f2ce16fb96ba0b950ceaa098fe6eabed9e4a0e512252debad8fa6bc5ef5\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Shaq-Fu\n"
+    "    name:     Shaq-Fu\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-10\n"
+    "    serial:   SNS-AQFE-USA\n"
+    "    sha256:   c73757eea258e169e506eaef989227a59918060f94117917f338183db14c50b6\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Wild Guns\n"
+    "    name:     Wild Guns\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-4W-USA\n"
+    "    sha256:   c8f159e2625ac8078535c06857ea28475706da45df494de8e46f50888272cf71\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A0N revision=01,10,11,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Kawasaki Caribbean Challenge\n"
+    "    name:     Kawasaki Caribbean Challenge\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A0N-10\n"
+    "    serial:   SNS-KC-USA\n"
+    "    sha256:   7cc3693cc5e1e834d57795f04b048fab27864a898a9507e7ca383771e2035414\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Jeopardy!\n"
+    "    name:     Jeopardy!\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-JY-USA\n"
+    "    sha256:   85e5f6fedc420925557092d728e1dc6b4e2042368fb78bf93c0df447f8c9c0c0\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Pocky & Rocky\n"
+    "    name:     Pocky & Rocky\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-KK-USA\n"
+    "    sha256:   72b2b3bead3fcd27a1610ad5d4d8be3235efeaff96df2e7858911992a5892d21\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3B revision=11,12,13\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-1f,80-9f:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    PGA Tour Golf\n"
+    "    name:     PGA Tour Golf\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3B-12\n"
+    "    serial:   SNS-PG-USA\n"
+    "    sha256:   5c0b5266a191852ca593235f07180e673cb79e3f0b0dd31f65808eef83bf6e90\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Zero the Kamikaze Squirrel\n"
+    "    name:     Zero the Kamikaze Squirrel\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-AZKE-USA\n"
+    "    sha256:   7d414b7f5941f1eddc35259a22accbbbd7b47c517dfcf8bad86c4dcfa9e50b1e\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super Alfred Chicken\n"
+    "    name:     Super Alfred Chicken\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-8A-USA\n"
+    "    sha256:   0deb7a91fbe5848f1733ce668daaa49b0dad3d821bacc0791837c1ba15e60d7c\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Chester Cheetah: Too Cool to Fool\n"
+    "    name:     Chester Cheetah - Too Cool to Fool\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-CE-USA\n"
+    "    sha256:   c7e7df8932bf0056aa530f3dc3c913c1171a359af4c197094c2b972946dc6051\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Operation Logic Bomb\n"
+    "    name:     Operation Logic Bomb\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-IY-USA\n"
+    "    sha256:   190742792a950a112f893cba0e083eb787cf24293f698967defff929635ba0e7\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=YA0N revision=01\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Alien vs. Predator\n"
+    "    name:     Alien vs. Predator\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-YA0N-01\n"
+    "    serial:   SNS-AP-USA\n"
+    "    sha256:   05eb897d7696555790591c431c9d55a43ff9a1c12162443c17c5fcddfa5eb3c5\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A1M revision=01,11,20\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x800\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    NCAA Football\n"
+    "    name:     NCAA Football\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A1M-11\n"
+    "    serial:   SNS-AFBE-USA\n"
+    "    sha256:   8c43b7c2f2ef1fca9237c64c2f4c9e98d1a48940dae500ce8eac71278d34efb3\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x800\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Plok\n"
+    "    name:     Plok\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-P4-USA\n"
+    "    sha256:   0b3b0fd42bbe06a812053df376b183412fc0de335c4b7cb8e45f3fe47b0044e9\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    American Gladiators\n"
+    "    name:     American Gladiators\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-AA-USA\n"
+    "    sha256:   dc9cefb4dd50dce2e9d626ac71d4a06306516cba4bc784c90e4a30fe4e7ff4ef\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board id:BSC-1A5B9P-01\n"
+    "    bsx\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x8000\n"
+    "      ram name=download.ram size=0x40000\n"
+    "      map id=io address=00-3f,80-bf:5000-5fff\n"
+    "      map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "      map id=rom address=40-5f,c0-ff:0000-ffff\n"
+    "      map id=rom address=78-7d:0000-ffff\n"
+    "      map id=ram address=20-3f:6000-7fff mask=0xe000\n"
+    "      map id=ram address=70-77:0000-ffff\n"
+    "  information\n"
+    "    title:    BS-X それは名前を盗まれた待の物語\n"
+    "    name:     BS-X - Sore wa Namae o Nusumareta Machi no Monogatari\n"
+    "    region:   JP\n"
+    "    revision: 1.1\n"
+    "    board:    BSC-1A5B9P-01\n"
+    "    serial:   SHVC-ZBSJ-JPN\n"
+    "    sha256:   3ce321496edc5d77038de2034eb3fb354d7724afd0bc7fd0319f3eb5d57b984d\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x8000\n"
+    "      ram name=download.ram size=0x40000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Radical Rex\n"
+    "    name:     Radical Rex\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-ARRE-USA\n"
+    "    sha256:   1869c0faf93bf21b7ff965f1925fad4b2924a64b1e48f4837221eebdf741226c\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super Bowling\n"
+    "    name:     Super Bowling\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-02\n"
+    "    serial:   SNS-BW-USA\n"
+    "    sha256:   946de556b4f877e54e16b5c828db89c038e50349cfd0ddf8ea96b6541f9d70fa\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    WWF Royal Rumble\n"
+    "    name:     WWF Royal Rumble\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-WU-USA\n"
+    "    sha256:   51c53e36ed0b959b0695fc6ef036fa7302d1c995eca35c28261d6f3cb77df0ca\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Dream T.V.\n"
+    "    name:     Dream TV\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-VE-USA\n"
+    "    sha256:   1a79d51a2ad7dd4848205a07ff8e5d873b155dc420de5e52158c9bab935e05c3\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Chuck Rock\n"
+    "    name:     Chuck Rock\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-CK-USA\n"
+    "    sha256:   63ab79e86ea13e2cf9bb67aec971febb68450db9865b00b5f412610653822393\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A1M revision=01,11,20\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x800\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Ultima: Runes of Virtue II\n"
+    "    name:     Ultima - Runes of Virtue II\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A1M-11\n"
+    "    serial:   SNS-7U-USA\n"
+    "    sha256:   094555d5720158ee60c9d5ab9a13110192db5ebf0f6cf69abbb59a00bc470345\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x800\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A1M revision=01,11,20\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x800\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    NHL Stanley Cup\n"
+    "    name:     NHL Stanley Cup\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A1M-01\n"
+    "    serial:   SNS-NH-USA\n"
+    "    sha256:   d44f487d84f5bb761955b7b70a5464b2f094e199875f595f312c88e04ac647ff\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x800\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1L3B revision=02,11\n"
+    "    sa1\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "      ram size=0x800\n"
+    "      map id=io address=00-3f,80-bf:2200-23ff\n"
+    "      map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "      map id=rom address=c0-ff:0000-ffff\n"
+    "      map id=bwram address=00-3f,80-bf:6000-7fff\n"
+    "      map id=bwram address=40-4f:0000-ffff\n"
+    "      map id=iram address=00-3f,80-bf:3000-37ff\n"
+    "  information\n"
+    "    title:    PGA European Tour\n"
+    "    name:     PGA European Tour\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1L3B-11\n"
+    "    serial:   SNS-AEPE-USA\n"
+    "    sha256:   5abfb974ca0e56aabb3f4126817d14a546c57a5a5c6042d31196063d80996698\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "      ram size=0x800\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A0N revision=01,10,11,20\n"
+    "    rom name=program.rom size=0x140000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Mega Man Soccer\n"
+    "    name:     Mega Man Soccer\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A0N-11\n"
+    "    serial:   SNS-RQ-USA\n"
+    "    sha256:   cf4d603dc0a3759da571224c671a9bfd29f9e52ca8dbb61bcc8ac8be5481e9b2\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x140000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    RoboCop 3\n"
+    "    name:     RoboCop 3\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-02\n"
+    "    serial:   SNS-R3-USA\n"
+    "    sha256:   055d9c6311a663af7c899a6f76a419c274c57baada3ef64c52fadb1c676b1446\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A0N revision=01,10,11,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Pocky & Rocky 2\n"
+    "    name:     Pocky & Rocky 2\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A0N-11\n"
+    "    serial:   SNS-29-USA\n"
+    "    sha256:   cc33ae02114ea18a86592de327b2b4bcc80728b11a5e4c61666dca71480d4169\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Total Carnage\n"
+    "    name:     Total Carnage\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-XC-USA\n"
+    "    sha256:   9bf884be5627d38f060ad7f3a61ea1fea1474d416e1d037d33014ca9d5205c1d\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Populous\n"
+    "    name:     Populous\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-01\n"
+    "    serial:   SNS-PO-USA\n"
+    "    sha256:   5e580f220ed16281df8ee9a5f450b553f39f8c4078d3f3048d66bda15f98e19f\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=YJ0N revision=01\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Inspector Gadget\n"
+    "    name:     Inspector Gadget\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-YJ0N-01\n"
+    "    serial:   SNS-5G-USA\n"
+    "    sha256:   c7b1706a0ee96f3e0d65cd043c05966bfe3d5c57d08bbd2df3118817424adf82\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    TKO Super Championship Boxing\n"
+    "    name:     TKO Super Championship Boxing\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-02\n"
+    "    serial:   SNS-BX-USA\n"
+    "    sha256:   08d808e9c5851e4301a38a56b350a20ea9e3adbef51546e87e1785d691d0f2d5\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=BJ0N revision=01,20\n"
+    "    rom name=program.rom size=0x300000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Earthworm Jim\n"
+    "    name:     Earthworm Jim\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-BJ0N-01\n"
+    "    serial:   SNS-AEJE-USA\n"
+    "    sha256:   4579e437279f79eedd6b9cf648a814df2ab2c83d937a1bcec1578d28965fb9a0\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x300000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1CA0N6S revision=01\n"
+    "    superfx revision=4\n"
+    "      rom name=program.rom size=0x80000\n"
+    "      ram name=save.ram size=0x10000\n"
+    "      map id=io address=00-3f,80-bf:3000-34ff\n"
+    "      map id=rom address=00-3f,80-bf:8000-ffff mask=0x8000\n"
+    "      map id=rom address=40-5f,c0-df:0000-ffff\n"
+    "      map id=ram address=00-3f,80-bf:6000-7fff size=0x2000\n"
+    "      map id=ram address=70-71,f0-f1:0000-ffff\n"
+    "  information\n"
+    "    title:    Dirt Trax FX\n"
+    "    name:     Dirt Trax FX\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1CA0N6S-01\n"
+    "    serial:   SNS-AF9E-USA\n"
+    "    sha256:   c5474de3592e2a99aac0e5511516658f9f0b50167c754a018409842ec35bcd45\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "      ram name=save.ram size=0x10000\n"
+    "      superfx revision=4\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1CB5B revision=20\n"
+    "    superfx revision=4\n"
+    "      rom name=program.rom size=0x200000\n"
+    "      ram name=save.ram size=0x8000\n"
+    "      map id=io address=00-3f,80-bf:3000-34ff\n"
+    "      map id=rom address=00-3f:8000-ffff mask=0x8000\n"
+    "      map id=rom address=40-5f:0000-ffff\n"
+    "      map id=ram address=00-3f,80-bf:6000-7fff size=0x2000\n"
+    "      map id=ram address=70-71:0000-ffff\n"
+    "  information\n"
+    "    title:    Super Mario World 2: Yoshi's Island\n"
+    "    name:     Super Mario World 2 - Yoshi's Island\n"
+    "    region:   NA\n"
+    "    revision: 1.1\n"
+    "    board:    SHVC-1CB5B-20\n"
+    "    serial:   SNS-YI-USA\n"
+    "    sha256:   bd763c1a56365c244be92e6cffefd318780a2a19eda7d5baf1c6d5bd6c1b3e06\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "      ram name=save.ram size=0x8000\n"
+    "      superfx revision=4\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Lemmings\n"
+    "    name:     Lemmings\n"
+    "    region:   NA\n"
+    "    revision: 1.1\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-LE-USA\n"
+    "    sha256:   cd016c41c7ef9f4f243d57c2b1564b4ceb3b4c38cc165cd02ab6c8e35c93aa2e\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super Ninja Boy\n"
+    "    name:     Super Ninja Boy\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-CW-USA\n"
+    "    sha256:   40b46bb29785fb431b325f22377faa8b099be4d77aecc1f03000b8a4cb589b63\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Ghoul Patrol\n"
+    "    name:     Ghoul Patrol\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-AGJE-USA\n"
+    "    sha256:   a4ceb31b82ea532e6eb640fa2eda61625758e72251efa5f0ae9a984f4a98a8a0\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    War 3010: The Revolution\n"
+    "    name:     War 3010 - The Revolution\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-AZNE-USA\n"
+    "    sha256:   8b12e5e4553fc921c23739d1aec2ed517535ec239daef800f39f602d8473847f\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Q*bert 3\n"
+    "    name:     Q-bert 3\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-02\n"
+    "    serial:   SNS-Q3-USA\n"
+    "    sha256:   89d57bf308033ef17f770a80080cbeed2d112244635d5b5f860f2016398cd2f6\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Star Trek: Deep Space Nine - Crossroads of Time\n"
+    "    name:     Star Trek - Deep Space Nine - Crossroads of Time\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-A9DE-USA\n"
+    "    sha256:   3a16ad45ae3d89b13c9e53e21c2a4c725ff7cec7fbe7896d538d163f92cb4aac\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Judge Dredd: The Movie\n"
+    "    name:     Judge Dredd - The Movie\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-AJDE-USA\n"
+    "    sha256:   67fa7115eb6bf292c024c3a8b06ce9bd457c4d46de182a06a573afff968cc0f1\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Red Line: F-1 Racer\n"
+    "    name:     Red Line - F1 Racer\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-6R-USA\n"
+    "    sha256:   549f2e5b17f685cad25ba71ce7bc6e004e7bfd09e6be12a827af9a9a26556fff\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Battletoads in Battlemaniacs\n"
+    "    name:     Battletoads in Battlemaniacs\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-NX-USA\n"
+    "    sha256:   b0dbd4d7e5689c32234e80b0c5362ef67c425ab72d6ddb49d1cb1133ef630ef7\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Pac-in-Time\n"
+    "    name:     Pac-in-Time\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-APTE-USA\n"
+    "    sha256:   7fe4cb9c294d66589ff78e225774471ecb7db80df25f2b6199ca25671358072b\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J5M revision=11,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    ram name=save.ram size=0x8000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "    map id=ram address=20-3f,a0-bf:6000-7fff mask=0xe000\n"
+    "  information\n"
+    "    title:    Sid Meier's Civilization\n"
+    "    name:     Sid Meier's Civilization\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J5M-20\n"
+    "    serial:   SNS-EQ-USA\n"
+    "    sha256:   de2d5a952096c5f50368b9270d342aa6e7a39007ffbec27117e182e30ef4cf32\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "      ram name=save.ram size=0x8000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Steel Talons\n"
+    "    name:     Steel Talons\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-5S-USA\n"
+    "    sha256:   91f938b4989215b1cd39635797f23b59b9d7b6d36e583f9eb69d022abe537bfc\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A1B revision=04,05,06\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    ram name=save.ram size=0x800\n"
+    "    map id=rom address=00-1f,80-9f:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    F-Zero\n"
+    "    name:     F-Zero\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A1B-04\n"
+    "    serial:   SNS-FZ-USA\n"
+    "    sha256:   bf16c3c867c58e2ab061c70de9295b6930d63f29f81cc986f5ecae03e0ad18d2\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "      ram name=save.ram size=0x800\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super Goal! 2\n"
+    "    name:     Super Goal! 2\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-JV-USA\n"
+    "    sha256:   d4caa6683ee1b6c70c10fd0555ade33dadcc6551d94e791586e64fd683d8f3a8\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Thunder Spirits\n"
+    "    name:     Thunder Spirits\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-02\n"
+    "    serial:   SNS-TH-USA\n"
+    "    sha256:   d50aaa41e153ca356eee16a9deccb1a763ee56ebbe6c80cd28c5ad1db66a5316\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Side Pocket\n"
+    "    name:     Side Pocket\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-4P-USA\n"
+    "    sha256:   d09ca5adaee65cfd686742482bc55b1a3ce9bc5ebed61f24c5631555151a7fc7\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x40000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Ms. Pac-Man\n"
+    "    name:     Ms. Pac-Man\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   SNS-AN8E-USA\n"
+    "    sha256:   007735e68a91cab403f1c955d9d562e9311124e660fa5b32e5c5d0a2e052160e\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x40000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Skuljagger: Revolt of the Westicans\n"
+    "    name:     Skuljagger - Revolt of the Westicans\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-SL-USA\n"
+    "    sha256:   e10070f01845505ae8bfdf7b5b492e7209c2ae876f169fb6ff420dea269f4da3\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3M revision=10,20,21,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Aerobiz Supersonic\n"
+    "    name:     Aerobiz Supersonic\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3M-21\n"
+    "    serial:   SNS-AG-USA\n"
+    "    sha256:   6b6921d7aba9ba353e96e39c8d79d24eef1b84eb5c7fa54edaa83d2447dcd954\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3M revision=10,20,21,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Kirby's Dream Course\n"
+    "    name:     Kirby's Dream Course\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3M-30\n"
+    "    serial:   SNS-CG-USA\n"
+    "    sha256:   0f984dc5fe8293f75e3b8fad98b0cb564706d9b1e3902b56415aa399c2d4df2b\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Jeopardy! Sports Edition\n"
+    "    name:     Jeopardy! Sports Edition\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-8Y-USA\n"
+    "    sha256:   d7110ddc0b34aa4ecd5e55f7b846657edb982db82cf0ba340fe0464daf0ca9be\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Cliffhanger\n"
+    "    name:     Cliffhanger\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-6C-USA\n"
+    "    sha256:   e5980b990605a9c91fa89101c440b2ec9993329296ba09a9538042d724a080fb\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J3B revision=01\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "    map id=ram address=20-3f,a0-bf:6000-7fff mask=0xe000\n"
+    "  information\n"
+    "    title:    Genghis Khan II: Clan of the Gray Wolf\n"
+    "    name:     Genghis Khan II - Clan of the Gray Wolf\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J3B-01\n"
+    "    serial:   SNS-6G-USA\n"
+    "    sha256:   05e9404bfe0689e484a34991f22712c9da718cf000b0f748378af5758b654a3d\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Final Fight\n"
+    "    name:     Final Fight\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-01\n"
+    "    serial:   SNS-FT-USA\n"
+    "    sha256:   60cca2592d0756b8c4c7a0a254fafa5ac47aa752521fd1f77dcbf4b6ee1bee90\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2J3M revision=01,11,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "    map id=ram address=10-1f,30-3f:6000-7fff mask=0xe000\n"
+    "    map id=ram address=90-9f,b0-bf:6000-7fff mask=0xe000\n"
+    "  information\n"
+    "    title:    Rise of the Phoenix\n"
+    "    name:     Rise of the Phoenix\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2J3M-11\n"
+    "    serial:   SNS-QG-USA\n"
+    "    sha256:   cce455b7074f62ffdb41863ee8c160ea06f7acd028837666329bc1e0c3567ad0\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Top Gear 2\n"
+    "    name:     Top Gear 2\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-2P-USA\n"
+    "    sha256:   76b2702c4be8b668c1017f2817c280283c275eaa41535bf6ffa2b8d2220b68c6\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Road Riot 4WD\n"
+    "    name:     Road Riot 4WD\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-RR-USA\n"
+    "    sha256:   864aa9068fb23cd20022a9ac36fb9082299278ea0cb07a20deec2b6a1c6cbc70\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Phalanx: The Enforce Fighter A-144\n"
+    "    name:     Phalanx - The Enforce Fighter A-144\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-02\n"
+    "    serial:   SNS-PH-USA\n"
+    "    sha256:   0663330bc061f4b768fa1806610878ef6e6cf546f36041ae087c8e55703693b8\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Natsume Championship Wrestling\n"
+    "    name:     Natsume Championship Wrestling\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-10\n"
+    "    serial:   SNS-7W-USA\n"
+    "    sha256:   22d2260de02552b1205aac2ff5a202a4c80532ac28045ef5a058d88279ab758e\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Jimmy Connors' Pro Tennis Tour\n"
+    "    name:     Jimmy Connors' Pro Tennis Tour\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-JC-USA\n"
+    "    sha256:   205890f94e27e7c1b381124cc35c866351bafa906383e507cd17ccb9d1b68ffd\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    The Ren & Stimpy Show: Buckeroo$!\n"
+    "    name:     Ren & Stimpy Show - Buckeroo$!, The\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   SNS-ARBE-USA\n"
+    "    sha256:   d322ce440076be0e3678277596acee8089098f4397b35ac8b3df88be5ce5e02f\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Top Gear\n"
+    "    name:     Top Gear\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-02\n"
+    "    serial:   SNS-TR-USA\n"
+    "    sha256:   ca9889f17f184b3d99a2eaaa82af73e366f03ed00313fdd369e5e023b208e788\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2J0N revision=01,10,11\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Super Baseball 2020\n"
+    "    name:     Super Baseball 2020\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2J0N-01\n"
+    "    serial:   SNS-SA-USA\n"
+    "    sha256:   8808783f789ca6413364a7abea240f6f7291b5906026f360ba8cfdd2791fc179\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A0N revision=01,10,11,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Home Improvement\n"
+    "    name:     Home Improvement\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A0N-11\n"
+    "    serial:   SNS-AHIE-USA\n"
+    "    sha256:   48a3ac52e2c9128abc2dc60e07817a51898e8a93be0d51d6f541a8635263a089\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Skyblazer\n"
+    "    name:     Skyblazer\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-LZ-USA\n"
+    "    sha256:   a4ba1483db79c3f6278082387bce216d8f3e3b11ca32d49516d27f5ac07135a5\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3M revision=10,20,21,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Uniracers\n"
+    "    name:     Uniracers\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3M-21\n"
+    "    serial:   SNS-4L-USA\n"
+    "    sha256:   859ec99fdc25dd9b239d9085bf656e4f49c93a32faa5bb248da83efd68ebd478\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1B0N revision=02,03\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-1f,80-9f:8000-ffff mask=0x8000\n"
+    "    necdsp model=uPD7725 frequency=8000000\n"
+    "      rom name=dsp1.program.rom size=0x1800\n"
+    "      rom name=dsp1.data.rom size=0x800\n"
+    "      ram size=0x200\n"
+    "      map id=io address=30-3f,b0-bf:8000-ffff select=0x4000\n"
+    "  information\n"
+    "    title:    Pilotwings\n"
+    "    name:     Pilotwings\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1B0N-02\n"
+    "    serial:   SNS-PW-USA\n"
+    "    sha256:   724144e34990069213591b5df067dd437a613b30f669840e9098db1dce626d2d\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "      rom name=dsp1.program.rom size=0x1800\n"
+    "      rom name=dsp1.data.rom size=0x800\n"
+    "      ram name=dsp1.data.ram size=0x200\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Lost Vikings 2\n"
+    "    name:     Lost Vikings 2\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   SNS-ALVE-USA\n"
+    "    sha256:   ab3d97c1a3a979e1680a428ec65df54cfb72997bbfe2173292248a4fa8c51ba1\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Jim Power: The Lost Dimension in 3D\n"
+    "    name:     Jim Power - The Lost Dimension in 3D\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-6J-USA\n"
+    "    sha256:   6f0bec87ece503b0fbe108cd159ed6f5fa7711b1c4fe31e982af41ad5c638093\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    The Terminator\n"
+    "    name:     Terminator\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-TN-USA\n"
+    "    sha256:   bd7074ef4a05d790646abe145ffd2587fb48044e4b730286d807abe102841177\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    MechWarrior 3050\n"
+    "    name:     MechWarrior 3050\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-20\n"
+    "    serial:   M/SNS-A35E-USA\n"
+    "    sha256:   7bffa1dc31604fa3d61e06ce2c59168098cc8dd7e59998e1d5f30c49bdf8d617\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3M revision=10,20,21,30\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    FIFA Soccer '96\n"
+    "    name:     FIFA Soccer '96\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3M-30\n"
+    "    serial:   M/SNS-A6SE-USA\n"
+    "    sha256:   26ff143c2f1a4a16ca838cc4b5555e39bbe7208515dca8f1c4b1a00dec61cf09\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A0N revision=01,10,11,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Mighty Morphin Power Rangers: The Movie\n"
+    "    name:     Mighty Morphin Power Rangers - The Movie\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A0N-20\n"
+    "    serial:   M/SNS-A2RE-USA\n"
+    "    sha256:   c706b70097c679f6f0ced6f77a30620807d0b2555fc3c683c0ec2fc791176039\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3M revision=10,20,21,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Dragon View\n"
+    "    name:     Dragon View\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3M-21\n"
+    "    serial:   SNS-ADVE-USA\n"
+    "    sha256:   a3b1cae3fe55fe52c035ab122e7f850640b0935524496d45b1915ca3c8a934f4\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3B revision=11,12,13\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-1f,80-9f:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Extra Innings\n"
+    "    name:     Extra Innings\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3B-12\n"
+    "    serial:   SNS-GL-USA\n"
+    "    sha256:   1576066e0cb771a91caf79e7d4f6dc00eb0daa47f0786f1604b32537429a7f45\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    George Foreman's KO Boxing\n"
+    "    name:     George Foreman's KO Boxing\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-GK-USA\n"
+    "    sha256:   fc993c122079b94ebc9b9452b46a55d5ddcd3715a4b97af795222b264827e90f\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    The Miracle Piano Teaching System\n"
+    "    name:     Miracle Piano Teaching System, The\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-01\n"
+    "    serial:   SNS-MR-USA\n"
+    "    sha256:   8546dfc91f6256df8b21083531457e3edf0021da12fce6858e2c59ff239c31da\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Super Bomberman 2\n"
+    "    name:     Super Bomberman 2\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-10\n"
+    "    serial:   SNS-M4-USA\n"
+    "    sha256:   0a4b4a783a7faf6ada3e1326ecf85de77e8c2a171659b42a78a1fae43f806ca6\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super Battleship\n"
+    "    name:     Super Battleship\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-8B-USA\n"
+    "    sha256:   1d6573e3db2efab0c98d1940b4171d569348d27a1cc20e80a83094e6c0e66e35\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Gods\n"
+    "    name:     Gods\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-GZ-USA\n"
+    "    sha256:   8796ca4de3aeffd3a494fe28e7d7e2aeb220ca652b43684f29e2cc94f02c20c4\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3M revision=10,20,21,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Championship Soccer '94\n"
+    "    name:     Championship Soccer '94\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3M-20\n"
+    "    serial:   SNS-67-USA\n"
+    "    sha256:   fdd763dffc6fb38975d4c6d6e3123f9738122781b7d13e1fc7f9820464cbaeb5\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Spider-Man & X-Men: Arcade's Revenge\n"
+    "    name:     Spider-Man & X-Men - Arcade's Revenge\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-MN-USA\n"
+    "    sha256:   63210a91573fa8e19592f2e6c746a400831d804c00453739447d2df32e731df7\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=BJ3M revision=10\n"
+    "    rom name=program.rom size=0x300000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "    map id=ram address=20-3f,a0-bf:6000-7fff mask=0xe000\n"
+    "  information\n"
+    "    title:    Final Fantasy III\n"
+    "    name:     Final Fantasy III\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-BJ3M-10\n"
+    "    serial:   SNS-F6-USA\n"
+    "    sha256:   0f51b4fca41b7fd509e4b8f9d543151f68efa5e97b08493e4b2a0c06f5d8d5e2\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x300000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    B.O.B.\n"
+    "    name:     BOB\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-B4-USA\n"
+    "    sha256:   9e6ebebcf14609c2a38a5f4409d0c8c859949cded70c5b6fd16fd15d9983d9d3\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1K0N revision=01\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "    necdsp model=uPD7725 frequency=8000000\n"
+    "      rom name=dsp1.program.rom size=0x1800\n"
+    "      rom name=dsp1.data.rom size=0x800\n"
+    "      ram size=0x200\n"
+    "      map id=io address=00-1f,80-9f:6000-7fff select=0x1000\n"
+    "  information\n"
+    "    title:    Suzuka 8 Hours\n"
+    "    name:     Suzuka 8 Hours\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1K0N-01\n"
+    "    serial:   SNS-8H-USA\n"
+    "    sha256:   dfada65f4497f482d5f81964322d9952f678f50e65418d307d4503f9bf9a32d9\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      rom name=dsp1.program.rom size=0x1800\n"
+    "      rom name=dsp1.data.rom size=0x800\n"
+    "      ram name=dsp1.data.ram size=0x200\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Terminator 2: Judgment Day\n"
+    "    name:     Terminator 2 - Judgment Day\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-TP-USA\n"
+    "    sha256:   06db3be569a587d79b51bfc684fd2ebdea977863875aedec88218fbb4169c21b\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Harley's Humongous Adventure\n"
+    "    name:     Harley's Humongous Adventure\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-HV-USA\n"
+    "    sha256:   6e2a02a8944c19db3da76d2646f232fbe3ed039bc7d44cc03910814fa77a7acf\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x300000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Spawn\n"
+    "    name:     Spawn\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-20\n"
+    "    serial:   SNS-A9WE-USA\n"
+    "    sha256:   32d0f1ca5b91fd9b2caf81422fb9e8fb30bc091f0b2a429b9269dd307fcba4fd\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x300000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J3B revision=01\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "    map id=ram address=20-3f,a0-bf:6000-7fff mask=0xe000\n"
+    "  information\n"
+    "    title:    Illusion of Gaia\n"
+    "    name:     Illusion of Gaia\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J3B-01\n"
+    "    serial:   SNS-JG-USA\n"
+    "    sha256:   32adc048fd89228a4310c03df243e83de7d436cdb2460b4cc83ade20d359b2bd\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=LJ3M revision=01\n"
+    "    rom name=program.rom size=0x600000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-3f:8000-ffff base=0x400000\n"
+    "    map id=rom address=40-7d:0000-ffff base=0x400000\n"
+    "    map id=rom address=80-bf:8000-ffff mask=0xc00000\n"
+    "    map id=rom address=c0-ff:0000-ffff mask=0xc00000\n"
+    "    map id=ram address=80-bf:6000-7fff mask=0xe000\n"
+    "  information\n"
+    "    title:    テイルズ オブ ファンタジア\n"
+    "    name:     Tales of Phantasia\n"
+    "    region:   JP\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-LJ3M-01\n"
+    "    serial:   SHVC-ATVJ-JPN\n"
+    "    sha256:   77b2d5450ce3c87185f913c2584673530c13dfbe8cc433b1e9fe5e9a653bf7d5\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x600000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3B revision=11,12,13\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-1f,80-9f:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    True Golf Classics: Pebble Beach Golf Links\n"
+    "    name:     True Golf Classics - Pebble Beach Golf Links\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3B-12\n"
+    "    serial:   SNS-GB-USA\n"
+    "    sha256:   5c7b28bb24bad697156ad444ff23bd15ad6744dbf9899b3cccf2aa36d559d825\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Beauty and the Beast\n"
+    "    name:     Beauty and the Beast\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-EW-USA\n"
+    "    sha256:   d7271ca08400bbf5ae165b0aaa6e8a8a1b266f72e6e0ae10aae529732a472f7c\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Cybernator\n"
+    "    name:     Cybernator\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-AV-USA\n"
+    "    sha256:   ad31b94ce928ecff605e2b89082154671691509e95d38370ed381437f2c36698\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    The Simpsons: Virtual Bart\n"
+    "    name:     Simpsons - Virtual Bart, The\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-AVBE-USA\n"
+    "    sha256:   29c28188234ddbb0b72fc84253dcd3514e23034779c773db8097b073b73390c8\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=BJ0N revision=01,20\n"
+    "    rom name=program.rom size=0x300000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Mortal Kombat II\n"
+    "    name:     Mortal Kombat 2\n"
+    "    region:   NA\n"
+    "    revision: 1.1\n"
+    "    board:    SHVC-BJ0N-01\n"
+    "    serial:   SNS-28-USA\n"
+    "    sha256:   ca2f86ca77f822fcd8e86f5a287f2a76d0becbb81a7bce73ae22909beb2f834c\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x300000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Hammer Lock Wrestling\n"
+    "    name:     Hammer Lock Wrestling\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-LJ-USA\n"
+    "    sha256:   21cd6d749674c55342f5f1a895642d4b58b9bd7eb211f5df3a35dc6c2f5d4501\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Bubsy in Claws Encounters of the Furred Kind\n"
+    "    name:     Bubsy I - Claws Encounters of the Furred Kind\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-UY-USA\n"
+    "    sha256:   811cbc3287c0959e8eb242e817684d36de664ebebc5873a1fa9958693857c438\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Lethal Weapon\n"
+    "    name:     Lethal Weapon\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-L3-USA\n"
+    "    sha256:   80c22cc92d51a54de9cd9fd00db5ff58a35fff35e822169c94e445d50834fba3\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A0N revision=01,10,11,20\n"
+    "    rom name=program.rom size=0x140000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    The Ren & Stimpy Show: Time Warp\n"
+    "    name:     Ren & Stimpy Show - Time Warp, The\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A0N-11\n"
+    "    serial:   SNS-ARTE-USA\n"
+    "    sha256:   ad7dd4efb8836d4009f6c76bd21865d8f5dcf9c3cbd8fa7bb32d686488847120\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x140000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    The Chessmaster\n"
+    "    name:     Chessmaster, The\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-01\n"
+    "    serial:   SNS-CH-USA\n"
+    "    sha256:   ee0e51d922d1cf8abe3dfc6b0d84a988a6635dc96b2a96962007c41aaa542774\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Tetris & Dr. Mario\n"
+    "    name:     Tetris & Dr. Mario\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   SNS-AFTE-USA-1\n"
+    "    sha256:   3cdebbd8adc4bb6773a7995f542fdac49adefca71cba583255a1c1bf37ac3946\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1K0N revision=01\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "    necdsp model=uPD7725 frequency=8000000\n"
+    "      rom name=dsp1b.program.rom size=0x1800\n"
+    "      rom name=dsp1b.data.rom size=0x800\n"
+    "      ram size=0x200\n"
+    "      map id=io address=00-1f,80-9f:6000-7fff select=0x1000\n"
+    "  information\n"
+    "    title:    Ballz 3D\n"
+    "    name:     Ballz 3D\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1K0N-01\n"
+    "    serial:   SNS-ABZE-USA\n"
+    "    sha256:   a3213e40d7abbc25a5b909642433103b06d8f90500c930bf64093ade0329da78\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      rom name=dsp1b.program.rom size=0x1800\n"
+    "      rom name=dsp1b.data.rom size=0x800\n"
+    "      ram name=dsp1b.data.ram size=0x200\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3M revision=10,20,21,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Dig & Spike Volleyball\n"
+    "    name:     Dig & Spike Volleyball\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3M-20\n"
+    "    serial:   SNS-VH-USA\n"
+    "    sha256:   9c4721339a197185d61e0697ea0149db143a27ddb2f57ebd398f18bcf4d7724b\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    RoboCop versus The Terminator\n"
+    "    name:     RoboCop vs. The Terminator\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-VR-USA\n"
+    "    sha256:   a2115e7576dec06e0de613efb89de861815a78ef72e78a3784be09fb7541928f\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super Strike Eagle\n"
+    "    name:     Super Strike Eagle\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-EG-USA\n"
+    "    sha256:   830c900083cccc6ded74c167c4e257db34df4786ecd6e2f053de454db7d31fe5\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Nigel Mansell's World Championship Racing\n"
+    "    name:     Nigel Mansell's World Championship Racing\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-M8-USA\n"
+    "    sha256:   ce9c819d6496e58901b39d9b04558a89e09ccc3aac33690b8d02bb0406682a57\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A0N revision=01,10,11,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Nickelodeon GUTS\n"
+    "    name:     Nickelodeon GUTS\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A0N-11\n"
+    "    serial:   SNS-ANGE-USA\n"
+    "    sha256:   d7ad6f67860da78fe25d9e79dd13af7ac7efaa0c8e0103898a4849ab4af9e438\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Time Trax\n"
+    "    name:     Time Trax\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-X8-USA\n"
+    "    sha256:   fa7e2b40093f0cc7233cc77e95bbbea2144c8183dec10446590396fffd7cda37\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3B revision=11,12,13\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-1f,80-9f:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    True Golf Classics: Waialae Country Club\n"
+    "    name:     True Golf Classics - Waialae Country Club\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3B-11\n"
+    "    serial:   SNS-TG-USA\n"
+    "    sha256:   72088194a65fc057f2910945a33d9f071682a4cecac8996f0bdabcdb5ef39962\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    King of the Monsters 2\n"
+    "    name:     King of the Monsters 2\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-10\n"
+    "    serial:   SNS-KT-USA\n"
+    "    sha256:   a9729d049ce580839bbfef1836a13dc16f2fc934d203ebf7390e0b1c47ea9a2d\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    The Mask\n"
+    "    name:     Mask, The\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-AMGE-USA\n"
+    "    sha256:   44cc113ce1e7616cc737adea9e8f140436c9f1c3fba57e8e9db48025d4ace632\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Smart Ball\n"
+    "    name:     Smart Ball\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-01\n"
+    "    serial:   SNS-JB-USA\n"
+    "    sha256:   cbca00fa5dfd6c72db2f21d010255657c33f7ac48de2554262035ead11bdf314\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Bulls vs. Blazers and the NBA Playoffs\n"
+    "    name:     Bulls vs. Blazers and the NBA Playoffs\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-BU-USA\n"
+    "    sha256:   ba4f31353e0e1233b574391ad97a80901d7de212e2c55d7be2af11a9a57c8225\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J3M revision=01,11,20\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "    map id=ram address=20-3f,a0-bf:6000-7fff mask=0xe000\n"
+    "  information\n"
+    "    title:    The Sporting News Baseball\n"
+    "    name:     Sporting News Baseball, The\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J3M-20\n"
+    "    serial:   M/SNS-AWBE-USA\n"
+    "    sha256:   8d3f20af0be588cf2edc39aee0d96d4085512919a05c0e90a7848e414cc20e42\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=YA0N revision=01\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Battle Blaze\n"
+    "    name:     Battle Blaze\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-YA0N-01\n"
+    "    serial:   SNS-BZ-USA\n"
+    "    sha256:   983022203546e031773db0d1af7552c489187954882843f13ff123f09064c1d3\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A1M revision=01,11,20\n"
+    "    rom name=program.rom size=0x300000\n"
+    "    ram name=save.ram size=0x800\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    NFL Quarterback Club '96\n"
+    "    name:     NFL Quarterback Club '96\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A1M-20\n"
+    "    serial:   SNS-AQBE-USA\n"
+    "    sha256:   f43f8ec546b8060e9d191fca860c38caf5a43eda86a304f0073647c6fad7b2c9\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x300000\n"
+    "      ram name=save.ram size=0x800\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A0N revision=01,10,11,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Brawl Brothers\n"
+    "    name:     Brawl Brothers\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A0N-10\n"
+    "    serial:   SNS-RE-USA\n"
+    "    sha256:   044b61613ed66eae08abd5fa5dcd13b24aab11a942e3309cdff624d198c47440\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Beavis and Butt-Head\n"
+    "    name:     Beavis and Butt-Head\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    MAXI-1A0N-30-2\n"
+    "    serial:   SNS-ABUE-USA\n"
+    "    sha256:   15d4fc90cb202a9391718cd40b9f0384165aef03018ed932540e8f7c18b397dd\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    3 Ninjas Kick Back\n"
+    "    name:     3 Ninjas Kick Back\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-A3NE-USA\n"
+    "    sha256:   2ffe8828480f943056fb1ab5c3c84d48a0bf8cbe3ed7c9960b349b59adb07f3b\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J3M revision=01,11,20\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "    map id=ram address=20-3f,a0-bf:6000-7fff mask=0xe000\n"
+    "  information\n"
+    "    title:    Madden NFL '95\n"
+    "    name:     Madden NFL '95\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J3M-11\n"
+    "    serial:   SNS-ANLE-USA\n"
+    "    sha256:   0ad77ae7af231313e1369a52d1622b88e3751aa5ec774628df7071f9e4244abc\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Sports Illustrated: Championship Football & Baseball\n"
+    "    name:     Sports Illustrated - Championship Football & Baseball\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-LU-USA\n"
+    "    sha256:   254d17a82a32d8bd231ca3a87d356b65e65cb0229902a69a57c21a4c99bbba1f\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A1M revision=01,11,20\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    ram name=save.ram size=0x800\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Riddick Bowe Boxing\n"
+    "    name:     Riddick Bowe Boxing\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A1M-01\n"
+    "    serial:   SNS-XG-USA\n"
+    "    sha256:   e3ea89964ee82d2ae1e5739b8503acf62732aedef28d1b3d5caa9ebae0feec06\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "      ram name=save.ram size=0x800\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Sunset Riders\n"
+    "    name:     Sunset Riders\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-6S-USA\n"
+    "    sha256:   e9c406d4f773697b9b671e7ddf2207c9d0ab242d7f23e502cdd453fbb264d392\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3B revision=11,12,13\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-1f,80-9f:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Soul Blazer\n"
+    "    name:     Soul Blazer\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3B-13\n"
+    "    serial:   SNS-SO-USA\n"
+    "    sha256:   8438da09de8ce9aded3bb08644543f7b60fb60cffc68ce2d67d6a0643f2ecfc2\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1CA0N5S revision=01\n"
+    "    superfx revision=4\n"
+    "      rom name=program.rom size=0x80000\n"
+    "      ram name=save.ram size=0x8000\n"
+    "      map id=io address=00-3f,80-bf:3000-34ff\n"
+    "      map id=rom address=00-3f,80-bf:8000-ffff mask=0x8000\n"
+    "      map id=rom address=40-5f,c0-df:0000-ffff\n"
+    "      map id=ram address=00-3f,80-bf:6000-7fff size=0x2000\n"
+    "      map id=ram address=70-71,f0-f1:0000-ffff\n"
+    "  information\n"
+    "    title:    Vortex\n"
+    "    name:     Vortex\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1CA0N5S-01\n"
+    "    serial:   SNS-4V-USA\n"
+    "    sha256:   41b5561de9e4984276e52987ea46c5f4fa8526d8141c70c738875a9eb9fe9d70\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "      ram name=save.ram size=0x8000\n"
+    "      superfx revision=4\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=3J0N revision=01\n"
+    "    rom name=program.rom size=0x280000\n"
+    "    map id=rom address=00-2f,80-af:8000-ffff\n"
+    "    map id=rom address=40-6f,c0-ef:0000-ffff\n"
+    "  information\n"
+    "    title:    Street Fighter II Turbo: Hyper Fighting\n"
+    "    name:     Street Fighter II Turbo - Hyper Fighting\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-3J0N-01\n"
+    "    serial:   SNS-TI-USA\n"
+    "    sha256:   3e487f8ba48c0b5e31744e3281d6bce375089db6075c8eb3d9a929376b817381\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x280000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J3M revision=01,11,20\n"
+    "    rom name=program.rom size=0x400000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "    map id=ram address=20-3f,a0-bf:6000-7fff mask=0xe000\n"
+    "  information\n"
+    "    title:    Ken Griffey Jr.'s Winning Run\n"
+    "    name:     Ken Griffey Jr.'s Winning Run\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J3M-20\n"
+    "    serial:   M/SNS-A9GE-USA\n"
+    "    sha256:   18b5276be764c06531219c1757d40214aeec06fae68f4ce3ec78b58ee750a43e\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x400000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=BJ0N revision=01,20\n"
+    "    rom name=program.rom size=0x300000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Double Dragon V: The Shadow Falls\n"
+    "    name:     Double Dragon V - The Shadow Falls\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-BJ0N-01\n"
+    "    serial:   SNS-5E-USA\n"
+    "    sha256:   b32aa9cbf8f6baacc84f6418fa6fbc33b9ce71458fecc91275aafdbf6f743a99\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x300000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    The Ignition Factor\n"
+    "    name:     Ignition Factor, The\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-10\n"
+    "    serial:   SNS-AIFE-USA\n"
+    "    sha256:   fa143784fd20721d61101920e6aae9b7f5012b8157b1ce0c7ea83ea6c875d84d\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3B revision=20\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Ken Griffey Jr. Presents Major League Baseball\n"
+    "    name:     Ken Griffey Jr. Presents Major League Baseball\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3B-20\n"
+    "    serial:   SNS-JR-USA\n"
+    "    sha256:   3104d6c06c8909c56f6adb2faecf1b4382f2490370798b605631da926c5306d8\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Time Cop\n"
+    "    name:     Time Cop\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-ATCE-USA\n"
+    "    sha256:   16fb965130e57f37dda2466f23820f091f8b96758aa7e30ba4fd63cb618e5ddb\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    The Jetsons: Invasion of the Planet Pirates\n"
+    "    name:     Jetsons - Invasion of the Planet Pirates, The\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-8J-USA\n"
+    "    sha256:   ee7a29eb9c302ea2bb235ef990fd8344a6beb9817499941c40a8a94ad5f7c964\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Yoshi's Cookie\n"
+    "    name:     Yoshi's Cookie\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-YC-USA\n"
+    "    sha256:   90ad69a489194aca7ef7b7fd1d30e0105da4934a81ac8b0333ea20f9248df92d\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    The Death and Return of Superman\n"
+    "    name:     Death and Return of Superman, The\n"
+    "    region:   NA\n"
+    "    revision: 1.1\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-9D-LTN\n"
+    "    sha256:   e678a29a93111cf2016c487ba9977b14de8f719040651a42c74bd74eea2d0d81\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3B revision=11,12,13\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-1f,80-9f:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Lagoon\n"
+    "    name:     Lagoon\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3B-12\n"
+    "    serial:   SNS-LA-USA\n"
+    "    sha256:   46c811f0cacffe8f20e1d63072d25d7c47e9bb3fd5124851fd05aca9884d21fb\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3M revision=10,20,21,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Harvest Moon\n"
+    "    name:     Harvest Moon\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3M-30\n"
+    "    serial:   SNS-AYWE-USA\n"
+    "    sha256:   73a3aa87ddd5ce5df5ba51292316f42b6e128280179b0a1b11b4dcddc17d4163\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A1M revision=01,11,20\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x800\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Big Sky Trooper\n"
+    "    name:     Big Sky Trooper\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A1M-20\n"
+    "    serial:   M/SNS-AB9E-USA\n"
+    "    sha256:   4cb601168c91fa0608c16a8cf2f292d991c6a5615d51861dee2f9b91c8d6bb19\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x800\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Doomsday Warrior\n"
+    "    name:     Doomsday Warrior\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-DM-USA\n"
+    "    sha256:   bb915b286b33842e39e9022366169233a4041515c7ecc60ac428420b28e48dd5\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super Star Wars III: Return of the Jedi\n"
+    "    name:     Super Star Wars III - Return of the Jedi\n"
+    "    region:   NA\n"
+    "    revision: 1.1\n"
+    "    board:    MAXI-1A0N-30-2\n"
+    "    serial:   SNS-ARJE-USA\n"
+    "    sha256:   f7df5cd16ce6624567d1a24e9b9c0b9050ea9b6a9fe5a7973484589637756596\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Darius Twin\n"
+    "    name:     Darius Twin\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-01\n"
+    "    serial:   SNS-DT-USA\n"
+    "    sha256:   ceb470157576eac3b8b8c16e8ab6b59672409681ffb4232e4ec39dd0cb37ef91\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Captain Commando\n"
+    "    name:     Captain Commando\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-20\n"
+    "    serial:   M/SNS-QM-USA\n"
+    "    sha256:   d9b7f9356be0780f0037093a86ef8450f15e569cbd3680073d1cd345dfadb709\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3B revision=11,12,13\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-1f,80-9f:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Arcana\n"
+    "    name:     Arcana\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3B-13\n"
+    "    serial:   SNS-RF-USA\n"
+    "    sha256:   aac9d6f2b8408e4bbdc83ebbba755428caf8021fefbfac7220fb4c772abd9944\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=YA0N revision=01\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Yoshi's Safari\n"
+    "    name:     Yoshi's Safari\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-YA0N-01\n"
+    "    serial:   SNS-RH-USA\n"
+    "    sha256:   12fba2aff04c8e39968e828629ebd16caa314bca397a9418d35fdaffe8188e20\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Taz-Mania\n"
+    "    name:     Taz-Mania\n"
+    "    region:   NA\n"
+    "    revision: 1.1\n"
+    "    board:    MAXI-1A0N-30-2\n"
+    "    serial:   SNS-TZ-USA\n"
+    "    sha256:   1711fe9010232b41ec406900e5b4ef528dd2beaa97b27d94ed7eef57d63904a0\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A5B revision=02,04\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    ram name=save.ram size=0x8000\n"
+    "    map id=rom address=00-1f,80-9f:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    SimCity\n"
+    "    name:     SimCity\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A5B-02\n"
+    "    serial:   SNS-SC-USA\n"
+    "    sha256:   e9c0bc05511e05a0d7c3e7cc42e761e1e8e532d46f59b9854b6902e1a2e9dd0a\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "      ram name=save.ram size=0x8000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3M revision=10,20,21,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Super Punch-Out!!\n"
+    "    name:     Super Punch-Out!!\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3M-21\n"
+    "    serial:   SNS-4Q-USA\n"
+    "    sha256:   a3d803b8c6b0b6ac55085671040b840f993543915c7f802e14fb651beabe9b63\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x140000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Aladdin\n"
+    "    name:     Aladdin\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    MAXI-1A0N-30-2\n"
+    "    serial:   SNS-RJ-USA\n"
+    "    sha256:   aa768b8b00123717c8d49f2c6731cdbfd80ab6a54128bae7594e93f45e38a19e\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x140000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super Battletank 2\n"
+    "    name:     Super Battletank 2\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-2X-USA\n"
+    "    sha256:   b68e865b0b5fe6af421a171e94fb1cb0006ae3e412b6361f6f858c44adaa304b\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    The Brainies\n"
+    "    name:     Brainies, The\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-B7-USA\n"
+    "    sha256:   9885ca148d32c4df6230642bcfa153f7e51b9559415042a831db14d07b3e6c3d\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Kawasaki Superbike Challenge\n"
+    "    name:     Kawasaki Superbike Challenge\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-AKEE-USA\n"
+    "    sha256:   fec6dd097e378e795dd164be658b10b1c60672b2351a7f4a7722d1fe5736410e\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super Off Road: The Baja\n"
+    "    name:     Super Off Road - The Baja\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    MAXI-1A0N-30-2\n"
+    "    serial:   SNS-R8-USA\n"
+    "    sha256:   16f9c90d75bd23d0620be00ecf818fcb25c5935d4ee26b1fe17b926f8987aa65\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    The Addams Family\n"
+    "    name:     Addams Family\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-01\n"
+    "    serial:   SNS-AF-USA\n"
+    "    sha256:   e645310d2406ace85523ed91070ee7ff6aa245217267dacb158ae9fc75109692\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Joe & Mac\n"
+    "    name:     Joe & Mac\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-01\n"
+    "    serial:   SNS-JT-USA\n"
+    "    sha256:   3b2b8b813b58049a4a86ce1c42d2a651f19fd9bbab2407a494e20cf343d3c1a4\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2J3M revision=01,11,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "    map id=ram address=10-1f,30-3f:6000-7fff mask=0xe000\n"
+    "    map id=ram address=90-9f,b0-bf:6000-7fff mask=0xe000\n"
+    "  information\n"
+    "    title:    Brain Lord\n"
+    "    name:     Brain Lord\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2J3M-11\n"
+    "    serial:   SNS-3B-USA\n"
+    "    sha256:   f4666355e7fea434843dc6d5119673bd6c23e69b884aac0b382ff036997e52b5\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Bill Walsh College Football\n"
+    "    name:     Bill Walsh College Football\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-10\n"
+    "    serial:   SNS-7F-USA\n"
+    "    sha256:   ec2d91e238c26a5ddf7067d104b3b3e2eaee89255377e1eb6c4df8f301300e64\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Mighty Morphin Power Rangers: The Fighting Edition\n"
+    "    name:     Mighty Morphin Power Rangers - The Fighting Edition\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-A3RE-USA\n"
+    "    sha256:   1b85c0690aa156a255c7f79e133e453345452698fa98abf8df744c262d0cf865\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Urban Strike\n"
+    "    name:     Urban Strike\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    MJSC-1A0N-30-2\n"
+    "    serial:   M/SNS-AUSE-USA\n"
+    "    sha256:   dcb33a89fcb8d8ca8f3a467034728ad6375273d8eb51a60418ca51ef745e9b38\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Krusty's Super Fun House\n"
+    "    name:     Krusty's Super Fun House\n"
+    "    region:   NA\n"
+    "    revision: 1.1\n"
+    "    board:    SHVC-1A0N-02\n"
+    "    serial:   SNS-FH-USA\n"
+    "    sha256:   e36322697c48baae6492db91e6cbf3844a420f6e0cc8a75f3a73556026ddbbb8\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Home Alone 2: Lost in New York\n"
+    "    name:     Home Alone 2 - Lost in New York\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-HN-USA\n"
+    "    sha256:   27eaccb4eea93832639565a664bf3561ed5a11ac025d377a3f33262d851c1b2b\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Cal Ripken Jr. Baseball\n"
+    "    name:     Cal Ripken Jr. Baseball\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-CJ-USA-1\n"
+    "    sha256:   75993076c8773e7c7d555ef290be10590def40ca7b83307b8dc86556b04a6565\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super Putty\n"
+    "    name:     Super Putty\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-YU-USA\n"
+    "    sha256:   3dff3513ae6acb85a02b00b9f5adb4757ab97661993bded4f329127a792cef87\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3M revision=10,20,21,30\n"
+    "    rom name=program.rom size=0x400000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Exertainment Mountain Bike Rally + Speed Racer\n"
+    "    name:     Exertainment Mountain Bike Rally + Speed Racer\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3M-30\n"
+    "    serial:   SNS-ALFE-USA\n"
+    "    sha256:   a0521f50b0d0bff6666bfb712498476eb8d5974ef38caf157e2f67cbce5475bb\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x400000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2E3M revision=01\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff mask=0x8000\n"
+    "    obc1\n"
+    "      ram name=save.ram size=0x2000\n"
+    "      map id=io address=00-3f,80-bf:6000-7fff\n"
+    "      map id=io address=70-71,f0-f1:6000-7fff,e000-ffff\n"
+    "  information\n"
+    "    title:    Metal Combat: Falcon's Revenge\n"
+    "    name:     Metal Combat - Falcon's Revenge\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2E3M-01\n"
+    "    serial:   SNS-KD-USA\n"
+    "    sha256:   d4f2cb6b209db29f7aec62e5a23846681c14665fb007e94d7bcfc7b5611e938b\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Where in Time is Carmen Sandiego\?\n"
+    "    name:     Where in Time is Carmen Sandiego\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-WN-USA\n"
+    "    sha256:   e3177f066bf004fd99aef31f2692ba0b412dd280d613dc3f4cf334d97f4c9af8\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Wolverine: Adamantium Rage\n"
+    "    name:     Wolverine - Adamantium Rage\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-AWXE-USA\n"
+    "    sha256:   44428a3d1c796fbd41da7620e321c45f11cd80a0e5f4ab8c48177106cb960d77\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Bust-a-Move\n"
+    "    name:     Bust-a-Move\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-AYKE-USA\n"
+    "    sha256:   d6f6c30732dae8d00cd83628c3156acbdf26f99df701f779522e21de74dae5fe\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2J0N revision=01,10,11\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Sonic Blast Man II\n"
+    "    name:     Sonic Blast Man II\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2J0N-11\n"
+    "    serial:   SNS-2C-USA\n"
+    "    sha256:   efe78f6fc68ddd0f6ef0ad9e0223d9417c14fcadece987dc8f50423fd6723b27\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3M revision=10,20,21,30\n"
+    "    rom name=program.rom size=0x300000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    College Slam\n"
+    "    name:     College Slam\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3M-30\n"
+    "    serial:   M/SNS-ANYE-USA\n"
+    "    sha256:   b0be35a0d5e500f4fffca5f2940e0ec52c81ce99dacd773c3ca9cf92f592d943\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x300000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    King of Dragons\n"
+    "    name:     King of Dragons\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-10\n"
+    "    serial:   SNS-EI-USA\n"
+    "    sha256:   6638b5541059814d4c34574e5e277ef613aebf81c91d3def557a7642fb5840e1\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J0N revision=01,10,20\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Pieces\n"
+    "    name:     Pieces\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1J0N-10\n"
+    "    serial:   SNS-Z5-USA\n"
+    "    sha256:   a0b39d7fd7c39c5b0f41f3542fb8d2887530ded1c111b4ffb2a863845e704ecc\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Space Ace\n"
+    "    name:     Space Ace\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-5A-USA\n"
+    "    sha256:   85887dfa92374048fb20809c00eabea428992024cf875d287d0431b9767cc7cb\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Rival Turf!\n"
+    "    name:     Rival Turf!\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-01\n"
+    "    serial:   SNS-RB-USA\n"
+    "    sha256:   3f59cc687d22cd1b23cc33ae6e4518234c9da813c01f79f4c43716e12d32a12d\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Alien 3\n"
+    "    name:     Alien 3\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-A3-USA\n"
+    "    sha256:   e637b8241d55ee334a3452888df5e30d72c520dbb55c498db1a984438bab3e55\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3B revision=11,12,13\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-1f,80-9f:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    F1 Race of Champions\n"
+    "    name:     F1 Race of Champions\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3B-13\n"
+    "    serial:   SNS-EH-USA\n"
+    "    sha256:   1d38e3af9e3a6409e93f4705b68c42558f558c68f3e83ef2a40e46cf560b26cc\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2J0N revision=01,10,11\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Ranma 1/2: Hard Battle\n"
+    "    name:     Ranma Half - Hard Battle\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2J0N-01\n"
+    "    serial:   SNS-R2-USA\n"
+    "    sha256:   32d32ef56af83887cdc2c04b3da4be1cd82a473988deaa2e7dd50d38ef79c3a1\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=BA3M revision=01\n"
+    "    rom name=program.rom size=0x300000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    Super Metroid\n"
+    "    name:     Super Metroid\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-BA3M-01\n"
+    "    serial:   SNS-RI-USA\n"
+    "    sha256:   12b77c4bc9c1832cee8881244659065ee1d84c70c3d29e6eaf92e6798cc2ca72\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x300000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Ka-Blooey\n"
+    "    name:     Ka-Blooey\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-02\n"
+    "    serial:   SNS-BB-USA\n"
+    "    sha256:   05152bcf9bf086e7bcdbfa7dd8edfe2085f1339c4d7e193e0071c49a10471ef4\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A0N revision=01,10,11,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    WCW Super Brawl Wrestling\n"
+    "    name:     WCW Super Brawl Wrestling\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A0N-11\n"
+    "    serial:   SNS-AWRE-USA\n"
+    "    sha256:   215ab7e576b31462e3284d035006dc638cae06bbfb1af2c5617403b15ab2b25a\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2J0N revision=01,10,11\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "  information\n"
+    "    title:    Soldiers of Fortune\n"
+    "    name:     Soldiers of Fortune\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2J0N-01\n"
+    "    serial:   SNS-UD-USA\n"
+    "    sha256:   6fe7c8d39fcfab7f0a18e837a7ee0dd162e0557d6989c6e0d10c81616d3a0b8b\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    International Superstar Soccer\n"
+    "    name:     International Superstar Soccer\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-3U-USA\n"
+    "    sha256:   6443fecebcdc2ff7061a40432f3ad1db6dfd354909a5f306972cf6afa122752c\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Biker Mice from Mars\n"
+    "    name:     Biker Mice from Mars\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-ABME-USA\n"
+    "    sha256:   91ba5691dea3cdf103177ae5779110fc372fce8229cf91f263073667e7a8b5b7\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A0N revision=01,10,11,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Barkley Shut Up and Jam!\n"
+    "    name:     Barkley Shut Up and Jam!\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A0N-11\n"
+    "    serial:   SNS-U5-USA\n"
+    "    sha256:   fe1ad128313b2b9a47f89cf0d95d4c0cc2cb35a817ac5d915ee6c4d98d47d675\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    The Hunt for Red October\n"
+    "    name:     Hunt for Red October, The\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-RO-USA\n"
+    "    sha256:   a03528344d40bf800cdbde2dd240b30442cec7aea6026fbbe312a7c36bf0f74a\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x80000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Bazooka Blitzkrieg\n"
+    "    name:     Bazooka Blitzkrieg\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-10\n"
+    "    serial:   SNS-BY-USA\n"
+    "    sha256:   0b0f991da7ce4b3c2974d6adf62191ec554db9793c5def14cdfb62b7ae28cc98\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x80000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super Slam Dunk\n"
+    "    name:     Super Slam Dunk\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-D9-USA\n"
+    "    sha256:   e987ceb53cc1407b1ba612b13a7b5391db6c41ea14552c165ae62ad42eeaa0ae\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Bebe's Kids\n"
+    "    name:     Bebe's Kids\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-6B-USA\n"
+    "    sha256:   4958eda26f2419f473449017c64121caee5e49c480ffa205422e7dd45cd23e31\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A3M revision=10,20,21,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    ram name=save.ram size=0x2000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=ram address=70-7d,f0-ff:0000-7fff\n"
+    "  information\n"
+    "    title:    NBA Showdown\n"
+    "    name:     NBA Showdown\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A3M-10\n"
+    "    serial:   SNS-6N-USA\n"
+    "    sha256:   6a7324734004d99206439430243b51a05fa8c25ffa314dafc7f127235d1a730f\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "      ram name=save.ram size=0x2000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    David Crane's Amazing Tennis\n"
+    "    name:     David Crane's Amazing Tennis\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-ZT-USA\n"
+    "    sha256:   e6efb6361af04963f22c772f879a466543f56b3b6a084204fef2dcb4659d82d9\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super Copa\n"
+    "    name:     Super Copa\n"
+    "    region:   MX\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-75-USA\n"
+    "    sha256:   db7d727de86a1ac886ce3c243bf5941910154eaef3be50209187b9711592830d\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=2A0N revision=01,10,11,20\n"
+    "    rom name=program.rom size=0x180000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Super Star Wars II: The Empire Strikes Back\n"
+    "    name:     Super Star Wars II - The Empire Strikes Back\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-2A0N-10\n"
+    "    serial:   SNS-E5-USA\n"
+    "    sha256:   1dd01da68cb61def641389bf3fa87b7a29113c9c8dd172cf303c0f7e03ba6e47\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x180000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Prince of Persia 2: The Shadow and the Flame\n"
+    "    name:     Prince of Persia 2 - The Shadow and the Flame\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   M/SNS-AUPE-USA\n"
+    "    sha256:   04ca1a481093c4a7e12f18b33697d6e05e50e30e0f5b1655aa265abd14719bba\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1J1M revision=11,20\n"
+    "    rom name=program.rom size=0x400000\n"
+    "    ram name=save.ram size=0x800\n"
+    "    map id=rom address=00-3f,80-bf:8000-ffff\n"
+    "    map id=rom address=40-7d,c0-ff:0000-ffff\n"
+    "    map id=ram address=20-3f,a0-bf:6000-7fff mask=0xe000\n"
+    "  information\n"
+    "    title:    Donkey Kong Country\n"
+    "    name:     Donkey Kong Country\n"
+    "    region:   NA\n"
+    "    revision: 1.2\n"
+    "    board:    SHVC-1J1M-20\n"
+    "    serial:   SNS-8X-USA\n"
+    "    sha256:   628147468c3539283197f58f03b94df49758a332831857481ea9cc31645f0527\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x400000\n"
+    "      ram name=save.ram size=0x800\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x200000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Carrier Aces\n"
+    "    name:     Carrier Aces\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-30\n"
+    "    serial:   SNS-ACAE-USA\n"
+    "    sha256:   ee5fc27dd19a2ecb3c3c7c73d558a18ffd5ff365710c18b88150e277f08d587e\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x200000\n"
+    "release\n"
+    "  cartridge region=NTSC\n"
+    "    board type=1A0N revision=01,02,10,20,30\n"
+    "    rom name=program.rom size=0x100000\n"
+    "    map id=rom address=00-7d,80-ff:8000-ffff mask=0x8000\n"
+    "    map id=rom address=40-7d,c0-ff:0000-7fff mask=0x8000\n"
+    "  information\n"
+    "    title:    Sparkster\n"
+    "    name:     Sparkster\n"
+    "    region:   NA\n"
+    "    revision: 1.0\n"
+    "    board:    SHVC-1A0N-20\n"
+    "    serial:   SNS-ASSE-USA\n"
+    "    sha256:   eaa06470734ea57eff9b888137aa468fcb7bb149a0870a85e68c9db123de4670\n"
+    "    configuration\n"
+    "      rom name=program.rom size=0x100000\n"
+  ;
+
+  //returns the entry whose image has this SHA-256 digest, or nullptr
+  inline const Entry* find(const uint8_t* sha256) {
+    uint32_t bucket = sha256[0] << 0 | sha256[1] << 8 | sha256[2] << 16 | sha256[3] << 24;
+    uint32_t key    = sha256[4] << 0 | sha256[5] << 8 | sha256[6] << 16 | sha256[7] << 24;
+    const Entry& e = entry[(uint32_t)((key ^ displacement[bucket & (Buckets - 1)]) * 0x9e3779b1u) >> (32 - SlotBits)];
+    return e.length && !memcmp(e.sha256, sha256, 32) ? &e : nullptr;
+  }
+}
@@ -121,10 +121,26 @@ void Ananke::createSuperFamicomHeuristicFirmware(vector<uint8_t> &buffer, const
 }
 
 string Ananke::openSuperFamicom(vector<uint8_t> &buffer) {
-  string sha256 = nall::sha256(buffer.data(), buffer.size());
+  sha256_ctx sha;
+  uint8_t hash[32];
+  sha256_init(&sha);
+  sha256_chunk(&sha, buffer.data(), buffer.size());
+  sha256_final(&sha);
+  sha256_hash(&sha, hash);
 
   string databaseText = string::read({configpath(), "ananke/database/Super Famicom.bml"}).strip();
-  if(databaseText.empty()) databaseText = string{Database::SuperFamicom}.strip();
+  if(databaseText.empty()) {
+    //built-in database: precompiled, indexed by SHA-256
+    if(auto entry = Database::SuperFamicomTable::find(hash)) {
+      string item = substr(Database::SuperFamicomTable::markup, entry->offset, entry->length);
+      auto document = Markup::Document(item);
+      return createSuperFamicomDatabase(buffer, document, item);
+    }
+    return createSuperFamicomHeuristic(buffer);
+  }
+
+  string sha256;
+  for(auto byte : hash) sha256.append(hex<2>(byte));
   lstring databaseItem = databaseText.split("\n\n");
 
   for(auto &item : databaseItem) {
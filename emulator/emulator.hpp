@@ -43,6 +43,7 @@ namespace Emulator {
 #include <nall/sha256.hpp>
 #include <nall/stdint.hpp>
 #include <nall/string.hpp>
+#include <nall/thread.hpp>
 #include <nall/utility.hpp>
 #include <nall/varint.hpp>
 #include <nall/vector.hpp>
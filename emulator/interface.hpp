@@ -53,6 +53,7 @@ struct Interface {
     virtual uint32_t videoColor(unsigned, uint16_t, uint16_t, uint16_t, uint16_t) { return 0u; }
     virtual void videoRefresh(const uint32_t*, const uint32_t*, unsigned, unsigned, unsigned) {}
     virtual void audioSample(int16_t, int16_t) {}
+    virtual void audioSamples(const int16_t* samples, unsigned frames) { for(unsigned n = 0; n < frames; n++) audioSample(samples[n * 2 + 0], samples[n * 2 + 1]); }
     virtual int16_t inputPoll(unsigned, unsigned, unsigned) { return 0; }
     virtual void inputRumble(unsigned, unsigned, unsigned, bool) {}
     virtual unsigned dipSettings(const Markup::Node&) { return 0; }
@@ -70,6 +71,7 @@ struct Interface {
   uint32_t videoColor(unsigned source, uint16_t alpha, uint16_t red, uint16_t green, uint16_t blue) { return bind->videoColor(source, alpha, red, green, blue); }
   void videoRefresh(const uint32_t* palette, const uint32_t* data, unsigned pitch, unsigned width, unsigned height) { return bind->videoRefresh(palette, data, pitch, width, height); }
   void audioSample(int16_t lsample, int16_t rsample) { return bind->audioSample(lsample, rsample); }
+  void audioSamples(const int16_t* samples, unsigned frames) { return bind->audioSamples(samples, frames); }
   int16_t inputPoll(unsigned port, unsigned device, unsigned input) { return bind->inputPoll(port, device, input); }
   void inputRumble(unsigned port, unsigned device, unsigned input, bool enable) { return bind->inputRumble(port, device, input, enable); }
   unsigned dipSettings(const Markup::Node& node) { return bind->dipSettings(node); }
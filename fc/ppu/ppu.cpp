@@ -103,6 +103,7 @@ uint8 PPU::read(uint16 addr) {
 
   switch(addr & 7) {
   case 2:  //PPUSTATUS
+    raster_sync();
     result |= status.nmi_flag << 7;
     result |= status.sprite_zero_hit << 6;
     result |= status.sprite_overflow << 5;
@@ -137,6 +138,7 @@ uint8 PPU::read(uint16 addr) {
 }
 
 void PPU::write(uint16 addr, uint8 data) {
+  raster_sync();
   status.mdr = data;
 
   switch(addr & 7) {
@@ -280,51 +282,65 @@ void PPU::scrolly_increment() {
 
 //
 
-void PPU::raster_pixel() {
+//pixels are drawn a tile at a time, once the tile's eight dots have been clocked.
+//the CPU runs while the PPU is suspended after drawing dot lx; before it can change
+//anything the pixels depend on, the pending pixels up to that dot are drawn.
+void PPU::raster_sync() {
+  if((status.ly < 240 || status.ly == 261) && status.lx < 256) raster_pixels(status.lx + 1);
+}
+
+//draws the pending pixels of the current tile, up to (not including) dot last
+void PPU::raster_pixels(unsigned last) {
+  if(raster.x >= last) return;
   uint32* output = buffer + status.ly * 256;
 
-  unsigned mask = 0x8000 >> (status.xaddr + (status.lx & 7));
-  unsigned palette = 0, object_palette = 0;
-  bool object_priority = 0;
-  palette |= (raster.tiledatalo & mask) ? 1 : 0;
-  palette |= (raster.tiledatahi & mask) ? 2 : 0;
-  if(palette) {
-    unsigned attr = raster.attribute;
-    if(mask >= 256) attr >>= 2;
-    palette |= (attr & 3) << 2;
+  //select the eight pixels under the fine X scroll, then expand them two bits per pixel
+  unsigned bg = 0;
+  if(status.bg_enable) {
+    bg  = planar[(uint8)(raster.tiledatalo << status.xaddr >> 8)] << 0;
+    bg |= planar[(uint8)(raster.tiledatahi << status.xaddr >> 8)] << 1;
   }
 
-  if(status.bg_enable == false) palette = 0;
-  if(status.bg_edge_enable == false && status.lx < 8) palette = 0;
-
-  if(status.sprite_enable == true)
-  for(signed sprite = 7; sprite >= 0; sprite--) {
-    if(status.sprite_edge_enable == false && status.lx < 8) continue;
-    if(raster.oam[sprite].id == 64) continue;
+  //only sprites that cover part of this tile are considered; the lowest index wins
+  unsigned sprites = 0, sprite[8], pixels[8];
+  if(status.sprite_enable)
+  for(unsigned n = 0; n < 8; n++) {
+    auto& obj = raster.oam[n];
+    if(obj.id == 64 || obj.x >= last || obj.x + 8 <= raster.x) continue;
+    pixels[sprites] = planar[obj.tiledatalo] << 0 | planar[obj.tiledatahi] << 1;
+    sprite[sprites++] = n;
+  }
 
-    unsigned spritex = status.lx - raster.oam[sprite].x;
-    if(spritex >= 8) continue;
+  for(unsigned x = raster.x; x < last; x++) {
+    unsigned fine = x & 7;
+    unsigned palette = bg >> fine * 2 & 3;
+    if(palette) {
+      unsigned attr = raster.attribute;
+      if(status.xaddr + fine < 8) attr >>= 2;
+      palette |= (attr & 3) << 2;
+    }
+    if(status.bg_edge_enable == false && x < 8) palette = 0;
 
-    if(raster.oam[sprite].attr & 0x40) spritex ^= 7;
-    unsigned mask = 0x80 >> spritex;
-    unsigned sprite_palette = 0;
-    sprite_palette |= (raster.oam[sprite].tiledatalo & mask) ? 1 : 0;
-    sprite_palette |= (raster.oam[sprite].tiledatahi & mask) ? 2 : 0;
-    if(sprite_palette == 0) continue;
+    if(status.sprite_edge_enable || x >= 8)
+    for(unsigned n = 0; n < sprites; n++) {
+      auto& obj = raster.oam[sprite[n]];
+      unsigned spritex = x - obj.x;
+      if(spritex >= 8) continue;
 
-    if(raster.oam[sprite].id == 0 && palette && status.lx != 255) status.sprite_zero_hit = 1;
-    sprite_palette |= (raster.oam[sprite].attr & 3) << 2;
+      if(obj.attr & 0x40) spritex ^= 7;
+      unsigned sprite_palette = pixels[n] >> spritex * 2 & 3;
+      if(sprite_palette == 0) continue;
 
-    object_priority = raster.oam[sprite].attr & 0x20;
-    object_palette = 16 + sprite_palette;
-  }
+      if(obj.id == 0 && palette && x != 255) status.sprite_zero_hit = 1;
+      if(palette == 0 || (obj.attr & 0x20) == 0) palette = 16 + (sprite_palette | (obj.attr & 3) << 2);
+      break;
+    }
 
-  if(object_palette) {
-    if(palette == 0 || object_priority == 0) palette = object_palette;
+    if(raster_enable() == false) palette = 0;
+    output[x] = (status.emphasis << 6) | cgram_read(palette);
   }
 
-  if(raster_enable() == false) palette = 0;
-  output[status.lx] = (status.emphasis << 6) | cgram_read(palette);
+  raster.x = last;
 }
 
 void PPU::raster_sprite() {
@@ -354,6 +370,7 @@ void PPU::raster_scanline() {
     return scanline();
   }
 
+  raster.x = 0;
   raster.oam_iterator = 0;
   raster.oam_counter = 0;
 
@@ -370,39 +387,30 @@ void PPU::raster_scanline() {
   for(unsigned tile = 0; tile < 32; tile++) {  //  0-255
     unsigned nametable = chr_load(0x2000 | (status.vaddr & 0x0fff));
     unsigned tileaddr = status.bg_addr + (nametable << 4) + (scrolly() & 7);
-    raster_pixel();
     tick();
-
-    raster_pixel();
     tick();
 
     unsigned attribute = chr_load(0x23c0 | (status.vaddr & 0x0fc0) | ((scrolly() >> 5) << 3) | (scrollx() >> 5));
     if(scrolly() & 16) attribute >>= 4;
     if(scrollx() & 16) attribute >>= 2;
-    raster_pixel();
     tick();
 
     scrollx_increment();
     if(tile == 31) scrolly_increment();
-    raster_pixel();
     raster_sprite();
     tick();
 
     unsigned tiledatalo = chr_load(tileaddr + 0);
-    raster_pixel();
     tick();
-
-    raster_pixel();
     tick();
 
     unsigned tiledatahi = chr_load(tileaddr + 8);
-    raster_pixel();
     tick();
 
-    raster_pixel();
     raster_sprite();
     tick();
 
+    raster_pixels(status.lx);
     raster.nametable = (raster.nametable << 8) | nametable;
     raster.attribute = (raster.attribute << 2) | (attribute & 3);
     raster.tiledatalo = (raster.tiledatalo << 8) | tiledatalo;
@@ -484,4 +492,11 @@ void PPU::raster_scanline() {
   return scanline();
 }
 
+PPU::PPU() {
+  for(unsigned n = 0; n < 256; n++) {
+    planar[n] = 0;
+    for(unsigned x = 0; x < 8; x++) planar[n] |= (n >> (7 - x) & 1) << x * 2;
+  }
+}
+
 }
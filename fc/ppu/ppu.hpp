@@ -29,11 +29,13 @@ struct PPU : Thread {
   void scrollx_increment();
   void scrolly_increment();
 
-  void raster_pixel();
+  void raster_sync();
+  void raster_pixels(unsigned last);
   void raster_sprite();
   void raster_scanline();
 
   void serialize(serializer&);
+  PPU();
 
   struct Status {
     uint8 mdr;
@@ -78,6 +80,8 @@ struct PPU : Thread {
   } status;
 
   struct Raster {
+    unsigned x;  //pixels of the current scanline drawn so far
+
     uint16 nametable;
     uint16 attribute;
     uint16 tiledatalo;
@@ -98,6 +102,8 @@ struct PPU : Thread {
     } oam[8], soam[8];
   } raster;
 
+  uint16 planar[256];  //bitplane byte -> eight 2-bit pixels, leftmost in the low bits
+
   uint32 buffer[256 * 262];
   uint8 ciram[2048];
   uint8 cgram[32];
@@ -16,7 +16,7 @@ void CPU::add_clocks(unsigned clocks) {
   }
 
   system.clocks_executed += clocks;
-  if(system.sgb()) scheduler.exit(Scheduler::ExitReason::StepEvent);
+  if(system.sgb() && system.clocks_executed >= system.clocks_budget) scheduler.exit(Scheduler::ExitReason::StepEvent);
 
   status.clock += clocks;
   if(status.clock >= 4 * 1024 * 1024) {
@@ -94,6 +94,69 @@ void PPU::cgb_run() {
   *output = color;
 }
 
+//draws the whole line at once, eight pixels per tile fetch; same output as 160 calls to cgb_run()
+void PPU::cgb_render() {
+  uint32* output = screen + status.ly * 160;
+  px = 160;
+  if(status.display_enable == false) {
+    for(unsigned x = 0; x < 160; x++) output[x] = 0x7fff;
+    return;
+  }
+
+  //BG and window color indexes and attributes; pixel x is at [8 + x], so partial tiles may spill into the margins
+  uint8 bgindex[176], bgattr[176], wdindex[176], wdattr[176];
+  uint8 obindex[160] = {0}, obattr[160];
+
+  unsigned scrolly = (status.ly + status.scy) & 255;
+  unsigned fine = status.scx & 7;
+  for(unsigned x = 0; x < 160 + fine; x += 8) {
+    cgb_read_tile(status.bg_tilemap_select, (status.scx + x) & 255, scrolly, background.attr, background.data);
+    decode(bgindex + 8 + x - fine, background.data);
+    memset(bgattr + 8 + x - fine, background.attr, 8);
+  }
+
+  scrolly = status.ly - status.wy;
+  unsigned first = status.wx < 7 ? 0 : status.wx - 7;
+  unsigned last = min(160u, status.wx + 153u);
+  if(status.window_display_enable && scrolly < 144u && first < last) {
+    unsigned scrollx = first + 7 - status.wx;
+    fine = scrollx & 7;
+    for(unsigned x = 0; first + x < last + fine; x += 8) {
+      cgb_read_tile(status.window_tilemap_select, scrollx + x, scrolly, window.attr, window.data);
+      decode(wdindex + 8 + first + x - fine, window.data);
+      memset(wdattr + 8 + first + x - fine, window.attr, 8);
+    }
+    for(unsigned x = 8 + first; x < 8 + last; x++) {
+      bgindex[x] = wdindex[x];
+      bgattr[x] = wdattr[x];
+    }
+  }
+
+  if(status.ob_enable) {
+    //render backwards, so that first sprite has priority
+    for(signed n = sprites - 1; n >= 0; n--) {
+      Sprite& s = sprite[n];
+      uint8 index[8];
+      decode(index, s.data);
+      for(unsigned tx = 0; tx < 8; tx++) {
+        unsigned x = s.x + tx;
+        if(x >= 160 || index[tx] == 0) continue;
+        obindex[x] = index[tx];
+        obattr[x] = s.attr;
+      }
+    }
+  }
+
+  for(unsigned x = 0; x < 160; x++) {
+    unsigned index = bgindex[8 + x], attr = bgattr[8 + x];
+    bool above = obindex[x] && (index == 0 || status.bg_enable == 0 || (!(attr & 0x80) && !(obattr[x] & 0x80)));
+    if(above) index = obindex[x], attr = obattr[x];
+    const uint8* palette = above ? obpd : bgpd;
+    unsigned entry = ((attr & 0x07) << 2) + index;
+    output[x] = (palette[(entry << 1) + 0] << 0 | palette[(entry << 1) + 1] << 8) & 0x7fff;
+  }
+}
+
 void PPU::cgb_run_bg() {
   unsigned scrolly = (status.ly + status.scy) & 255;
   unsigned scrollx = (px + status.scx) & 255;
@@ -81,6 +81,74 @@ void PPU::dmg_run() {
   *output = color;
 }
 
+//draws the whole line at once, eight pixels per tile fetch; same output as 160 calls to dmg_run()
+void PPU::dmg_render() {
+  uint32* output = screen + status.ly * 160;
+  px = 160;
+  if(status.display_enable == false) {
+    for(unsigned x = 0; x < 160; x++) output[x] = 0;
+    return;
+  }
+
+  //BG and window color indexes; pixel x is at [8 + x], so partial tiles may spill into the margins
+  uint8 bgindex[176] = {0}, bgcolor[176] = {0}, wdindex[176];
+  uint8 obindex[160] = {0}, obcolor[160], obpriority[160];
+
+  if(status.bg_enable) {
+    unsigned scrolly = (status.ly + status.scy) & 255;
+    unsigned fine = status.scx & 7;
+    for(unsigned x = 0; x < 160 + fine; x += 8) {
+      dmg_read_tile(status.bg_tilemap_select, (status.scx + x) & 255, scrolly, background.data);
+      decode(bgindex + 8 + x - fine, background.data);
+    }
+    for(unsigned x = 8; x < 168; x++) bgcolor[x] = bgp[bgindex[x]];
+  }
+
+  unsigned scrolly = status.ly - status.wy;
+  unsigned first = status.wx < 7 ? 0 : status.wx - 7;
+  unsigned last = min(160u, status.wx + 153u);
+  if(status.window_display_enable && scrolly < 144u && first < last) {
+    unsigned scrollx = first + 7 - status.wx;
+    unsigned fine = scrollx & 7;
+    for(unsigned x = 0; first + x < last + fine; x += 8) {
+      dmg_read_tile(status.window_tilemap_select, scrollx + x, scrolly, window.data);
+      decode(wdindex + 8 + first + x - fine, window.data);
+    }
+    for(unsigned x = 8 + first; x < 8 + last; x++) {
+      bgindex[x] = wdindex[x];
+      bgcolor[x] = bgp[wdindex[x]];
+    }
+  }
+
+  if(status.ob_enable) {
+    //render backwards, so that first sprite has priority
+    for(signed n = sprites - 1; n >= 0; n--) {
+      Sprite& s = sprite[n];
+      uint8 index[8];
+      decode(index, s.data);
+      for(unsigned tx = 0; tx < 8; tx++) {
+        unsigned x = s.x + tx;
+        if(x >= 160 || index[tx] == 0) continue;
+        obindex[x] = index[tx];
+        obcolor[x] = obp[(bool)(s.attr & 0x10)][index[tx]];
+        obpriority[x] = !(s.attr & 0x80);
+      }
+    }
+  }
+
+  for(unsigned x = 0; x < 160; x++) {
+    if(obindex[x] == 0) {
+      output[x] = bgcolor[8 + x];
+    } else if(bgindex[8 + x] == 0) {
+      output[x] = obcolor[x];
+    } else if(obpriority[x]) {
+      output[x] = obcolor[x];
+    } else {
+      output[x] = bgcolor[8 + x];
+    }
+  }
+}
+
 void PPU::dmg_run_bg() {
   unsigned scrolly = (status.ly + status.scy) & 255;
   unsigned scrollx = (px + status.scx) & 255;
@@ -20,10 +20,11 @@ uint8 PPU::mmio_read(uint16 addr) {
   }
 
   if(addr == 0xff41) {  //STAT
+    unsigned lx = status.lx - lead();
     unsigned mode;
     if(status.ly >= 144) mode = 1;  //Vblank
-    else if(status.lx < 80) mode = 2;  //OAM
-    else if(status.lx < 252) mode = 3;  //LCD
+    else if(lx < 80) mode = 2;  //OAM
+    else if(lx < 252) mode = 3;  //LCD
     else mode = 0;  //Hblank
 
     return (status.interrupt_lyc << 6)
@@ -91,12 +92,15 @@ uint8 PPU::mmio_read(uint16 addr) {
 }
 
 void PPU::mmio_write(uint16 addr, uint8 data) {
+  //draw the dots the CPU has already passed before the write can affect them (OAM is latched per line)
+  if(drawing && (addr < 0xfe00 || addr > 0xfe9f)) render(lead() < 160 ? 160 - lead() : 0);
+
   if(addr >= 0x8000 && addr <= 0x9fff) { vram[vram_addr(addr)] = data; return; }
   if(addr >= 0xfe00 && addr <= 0xfe9f) { oam[addr & 0xff] = data; return; }
 
   if(addr == 0xff40) {  //LCDC
     if(status.display_enable == false && (data & 0x80)) {
-      status.lx = 0;  //unverified behavior; fixes Super Mario Land 2 - Tree Zone
+      status.lx = lead();  //unverified behavior; fixes Super Mario Land 2 - Tree Zone
     }
 
     status.display_enable = data & 0x80;
@@ -28,10 +28,13 @@ void PPU::main() {
     if(status.display_enable && status.ly < 144) {
       if(status.interrupt_oam) cpu.interrupt_raise(CPU::Interrupt::Stat);
       add_clocks(92);
-      for(unsigned n = 0; n < 160; n++) {
-        system.cgb() ? cgb_run() : dmg_run();
-        add_clocks(1);
-      }
+      //mode 3 is drawn once the CPU has run past it: a whole line at a time, unless the CPU
+      //wrote to the PPU mid-line, in which case mmio_write() has drawn up to each write dot by dot
+      drawing = true;
+      add_clocks(160);
+      if(px == 0) system.cgb() ? cgb_render() : dmg_render();
+      else render(160);
+      drawing = false;
       if(status.interrupt_hblank) cpu.interrupt_raise(CPU::Interrupt::Stat);
       cpu.hblank();
       add_clocks(204);
@@ -75,6 +78,15 @@ void PPU::frame() {
   scheduler.exit(Scheduler::ExitReason::FrameEvent);
 }
 
+//number of dots the PPU has run ahead of the CPU while drawing
+unsigned PPU::lead() const {
+  return drawing && clock > 0 ? clock / cpu.frequency : 0;
+}
+
+void PPU::render(unsigned dot) {
+  while(px < dot) system.cgb() ? cgb_run() : dmg_run();
+}
+
 unsigned PPU::hflip(unsigned data) const {
   return ((data & 0x8080) >> 7) | ((data & 0x4040) >> 5)
        | ((data & 0x2020) >> 3) | ((data & 0x1010) >> 1)
@@ -82,6 +94,12 @@ unsigned PPU::hflip(unsigned data) const {
        | ((data & 0x0202) << 5) | ((data & 0x0101) << 7);
 }
 
+//expands one row of tile data to eight color indexes
+void PPU::decode(uint8* output, unsigned data) const {
+  uint64_t pixels = planar[data & 255] | planar[(data >> 8) & 255] << 1;
+  memcpy(output, &pixels, 8);
+}
+
 void PPU::power() {
   create(Main, 4 * 1024 * 1024);
 
@@ -166,6 +184,9 @@ void PPU::power() {
   }
   sprites = 0;
 
+  px = 0;
+  drawing = false;
+
   background.attr = 0;
   background.data = 0;
 
@@ -174,6 +195,11 @@ void PPU::power() {
 }
 
 PPU::PPU() {
+  for(unsigned n = 0; n < 256; n++) {
+    uint8 pixels[8];
+    for(unsigned x = 0; x < 8; x++) pixels[x] = (n >> (7 - x)) & 1;
+    memcpy(&planar[n], pixels, 8);
+  }
 }
 
 }
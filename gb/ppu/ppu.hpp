@@ -76,6 +76,8 @@ struct PPU : Thread, MMIO {
   unsigned sprites;
 
   unsigned px;
+  bool drawing;  //mode 3 of the current line is being drawn lazily (see main())
+  uint64_t planar[256];  //bitplane byte -> one byte per pixel
 
   struct Background {
     unsigned attr;
@@ -89,8 +91,11 @@ struct PPU : Thread, MMIO {
   void add_clocks(unsigned clocks);
   void scanline();
   void frame();
+  unsigned lead() const;
+  void render(unsigned dot);
 
   unsigned hflip(unsigned data) const;
+  void decode(uint8* output, unsigned data) const;
 
   //mmio.cpp
   unsigned vram_addr(uint16 addr) const;
@@ -101,6 +106,7 @@ struct PPU : Thread, MMIO {
   void dmg_read_tile(bool select, unsigned x, unsigned y, unsigned& data);
   void dmg_scanline();
   void dmg_run();
+  void dmg_render();
   void dmg_run_bg();
   void dmg_run_window();
   void dmg_run_ob();
@@ -109,6 +115,7 @@ struct PPU : Thread, MMIO {
   void cgb_read_tile(bool select, unsigned x, unsigned y, unsigned& attr, unsigned& data);
   void cgb_scanline();
   void cgb_run();
+  void cgb_render();
   void cgb_run_bg();
   void cgb_run_window();
   void cgb_run_ob();
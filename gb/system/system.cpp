@@ -70,6 +70,7 @@ void System::power() {
   scheduler.init();
 
   clocks_executed = 0;
+  clocks_budget = 0;
 }
 
 System::System() {
@@ -30,6 +30,7 @@ struct System {
   void power();
 
   unsigned clocks_executed;
+  unsigned clocks_budget;  //SGB: clocks to run before returning to the ICD2
 
   //serialization.cpp
   unsigned serialize_size;
@@ -142,6 +142,7 @@ void CPU::power() {
   for(unsigned n = 0x200; n <= 0x209; n++) bus.mmio[n] = this;  //System
   for(unsigned n = 0x300; n <= 0x301; n++) bus.mmio[n] = this;  //System
   //0x080-0x083 mirrored via gba/memory/memory.cpp              //System
+  bus.map();
 }
 
 CPU::CPU() {
@@ -298,8 +298,8 @@ void CPU::write(uint32 addr, uint8 byte) {
   case 0x04000203: regs.irq.flag = regs.irq.flag & ~(byte << 8); return;
 
   //WAITCNT
-  case 0x04000204: regs.wait.control = (regs.wait.control & 0xff00) | ((byte & 0xff) << 0); return;
-  case 0x04000205: regs.wait.control = (regs.wait.control & 0x00ff) | ((byte & 0x7f) << 8); return;
+  case 0x04000204: regs.wait.control = (regs.wait.control & 0xff00) | ((byte & 0xff) << 0); return bus.map();
+  case 0x04000205: regs.wait.control = (regs.wait.control & 0x00ff) | ((byte & 0x7f) << 8); return bus.map();
 
   //IME
   case 0x04000208: regs.ime = byte >> 0; return;
@@ -311,10 +311,10 @@ void CPU::write(uint32 addr, uint8 byte) {
 
   //MEMCNT_L
   //MEMCNT_H
-  case 0x04000800: regs.memory.control = (regs.memory.control & 0xffffff00) | (byte <<  0); return;
-  case 0x04000801: regs.memory.control = (regs.memory.control & 0xffff00ff) | (byte <<  8); return;
-  case 0x04000802: regs.memory.control = (regs.memory.control & 0xff00ffff) | (byte << 16); return;
-  case 0x04000803: regs.memory.control = (regs.memory.control & 0x00ffffff) | (byte << 24); return;
+  case 0x04000800: regs.memory.control = (regs.memory.control & 0xffffff00) | (byte <<  0); return bus.map();
+  case 0x04000801: regs.memory.control = (regs.memory.control & 0xffff00ff) | (byte <<  8); return bus.map();
+  case 0x04000802: regs.memory.control = (regs.memory.control & 0xff00ffff) | (byte << 16); return bus.map();
+  case 0x04000803: regs.memory.control = (regs.memory.control & 0x00ffffff) | (byte << 24); return bus.map();
 
   }
 }
@@ -31,39 +31,71 @@ uint32 Bus::mirror(uint32 addr, uint32 size) {
   return base;
 }
 
-uint32 Bus::speed(uint32 addr, uint32 size) {
-  if(addr & 0x08000000) {
-    static unsigned timing[] = {5, 4, 3, 9};
-    unsigned n = cpu.regs.wait.control.nwait[addr >> 25 & 3];
-    unsigned s = cpu.regs.wait.control.swait[addr >> 25 & 3];
-    n = timing[n];
-
-    switch(addr >> 25 & 3) {
-    case 0: s = s ? 3 : 2; break;
-    case 1: s = s ? 5 : 2; break;
-    case 2: s = s ? 9 : 2; break;
-    case 3: s = n; break;
+//rebuilt whenever WAITCNT or MEMCNT change
+void Bus::map() {
+  auto& memory = cpu.regs.memory.control;
+  for(unsigned n = 0; n < 0x4000; n++) {
+    uint32 addr = n << 14;
+    read_page[n] = write_page[n] = nullptr;
+
+    if(addr & 0x08000000) {
+      if(addr >= 0x0e000000) continue;  //SRAM, FlashROM
+      if(cartridge.has_eeprom() && (addr & cartridge.eeprom.mask & ~0x3fff) == (cartridge.eeprom.test & ~0x3fff)) continue;
+      read_page[n] = cartridge.rom.data + (addr & 0x01ffffff);
+      continue;
     }
 
-    bool sequential = cpu.sequential();
-    if((addr & 0xffff << 1) == 0) sequential = false;  //N cycle on 16-bit ROM crossing page boundary (RAM S==N)
-    if(idleflag) sequential = false;  //LDR/LDM interrupts instruction fetches
+    switch(addr >> 24 & 7) {
+    case 2:
+      if(memory.disable) break;
+      read_page[n] = write_page[n] = memory.ewram ? cpu.ewram + (addr & 0x3ffff) : cpu.iwram + (addr & 0x7fff);
+      break;
+    case 3:
+      if(memory.disable) break;
+      read_page[n] = write_page[n] = cpu.iwram + (addr & 0x7fff);
+      break;
+    case 6:  //byte writes to VRAM are duplicated, so only reads are direct
+      read_page[n] = ppu.vram + ((addr & 0x10000) ? 0x10000 + (addr & 0x7fff) : (addr & 0xffff));
+      break;
+    }
+  }
 
-    if(sequential) return s << (size == Word);  //16-bit bus requires two transfers for words
-    if(size == Word) n += s;
-    return n;
+  static unsigned timing[] = {5, 4, 3, 9};
+  for(unsigned region = 0; region < 16; region++) {
+    if(region & 8) {
+      unsigned n = cpu.regs.wait.control.nwait[region >> 1 & 3];
+      unsigned s = cpu.regs.wait.control.swait[region >> 1 & 3];
+      n = timing[n];
+
+      switch(region >> 1 & 3) {
+      case 0: s = s ? 3 : 2; break;
+      case 1: s = s ? 5 : 2; break;
+      case 2: s = s ? 9 : 2; break;
+      case 3: s = n; break;
+      }
+
+      cycles[region][0][0] = n;
+      cycles[region][0][1] = n + s;
+      cycles[region][1][0] = s;
+      cycles[region][1][1] = s << 1;  //16-bit bus requires two transfers for words
+      continue;
+    }
+
+    unsigned clocks = region == 2 ? 1 + 15 - memory.ewramwait : 1;
+    bool wide = region == 2 || region == 5 || region == 6;
+    cycles[region][0][0] = cycles[region][1][0] = clocks;
+    cycles[region][0][1] = cycles[region][1][1] = clocks << wide;
   }
+}
 
-  switch(addr >> 24 & 7) {
-  case 0: return 1;
-  case 1: return 1;
-  case 2: return (1 + 15 - cpu.regs.memory.control.ewramwait) << (size == Word);
-  case 3: return 1;
-  case 4: return 1;
-  case 5: return 1 << (size == Word);
-  case 6: return 1 << (size == Word);
-  case 7: return 1;
+uint32 Bus::speed(uint32 addr, uint32 size) {
+  bool sequential = false;
+  if(addr & 0x08000000) {
+    sequential = cpu.sequential();
+    if((addr & 0xffff << 1) == 0) sequential = false;  //N cycle on 16-bit ROM crossing page boundary (RAM S==N)
+    if(idleflag) sequential = false;  //LDR/LDM interrupts instruction fetches
   }
+  return cycles[addr >> 24 & 15][sequential][size == Word];
 }
 
 void Bus::idle(uint32 addr) {
@@ -72,6 +104,14 @@ void Bus::idle(uint32 addr) {
 
 uint32 Bus::read(uint32 addr, uint32 size) {
   idleflag = false;
+  if(addr < 0x10000000) if(uint8* data = read_page[addr >> 14]) {
+    switch(size) {
+    case Word: data += addr & 0x3ffc; return data[0] << 0 | data[1] << 8 | data[2] << 16 | data[3] << 24;
+    case Half: data += addr & 0x3ffe; return data[0] << 0 | data[1] << 8;
+    case Byte: return data[addr & 0x3fff];
+    }
+  }
+
   if(addr & 0x08000000) return cartridge.read(addr, size);
 
   switch(addr >> 24 & 7) {
@@ -91,6 +131,14 @@ uint32 Bus::read(uint32 addr, uint32 size) {
 
 void Bus::write(uint32 addr, uint32 size, uint32 word) {
   idleflag = false;
+  if(addr < 0x10000000) if(uint8* data = write_page[addr >> 14]) {
+    switch(size) {
+    case Word: data += addr & 0x3ffc; data[0] = word >> 0; data[1] = word >> 8; data[2] = word >> 16; data[3] = word >> 24; return;
+    case Half: data += addr & 0x3ffe; data[0] = word >> 0; data[1] = word >> 8; return;
+    case Byte: data[addr & 0x3fff] = word; return;
+    }
+  }
+
   if(addr & 0x08000000) return cartridge.write(addr, size, word);
 
   switch(addr >> 24 & 7) {
@@ -111,6 +159,8 @@ void Bus::write(uint32 addr, uint32 size, uint32 word) {
 void Bus::power() {
   for(unsigned n = 0; n < 0x400; n++) mmio[n] = &unmappedMemory;
   idleflag = false;
+  for(auto& page : read_page) page = nullptr;
+  for(auto& page : write_page) page = nullptr;
 }
 
 }
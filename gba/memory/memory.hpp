@@ -13,8 +13,13 @@ struct MMIO : Memory {
 struct Bus : Memory {
   Memory* mmio[0x400];
   bool idleflag;
+  uint8* read_page[0x4000];   //host memory behind each 16KB page below 0x10000000; nullptr = use handler
+  uint8* write_page[0x4000];
+  uint8 cycles[16][2][2];     //[addr >> 24][sequential][size == Word]
   static uint32 mirror(uint32 addr, uint32 size);
 
+  void map();
+
   uint32 speed(uint32 addr, uint32 size);
   void idle(uint32 addr);
   uint32 read(uint32 addr, uint32 size);
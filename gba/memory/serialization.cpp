@@ -1,3 +1,4 @@
 void Bus::serialize(serializer& s) {
   s.integer(idleflag);
+  if(s.mode() == serializer::Load) map();
 }
@@ -6,7 +6,7 @@ void PPU::render_mosaic_background(unsigned id) {
   for(unsigned x = 0; x < 240;) {
     for(unsigned m = 1; m < width; m++) {
       if(x + m >= 240) break;
-      buffer[x + m] = buffer[x];
+      buffer.copy(x + m, x);
     }
     x += width;
   }
@@ -17,16 +17,15 @@ void PPU::render_mosaic_object() {
   unsigned width = 1 + regs.mosaic.objhsize;
   auto& buffer = layer[OBJ];
 
-  Pixel mosaicPixel;
-  mosaicPixel.mosaic = false;
+  signed source = -1;  //pixel being repeated; -1 = none
   unsigned counter = 0;
 
   for(unsigned x = 0; x < 240; x++) {
-    if(counter == width || mosaicPixel.mosaic == false) {
-      mosaicPixel = buffer[x];
+    if(counter == width || source < 0 || buffer.mosaic[source] == false) {
+      source = x;
       if(counter == width) counter = 0;
     } else {
-      if(buffer[x].mosaic) buffer[x] = mosaicPixel;
+      if(buffer.mosaic[x]) buffer.copy(x, source);
     }
     counter++;
   }
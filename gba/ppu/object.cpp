@@ -60,9 +60,9 @@ void PPU::render_object(Object& obj) {
       if(color) {
         if(obj.mode & 2) {
           windowmask[Obj][ox] = true;
-        } else if(output[ox].enable == false || obj.priority < output[ox].priority) {
+        } else if(output.enable[ox] == false || obj.priority < output.priority[ox]) {
           if(obj.colors == 0) color = obj.palette * 16 + color;
-          output[ox].write(true, obj.priority, pram[256 + color], obj.mode == 1, obj.mosaic);
+          output.write(ox, true, obj.priority, pram[256 + color], obj.mode == 1, obj.mosaic);
         }
       }
     }
@@ -1,4 +1,7 @@
 #include <gba/gba.hpp>
+#if defined(__SSE2__)
+  #include <emmintrin.h>
+#endif
 
 //pixel:      4 cycles
 
@@ -120,12 +123,12 @@ void PPU::scanline() {
         windowmask[0][x] = false;
         windowmask[1][x] = false;
         windowmask[2][x] = false;
-        layer[OBJ][x].write(false);
-        layer[BG0][x].write(false);
-        layer[BG1][x].write(false);
-        layer[BG2][x].write(false);
-        layer[BG3][x].write(false);
-        layer[SFX][x].write(true, 3, pram[0]);
+        layer[OBJ].write(x, false);
+        layer[BG0].write(x, false);
+        layer[BG1].write(x, false);
+        layer[BG2].write(x, false);
+        layer[BG3].write(x, false);
+        layer[SFX].write(x, true, 3, pram[0]);
       }
       render_window(0);
       render_window(1);
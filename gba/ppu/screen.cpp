@@ -14,23 +14,101 @@ void PPU::render_screen() {
   if(regs.bg[3].control.mosaic) render_mosaic_background(BG3);
   render_mosaic_object();
 
-  for(unsigned x = 0; x < 240; x++) {
-    Registers::WindowFlags flags;
-    flags = ~0;  //enable all layers if no windows are enabled
-
-    //determine active window
-    if(regs.control.enablewindow[In0] || regs.control.enablewindow[In1] || regs.control.enablewindow[Obj]) {
-      flags = (uint8)regs.windowflags[Out];
-      if(regs.control.enablewindow[Obj] && windowmask[Obj][x]) flags = (uint8)regs.windowflags[Obj];
-      if(regs.control.enablewindow[In1] && windowmask[In1][x]) flags = (uint8)regs.windowflags[In1];
-      if(regs.control.enablewindow[In0] && windowmask[In0][x]) flags = (uint8)regs.windowflags[In0];
+  auto layers = [](const Registers::WindowFlags& flags) {
+    unsigned mask = 0;
+    for(unsigned l = 0; l < 6; l++) mask |= flags.enable[l] << l;
+    return mask;
+  };
+
+  //determine active window: bit n of flags[x] enables layer n
+  uint8 flags[240];
+  if(regs.control.enablewindow[In0] || regs.control.enablewindow[In1] || regs.control.enablewindow[Obj]) {
+    memset(flags, layers(regs.windowflags[Out]), 240);
+    for(unsigned w : {Obj, In1, In0}) {
+      if(regs.control.enablewindow[w] == false) continue;
+      uint8 mask = layers(regs.windowflags[w]);
+      for(unsigned x = 0; x < 240; x++) flags[x] = windowmask[w][x] ? mask : flags[x];
+    }
+  } else {
+    memset(flags, 0x3f, 240);  //enable all layers if no windows are enabled
+  }
+
+  #if defined(__SSE2__)
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i eva = _mm_set1_epi16(regs.blend.eva), evb = _mm_set1_epi16(regs.blend.evb);
+  const __m128i evy = _mm_set1_epi16(regs.blend.evy), evz = _mm_set1_epi16(16 - regs.blend.evy);
+  const __m128i fade = _mm_set1_epi16(regs.blend.control.mode == 2 ? 0x7fff : 0x0000);
+  const bool alphamode = regs.blend.control.mode == 1;
+  const bool fademode = regs.blend.control.mode >= 2;
+
+  //blends eight pixels at once; same results as blend()
+  auto blend8 = [](__m128i above, __m128i eva, __m128i below, __m128i evb) {
+    const __m128i mask = _mm_set1_epi16(31);
+    __m128i r = _mm_add_epi16(_mm_mullo_epi16(_mm_and_si128(above, mask), eva), _mm_mullo_epi16(_mm_and_si128(below, mask), evb));
+    above = _mm_srli_epi16(above, 5), below = _mm_srli_epi16(below, 5);
+    __m128i g = _mm_add_epi16(_mm_mullo_epi16(_mm_and_si128(above, mask), eva), _mm_mullo_epi16(_mm_and_si128(below, mask), evb));
+    above = _mm_srli_epi16(above, 5), below = _mm_srli_epi16(below, 5);
+    __m128i b = _mm_add_epi16(_mm_mullo_epi16(_mm_and_si128(above, mask), eva), _mm_mullo_epi16(_mm_and_si128(below, mask), evb));
+
+    r = _mm_min_epi16(_mm_srli_epi16(r, 4), mask);
+    g = _mm_min_epi16(_mm_srli_epi16(g, 4), mask);
+    b = _mm_min_epi16(_mm_srli_epi16(b, 4), mask);
+    return _mm_or_si128(r, _mm_or_si128(_mm_slli_epi16(g, 5), _mm_slli_epi16(b, 10)));
+  };
+
+  for(unsigned x = 0; x < 240; x += 8) {
+    auto load8 = [&](const void* data) { return _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)data), zero); };
+    __m128i visible = load8(flags + x);
+
+    //priority sorting: key = priority * 8 + layer, lowest key is topmost;
+    //keep the two lowest keys (253 selects layer 5 when fewer than two layers are visible)
+    __m128i first = _mm_set1_epi16(253), second = first;
+    for(unsigned l = 0; l < 6; l++) {
+      __m128i bit = _mm_set1_epi16(1 << l);
+      __m128i enable = _mm_and_si128(_mm_cmpgt_epi16(load8(layer[l].enable + x), zero), _mm_cmpeq_epi16(_mm_and_si128(visible, bit), bit));
+      __m128i key = _mm_or_si128(_mm_slli_epi16(load8(layer[l].priority + x), 3), _mm_set1_epi16(l));
+      key = _mm_or_si128(_mm_and_si128(enable, key), _mm_andnot_si128(enable, _mm_set1_epi16(253)));
+      second = _mm_min_epi16(second, _mm_max_epi16(first, key));
+      first = _mm_min_epi16(first, key);
+    }
+    first = _mm_and_si128(first, _mm_set1_epi16(7));
+    second = _mm_and_si128(second, _mm_set1_epi16(7));
+
+    __m128i above = zero, below = zero, blendabove = zero, blendbelow = zero;
+    for(unsigned l = 0; l < 6; l++) {
+      __m128i color = _mm_loadu_si128((const __m128i*)(layer[l].color + x));
+      __m128i isabove = _mm_cmpeq_epi16(first, _mm_set1_epi16(l));
+      __m128i isbelow = _mm_cmpeq_epi16(second, _mm_set1_epi16(l));
+      above = _mm_or_si128(above, _mm_and_si128(isabove, color));
+      below = _mm_or_si128(below, _mm_and_si128(isbelow, color));
+      if(regs.blend.control.above[l]) blendabove = _mm_or_si128(blendabove, isabove);
+      if(regs.blend.control.below[l]) blendbelow = _mm_or_si128(blendbelow, isbelow);
+    }
+    __m128i translucent = _mm_and_si128(_mm_cmpeq_epi16(first, _mm_set1_epi16(OBJ)), _mm_cmpgt_epi16(load8(layer[OBJ].translucent + x), zero));
+    __m128i sfx = _mm_cmpeq_epi16(_mm_and_si128(visible, _mm_set1_epi16(1 << SFX)), _mm_set1_epi16(1 << SFX));
+
+    //perform blending, if needed
+    __m128i alpha = _mm_and_si128(translucent, blendbelow);
+    if(alphamode) alpha = _mm_or_si128(alpha, _mm_and_si128(blendabove, blendbelow));
+    alpha = _mm_and_si128(alpha, sfx);
+    __m128i color = above;
+    color = _mm_or_si128(_mm_andnot_si128(alpha, color), _mm_and_si128(alpha, blend8(above, eva, below, evb)));
+    if(fademode) {
+      __m128i faded = _mm_andnot_si128(_mm_and_si128(translucent, blendbelow), _mm_and_si128(blendabove, sfx));
+      color = _mm_or_si128(_mm_andnot_si128(faded, color), _mm_and_si128(faded, blend8(above, evz, fade, evy)));
     }
 
+    //output pixels
+    _mm_storeu_si128((__m128i*)(line + x + 0), _mm_unpacklo_epi16(color, zero));
+    _mm_storeu_si128((__m128i*)(line + x + 4), _mm_unpackhi_epi16(color, zero));
+  }
+  #else
+  for(unsigned x = 0; x < 240; x++) {
     //priority sorting: find topmost two pixels
     unsigned a = 5, b = 5;
     for(signed p = 3; p >= 0; p--) {
       for(signed l = 5; l >= 0; l--) {
-        if(layer[l][x].enable && layer[l][x].priority == p && flags.enable[l]) {
+        if(layer[l].enable[x] && layer[l].priority[x] == p && (flags[x] >> l & 1)) {
           b = a;
           a = l;
         }
@@ -41,23 +119,24 @@ void PPU::render_screen() {
     auto& below = layer[b];
     bool blendabove = regs.blend.control.above[a];
     bool blendbelow = regs.blend.control.below[b];
-    unsigned color = above[x].color;
+    unsigned color = above.color[x];
 
     //perform blending, if needed
-    if(flags.enable[SFX] == false) {
-    } else if(above[x].translucent && blendbelow) {
-      color = blend(above[x].color, regs.blend.eva, below[x].color, regs.blend.evb);
+    if((flags[x] >> SFX & 1) == 0) {
+    } else if(above.translucent[x] && blendbelow) {
+      color = blend(above.color[x], regs.blend.eva, below.color[x], regs.blend.evb);
     } else if(regs.blend.control.mode == 1 && blendabove && blendbelow) {
-      color = blend(above[x].color, regs.blend.eva, below[x].color, regs.blend.evb);
+      color = blend(above.color[x], regs.blend.eva, below.color[x], regs.blend.evb);
     } else if(regs.blend.control.mode == 2 && blendabove) {
-      color = blend(above[x].color, 16 - regs.blend.evy, 0x7fff, regs.blend.evy);
+      color = blend(above.color[x], 16 - regs.blend.evy, 0x7fff, regs.blend.evy);
     } else if(regs.blend.control.mode == 3 && blendabove) {
-      color = blend(above[x].color, 16 - regs.blend.evy, 0x0000, regs.blend.evy);
+      color = blend(above.color[x], 16 - regs.blend.evy, 0x0000, regs.blend.evy);
     }
 
     //output pixel
     line[x] = color;
   }
+  #endif
 }
 
 void PPU::render_window(unsigned w) {
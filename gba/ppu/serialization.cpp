@@ -71,15 +71,12 @@ void PPU::serialize(serializer& s) {
   s.integer(regs.blend.evb);
   s.integer(regs.blend.evy);
 
-  for(unsigned l = 0; l < 6; l++) {
-    for(unsigned p = 0; p < 240; p++) {
-      auto& pixel = layer[l][p];
-      s.integer(pixel.enable);
-      s.integer(pixel.priority);
-      s.integer(pixel.color);
-      s.integer(pixel.translucent);
-      s.integer(pixel.mosaic);
-    }
+  for(auto& l : layer) {
+    s.array(l.enable);
+    s.array(l.priority);
+    s.array(l.color);
+    s.array(l.translucent);
+    s.array(l.mosaic);
   }
 
   for(unsigned w = 0; w < 3; w++) {
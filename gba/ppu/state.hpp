@@ -1,16 +1,18 @@
-struct Pixel {
-  bool enable;
-  unsigned priority;
-  unsigned color;
+//one scanline per layer, stored by field so that render_screen() can process many pixels at once
+struct Layer {
+  bool enable[240];
+  uint8 priority[240];
+  uint16 color[240];
 
   //objects only
-  bool translucent;
-  bool mosaic;
-
-  alwaysinline void write(bool e) { enable = e; }
-  alwaysinline void write(bool e, unsigned p, unsigned c) { enable = e; priority = p; color = c; }
-  alwaysinline void write(bool e, unsigned p, unsigned c, bool t, bool m) { enable = e; priority = p; color = c; translucent = t; mosaic = m; }
-} layer[6][240];
+  bool translucent[240];
+  bool mosaic[240];
+
+  alwaysinline void write(unsigned x, bool e) { enable[x] = e; }
+  alwaysinline void write(unsigned x, bool e, unsigned p, unsigned c) { enable[x] = e; priority[x] = p; color[x] = c; }
+  alwaysinline void write(unsigned x, bool e, unsigned p, unsigned c, bool t, bool m) { enable[x] = e; priority[x] = p; color[x] = c; translucent[x] = t; mosaic[x] = m; }
+  alwaysinline void copy(unsigned x, unsigned source) { write(x, enable[source], priority[source], color[source], translucent[source], mosaic[source]); }
+} layer[6];
 
 bool windowmask[3][240];
 unsigned vmosaic[5];
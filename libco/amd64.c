@@ -116,6 +116,7 @@ void co_init(void)
 }
 #else
 __asm__(
+".text                 \n" /* do not inherit whatever section the compiler left open */
 ".intel_syntax noprefix\n"
 ".globl co_swap        \n"
 "co_swap:              \n"
@@ -146,6 +147,40 @@ static void crash(void)
   assert(0); /* called only if cothread_t entrypoint returns */
 }
 
+#ifndef _WIN32
+/* stacks are mapped with a guard page below them, so that an overrun faults
+   instead of corrupting the heap. */
+#include <unistd.h>
+#include <sys/mman.h>
+
+#ifndef MAP_ANONYMOUS
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+#ifndef MAP_STACK
+#define MAP_STACK 0
+#endif
+
+/* mapping length, stored past the registers saved by co_swap */
+#define co_length(handle) (((unsigned long long*)(handle))[8])
+
+static cothread_t co_allocate(unsigned long long size)
+{
+   unsigned long long page = sysconf(_SC_PAGESIZE);
+   unsigned long long length = page + ((size + page - 1) & ~(page - 1));
+   char *base = (char*)mmap(0, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_STACK, -1, 0);
+   if(base == (char*)MAP_FAILED) return 0;
+   mprotect(base, page, PROT_NONE);
+   co_length(base + page) = length;
+   return base + page;
+}
+
+static void co_release(cothread_t handle)
+{
+   unsigned long long page = sysconf(_SC_PAGESIZE);
+   munmap((char*)handle - page, co_length(handle));
+}
+#endif
+
 cothread_t co_active(void)
 {
   if (!co_active_handle)
@@ -170,8 +205,14 @@ cothread_t co_create(unsigned int size, void (*entrypoint)(void))
    size += 512; /* allocate additional space for storage */
    size &= ~15; /* align stack to 16-byte boundary */
 
+#ifndef _WIN32
+   if((handle = co_allocate(size)))
+   {
+      size = co_length(handle) - sysconf(_SC_PAGESIZE); /* use the whole mapping */
+#else
    if((handle = (cothread_t)malloc(size)))
    {
+#endif
       long long *p = (long long*)((char*)handle + size); /* seek to top of stack */
       *--p = (long long)crash;                           /* crash if entrypoint returns */
       *--p = (long long)entrypoint;                      /* start of function */
@@ -183,7 +224,11 @@ cothread_t co_create(unsigned int size, void (*entrypoint)(void))
 
 void co_delete(cothread_t handle)
 {
+#ifndef _WIN32
+   co_release(handle);
+#else
    free(handle);
+#endif
 }
 
 void co_switch(cothread_t handle)
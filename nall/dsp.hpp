@@ -4,9 +4,14 @@
 #include <nall/bit.hpp>
 
 #include <algorithm>
+#include <memory>
+#include <mutex>
 #ifdef __SSE__
   #include <xmmintrin.h>
 #endif
+#ifdef __AVX__
+  #include <immintrin.h>
+#endif
 
 #define NALL_DSP_INTERNAL_HPP
 #include <nall/dsp/core.hpp>
@@ -41,6 +41,7 @@ struct DSP {
 
   inline void setResampler(ResampleEngine resamplingEngine);
   inline void setResamplerFrequency(real frequency);  //outputFrequency
+  inline void setResamplerQuality(unsigned quality);  //Sinc: 0 (shortest filter, lowest latency) - 4 (default)
 
   inline void sample(signed channel[]);
   inline bool pending();
@@ -65,6 +66,7 @@ protected:
     real frequency;
     real volume;
     real balance;
+    unsigned quality;
 
     //internal
     real intensity;
@@ -148,6 +150,7 @@ void DSP::clear() {
 DSP::DSP() {
   setResampler(ResampleEngine::Hermite);
   setResamplerFrequency(44100.0);
+  settings.quality = 4;
 
   setChannels(2);
   setPrecision(16);
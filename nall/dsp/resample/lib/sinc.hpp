@@ -17,6 +17,10 @@ typedef float resample_samp_t;
       #define RESAMPLE_SSEREGPARM __attribute__((sseregparm))
     #endif
   #endif
+  #if defined(__AVX__)
+    // A channel pair is convolved in the two 128-bit lanes of one AVX register, with the same operations as the SSE path.
+    #define SINCRESAMPLE_USE_AVX 1
+  #endif
 #else
   // TODO: altivec here
 #endif
@@ -29,29 +33,36 @@ namespace ResampleUtility
  inline void normalize(double* io, int size, double gain = 1.0);
 
  inline void* make_aligned(void* ptr, unsigned boundary);	// boundary must be a power of 2
+
+ // Coefficient tables depend only on the filter parameters in "key"; they are generated once by "build" and shared
+ // between all channels and resampler instances using the same parameters.
+ typedef std::shared_ptr<const std::vector<unsigned char>> coeff_table;
+ template<typename Build> inline coeff_table shared_table(const std::vector<double>& key, const Build& build);
 }
 
 class SincResampleHR
 {
  private:
 
- inline void Init(unsigned ratio_arg, double desired_bandwidth, double beta, double d);
+ inline void Init(unsigned ratio_arg, double desired_bandwidth, double beta, double d, unsigned channels_arg);
 
- inline void write(resample_samp_t sample) RESAMPLE_SSEREGPARM;
- inline resample_samp_t read(void) RESAMPLE_SSEREGPARM;
+ inline void write(const resample_samp_t *samples) RESAMPLE_SSEREGPARM;
+ inline void read(resample_samp_t *samples) RESAMPLE_SSEREGPARM;
  inline bool output_avail(void);
 
  private:
 
  inline resample_samp_t mac(const resample_samp_t *wave, const resample_coeff_t *coeff, unsigned count);
+ inline void mac2(const resample_samp_t *wave0, const resample_samp_t *wave1, const resample_coeff_t *coeff, unsigned count, resample_samp_t *out);
 
  unsigned ratio;
  unsigned num_convolutions;
+ unsigned channels;
 
- resample_coeff_t *coeffs;
- std::vector<unsigned char> coeffs_mem;
+ const resample_coeff_t *coeffs;
+ ResampleUtility::coeff_table coeffs_mem;
 
- // second half of ringbuffer should be copy of first half.
+ // One ringbuffer per channel, rb_stride apart; second half of each ringbuffer should be copy of first half.
  resample_samp_t *rb;
  std::vector<unsigned char> rb_mem;
 
@@ -59,6 +70,7 @@ class SincResampleHR
  signed rb_writepos;
  signed rb_in;
  signed rb_eff_size;
+ unsigned rb_stride;
 
  friend class SincResample;
 };
@@ -74,10 +86,11 @@ class SincResample
   QUALITY_HIGH = 4
  };
 
- inline SincResample(double input_rate, double output_rate, double desired_bandwidth, unsigned quality = QUALITY_HIGH);
+ inline SincResample(double input_rate, double output_rate, double desired_bandwidth, unsigned quality = QUALITY_HIGH, unsigned channels = 1);
 
- inline void write(resample_samp_t sample) RESAMPLE_SSEREGPARM;
- inline resample_samp_t read(void) RESAMPLE_SSEREGPARM;
+ // One sample per channel.
+ inline void write(const resample_samp_t *samples) RESAMPLE_SSEREGPARM;
+ inline void read(resample_samp_t *samples) RESAMPLE_SSEREGPARM;
  inline bool output_avail(void);
 
  private:
@@ -85,9 +98,11 @@ class SincResample
  inline void Init(double input_rate, double output_rate, double desired_bandwidth, double beta, double d, unsigned pn_nume, unsigned phases_min);
 
  inline resample_samp_t mac(const resample_samp_t *wave, const resample_coeff_t *coeffs_a, const resample_coeff_t *coeffs_b, const double ffract, unsigned count) RESAMPLE_SSEREGPARM;
+ inline void mac2(const resample_samp_t *wave0, const resample_samp_t *wave1, const resample_coeff_t *coeffs_a, const resample_coeff_t *coeffs_b, const double ffract, unsigned count, resample_samp_t *out);
 
  unsigned num_convolutions;
  unsigned num_phases;
+ unsigned channels;
 
  unsigned step_int;
  double step_fract;
@@ -95,11 +110,12 @@ class SincResample
  double input_pos_fract;
 
 
- std::vector<resample_coeff_t *> coeffs;	// Pointers into coeff_mem.
- std::vector<unsigned char> coeff_mem;
+ std::vector<const resample_coeff_t *> coeffs;	// Pointers into coeff_mem.
+ ResampleUtility::coeff_table coeff_mem;
 
 
- std::vector<resample_samp_t> rb;	// second half should be copy of first half.
+ std::vector<resample_samp_t> rb;	// One ringbuffer per channel, rb_stride apart; second half should be copy of first half.
+ unsigned rb_stride;
  signed rb_readpos;
  signed rb_writepos;
  signed rb_in;
@@ -125,13 +141,13 @@ namespace bit
 }
 #endif
 
-void SincResampleHR::Init(unsigned ratio_arg, double desired_bandwidth, double beta, double d)
+void SincResampleHR::Init(unsigned ratio_arg, double desired_bandwidth, double beta, double d, unsigned channels_arg)
 {
  const unsigned align_boundary = 16;
- std::vector<double> coeffs_tmp;
  double cutoff;	// 1.0 = f/2
 
  ratio = ratio_arg;
+ channels = channels_arg;
 
  //num_convolutions = ((unsigned)ceil(d / ((1.0 - desired_bandwidth) / ratio)) + 1) &~ 1;	// round up to be even
  num_convolutions = ((unsigned)ceil(d / ((1.0 - desired_bandwidth) / ratio)) | 1);
@@ -142,29 +158,35 @@ void SincResampleHR::Init(unsigned ratio_arg, double desired_bandwidth, double b
  assert(num_convolutions > ratio);
 
 
- // Generate windowed sinc of POWER
- coeffs_tmp.resize(num_convolutions);
- //ResampleUtility::gen_sinc(&coeffs_tmp[0], num_convolutions, cutoff, beta);
- ResampleUtility::gen_sinc_os(&coeffs_tmp[0], num_convolutions, cutoff, beta);
- ResampleUtility::normalize(&coeffs_tmp[0], num_convolutions);
+ coeffs_mem = ResampleUtility::shared_table({ 0, (double)ratio, desired_bandwidth, beta, d }, [&](std::vector<unsigned char>& mem)
+ {
+  std::vector<double> coeffs_tmp;
 
- // Copy from coeffs_tmp to coeffs~
- // We multiply many coefficients at a time in the mac loop, so make sure the last few that don't really
- // exist are allocated, zero'd mem.
+  // Generate windowed sinc of POWER
+  coeffs_tmp.resize(num_convolutions);
+  //ResampleUtility::gen_sinc(&coeffs_tmp[0], num_convolutions, cutoff, beta);
+  ResampleUtility::gen_sinc_os(&coeffs_tmp[0], num_convolutions, cutoff, beta);
+  ResampleUtility::normalize(&coeffs_tmp[0], num_convolutions);
 
- coeffs_mem.resize(((num_convolutions + 7) &~ 7) * sizeof(resample_coeff_t) + (align_boundary - 1));
- coeffs = (resample_coeff_t *)ResampleUtility::make_aligned(&coeffs_mem[0], align_boundary);
+  // Copy from coeffs_tmp to coeffs~
+  // We multiply many coefficients at a time in the mac loop, so make sure the last few that don't really
+  // exist are allocated, zero'd mem.
 
+  mem.resize(((num_convolutions + 7) &~ 7) * sizeof(resample_coeff_t) + (align_boundary - 1));
+  resample_coeff_t *out = (resample_coeff_t *)ResampleUtility::make_aligned(&mem[0], align_boundary);
 
- for(unsigned i = 0; i < num_convolutions; i++)
-  coeffs[i] = coeffs_tmp[i];
+  for(unsigned i = 0; i < num_convolutions; i++)
+   out[i] = coeffs_tmp[i];
+ });
+ coeffs = (const resample_coeff_t *)ResampleUtility::make_aligned((void *)&(*coeffs_mem)[0], align_boundary);
 
  rb_eff_size = nall::bit::round(num_convolutions * 2) >> 1;
  rb_readpos = 0;
  rb_writepos = 0;
  rb_in = 0;
 
- rb_mem.resize(rb_eff_size * 2 * sizeof(resample_samp_t) + (align_boundary - 1));
+ rb_stride = rb_eff_size * 2 + 16;	// padded so that the channels' ringbuffers don't map to the same cache sets
+ rb_mem.resize(channels * rb_stride * sizeof(resample_samp_t) + (align_boundary - 1));
  rb = (resample_samp_t *)ResampleUtility::make_aligned(&rb_mem[0], align_boundary);
 }
 
@@ -174,12 +196,17 @@ inline bool SincResampleHR::output_avail(void)
  return(rb_in >= (signed)num_convolutions);
 }
 
-inline void SincResampleHR::write(resample_samp_t sample)
+inline void SincResampleHR::write(const resample_samp_t *samples)
 {
  assert(!output_avail());
 
- rb[rb_writepos] = sample;
- rb[rb_writepos + rb_eff_size] = sample;
+ for(unsigned ch = 0; ch < channels; ch++)
+ {
+  resample_samp_t *crb = &rb[ch * rb_stride];
+
+  crb[rb_writepos] = samples[ch];
+  crb[rb_writepos + rb_eff_size] = samples[ch];
+ }
  rb_writepos = (rb_writepos + 1) & (rb_eff_size - 1);
  rb_in++;
 }
@@ -231,22 +258,81 @@ resample_samp_t SincResampleHR::mac(const resample_samp_t *wave, const resample_
 #endif
 }
 
+#if SINCRESAMPLE_USE_SSE
+// Same as mac() for two channels at once, sharing the coefficient loads; results are identical to two mac() calls.
+void SincResampleHR::mac2(const resample_samp_t *wave0, const resample_samp_t *wave1, const resample_coeff_t *coeff, unsigned count, resample_samp_t *out)
+{
+#if SINCRESAMPLE_USE_AVX
+ __m256 accum_veca[2] = { _mm256_setzero_ps(), _mm256_setzero_ps() };
+
+ for(unsigned c = 0; c < count; c += 8)
+ {
+  for(unsigned i = 0; i < 2; i++)
+  {
+   __m256 co = _mm256_broadcast_ps((const __m128 *)&coeff[c + i * 4]);
+   __m256 w = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_load_ps(&wave0[c + i * 4])), _mm_load_ps(&wave1[c + i * 4]), 1);
+
+   w = _mm256_mul_ps(w, co);
+
+   accum_veca[i] = _mm256_add_ps(w, accum_veca[i]);
+  }
+ }
+
+ __m256 accum_vec = _mm256_add_ps(accum_veca[0], accum_veca[1]);
+
+ accum_vec = _mm256_add_ps(accum_vec, _mm256_shuffle_ps(accum_vec, accum_vec, (3 << 0) | (2 << 2) | (1 << 4) | (0 << 6)));
+ accum_vec = _mm256_add_ps(accum_vec, _mm256_shuffle_ps(accum_vec, accum_vec, (1 << 0) | (0 << 2) | (1 << 4) | (0 << 6)));
+
+ _mm_store_ss(&out[0], _mm256_castps256_ps128(accum_vec));
+ _mm_store_ss(&out[1], _mm256_extractf128_ps(accum_vec, 1));
+#else
+ // Accumulators are spelled out so that they stay in registers.
+ __m128 accum0a = _mm_set1_ps(0), accum0b = _mm_set1_ps(0);
+ __m128 accum1a = _mm_set1_ps(0), accum1b = _mm_set1_ps(0);
+
+ for(unsigned c = 0; c < count; c += 8)
+ {
+  __m128 co_a = _mm_load_ps(&coeff[c + 0]);
+  __m128 co_b = _mm_load_ps(&coeff[c + 4]);
+
+  accum0a = _mm_add_ps(_mm_mul_ps(_mm_load_ps(&wave0[c + 0]), co_a), accum0a);
+  accum0b = _mm_add_ps(_mm_mul_ps(_mm_load_ps(&wave0[c + 4]), co_b), accum0b);
+  accum1a = _mm_add_ps(_mm_mul_ps(_mm_load_ps(&wave1[c + 0]), co_a), accum1a);
+  accum1b = _mm_add_ps(_mm_mul_ps(_mm_load_ps(&wave1[c + 4]), co_b), accum1b);
+ }
 
-resample_samp_t SincResampleHR::read(void)
+ __m128 accum_vec[2] = { _mm_add_ps(accum0a, accum0b), _mm_add_ps(accum1a, accum1b) };
+
+ for(unsigned ch = 0; ch < 2; ch++)
+ {
+  accum_vec[ch] = _mm_add_ps(accum_vec[ch], _mm_shuffle_ps(accum_vec[ch], accum_vec[ch], (3 << 0) | (2 << 2) | (1 << 4) | (0 << 6)));
+  accum_vec[ch] = _mm_add_ps(accum_vec[ch], _mm_shuffle_ps(accum_vec[ch], accum_vec[ch], (1 << 0) | (0 << 2) | (1 << 4) | (0 << 6)));
+
+  _mm_store_ss(&out[ch], accum_vec[ch]);
+ }
+#endif
+}
+#endif
+
+
+void SincResampleHR::read(resample_samp_t *samples)
 {
  assert(output_avail());
- resample_samp_t ret;
+ unsigned ch = 0;
 
- ret = mac(&rb[rb_readpos], &coeffs[0], num_convolutions);
+#if SINCRESAMPLE_USE_SSE
+ for(; ch + 1 < channels; ch += 2)
+  mac2(&rb[ch * rb_stride + rb_readpos], &rb[(ch + 1) * rb_stride + rb_readpos], &coeffs[0], num_convolutions, &samples[ch]);
+#endif
+ for(; ch < channels; ch++)
+  samples[ch] = mac(&rb[ch * rb_stride + rb_readpos], &coeffs[0], num_convolutions);
 
  rb_readpos = (rb_readpos + ratio) & (rb_eff_size - 1);
  rb_in -= ratio;
-
- return ret;
 }
 
 
-SincResample::SincResample(double input_rate, double output_rate, double desired_bandwidth, unsigned quality)
+SincResample::SincResample(double input_rate, double output_rate, double desired_bandwidth, unsigned quality, unsigned channels_arg)
 {
  const struct
  {
@@ -273,7 +359,9 @@ SincResample::SincResample(double input_rate, double output_rate, double desired
  // upsampling.
  assert(desired_bandwidth >= 0.25 && desired_bandwidth < 0.96);
  assert(quality >= 0 && quality <= 4);
+ assert(channels_arg >= 1 && channels_arg <= 8);
 
+ channels = channels_arg;
  hr_used = false;
 
 #if 1
@@ -285,7 +373,7 @@ SincResample::SincResample(double input_rate, double output_rate, double desired
 
  if(ioratio_rd >= 8)
  {
-  hr.Init(ioratio_rd, desired_bandwidth, qtab[quality].beta, qtab[quality].d); //10.056, 6.4); 
+  hr.Init(ioratio_rd, desired_bandwidth, qtab[quality].beta, qtab[quality].d, channels); //10.056, 6.4); 
   hr_used = true;
 
   input_rate /= ioratio_rd;
@@ -303,7 +391,6 @@ void SincResample::Init(double input_rate, double output_rate, double desired_ba
  const double input_to_output_ratio = input_rate / output_rate;
  const double output_to_input_ratio = output_rate / input_rate;
  double cutoff;		// 1.0 = input_rate / 2
- std::vector<double> coeff_init_buffer;
 
  // Round up num_convolutions to be even.
  if(output_rate > input_rate)
@@ -328,46 +415,52 @@ void SincResample::Init(double input_rate, double output_rate, double desired_ba
 // fprintf(stderr, "num_convolutions=%u, num_phases=%u, total expected coeff byte size=%lu\n", num_convolutions, num_phases,
 //        (long)((num_phases + 2) * ((num_convolutions + max_mult_minus1) & ~max_mult_minus1) * sizeof(float) + conv_alignment_bytes));
 
- coeff_init_buffer.resize(num_phases * num_convolutions);
+ const unsigned conv_stride = (num_convolutions + max_mult_minus1) &~ max_mult_minus1;
 
- coeffs.resize(num_phases + 1 + 1);
+ coeff_mem = ResampleUtility::shared_table({ 1, input_rate, output_rate, desired_bandwidth, beta, d, (double)pn_nume, (double)phases_min }, [&](std::vector<unsigned char>& mem)
+ {
+  std::vector<double> coeff_init_buffer;
 
- coeff_mem.resize((num_phases + 1 + 1) * ((num_convolutions + max_mult_minus1) &~ max_mult_minus1) * sizeof(resample_coeff_t) + conv_alignment_bytes);
+  coeff_init_buffer.resize(num_phases * num_convolutions);
 
- // Assign aligned pointers into coeff_mem
- {
-  resample_coeff_t *base_ptr = (resample_coeff_t *)ResampleUtility::make_aligned(&coeff_mem[0], conv_alignment_bytes);
+  mem.resize((num_phases + 1 + 1) * conv_stride * sizeof(resample_coeff_t) + conv_alignment_bytes);
 
-  for(unsigned phase = 0; phase < (num_phases + 1 + 1); phase++)
+  resample_coeff_t *base_ptr = (resample_coeff_t *)ResampleUtility::make_aligned(&mem[0], conv_alignment_bytes);
+
+  ResampleUtility::gen_sinc(&coeff_init_buffer[0], num_phases * num_convolutions, cutoff, beta);
+  ResampleUtility::normalize(&coeff_init_buffer[0], num_phases * num_convolutions, num_phases);
+
+  // Reorder coefficients to allow for more efficient convolution.
+  for(int phase = -1; phase < ((int)num_phases + 1); phase++)
   {
-   coeffs[phase] = base_ptr + (((num_convolutions + max_mult_minus1) & ~max_mult_minus1) * phase);
+   for(int conv = 0; conv < (int)num_convolutions; conv++)
+   {
+    double coeff;
+
+    if(phase == -1 && conv == 0)
+     coeff = 0;
+    else if(phase == (int)num_phases && conv == ((int)num_convolutions - 1))
+     coeff = 0;
+    else
+     coeff = coeff_init_buffer[conv * num_phases + phase];
+
+    base_ptr[conv_stride * (phase + 1) + conv] = coeff;
+   }
   }
- }
+ });
 
- ResampleUtility::gen_sinc(&coeff_init_buffer[0], num_phases * num_convolutions, cutoff, beta);
- ResampleUtility::normalize(&coeff_init_buffer[0], num_phases * num_convolutions, num_phases);
+ coeffs.resize(num_phases + 1 + 1);
 
- // Reorder coefficients to allow for more efficient convolution.
- for(int phase = -1; phase < ((int)num_phases + 1); phase++)
+ // Assign aligned pointers into coeff_mem
  {
-  for(int conv = 0; conv < (int)num_convolutions; conv++)
-  {
-   double coeff;
-
-   if(phase == -1 && conv == 0)
-    coeff = 0;
-   else if(phase == (int)num_phases && conv == ((int)num_convolutions - 1))
-    coeff = 0;
-   else
-    coeff = coeff_init_buffer[conv * num_phases + phase];
+  const resample_coeff_t *base_ptr = (const resample_coeff_t *)ResampleUtility::make_aligned((void *)&(*coeff_mem)[0], conv_alignment_bytes);
 
-   coeffs[phase + 1][conv] = coeff;
+  for(unsigned phase = 0; phase < (num_phases + 1 + 1); phase++)
+  {
+   coeffs[phase] = base_ptr + (conv_stride * phase);
   }
  }
 
- // Free a bit of mem
- coeff_init_buffer.resize(0);
-
  step_int = floor(input_to_output_ratio);
  step_fract = input_to_output_ratio - step_int;
 
@@ -378,7 +471,8 @@ void SincResample::Init(double input_rate, double output_rate, double desired_ba
  // rather than just 1, in which case this over-read wouldn't happen), from the first half into the duplicated half,
  // since those corresponding coefficients will be zero anyway; this is just to handle the case of reading off the end of the duplicated half to
  // prevent illegal memory accesses.
- rb.resize(num_convolutions * 2 + max_mult_minus1);
+ rb_stride = num_convolutions * 2 + max_mult_minus1;
+ rb.resize(channels * rb_stride);
 
  rb_readpos = 0;
  rb_writepos = 0;
@@ -442,12 +536,93 @@ resample_samp_t SincResample::mac(const resample_samp_t *wave, const resample_co
  return accum;
 }
 
+#if SINCRESAMPLE_USE_SSE
+// Same as mac() for two channels at once, sharing the coefficient loads; results are identical to two mac() calls.
+void SincResample::mac2(const resample_samp_t *wave0, const resample_samp_t *wave1, const resample_coeff_t *coeffs_a, const resample_coeff_t *coeffs_b, const double ffract, unsigned count, resample_samp_t *out)
+{
+#if SINCRESAMPLE_USE_AVX
+ __m256 accum_vec_a[2] = { _mm256_setzero_ps(), _mm256_setzero_ps() };
+ __m256 accum_vec_b[2] = { _mm256_setzero_ps(), _mm256_setzero_ps() };
+
+ for(unsigned c = 0; c < count; c += 8)
+ {
+  for(unsigned i = 0; i < 2; i++)
+  {
+   __m256 coeff_a = _mm256_broadcast_ps((const __m128 *)&coeffs_a[c + (i * 4)]);
+   __m256 coeff_b = _mm256_broadcast_ps((const __m128 *)&coeffs_b[c + (i * 4)]);
+   __m256 w = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(&wave0[c + (i * 4)])), _mm_loadu_ps(&wave1[c + (i * 4)]), 1);
+
+   accum_vec_a[i] = _mm256_add_ps(_mm256_mul_ps(coeff_a, w), accum_vec_a[i]);
+   accum_vec_b[i] = _mm256_add_ps(_mm256_mul_ps(coeff_b, w), accum_vec_b[i]);
+  }
+ }
+
+ __m256 accum_vec, av_a, av_b;
+ __m256 mult_a_vec = _mm256_set1_ps(1.0 - ffract);
+ __m256 mult_b_vec = _mm256_set1_ps(ffract);
+
+ av_a = _mm256_mul_ps(mult_a_vec, _mm256_add_ps(accum_vec_a[0], accum_vec_a[1]));
+ av_b = _mm256_mul_ps(mult_b_vec, _mm256_add_ps(accum_vec_b[0], accum_vec_b[1]));
+
+ accum_vec = _mm256_add_ps(av_a, av_b);
+
+ accum_vec = _mm256_add_ps(accum_vec, _mm256_shuffle_ps(accum_vec, accum_vec, (3 << 0) | (2 << 2) | (1 << 4) | (0 << 6)));
+ accum_vec = _mm256_add_ps(accum_vec, _mm256_shuffle_ps(accum_vec, accum_vec, (1 << 0) | (0 << 2) | (1 << 4) | (0 << 6)));
+
+ _mm_store_ss(&out[0], _mm256_castps256_ps128(accum_vec));
+ _mm_store_ss(&out[1], _mm256_extractf128_ps(accum_vec, 1));
+#else
+ // Accumulators are spelled out so that they stay in registers.
+ __m128 accum0a0 = _mm_set1_ps(0), accum0a1 = _mm_set1_ps(0), accum0b0 = _mm_set1_ps(0), accum0b1 = _mm_set1_ps(0);
+ __m128 accum1a0 = _mm_set1_ps(0), accum1a1 = _mm_set1_ps(0), accum1b0 = _mm_set1_ps(0), accum1b1 = _mm_set1_ps(0);
+
+ for(unsigned c = 0; c < count; c += 8)
+ {
+  __m128 coeff_a0 = _mm_load_ps(&coeffs_a[c + 0]), coeff_a1 = _mm_load_ps(&coeffs_a[c + 4]);
+  __m128 coeff_b0 = _mm_load_ps(&coeffs_b[c + 0]), coeff_b1 = _mm_load_ps(&coeffs_b[c + 4]);
+  __m128 w00 = _mm_loadu_ps(&wave0[c + 0]), w01 = _mm_loadu_ps(&wave0[c + 4]);
+  __m128 w10 = _mm_loadu_ps(&wave1[c + 0]), w11 = _mm_loadu_ps(&wave1[c + 4]);
+
+  accum0a0 = _mm_add_ps(_mm_mul_ps(coeff_a0, w00), accum0a0);
+  accum0a1 = _mm_add_ps(_mm_mul_ps(coeff_a1, w01), accum0a1);
+  accum0b0 = _mm_add_ps(_mm_mul_ps(coeff_b0, w00), accum0b0);
+  accum0b1 = _mm_add_ps(_mm_mul_ps(coeff_b1, w01), accum0b1);
+  accum1a0 = _mm_add_ps(_mm_mul_ps(coeff_a0, w10), accum1a0);
+  accum1a1 = _mm_add_ps(_mm_mul_ps(coeff_a1, w11), accum1a1);
+  accum1b0 = _mm_add_ps(_mm_mul_ps(coeff_b0, w10), accum1b0);
+  accum1b1 = _mm_add_ps(_mm_mul_ps(coeff_b1, w11), accum1b1);
+ }
+
+ __m128 accum_a[2] = { _mm_add_ps(accum0a0, accum0a1), _mm_add_ps(accum1a0, accum1a1) };
+ __m128 accum_b[2] = { _mm_add_ps(accum0b0, accum0b1), _mm_add_ps(accum1b0, accum1b1) };
+
+ __m128 mult_a_vec = _mm_set1_ps(1.0 - ffract);
+ __m128 mult_b_vec = _mm_set1_ps(ffract);
+
+ for(unsigned ch = 0; ch < 2; ch++)
+ {
+  __m128 accum_vec, av_a, av_b;
+
+  av_a = _mm_mul_ps(mult_a_vec, accum_a[ch]);
+  av_b = _mm_mul_ps(mult_b_vec, accum_b[ch]);
+
+  accum_vec = _mm_add_ps(av_a, av_b);
+
+  accum_vec = _mm_add_ps(accum_vec, _mm_shuffle_ps(accum_vec, accum_vec, (3 << 0) | (2 << 2) | (1 << 4) | (0 << 6)));
+  accum_vec = _mm_add_ps(accum_vec, _mm_shuffle_ps(accum_vec, accum_vec, (1 << 0) | (0 << 2) | (1 << 4) | (0 << 6)));
+
+  _mm_store_ss(&out[ch], accum_vec);
+ }
+#endif
+}
+#endif
+
 inline bool SincResample::output_avail(void)
 {
  return(rb_in >= (int)num_convolutions);
 }
 
-resample_samp_t SincResample::read(void)
+void SincResample::read(resample_samp_t *samples)
 {
  assert(output_avail());
  double phase = input_pos_fract * num_phases - 0.5;
@@ -455,9 +630,15 @@ resample_samp_t SincResample::read(void)
  double phase_fract = phase - phase_int;
  unsigned phase_a = num_phases - 1 - phase_int;
  unsigned phase_b = phase_a - 1;
- resample_samp_t ret;
+ unsigned ch = 0;
 
- ret = mac(&rb[rb_readpos], &coeffs[phase_a + 1][0], &coeffs[phase_b + 1][0], phase_fract, num_convolutions);
+ // All channels are convolved with the same pair of phases.
+#if SINCRESAMPLE_USE_SSE
+ for(; ch + 1 < channels; ch += 2)
+  mac2(&rb[ch * rb_stride + rb_readpos], &rb[(ch + 1) * rb_stride + rb_readpos], &coeffs[phase_a + 1][0], &coeffs[phase_b + 1][0], phase_fract, num_convolutions, &samples[ch]);
+#endif
+ for(; ch < channels; ch++)
+  samples[ch] = mac(&rb[ch * rb_stride + rb_readpos], &coeffs[phase_a + 1][0], &coeffs[phase_b + 1][0], phase_fract, num_convolutions);
 
  unsigned int_increment = step_int;
 
@@ -467,21 +648,22 @@ resample_samp_t SincResample::read(void)
 
  rb_readpos = (rb_readpos + int_increment) % num_convolutions;
  rb_in -= int_increment;
-
- return ret;
 }
 
-inline void SincResample::write(resample_samp_t sample)
+inline void SincResample::write(const resample_samp_t *samples)
 {
  assert(!output_avail());
 
+ resample_samp_t decimated[8];
+
  if(hr_used)
  {
-  hr.write(sample);
+  hr.write(samples);
 
   if(hr.output_avail())
   {
-   sample = hr.read();
+   hr.read(decimated);
+   samples = decimated;
   }
   else
   {
@@ -489,8 +671,11 @@ inline void SincResample::write(resample_samp_t sample)
   }
  }
 
- rb[rb_writepos + 0 * num_convolutions] = sample;
- rb[rb_writepos + 1 * num_convolutions] = sample;
+ for(unsigned ch = 0; ch < channels; ch++)
+ {
+  rb[ch * rb_stride + rb_writepos + 0 * num_convolutions] = samples[ch];
+  rb[ch * rb_stride + rb_writepos + 1 * num_convolutions] = samples[ch];
+ }
  rb_writepos = (rb_writepos + 1) % num_convolutions;
  rb_in++;
 }
@@ -601,3 +786,28 @@ void* ResampleUtility::make_aligned(void* ptr, unsigned boundary)
 
  return uc_ptr;
 }
+
+template<typename Build> ResampleUtility::coeff_table ResampleUtility::shared_table(const std::vector<double>& key, const Build& build)
+{
+ // A few recently used tables are kept alive, so that recreating a resampler with the same parameters
+ // (as happens on every reset) does not regenerate them.
+ enum { cache_size = 4 };
+ static std::mutex mutex;
+ static std::vector<std::pair<std::vector<double>, coeff_table>> tables;
+ std::lock_guard<std::mutex> lock(mutex);
+
+ for(auto& table : tables)
+ {
+  if(table.first == key)
+   return table.second;
+ }
+
+ auto mem = std::make_shared<std::vector<unsigned char>>();
+ build(*mem);
+
+ if(tables.size() == cache_size)
+  tables.erase(tables.begin());
+ tables.push_back({key, mem});
+
+ return mem;
+}
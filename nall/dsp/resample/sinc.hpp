@@ -7,10 +7,11 @@ struct ResampleSinc : Resampler {
   inline void clear();
   inline void sample();
   inline ResampleSinc(DSP& dsp);
+  inline ~ResampleSinc();
 
 private:
   inline void remakeSinc();
-  SincResample* sinc_resampler[8];
+  SincResample* sinc_resampler = nullptr;  //all channels share one filter and its coefficient table
 };
 
 void ResampleSinc::setFrequency() {
@@ -22,33 +23,31 @@ void ResampleSinc::clear() {
 }
 
 void ResampleSinc::sample() {
-  for(unsigned c = 0; c < dsp.settings.channels; c++) {
-    sinc_resampler[c]->write(dsp.buffer.read(c));
-  }
-
-  if(sinc_resampler[0]->output_avail()) {
-    do {
-      for(unsigned c = 0; c < dsp.settings.channels; c++) {
-        dsp.output.write(c) = sinc_resampler[c]->read();
-      }
-      dsp.output.wroffset++;
-    } while(sinc_resampler[0]->output_avail());
+  resample_samp_t samples[8];
+  for(unsigned c = 0; c < dsp.settings.channels; c++) samples[c] = dsp.buffer.read(c);
+  sinc_resampler->write(samples);
+
+  while(sinc_resampler->output_avail()) {
+    sinc_resampler->read(samples);
+    for(unsigned c = 0; c < dsp.settings.channels; c++) dsp.output.write(c) = samples[c];
+    dsp.output.wroffset++;
   }
 
   dsp.buffer.rdoffset++;
 }
 
 ResampleSinc::ResampleSinc(DSP& dsp) : Resampler(dsp) {
-  for(unsigned n = 0; n < 8; n++) sinc_resampler[n] = nullptr;
+}
+
+ResampleSinc::~ResampleSinc() {
+  if(sinc_resampler) delete sinc_resampler;
 }
 
 void ResampleSinc::remakeSinc() {
-  assert(dsp.settings.channels < 8);
+  assert(dsp.settings.channels <= 8);
 
-  for(unsigned c = 0; c < dsp.settings.channels; c++) {
-    if(sinc_resampler[c]) delete sinc_resampler[c];
-    sinc_resampler[c] = new SincResample(dsp.settings.frequency, frequency, 0.85, SincResample::QUALITY_HIGH);
-  }
+  if(sinc_resampler) delete sinc_resampler;
+  sinc_resampler = new SincResample(dsp.settings.frequency, frequency, 0.85, dsp.settings.quality, dsp.settings.channels);
 }
 
 #endif
@@ -47,4 +47,10 @@ void DSP::setResamplerFrequency(real frequency) {
   resampler->setFrequency();
 }
 
+void DSP::setResamplerQuality(unsigned quality) {
+  if(settings.quality == quality) return;
+  settings.quality = quality;
+  resampler->setFrequency();
+}
+
 #endif
@@ -29,6 +29,8 @@ struct filemap {
   unsigned size() const { return p_size; }
   uint8_t* data() { return p_handle; }
   const uint8_t* data() const { return p_handle; }
+  //hint that [offset, offset + length) will be read soon; returns immediately
+  void prefetch(unsigned offset, unsigned length) const { return p_prefetch(offset, length); }
   filemap() { p_ctor(); }
   filemap(const string& filename, mode mode_) { p_ctor(); p_open(filename, mode_); }
   ~filemap() { p_dtor(); }
@@ -120,6 +122,9 @@ private:
     }
   }
 
+  void p_prefetch(unsigned offset, unsigned length) const {
+  }
+
   void p_ctor() {
     p_filehandle = INVALID_HANDLE_VALUE;
     p_maphandle  = INVALID_HANDLE_VALUE;
@@ -199,6 +204,15 @@ private:
     }
   }
 
+  void p_prefetch(unsigned offset, unsigned length) const {
+    if(p_handle == nullptr || offset >= p_size) return;
+    if(length > p_size - offset) length = p_size - offset;
+    uintptr_t mask = sysconf(_SC_PAGESIZE) - 1;
+    uintptr_t lo = (uintptr_t)(p_handle + offset) & ~mask;
+    uintptr_t hi = (uintptr_t)(p_handle + offset + length);
+    madvise((void*)lo, hi - lo, MADV_WILLNEED);
+  }
+
   void p_ctor() {
     p_fd = -1;
   }
@@ -5,6 +5,13 @@
 
 #include <nall/stdint.hpp>
 
+//blocks are compressed with the SHA extensions when the processor reports them
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  #define NALL_SHA256_SHANI
+  #include <cpuid.h>
+  #include <immintrin.h>
+#endif
+
 namespace nall {
 
 #define PTR(t, a) ((t*)(a))
@@ -57,13 +64,13 @@ inline void sha256_init(sha256_ctx* p) {
   memcpy(p->h, T_H, sizeof(T_H));
 }
 
-static void sha256_block(sha256_ctx* p) {
+static void sha256_block(sha256_ctx* p, const uint8_t* in) {
   unsigned i;
   uint32_t s0, s1;
   uint32_t a, b, c, d, e, f, g, h;
   uint32_t t1, t2, maj, ch;
 
-  for(i = 0; i < 16; i++) p->w[i] = LD32BE(p->in + i * 4);
+  for(i = 0; i < 16; i++) p->w[i] = LD32BE(in + i * 4);
 
   for(i = 16; i < 64; i++) {
     s0 = ROR32(p->w[i - 15],  7) ^ ROR32(p->w[i - 15], 18) ^ LSR32(p->w[i - 15],  3);
@@ -88,9 +95,67 @@ static void sha256_block(sha256_ctx* p) {
 
   p->h[0] += a; p->h[1] += b; p->h[2] += c; p->h[3] += d;
   p->h[4] += e; p->h[5] += f; p->h[6] += g; p->h[7] += h;
+}
 
-  //next block
-  p->inlen = 0;
+#if defined(NALL_SHA256_SHANI)
+inline bool sha256_shani() {
+  static const bool supported = [] {
+    unsigned a, b, c, d;
+    if(__get_cpuid_max(0, nullptr) < 7) return false;
+    __cpuid_count(7, 0, a, b, c, d);
+    bool sha = b & 1 << 29;
+    __cpuid(1, a, b, c, d);
+    bool sse41 = c & 1 << 19;
+    return sha && sse41;
+  }();
+  return supported;
+}
+
+//state is kept as ABEF/CDGH pairs, the layout sha256rnds2 expects
+__attribute__((target("sha,sse4.1")))
+static void sha256_blocks_shani(uint32_t* h, const uint8_t* s, unsigned blocks) {
+  const __m128i mask = _mm_set_epi64x(0x0c0d0e0f08090a0bull, 0x0405060700010203ull);
+  __m128i t = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)(h + 0)), 0xb1);
+  __m128i cdgh = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)(h + 4)), 0x1b);
+  __m128i abef = _mm_alignr_epi8(t, cdgh, 8);
+  cdgh = _mm_blend_epi16(cdgh, t, 0xf0);
+
+  while(blocks--) {
+    __m128i abefSave = abef, cdghSave = cdgh;
+    __m128i m0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(s +  0)), mask);
+    __m128i m1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(s + 16)), mask);
+    __m128i m2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(s + 32)), mask);
+    __m128i m3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(s + 48)), mask);
+
+    //four rounds per step; m0 always holds the schedule words for the current step
+    for(unsigned i = 0; i < 16; i++) {
+      __m128i k = _mm_add_epi32(m0, _mm_loadu_si128((const __m128i*)(T_K + i * 4)));
+      cdgh = _mm_sha256rnds2_epu32(cdgh, abef, k);
+      abef = _mm_sha256rnds2_epu32(abef, cdgh, _mm_shuffle_epi32(k, 0x0e));
+
+      __m128i next = _mm_sha256msg1_epu32(m0, m1);
+      next = _mm_add_epi32(next, _mm_alignr_epi8(m3, m2, 4));
+      next = _mm_sha256msg2_epu32(next, m3);
+      m0 = m1; m1 = m2; m2 = m3; m3 = next;
+    }
+
+    abef = _mm_add_epi32(abef, abefSave);
+    cdgh = _mm_add_epi32(cdgh, cdghSave);
+    s += 64;
+  }
+
+  t = _mm_shuffle_epi32(abef, 0x1b);
+  cdgh = _mm_shuffle_epi32(cdgh, 0xb1);
+  _mm_storeu_si128((__m128i*)(h + 0), _mm_blend_epi16(t, cdgh, 0xf0));
+  _mm_storeu_si128((__m128i*)(h + 4), _mm_alignr_epi8(cdgh, t, 8));
+}
+#endif
+
+inline void sha256_blocks(sha256_ctx* p, const uint8_t* s, unsigned blocks) {
+  #if defined(NALL_SHA256_SHANI)
+  if(sha256_shani()) return sha256_blocks_shani(p->h, s, blocks);
+  #endif
+  while(blocks--) sha256_block(p, s), s += 64;
 }
 
 inline void sha256_chunk(sha256_ctx* p, const uint8_t* s, unsigned len) {
@@ -98,6 +163,15 @@ inline void sha256_chunk(sha256_ctx* p, const uint8_t* s, unsigned len) {
   p->len += len;
 
   while(len) {
+    //whole blocks are compressed straight from the source
+    if(p->inlen == 0 && len >= 64) {
+      l = len & ~63;
+      sha256_blocks(p, s, l >> 6);
+      s += l;
+      len -= l;
+      continue;
+    }
+
     l = 64 - p->inlen;
     l = (len < l) ? len : l;
 
@@ -106,7 +180,10 @@ inline void sha256_chunk(sha256_ctx* p, const uint8_t* s, unsigned len) {
     p->inlen += l;
     len -= l;
 
-    if(p->inlen == 64) sha256_block(p);
+    if(p->inlen == 64) {
+      sha256_blocks(p, p->in, 1);
+      p->inlen = 0;
+    }
   }
 }
 
@@ -116,7 +193,8 @@ inline void sha256_final(sha256_ctx* p) {
 
   if(p->inlen > 56) {
     memset(p->in + p->inlen, 0, 64 - p->inlen);
-    sha256_block(p);
+    sha256_blocks(p, p->in, 1);
+    p->inlen = 0;
   }
 
   memset(p->in + p->inlen, 0, 56 - p->inlen);
@@ -124,7 +202,7 @@ inline void sha256_final(sha256_ctx* p) {
   len = p->len << 3;
   ST32BE(p->in + 56, len >> 32);
   ST32BE(p->in + 60, len);
-  sha256_block(p);
+  sha256_blocks(p, p->in, 1);
 }
 
 inline void sha256_hash(sha256_ctx* p, uint8_t* s) {
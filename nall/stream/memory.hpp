@@ -15,6 +15,7 @@ struct memorystream : stream {
   bool randomaccess() const { return true; }
 
   uint8_t* data() const { return pdata; }
+  bool persistent() const { return ppersistent; }
   unsigned size() const { return psize; }
   unsigned offset() const { return poffset; }
   void seek(unsigned offset) const { poffset = offset; }
@@ -25,21 +26,22 @@ struct memorystream : stream {
   uint8_t read(unsigned offset) const { return pdata[offset]; }
   void write(unsigned offset, uint8_t data) const { pdata[offset] = data; }
 
-  memorystream() : pdata(nullptr), psize(0), poffset(0), pwritable(true) {}
+  memorystream() : pdata(nullptr), psize(0), poffset(0), pwritable(true), ppersistent(false) {}
 
   memorystream(uint8_t* data, unsigned size) {
     pdata = data, psize = size, poffset = 0;
-    pwritable = true;
+    pwritable = true, ppersistent = false;
   }
 
-  memorystream(const uint8_t* data, unsigned size) {
+  memorystream(const uint8_t* data, unsigned size, bool persistent = false) {
     pdata = (uint8_t*)data, psize = size, poffset = 0;
-    pwritable = false;
+    pwritable = false, ppersistent = persistent;
   }
 
 protected:
   mutable uint8_t* pdata;
   mutable unsigned psize, poffset, pwritable;
+  bool ppersistent;
 };
 
 }
@@ -10,6 +10,7 @@ struct stream {
   virtual bool randomaccess() const = 0;
 
   virtual uint8_t* data() const { return nullptr; }
+  virtual bool persistent() const { return false; }  //data() outlives the stream
   virtual unsigned size() const = 0;
   virtual unsigned offset() const = 0;
   virtual void seek(unsigned offset) const = 0;
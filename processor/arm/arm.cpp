@@ -11,6 +11,13 @@ namespace Processor {
 #include "serialization.cpp"
 
 void ARM::power() {
+  static bool initialized = false;
+  if(initialized == false) {
+    initialized = true;
+    for(unsigned n = 0; n < 4096; n++) arm_table[n] = arm_decode((n & 0xff0) << 16 | (n & 0x00f) << 4);
+    for(unsigned n = 0; n < 1024; n++) thumb_table[n] = thumb_decode(n << 6);
+  }
+
   processor.power();
   vector(0x00000000, Processor::Mode::SVC);
   pipeline.reload = true;
@@ -8,6 +8,7 @@ namespace Processor {
 
 struct ARM {
   enum : unsigned { Byte = 8, Half = 16, Word = 32 };
+  typedef void (ARM::*Handler)();
   #include "registers.hpp"
   #include "instructions-arm.hpp"
   #include "instructions-thumb.hpp"
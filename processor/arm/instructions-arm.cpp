@@ -28,10 +28,18 @@ void ARM::arm_step() {
 
   if(condition(instruction() >> 28) == false) return;
 
+  uint32 opcode = instruction();
+  (this->*arm_table[(opcode >> 16 & 0xff0) | (opcode >> 4 & 0x00f)])();
+}
+
+//only bits 27-20 and 7-4 select an instruction, so handlers are looked up from those twelve bits
+ARM::Handler ARM::arm_table[4096];
+
+ARM::Handler ARM::arm_decode(uint32 instruction) {
   #define decode(pattern, execute) if( \
-    (instruction() & std::integral_constant<uint32, bit::mask(pattern)>::value) \
+    (instruction & std::integral_constant<uint32, bit::mask(pattern)>::value) \
     == std::integral_constant<uint32, bit::test(pattern)>::value \
-  ) return arm_op_ ## execute()
+  ) return &ARM::arm_op_ ## execute
 
   decode("???? 0001 0010 ++++ ++++ ++++ 0001 ????", branch_exchange_register);
   decode("???? 0000 00?? ???? ???? ???? 1001 ????", multiply);
@@ -55,6 +63,10 @@ void ARM::arm_step() {
 
   #undef decode
 
+  return &ARM::arm_op_undefined;
+}
+
+void ARM::arm_op_undefined() {
   crash = true;
 }
 
@@ -1,4 +1,6 @@
 void arm_step();
+static Handler arm_decode(uint32 instruction);
+static Handler arm_table[4096];
 
 void arm_opcode(uint32 rm);
 void arm_move_to_status(uint32 rm);
@@ -24,3 +26,4 @@ void arm_op_move_register_offset();
 void arm_op_move_multiple();
 void arm_op_branch();
 void arm_op_software_interrupt();
+void arm_op_undefined();
@@ -26,10 +26,17 @@ void ARM::thumb_step() {
     print(disassemble_thumb_instruction(pipeline.execute.address), "\n");
   }
 
+  (this->*thumb_table[instruction() >> 6 & 0x3ff])();
+}
+
+//only bits 15-6 select an instruction, so handlers are looked up from those ten bits
+ARM::Handler ARM::thumb_table[1024];
+
+ARM::Handler ARM::thumb_decode(uint16 instruction) {
   #define decode(pattern, execute) if( \
-    (instruction() & std::integral_constant<uint32, bit::mask(pattern)>::value) \
+    (instruction & std::integral_constant<uint32, bit::mask(pattern)>::value) \
     == std::integral_constant<uint32, bit::test(pattern)>::value \
-  ) return thumb_op_ ## execute()
+  ) return &ARM::thumb_op_ ## execute
 
   decode("0001 10?? ???? ????", adjust_register);
   decode("0001 11?? ???? ????", adjust_immediate);
@@ -56,6 +63,10 @@ void ARM::thumb_step() {
 
   #undef decode
 
+  return &ARM::thumb_op_undefined;
+}
+
+void ARM::thumb_op_undefined() {
   crash = true;
 }
 
@@ -1,4 +1,6 @@
 void thumb_step();
+static Handler thumb_decode(uint16 instruction);
+static Handler thumb_table[1024];
 
 void thumb_opcode(uint4 opcode, uint4 d, uint4 s);
 
@@ -24,3 +26,4 @@ void thumb_op_branch_conditional();
 void thumb_op_branch_short();
 void thumb_op_branch_long_prefix();
 void thumb_op_branch_long_suffix();
+void thumb_op_undefined();
@@ -17,6 +17,12 @@ void HG51B::exec(uint24 addr) {
 }
 
 void HG51B::power() {
+  static bool initialized = false;
+  if(initialized == false) {
+    initialized = true;
+    for(unsigned n = 0; n < 65536; n++) decoded[n] = decode(n);
+  }
+
   regs.halt = true;
 
   regs.n = 0;
@@ -23,6 +23,8 @@ protected:
   unsigned sa();
   unsigned ri();
   unsigned np();
+  static uint8 decode(uint16 opcode);
+  static uint8 decoded[65536];
   void instruction();
 };
 
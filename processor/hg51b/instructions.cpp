@@ -45,168 +45,242 @@ unsigned HG51B::np() {
   return (regs.pc & 0xffff00) | (opcode & 0xff);
 }
 
+//each opcode is matched against the instruction patterns once, by power();
+//instruction() then dispatches on the index of the pattern that matched
+uint8 HG51B::decoded[65536];
+
+uint8 HG51B::decode(uint16 opcode) {
+  if((opcode & 0xffff) == 0x0000) return  0;  //nop
+  if((opcode & 0xdd00) == 0x0800) return  1;  //jump i
+  if((opcode & 0xdd00) == 0x0c00) return  2;  //jumpeq i
+  if((opcode & 0xdd00) == 0x1000) return  3;  //jumpge i
+  if((opcode & 0xdd00) == 0x1400) return  4;  //jumpmi i
+  if((opcode & 0xffff) == 0x1c00) return  5;  //loop?
+  if((opcode & 0xfffe) == 0x2500) return  6;  //skiplt/skipge
+  if((opcode & 0xfffe) == 0x2600) return  7;  //skipne/skipeq
+  if((opcode & 0xfffe) == 0x2700) return  8;  //skipmi/skippl
+  if((opcode & 0xffff) == 0x3c00) return  9;  //ret
+  if((opcode & 0xffff) == 0x4000) return 10;  //rdbus
+  if((opcode & 0xf800) == 0x4800) return 11;  //cmpr a<<n,ri
+  if((opcode & 0xf800) == 0x5000) return 12;  //cmp a<<n,ri
+  if((opcode & 0xfb00) == 0x5900) return 13;  //sxb
+  if((opcode & 0xfb00) == 0x5a00) return 14;  //sxw
+  if((opcode & 0xfb00) == 0x6000) return 15;  //ld a,ri
+  if((opcode & 0xfb00) == 0x6100) return 16;  //ld ?,ri
+  if((opcode & 0xfb00) == 0x6300) return 17;  //ld p,ri
+  if((opcode & 0xfb00) == 0x6800) return 18;  //rdraml
+  if((opcode & 0xfb00) == 0x6900) return 19;  //rdramh
+  if((opcode & 0xfb00) == 0x6a00) return 20;  //rdramb
+  if((opcode & 0xffff) == 0x7000) return 21;  //rdrom
+  if((opcode & 0xff00) == 0x7c00) return 22;  //ld pl,i
+  if((opcode & 0xff00) == 0x7d00) return 23;  //ld ph,i
+  if((opcode & 0xf800) == 0x8000) return 24;  //add a<<n,ri
+  if((opcode & 0xf800) == 0x8800) return 25;  //subr a<<n,ri
+  if((opcode & 0xf800) == 0x9000) return 26;  //sub a<<n,ri
+  if((opcode & 0xfb00) == 0x9800) return 27;  //mul a,ri
+  if((opcode & 0xf800) == 0xa800) return 28;  //xor a<<n,ri
+  if((opcode & 0xf800) == 0xb000) return 29;  //and a<<n,ri
+  if((opcode & 0xf800) == 0xb800) return 30;  //or a<<n,ri
+  if((opcode & 0xfb00) == 0xc000) return 31;  //shr a,ri
+  if((opcode & 0xfb00) == 0xc800) return 32;  //asr a,ri
+  if((opcode & 0xfb00) == 0xd000) return 33;  //ror a,ri
+  if((opcode & 0xfb00) == 0xd800) return 34;  //shl a,ri
+  if((opcode & 0xff00) == 0xe000) return 35;  //st r,a
+  if((opcode & 0xfb00) == 0xe800) return 36;  //wrraml
+  if((opcode & 0xfb00) == 0xe900) return 37;  //wrramh
+  if((opcode & 0xfb00) == 0xea00) return 38;  //wrramb
+  if((opcode & 0xff00) == 0xf000) return 39;  //swap a,r
+  if((opcode & 0xffff) == 0xfc00) return 40;  //halt
+  return 0xff;
+}
+
 void HG51B::instruction() {
-  if((opcode & 0xffff) == 0x0000) {
+  switch(decoded[opcode]) {
+  case  0: {
     //0000 0000 0000 0000
     //nop
+    break;
   }
 
-  else if((opcode & 0xdd00) == 0x0800) {
+  case  1: {
     //00.0 10.0 .... ....
     //jump i
     if(opcode & 0x2000) push();
     regs.pc = np();
+    break;
   }
 
-  else if((opcode & 0xdd00) == 0x0c00) {
+  case  2: {
     //00.0 11.0 .... ....
     //jumpeq i
     if(regs.z) {
       if(opcode & 0x2000) push();
       regs.pc = np();
     }
+    break;
   }
 
-  else if((opcode & 0xdd00) == 0x1000) {
+  case  3: {
     //00.1 00.0 .... ....
     //jumpge i
     if(regs.c) {
       if(opcode & 0x2000) push();
       regs.pc = np();
     }
+    break;
   }
 
-  else if((opcode & 0xdd00) == 0x1400) {
+  case  4: {
     //00.1 01.0 .... ....
     //jumpmi i
     if(regs.n) {
       if(opcode & 0x2000) push();
       regs.pc = np();
     }
+    break;
   }
 
-  else if((opcode & 0xffff) == 0x1c00) {
+  case  5: {
     //0001 1100 0000 0000
     //loop?
+    break;
   }
 
-  else if((opcode & 0xfffe) == 0x2500) {
+  case  6: {
     //0010 0101 0000 000.
     //skiplt/skipge
     if(regs.c == (opcode & 1)) regs.pc++;
+    break;
   }
 
-  else if((opcode & 0xfffe) == 0x2600) {
+  case  7: {
     //0010 0110 0000 000.
     //skipne/skipeq
     if(regs.z == (opcode & 1)) regs.pc++;
+    break;
   }
 
-  else if((opcode & 0xfffe) == 0x2700) {
+  case  8: {
     //0010 0111 0000 000.
     //skipmi/skippl
     if(regs.n == (opcode & 1)) regs.pc++;
+    break;
   }
 
-  else if((opcode & 0xffff) == 0x3c00) {
+  case  9: {
     //0011 1100 0000 0000
     //ret
     pull();
+    break;
   }
 
-  else if((opcode & 0xffff) == 0x4000) {
+  case 10: {
     //0100 0000 0000 0000
     //rdbus
     regs.busdata = bus_read(regs.busaddr++);
+    break;
   }
 
-  else if((opcode & 0xf800) == 0x4800) {
+  case 11: {
     //0100 1... .... ....
     //cmpr a<<n,ri
     int result = ri() - sa();
     regs.n = result & 0x800000;
     regs.z = (uint24)result == 0;
     regs.c = result >= 0;
+    break;
   }
 
-  else if((opcode & 0xf800) == 0x5000) {
+  case 12: {
     //0101 0... .... ....
     //cmp a<<n,ri
     int result = sa() - ri();
     regs.n = result & 0x800000;
     regs.z = (uint24)result == 0;
     regs.c = result >= 0;
+    break;
   }
 
-  else if((opcode & 0xfb00) == 0x5900) {
+  case 13: {
     //0101 1.01 .... ....
     //sxb
     regs.a = (int8)ri();
+    break;
   }
 
-  else if((opcode & 0xfb00) == 0x5a00) {
+  case 14: {
     //0101 1.10 .... ....
     //sxw
     regs.a = (int16)ri();
+    break;
   }
 
-  else if((opcode & 0xfb00) == 0x6000) {
+  case 15: {
     //0110 0.00 .... ....
     //ld a,ri
     regs.a = ri();
+    break;
   }
 
-  else if((opcode & 0xfb00) == 0x6100) {
+  case 16: {
     //0110 0.01 .... ....
     //ld ?,ri
+    break;
   }
 
-  else if((opcode & 0xfb00) == 0x6300) {
+  case 17: {
     //0110 0.11 .... ....
     //ld p,ri
     regs.p = ri();
+    break;
   }
 
-  else if((opcode & 0xfb00) == 0x6800) {
+  case 18: {
     //0110 1.00 .... ....
     //rdraml
     uint24 target = ri() + (opcode & 0x0400 ? regs.ramaddr : (uint24)0);
     if(target < 0xc00) regs.ramdata = (regs.ramdata & 0xffff00) | (dataRAM[target] <<  0);
+    break;
   }
 
-  else if((opcode & 0xfb00) == 0x6900) {
+  case 19: {
     //0110 1.01 .... ....
     //rdramh
     uint24 target = ri() + (opcode & 0x0400 ? regs.ramaddr : (uint24)0);
     if(target < 0xc00) regs.ramdata = (regs.ramdata & 0xff00ff) | (dataRAM[target] <<  8);
+    break;
   }
 
-  else if((opcode & 0xfb00) == 0x6a00) {
+  case 20: {
     //0110 1.10 .... ....
     //rdramb
     uint24 target = ri() + (opcode & 0x0400 ? regs.ramaddr : (uint24)0);
     if(target < 0xc00) regs.ramdata = (regs.ramdata & 0x00ffff) | (dataRAM[target] << 16);
+    break;
   }
 
-  else if((opcode & 0xffff) == 0x7000) {
+  case 21: {
     //0111 0000 0000 0000
     //rdrom
     regs.romdata = dataROM[regs.a & 0x3ff];
+    break;
   }
 
-  else if((opcode & 0xff00) == 0x7c00) {
+  case 22: {
     //0111 1100 .... ....
     //ld pl,i
     regs.p = (regs.p & 0xff00) | ((opcode & 0xff) << 0);
+    break;
   }
 
-  else if((opcode & 0xff00) == 0x7d00) {
+  case 23: {
     //0111 1101 .... ....
     //ld ph,i
     regs.p = (regs.p & 0x00ff) | ((opcode & 0xff) << 8);
+    break;
   }
 
-  else if((opcode & 0xf800) == 0x8000) {
+  case 24: {
     //1000 0... .... ....
     //add a<<n,ri
     int result = sa() + ri();
@@ -214,9 +288,10 @@ void HG51B::instruction() {
     regs.n = regs.a & 0x800000;
     regs.z = regs.a == 0;
     regs.c = result > 0xffffff;
+    break;
   }
 
-  else if((opcode & 0xf800) == 0x8800) {
+  case 25: {
     //1000 1... .... ....
     //subr a<<n,ri
     int result = ri() - sa();
@@ -224,9 +299,10 @@ void HG51B::instruction() {
     regs.n = regs.a & 0x800000;
     regs.z = regs.a == 0;
     regs.c = result >= 0;
+    break;
   }
 
-  else if((opcode & 0xf800) == 0x9000) {
+  case 26: {
     //1001 0... .... ....
     //sub a<<n,ri
     int result = sa() - ri();
@@ -234,9 +310,10 @@ void HG51B::instruction() {
     regs.n = regs.a & 0x800000;
     regs.z = regs.a == 0;
     regs.c = result >= 0;
+    break;
   }
 
-  else if((opcode & 0xfb00) == 0x9800) {
+  case 27: {
     //1001 1.00 .... ....
     //mul a,ri
     int64 x = (int24)regs.a;
@@ -246,110 +323,126 @@ void HG51B::instruction() {
     regs.acch = x >> 24ull;
     regs.n = regs.acch & 0x800000;
     regs.z = x == 0;
+    break;
   }
 
-  else if((opcode & 0xf800) == 0xa800) {
+  case 28: {
     //1010 1... .... ....
     //xor a<<n,ri
     regs.a = sa() ^ ri();
     regs.n = regs.a & 0x800000;
     regs.z = regs.a == 0;
+    break;
   }
 
-  else if((opcode & 0xf800) == 0xb000) {
+  case 29: {
     //1011 0... .... ....
     //and a<<n,ri
     regs.a = sa() & ri();
     regs.n = regs.a & 0x800000;
     regs.z = regs.a == 0;
+    break;
   }
 
-  else if((opcode & 0xf800) == 0xb800) {
+  case 30: {
     //1011 1... .... ....
     //or a<<n,ri
     regs.a = sa() | ri();
     regs.n = regs.a & 0x800000;
     regs.z = regs.a == 0;
+    break;
   }
 
-  else if((opcode & 0xfb00) == 0xc000) {
+  case 31: {
     //1100 0.00 .... ....
     //shr a,ri
     regs.a = regs.a >> ri();
     regs.n = regs.a & 0x800000;
     regs.z = regs.a == 0;
+    break;
   }
 
-  else if((opcode & 0xfb00) == 0xc800) {
+  case 32: {
     //1100 1.00 .... ....
     //asr a,ri
     regs.a = (int24)regs.a >> ri();
     regs.n = regs.a & 0x800000;
     regs.z = regs.a == 0;
+    break;
   }
 
-  else if((opcode & 0xfb00) == 0xd000) {
+  case 33: {
     //1101 0.00 .... ....
     //ror a,ri
     uint24 length = ri();
     regs.a = (regs.a >> length) | (regs.a << (24 - length));
     regs.n = regs.a & 0x800000;
     regs.z = regs.a == 0;
+    break;
   }
 
-  else if((opcode & 0xfb00) == 0xd800) {
+  case 34: {
     //1101 1.00 .... ....
     //shl a,ri
     regs.a = regs.a << ri();
     regs.n = regs.a & 0x800000;
     regs.z = regs.a == 0;
+    break;
   }
 
-  else if((opcode & 0xff00) == 0xe000) {
+  case 35: {
     //1110 0000 .... ....
     //st r,a
     reg_write(opcode & 0xff, regs.a);
+    break;
   }
 
-  else if((opcode & 0xfb00) == 0xe800) {
+  case 36: {
     //1110 1.00 .... ....
     //wrraml
     uint24 target = ri() + (opcode & 0x0400 ? regs.ramaddr : (uint24)0);
     if(target < 0xc00) dataRAM[target] = regs.ramdata >>  0;
+    break;
   }
 
-  else if((opcode & 0xfb00) == 0xe900) {
+  case 37: {
     //1110 1.01 .... ....
     //wrramh
     uint24 target = ri() + (opcode & 0x0400 ? regs.ramaddr : (uint24)0);
     if(target < 0xc00) dataRAM[target] = regs.ramdata >>  8;
+    break;
   }
 
-  else if((opcode & 0xfb00) == 0xea00) {
+  case 38: {
     //1110 1.10 .... ....
     //wrramb
     uint24 target = ri() + (opcode & 0x0400 ? regs.ramaddr : (uint24)0);
     if(target < 0xc00) dataRAM[target] = regs.ramdata >> 16;
+    break;
   }
 
-  else if((opcode & 0xff00) == 0xf000) {
+  case 39: {
     //1111 0000 .... ....
     //swap a,r
     uint24 source = reg_read(opcode & 0xff);
     uint24 target = regs.a;
     regs.a = source;
     reg_write(opcode & 0xff, target);
+    break;
   }
 
-  else if((opcode & 0xffff) == 0xfc00) {
+  case 40: {
     //1111 1100 0000 0000
     //halt
     regs.halt = true;
+    break;
   }
 
-  else {
+  default: {
     print("Hitachi DSP: unknown opcode @ ", hex<4>(regs.pc - 1), " = ", hex<4>(opcode), "\n");
     regs.halt = true;
+    break;
+  }
   }
 }
 
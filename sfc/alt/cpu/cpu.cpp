@@ -81,8 +81,8 @@ alwaysinline void CPU::op_step() {
 }
 
 void CPU::enable() {
-  function<uint8 (unsigned)> reader = {&CPU::mmio_read, (CPU*)&cpu};
-  function<void (unsigned, uint8)> writer = {&CPU::mmio_write, (CPU*)&cpu};
+  Bus::Reader reader = {&CPU::mmio_read, (CPU*)&cpu};
+  Bus::Writer writer = {&CPU::mmio_write, (CPU*)&cpu};
 
   bus.map(reader, writer, 0x00, 0x3f, 0x2140, 0x2183);
   bus.map(reader, writer, 0x80, 0xbf, 0x2140, 0x2183);
@@ -134,6 +134,9 @@ void CPU::reset() {
   regs.pc.h = bus.read(0xfffd);
   regs.pc.b = 0x00;
 
+  //$2140-217f
+  for(auto& port : port_data) port = 0x00;
+
   status.nmi_valid = false;
   status.nmi_line = false;
   status.nmi_transition = false;
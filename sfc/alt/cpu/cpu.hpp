@@ -2,7 +2,7 @@ struct CPU : Processor::R65816, Thread, public PPUcounter {
   uint8 wram[128 * 1024];
 
   enum : bool { Threaded = true };
-  vector<Thread*> coprocessors;
+  vector<Coprocessor*> coprocessors;
   alwaysinline void step(unsigned clocks);
   alwaysinline void synchronize_smp();
   void synchronize_ppu();
@@ -859,6 +859,23 @@ void SPC_DSP::soft_reset()
 	soft_reset_common();
 }
 
+bool SPC_DSP::echo_reaches( int addr, int size ) const
+{
+	// latched and written ESA/EDL/FLG both take part until the latches catch up
+	if ( m.t_echo_enabled & REG(flg) & 0x20 )
+		return false;
+	
+	int length = max( max( m.echo_length, (REG(edl) & 0x0F) * 0x800 ), 4 );
+	int const esa [2] = { m.t_esa, REG(esa) };
+	for ( int i = 0; i < 2; i++ )
+	{
+		int base = esa [i] * 0x100;
+		if ( ((addr - base) & 0xFFFF) < length || ((base - addr) & 0xFFFF) < size )
+			return true;
+	}
+	return false;
+}
+
 void SPC_DSP::load( uint8_t const regs [register_count] )
 {
 	memcpy( m.regs, regs, sizeof m.regs );
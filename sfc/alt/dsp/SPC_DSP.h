@@ -234,6 +234,9 @@ private:
 
 public:
 	bool mute() { return m.regs[r_flg] & 0x40; }
+
+	// True if echo writes could reach [addr, addr + size) before the registers are written again
+	bool echo_reaches( int addr, int size ) const;
 };
 
 #include <assert.h>
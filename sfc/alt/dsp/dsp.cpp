@@ -35,6 +35,10 @@ bool DSP::mute() {
   return spc_dsp.mute();
 }
 
+bool DSP::echo_reaches(uint16 addr, unsigned size) const {
+  return spc_dsp.echo_reaches(addr, size);
+}
+
 uint8 DSP::read(uint8 addr) {
   return spc_dsp.read(addr);
 }
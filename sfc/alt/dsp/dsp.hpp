@@ -6,6 +6,7 @@ struct DSP : Thread {
   alwaysinline void synchronize_smp();
 
   bool mute();
+  bool echo_reaches(uint16 addr, unsigned size) const;
   uint8 read(uint8 addr);
   void write(uint8 addr, uint8 data);
 
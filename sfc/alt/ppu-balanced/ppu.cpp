@@ -118,8 +118,8 @@ void PPU::frame() {
 }
 
 void PPU::enable() {
-  function<uint8 (unsigned)> reader = {&PPU::mmio_read, (PPU*)&ppu};
-  function<void (unsigned, uint8)> writer = {&PPU::mmio_write, (PPU*)&ppu};
+  Bus::Reader reader = {&PPU::mmio_read, (PPU*)&ppu};
+  Bus::Writer writer = {&PPU::mmio_write, (PPU*)&ppu};
 
   bus.map(reader, writer, 0x00, 0x3f, 0x2100, 0x213f);
   bus.map(reader, writer, 0x80, 0xbf, 0x2100, 0x213f);
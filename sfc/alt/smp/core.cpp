@@ -14,6 +14,8 @@ void SMP::op_io() {
   #endif
 }
 
+//opcodes dispatch through one switch, and RAM fetches are a single index: a pre-decoded
+//instruction cache would save little beyond the operand loads, see sfc/smp/memory.cpp
 uint8 SMP::op_read(uint16 addr) {
   #if defined(CYCLE_ACCURATE)
   tick();
@@ -3,6 +3,7 @@ struct SMP : Thread {
   uint8* apuram;
 
   enum : bool { Threaded = false };
+  enum : bool { on_thread = false };  //always stepped from the S-CPU, see SMP::enter()
   alwaysinline void synchronize_cpu();
   alwaysinline void synchronize_dsp();
 
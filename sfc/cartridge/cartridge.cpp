@@ -27,6 +27,17 @@ string Cartridge::title() {
   return information.title.cartridge;
 }
 
+string Cartridge::sha256() {
+  hash.wait();
+  if(hash.digest.empty() && loaded) hash.compute();
+  return hash.digest;
+}
+
+void Cartridge::set_sha256(const string& digest, unsigned size) {
+  hash.known = digest;
+  hash.known_size = size;
+}
+
 void Cartridge::load() {
   region = Region::NTSC;
 
@@ -72,65 +83,61 @@ void Cartridge::load() {
   interface->loadRequest(ID::Manifest, "manifest.bml");
   parse_markup(information.markup.cartridge);
 
+  //no write reaches these images, so they can be used in place and hashed while the game runs;
+  //the S-CPU can write to SuperFX, BS-X and Sufami Turbo ROM, which stay writable as before
+  for(auto image : {&rom, &sa1.rom, &hitachidsp.rom, &spc7110.prom, &spc7110.drom, &sdd1.rom}) image->write_protect(true);
+  for(auto image : {&superfx.rom, &bsxcartridge.rom, &sufamiturboA.rom, &sufamiturboB.rom}) image->write_protect(false);
+
   //Super Game Boy
   if(cartridge.has_gb_slot()) {
-    sha256 = nall::sha256(GameBoy::cartridge.romdata, GameBoy::cartridge.romsize);
+    hash.images.append({GameBoy::cartridge.romdata, GameBoy::cartridge.romsize});
   }
 
   //Broadcast Satellaview
   else if(cartridge.has_bs_cart() && cartridge.has_bs_slot()) {
-    sha256 = nall::sha256(satellaviewcartridge.memory.data(), satellaviewcartridge.memory.size());
+    //flash memory can be rewritten once running, so it is hashed now
+    hash.digest = nall::sha256(satellaviewcartridge.memory.data(), satellaviewcartridge.memory.size());
   }
 
   //Sufami Turbo
   else if(cartridge.has_st_slots()) {
-    sha256_ctx sha;
-    uint8_t hash[32];
-    sha256_init(&sha);
-    sha256_chunk(&sha, sufamiturboA.rom.data(), sufamiturboA.rom.size());
-    sha256_chunk(&sha, sufamiturboB.rom.data(), sufamiturboB.rom.size());
-    sha256_final(&sha);
-    sha256_hash(&sha, hash);
-    string result;
-    for(auto& byte : hash) result.append(hex<2>(byte));
-    sha256 = result;
+    hash.append(sufamiturboA.rom);
+    hash.append(sufamiturboB.rom);
   }
 
   //Super Famicom
   else {
-    sha256_ctx sha;
-    uint8_t hash[32];
-    vector<uint8_t> buffer;
-    sha256_init(&sha);
     //hash each ROM image that exists; any with size() == 0 is ignored by sha256_chunk()
-    sha256_chunk(&sha, rom.data(), rom.size());
-    sha256_chunk(&sha, bsxcartridge.rom.data(), bsxcartridge.rom.size());
-    sha256_chunk(&sha, sa1.rom.data(), sa1.rom.size());
-    sha256_chunk(&sha, superfx.rom.data(), superfx.rom.size());
-    sha256_chunk(&sha, hitachidsp.rom.data(), hitachidsp.rom.size());
-    sha256_chunk(&sha, spc7110.prom.data(), spc7110.prom.size());
-    sha256_chunk(&sha, spc7110.drom.data(), spc7110.drom.size());
-    sha256_chunk(&sha, sdd1.rom.data(), sdd1.rom.size());
+    hash.append(rom);
+    hash.append(bsxcartridge.rom);
+    hash.append(sa1.rom);
+    hash.append(superfx.rom);
+    hash.append(hitachidsp.rom);
+    hash.append(spc7110.prom);
+    hash.append(spc7110.drom);
+    hash.append(sdd1.rom);
     //hash all firmware that exists
-    buffer = armdsp.firmware();
-    sha256_chunk(&sha, buffer.data(), buffer.size());
-    buffer = hitachidsp.firmware();
-    sha256_chunk(&sha, buffer.data(), buffer.size());
-    buffer = necdsp.firmware();
-    sha256_chunk(&sha, buffer.data(), buffer.size());
-    //finalize hash
-    sha256_final(&sha);
-    sha256_hash(&sha, hash);
-    string result;
-    for(auto& byte : hash) result.append(hex<2>(byte));
-    sha256 = result;
+    for(auto byte : armdsp.firmware()) hash.firmware.append(byte);
+    for(auto byte : hitachidsp.firmware()) hash.firmware.append(byte);
+    for(auto byte : necdsp.firmware()) hash.firmware.append(byte);
   }
 
-  rom.write_protect(true);
+  //the frontend's digest can only stand in for a configuration made of that one image
+  if(hash.digest.empty() && hash.known.empty() == false && hash.firmware.size() == 0) {
+    unsigned count = 0, size = 0;
+    for(auto& image : hash.images) if(image.size) count++, size = image.size;
+    if(count == 1 && size == hash.known_size) hash.digest = hash.known;
+  }
+  hash.known = "";
+
   ram.write_protect(false);
 
   system.load();
   loaded = true;
+
+  #if !defined(PLATFORM_UNKNOWN)
+  if(hash.digest.empty()) hash.worker = new nall::thread([&] { hash.compute(); });
+  #endif
 }
 
 void Cartridge::load_super_game_boy() {
@@ -215,6 +222,7 @@ void Cartridge::load_sufami_turbo_b() {
 
 void Cartridge::unload() {
   if(loaded == false) return;
+  hash.reset();
 
   system.unload();
   rom.reset();
@@ -224,6 +232,44 @@ void Cartridge::unload() {
   memory.reset();
 }
 
+//the worker reads the images while the game runs: one that can still be written is hashed from a copy
+void Cartridge::Hash::append(MappedRAM& image) {
+  Image entry = {image.data(), image.size()};
+  if(image.write_protected() == false) {
+    entry.copy.resize(image.size());
+    memcpy(entry.copy.data(), image.data(), image.size());
+  }
+  images.append(entry);
+}
+
+void Cartridge::Hash::compute() {
+  sha256_ctx sha;
+  uint8_t result[32];
+  sha256_init(&sha);
+  for(auto& image : images) sha256_chunk(&sha, image.copy.size() ? image.copy.data() : image.data, image.size);
+  sha256_chunk(&sha, firmware.data(), firmware.size());
+  sha256_final(&sha);
+  sha256_hash(&sha, result);
+  digest = "";
+  for(auto& byte : result) digest.append(hex<2>(byte));
+}
+
+void Cartridge::Hash::wait() {
+  #if !defined(PLATFORM_UNKNOWN)
+  if(worker == nullptr) return;
+  worker->join();
+  delete worker;
+  worker = nullptr;
+  #endif
+}
+
+void Cartridge::Hash::reset() {
+  wait();
+  images.reset();
+  firmware.reset();
+  digest = "";
+}
+
 Cartridge::Cartridge() {
   loaded = false;
 }
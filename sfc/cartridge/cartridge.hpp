@@ -17,7 +17,6 @@ struct Cartridge : property<Cartridge> {
   MappedRAM ram;
 
   readonly<bool> loaded;
-  readonly<string> sha256;
 
   readonly<Region> region;
 
@@ -48,8 +47,8 @@ struct Cartridge : property<Cartridge> {
   readonly<bool> has_sgbexternal;
 
   struct Mapping {
-    function<uint8 (unsigned)> reader;
-    function<void (unsigned, uint8)> writer;
+    Bus::Reader reader;
+    Bus::Writer writer;
     string addr;
     unsigned size;
     unsigned base;
@@ -59,7 +58,7 @@ struct Cartridge : property<Cartridge> {
     uint8* fastptr;
 
     Mapping();
-    Mapping(const function<uint8 (unsigned)>&, const function<void (unsigned, uint8)>&);
+    Mapping(const Bus::Reader&, const Bus::Writer&);
     Mapping(SuperFamicom::Memory&);
   };
   vector<Mapping> mapping;
@@ -89,6 +88,8 @@ struct Cartridge : property<Cartridge> {
   } information;
 
   string title();
+  string sha256();
+  void set_sha256(const string& digest, unsigned size);  //digest of a single image the frontend already hashed
 
   void load();
   void unload();
@@ -98,6 +99,28 @@ struct Cartridge : property<Cartridge> {
   ~Cartridge();
 
 private:
+  //images are hashed on a worker thread while the system is brought up; sha256() waits for it
+  struct Hash {
+    struct Image {
+      const uint8_t* data;
+      unsigned size;
+      vector<uint8_t> copy;  //of an image that can be written to while the worker runs
+    };
+    vector<Image> images;
+    vector<uint8_t> firmware;
+    string digest;
+    string known;  //from set_sha256(); used by the next load() if it matches what would be hashed
+    unsigned known_size = 0;
+    #if !defined(PLATFORM_UNKNOWN)
+    nall::thread* worker = nullptr;
+    #endif
+
+    void append(MappedRAM& image);
+    void compute();
+    void wait();
+    void reset();
+  } hash;
+
   void load_super_game_boy();
   void load_satellaview();
   void load_sufami_turbo_a();
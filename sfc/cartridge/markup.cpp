@@ -706,7 +706,7 @@ Cartridge::Mapping::Mapping(SuperFamicom::Memory& memory) {
   fastmode = Mapping::fastmode_slow;
 }
 
-Cartridge::Mapping::Mapping(const function<uint8 (unsigned)>& reader, const function<void (unsigned, uint8)>& writer) {
+Cartridge::Mapping::Mapping(const Bus::Reader& reader, const Bus::Writer& writer) {
   this->reader = reader;
   this->writer = writer;
   size = base = mask = 0;
@@ -90,6 +90,7 @@ void ArmDSP::mmio_write(unsigned addr, uint8 data) {
 }
 
 void ArmDSP::init() {
+  deferred = true;
 }
 
 void ArmDSP::load() {
@@ -1,6 +1,10 @@
 struct Coprocessor : Thread {
   alwaysinline void step(unsigned clocks);
   alwaysinline void synchronize_cpu();
+
+  //set by chips that the S-CPU can only observe through their own handlers;
+  //those are not resumed after every S-CPU step, only when accessed
+  bool deferred = false;
 };
 
 #include <sfc/chip/icd2/icd2.hpp>
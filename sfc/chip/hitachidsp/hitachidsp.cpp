@@ -21,6 +21,7 @@ void HitachiDSP::enter() {
         step(2);
       }
       mmio.dma = false;
+      deferred = true;
     }
 
     exec(mmio.program_offset);
@@ -43,6 +44,7 @@ void HitachiDSP::unload() {
 
 void HitachiDSP::power() {
   mmio.dma = false;
+  deferred = true;
 
   mmio.dma_source = 0x000000;
   mmio.dma_length = 0x0000;
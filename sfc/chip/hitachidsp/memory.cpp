@@ -12,6 +12,8 @@ void HitachiDSP::bus_write(uint24 addr, uint8 data) {
 }
 
 uint8 HitachiDSP::rom_read(unsigned addr) {
+  //ROM reads do not catch the chip up: while it runs, the ROM bus stays with the chip until the S-CPU
+  //next syncs it, through its registers, its RAM or the scanline sync. software polls $7f5e for that.
   if(co_active() == hitachidsp.thread || regs.halt) {
     addr = bus.mirror(addr, rom.size());
   //if(Roms == 2 && mmio.r1f52 == 1 && addr >= (bit::round(rom.size()) >> 1)) return 0x00;
@@ -25,16 +27,19 @@ void HitachiDSP::rom_write(unsigned addr, uint8 data) {
 }
 
 uint8 HitachiDSP::ram_read(unsigned addr) {
+  if(co_active() == cpu.thread) cpu.synchronize_coprocessors();
   if(ram.size() == 0) return 0x00;  //not open bus
   return ram.read(bus.mirror(addr, ram.size()));
 }
 
 void HitachiDSP::ram_write(unsigned addr, uint8 data) {
+  if(co_active() == cpu.thread) cpu.synchronize_coprocessors();
   if(ram.size() == 0) return;
   return ram.write(bus.mirror(addr, ram.size()), data);
 }
 
 uint8 HitachiDSP::dsp_read(unsigned addr) {
+  if(co_active() == cpu.thread) cpu.synchronize_coprocessors();
   addr &= 0x1fff;
 
   //Data RAM
@@ -85,6 +90,7 @@ uint8 HitachiDSP::dsp_read(unsigned addr) {
 }
 
 void HitachiDSP::dsp_write(unsigned addr, uint8 data) {
+  if(co_active() == cpu.thread) cpu.synchronize_coprocessors();
   addr &= 0x1fff;
 
   //Data RAM
@@ -103,7 +109,11 @@ void HitachiDSP::dsp_write(unsigned addr, uint8 data) {
   case 0x1f45: mmio.dma_target = (mmio.dma_target & 0xffff00) | (data <<  0); return;
   case 0x1f46: mmio.dma_target = (mmio.dma_target & 0xff00ff) | (data <<  8); return;
   case 0x1f47: mmio.dma_target = (mmio.dma_target & 0x00ffff) | (data << 16);
-    if(regs.halt) mmio.dma = true;
+    //DMA can touch any bus address, so the chip follows the S-CPU step for step until it completes
+    if(regs.halt) {
+      mmio.dma = true;
+      deferred = false;
+    }
     return;
   case 0x1f48: mmio.r1f48 = data & 0x01; return;
   case 0x1f49: mmio.program_offset = (mmio.program_offset & 0xffff00) | (data <<  0); return;
@@ -17,6 +17,7 @@ void HitachiDSP::serialize(serializer& s) {
   Thread::serialize(s);
 
   s.integer(mmio.dma);
+  deferred = !mmio.dma;
   s.integer(mmio.dma_source);
   s.integer(mmio.dma_length);
   s.integer(mmio.dma_target);
@@ -18,6 +18,9 @@ void ICD2::enter() {
     }
 
     if(r6003 & 0x80) {
+      //the Game Boy only returns once it has caught up to the S-CPU,
+      //which is the first point where synchronize_cpu() below would switch away
+      GameBoy::system.clocks_budget = clock < 0 ? (-clock + cpu.frequency - 1) / cpu.frequency : 0;
       GameBoy::system.run();
       step(GameBoy::system.clocks_executed);
       GameBoy::system.clocks_executed = 0;
@@ -30,6 +33,8 @@ void ICD2::enter() {
 }
 
 void ICD2::init() {
+  //the S-CPU only sees the Game Boy through $6000-7fff, so it is caught up there
+  deferred = true;
 }
 
 void ICD2::load() {
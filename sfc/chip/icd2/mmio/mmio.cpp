@@ -15,6 +15,7 @@ void ICD2::render(const uint32* source) {
 }
 
 uint8 ICD2::read(unsigned addr) {
+  cpu.synchronize_coprocessors();
   addr &= 0xffff;
 
   //LY counter
@@ -56,6 +57,7 @@ uint8 ICD2::read(unsigned addr) {
 }
 
 void ICD2::write(unsigned addr, uint8 data) {
+  cpu.synchronize_coprocessors();
   addr &= 0xffff;
 
   //VRAM port
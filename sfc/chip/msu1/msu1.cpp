@@ -24,27 +24,29 @@ void MSU1::enter() {
 
     if(mmio.audio_play) {
       if(audiofile.open()) {
-        if(audiofile.end()) {
+        if(mmio.audio_offset >= audiofile.size()) {
           if(!mmio.audio_repeat) {
             mmio.audio_play = false;
-            audiofile.seek(mmio.audio_offset = 8);
+            mmio.audio_offset = 8;
           } else {
-            audiofile.seek(mmio.audio_offset = mmio.audio_loop_offset);
+            mmio.audio_offset = mmio.audio_loop_offset;
           }
+          audiofile.prefetch(mmio.audio_offset, PrefetchSize);
         } else {
+          uint32 offset = mmio.audio_offset;
           mmio.audio_offset += 4;
-          left  = audiofile.readl(2);
-          right = audiofile.readl(2);
+          left  = read(audiofile, offset + 0) << 0 | read(audiofile, offset + 1) << 8;
+          right = read(audiofile, offset + 2) << 0 | read(audiofile, offset + 3) << 8;
+          if(offset % PrefetchInterval == 0) audiofile.prefetch(offset, PrefetchSize);
         }
       } else {
         mmio.audio_play = false;
       }
     }
 
-    signed lchannel = (double)left  * (double)mmio.audio_volume / 255.0;
-    signed rchannel = (double)right * (double)mmio.audio_volume / 255.0;
-    left  = sclamp<16>(lchannel);
-    right = sclamp<16>(rchannel);
+    //|sample * volume / 255| never exceeds 32768, so no clamping is needed
+    left  = left  * mmio.audio_volume / 255;
+    right = right * mmio.audio_volume / 255;
     if(dsp.mute()) left = 0, right = 0;
 
     audio.coprocessor_sample(left, right);
@@ -62,6 +64,7 @@ void MSU1::load() {
 
 void MSU1::unload() {
   if(datafile.open()) datafile.close();
+  data_stream = false;
   if(audiofile.open()) audiofile.close();
 }
 
@@ -85,14 +88,22 @@ void MSU1::reset() {
   mmio.audio_error  = false;
 }
 
+//reads past the end of the file return 0xff
+uint8 MSU1::read(const filemap& stream, uint32 offset) {
+  if(offset >= stream.size()) return 0xff;
+  return stream.data()[offset];
+}
+
+//both files are memory-mapped, and the kernel is asked to read ahead of playback,
+//so disk latency does not stall emulation and instances share the page cache
 void MSU1::data_open() {
   if(datafile.open()) datafile.close();
   auto document = Markup::Document(cartridge.information.markup.cartridge);
   string name = document["cartridge/msu1/rom/name"].data;
   if(name.empty()) name = "msu1.rom";
-  if(datafile.open({interface->path(ID::SuperFamicom), name}, file::mode::read)) {
-    datafile.seek(mmio.data_offset);
-  }
+  data_position = mmio.data_offset;
+  data_stream = datafile.open({interface->path(ID::SuperFamicom), name}, filemap::mode::read);
+  if(data_stream) datafile.prefetch(data_position, PrefetchSize);
 }
 
 void MSU1::audio_open() {
@@ -104,8 +115,8 @@ void MSU1::audio_open() {
     name = track["name"].data;
     break;
   }
-  if(audiofile.open({interface->path(ID::SuperFamicom), name}, file::mode::read)) {
-    audiofile.seek(mmio.audio_offset);
+  if(audiofile.open({interface->path(ID::SuperFamicom), name}, filemap::mode::read)) {
+    audiofile.prefetch(mmio.audio_offset, PrefetchSize);
   }
 }
 
@@ -124,7 +135,10 @@ uint8 MSU1::mmio_read(unsigned addr) {
   case 0x2001:
     if(mmio.data_busy) return 0x00;
     mmio.data_offset++;
-    if(datafile.open()) return datafile.read();
+    if(data_stream) {
+      if(data_position % PrefetchInterval == 0) datafile.prefetch(data_position, PrefetchSize);
+      return read(datafile, data_position++);
+    }
     return 0x00;
   case 0x2002: return 'S';
   case 0x2003: return '-';
@@ -147,7 +161,8 @@ void MSU1::mmio_write(unsigned addr, uint8 data) {
   case 0x2001: mmio.data_offset = (mmio.data_offset & 0xffff00ff) | (data <<  8); break;
   case 0x2002: mmio.data_offset = (mmio.data_offset & 0xff00ffff) | (data << 16); break;
   case 0x2003: mmio.data_offset = (mmio.data_offset & 0x00ffffff) | (data << 24);
-    if(datafile.open()) datafile.seek(mmio.data_offset);
+    data_position = mmio.data_offset;
+    if(data_stream) datafile.prefetch(data_position, PrefetchSize);
     mmio.data_busy = false;
     break;
   case 0x2004: mmio.audio_track = (mmio.audio_track & 0xff00) | (data << 0); break;
@@ -155,11 +170,12 @@ void MSU1::mmio_write(unsigned addr, uint8 data) {
     mmio.audio_offset = 0;
     audio_open();
     if(audiofile.open()) {
-      uint32 header = audiofile.readm(4);
+      uint32 header = read(audiofile, 0) << 24 | read(audiofile, 1) << 16 | read(audiofile, 2) << 8 | read(audiofile, 3) << 0;
       if(header != 0x4d535531) {  //verify 'MSU1' header
         audiofile.close();
       } else {
-        mmio.audio_loop_offset = 8 + audiofile.readl(4) * 4;
+        uint32 loop = read(audiofile, 4) << 0 | read(audiofile, 5) << 8 | read(audiofile, 6) << 16 | read(audiofile, 7) << 24;
+        mmio.audio_loop_offset = 8 + loop * 4;
         mmio.audio_offset = 8;
       }
     }
@@ -17,8 +17,16 @@ struct MSU1 : Coprocessor {
 
 private:
   bool boot;
-  file datafile;
-  file audiofile;
+  filemap datafile;
+  bool data_stream = false;  //datafile.open() is false for an empty file, which maps nothing
+  filemap audiofile;
+  uint32 data_position;
+
+  enum : unsigned {
+    PrefetchSize     = 256 * 1024,
+    PrefetchInterval =  64 * 1024,
+  };
+  static uint8 read(const filemap& stream, uint32 offset);
 
   enum Flag {
     DataBusy       = 0x80,
@@ -49,6 +49,7 @@ void NECDSP::ram_write(unsigned addr, uint8 data) {
 }
 
 void NECDSP::init() {
+  deferred = true;
 }
 
 void NECDSP::load() {
@@ -1,6 +1,8 @@
 #ifdef SA1_CPP
 
 uint8 SA1::bus_read(unsigned addr) {
+  if(auto page = mmcrom_page[addr >> Bus::fast_page_size_bits]) return page[addr];
+
   if((addr & 0x40fe00) == 0x002200) {  //$00-3f|80-bf:2200-23ff
     return mmio_read(addr);
   }
@@ -76,6 +78,8 @@ void SA1::bus_write(unsigned addr, uint8 data) {
 //to avoid syncing the S-CPU and SA-1*; as both chips are able to access
 //these ports.
 uint8 SA1::vbr_read(unsigned addr) {
+  if(auto page = mmcrom_page[addr >> Bus::fast_page_size_bits]) return page[addr];
+
   if((addr & 0x408000) == 0x008000) {  //$00-3f|80-bf:8000-ffff
     return mmcrom_read(addr);
   }
@@ -126,6 +130,9 @@ void SA1::op_write(unsigned addr, uint8 data) {
 }
 
 uint8 SA1::mmcrom_read(unsigned addr) {
+  unsigned page = addr >> Bus::fast_page_size_bits;
+  if(mmcrom_page[page]) return mmcrom_page[page][addr];
+
   if((addr & 0xffffe0) == 0x00ffe0) {
     if(addr == 0xffea && sa1.mmio.cpu_nvsw) return sa1.mmio.snv >> 0;
     if(addr == 0xffeb && sa1.mmio.cpu_nvsw) return sa1.mmio.snv >> 8;
@@ -133,51 +140,71 @@ uint8 SA1::mmcrom_read(unsigned addr) {
     if(addr == 0xffef && sa1.mmio.cpu_ivsw) return sa1.mmio.siv >> 8;
   }
 
-  static auto read = [](unsigned addr) {
-    return sa1.rom.read(bus.mirror(addr, sa1.rom.size()));
-  };
+  unsigned offset = mmcrom_offset(addr);
+  if(offset == ~0u) return 0x00;
 
+  //map the page directly, unless it holds the S-CPU vectors or straddles a mirror boundary
+  unsigned lo = bus.mirror(offset & ~Bus::fast_page_size_mask, rom.size());
+  unsigned hi = bus.mirror(offset |  Bus::fast_page_size_mask, rom.size());
+  if(page != (0x00ffe0 >> Bus::fast_page_size_bits) && hi - lo == Bus::fast_page_size_mask) {
+    mmcrom_page[page] = rom.data() + lo - (addr & ~Bus::fast_page_size_mask);
+  }
+
+  return rom.read(bus.mirror(offset, rom.size()));
+}
+
+//returns the ROM offset selected by the Super MMC, or ~0 when addr is not ROM
+unsigned SA1::mmcrom_offset(unsigned addr) {
   if((addr & 0xe08000) == 0x008000) {  //$00-1f:8000-ffff
     addr = ((addr & 0x1f0000) >> 1) | (addr & 0x007fff);
-    if(mmio.cbmode == 0) return read(0x000000 | addr);
-    return read((mmio.cb << 20) | addr);
+    if(mmio.cbmode == 0) return 0x000000 | addr;
+    return (mmio.cb << 20) | addr;
   }
 
   if((addr & 0xe08000) == 0x208000) {  //$20-3f:8000-ffff
     addr = ((addr & 0x1f0000) >> 1) | (addr & 0x007fff);
-    if(mmio.dbmode == 0) return read(0x100000 | addr);
-    return read((mmio.db << 20) | addr);
+    if(mmio.dbmode == 0) return 0x100000 | addr;
+    return (mmio.db << 20) | addr;
   }
 
   if((addr & 0xe08000) == 0x808000) {  //$80-9f:8000-ffff
     addr = ((addr & 0x1f0000) >> 1) | (addr & 0x007fff);
-    if(mmio.ebmode == 0) return read(0x200000 | addr);
-    return read((mmio.eb << 20) | addr);
+    if(mmio.ebmode == 0) return 0x200000 | addr;
+    return (mmio.eb << 20) | addr;
   }
 
   if((addr & 0xe08000) == 0xa08000) {  //$a0-bf:8000-ffff
     addr = ((addr & 0x1f0000) >> 1) | (addr & 0x007fff);
-    if(mmio.fbmode == 0) return read(0x300000 | addr);
-    return read((mmio.fb << 20) | addr);
+    if(mmio.fbmode == 0) return 0x300000 | addr;
+    return (mmio.fb << 20) | addr;
   }
 
   if((addr & 0xf00000) == 0xc00000) {  //$c0-cf:0000-ffff
-    return read((mmio.cb << 20) | (addr & 0x0fffff));
+    return (mmio.cb << 20) | (addr & 0x0fffff);
   }
 
   if((addr & 0xf00000) == 0xd00000) {  //$d0-df:0000-ffff
-    return read((mmio.db << 20) | (addr & 0x0fffff));
+    return (mmio.db << 20) | (addr & 0x0fffff);
   }
 
   if((addr & 0xf00000) == 0xe00000) {  //$e0-ef:0000-ffff
-    return read((mmio.eb << 20) | (addr & 0x0fffff));
+    return (mmio.eb << 20) | (addr & 0x0fffff);
   }
 
   if((addr & 0xf00000) == 0xf00000) {  //$f0-ff:0000-ffff
-    return read((mmio.fb << 20) | (addr & 0x0fffff));
+    return (mmio.fb << 20) | (addr & 0x0fffff);
   }
 
-  return 0x00;
+  return ~0u;
+}
+
+//must be called whenever the Super MMC bank registers change
+void SA1::mmcrom_invalidate(unsigned banklo, unsigned bankhi) {
+  for(unsigned bank = banklo; bank <= bankhi; bank++) {
+    for(unsigned addr = 0x0000; addr <= 0xffff; addr += Bus::fast_page_size) {
+      mmcrom_page[(bank << 16 | addr) >> Bus::fast_page_size_bits] = nullptr;
+    }
+  }
 }
 
 void SA1::mmcrom_write(unsigned addr, uint8 data) {
@@ -8,6 +8,11 @@ alwaysinline void op_write(unsigned addr, uint8 data);
 
 uint8 mmcrom_read(unsigned addr);
 void mmcrom_write(unsigned addr, uint8 data);
+unsigned mmcrom_offset(unsigned addr);
+void mmcrom_invalidate(unsigned banklo, unsigned bankhi);
+
+//ROM pages as mapped by $2220-$2223, filled in by mmcrom_read(); nullptr when not yet (or never) direct
+uint8* mmcrom_page[0x1000000 >> Bus::fast_page_size_bits];
 
 uint8 mmcbwram_read(unsigned addr);
 void mmcbwram_write(unsigned addr, uint8 data);
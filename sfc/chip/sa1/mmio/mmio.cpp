@@ -143,24 +143,32 @@ void SA1::mmio_w2215(uint8 data) { mmio.vcnt = (mmio.vcnt & 0x00ff) | (data << 8
 void SA1::mmio_w2220(uint8 data) {
   mmio.cbmode = (data & 0x80);
   mmio.cb     = (data & 0x07);
+  mmcrom_invalidate(0x00, 0x1f);
+  mmcrom_invalidate(0xc0, 0xcf);
 }
 
 //(DXB) Super MMC bank D
 void SA1::mmio_w2221(uint8 data) {
   mmio.dbmode = (data & 0x80);
   mmio.db     = (data & 0x07);
+  mmcrom_invalidate(0x20, 0x3f);
+  mmcrom_invalidate(0xd0, 0xdf);
 }
 
 //(EXB) Super MMC bank E
 void SA1::mmio_w2222(uint8 data) {
   mmio.ebmode = (data & 0x80);
   mmio.eb     = (data & 0x07);
+  mmcrom_invalidate(0x80, 0x9f);
+  mmcrom_invalidate(0xe0, 0xef);
 }
 
 //(FXB) Super MMC bank F
 void SA1::mmio_w2223(uint8 data) {
   mmio.fbmode = (data & 0x80);
   mmio.fb     = (data & 0x07);
+  mmcrom_invalidate(0xa0, 0xbf);
+  mmcrom_invalidate(0xf0, 0xff);
 }
 
 //(BMAPS) S-CPU BW-RAM address mapping
@@ -233,6 +233,7 @@ void SA1::reset() {
   mmio.db = 0x01;
   mmio.eb = 0x02;
   mmio.fb = 0x03;
+  mmcrom_invalidate(0x00, 0xff);
 
   //$2224 BMAPS
   mmio.sbm = 0x00;
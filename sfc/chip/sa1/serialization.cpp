@@ -146,6 +146,8 @@ void SA1::serialize(serializer& s) {
   s.integer(mmio.mr);
 
   s.integer(mmio.overflow);
+
+  if(s.mode() == serializer::Load) mmcrom_invalidate(0x00, 0xff);
 }
 
 #endif
@@ -5,6 +5,7 @@
 //note: decompression module does not need to be serialized with bsnes
 //this is because decompression only runs during DMA, and bsnes will complete
 //any pending DMA transfers prior to serialization.
+//for the same reason, an entire transfer is decompressed at once when it begins.
 
 //input manager
 
@@ -155,18 +156,8 @@ uint8 SDD1::Decomp::PEM::get_bit(uint8 context) {
   uint8 current_mps = info.mps;
   const State& s = SDD1::Decomp::PEM::evolution_table[current_status];
 
-  uint8 bit;
   bool end_of_run;
-  switch(s.code_number) {
-  case 0: bit = self.bg0.get_bit(end_of_run); break;
-  case 1: bit = self.bg1.get_bit(end_of_run); break;
-  case 2: bit = self.bg2.get_bit(end_of_run); break;
-  case 3: bit = self.bg3.get_bit(end_of_run); break;
-  case 4: bit = self.bg4.get_bit(end_of_run); break;
-  case 5: bit = self.bg5.get_bit(end_of_run); break;
-  case 6: bit = self.bg6.get_bit(end_of_run); break;
-  case 7: bit = self.bg7.get_bit(end_of_run); break;
-  }
+  uint8 bit = self.bg[s.code_number].get_bit(end_of_run);
 
   if(end_of_run) {
     if(bit) {
@@ -235,53 +226,50 @@ void SDD1::Decomp::OL::init(unsigned offset) {
   r0 = 0x01;
 }
 
-uint8 SDD1::Decomp::OL::decompress() {
+void SDD1::Decomp::OL::decompress(uint8* data, unsigned length) {
   switch(bitplanes_info) {
   case 0x00: case 0x40: case 0x80:
-    if(r0 == 0) {
-      r0 = ~r0;
-      return r2;
-    }
-    for(r0 = 0x80, r1 = 0, r2 = 0; r0; r0 >>= 1) {
-      if(self.cm.get_bit()) r1 |= r0;
-      if(self.cm.get_bit()) r2 |= r0;
+    while(length--) {
+      if(r0 == 0) {
+        r0 = ~r0;
+        *data++ = r2;
+        continue;
+      }
+      for(r0 = 0x80, r1 = 0, r2 = 0; r0; r0 >>= 1) {
+        if(self.cm.get_bit()) r1 |= r0;
+        if(self.cm.get_bit()) r2 |= r0;
+      }
+      *data++ = r1;
     }
-    return r1;
+    break;
   case 0xc0:
-    for(r0 = 0x01, r1 = 0; r0; r0 <<= 1) {
-      if(self.cm.get_bit()) r1 |= r0;
+    while(length--) {
+      for(r0 = 0x01, r1 = 0; r0; r0 <<= 1) {
+        if(self.cm.get_bit()) r1 |= r0;
+      }
+      *data++ = r1;
     }
-    return r1;
+    break;
   }
-
-  // NOT REACHED
-  return 0;
 }
 
 //core
 
 void SDD1::Decomp::init(unsigned offset) {
   im.init(offset);
-  bg0.init();
-  bg1.init();
-  bg2.init();
-  bg3.init();
-  bg4.init();
-  bg5.init();
-  bg6.init();
-  bg7.init();
+  for(auto& b : bg) b.init();
   pem.init();
   cm.init(offset);
   ol.init(offset);
 }
 
-uint8 SDD1::Decomp::read() {
-  return ol.decompress();
+void SDD1::Decomp::read(uint8* data, unsigned length) {
+  ol.decompress(data, length);
 }
 
 SDD1::Decomp::Decomp():
 im(*this), gcd(*this),
-bg0(*this, 0), bg1(*this, 1), bg2(*this, 2), bg3(*this, 3),
-bg4(*this, 4), bg5(*this, 5), bg6(*this, 6), bg7(*this, 7),
+bg{{*this, 0}, {*this, 1}, {*this, 2}, {*this, 3},
+   {*this, 4}, {*this, 5}, {*this, 6}, {*this, 7}},
 pem(*this), cm(*this), ol(*this) {
 }
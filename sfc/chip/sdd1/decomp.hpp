@@ -61,7 +61,7 @@ struct Decomp {
   struct OL {  //output logic
     Decomp& self;
     void init(unsigned offset);
-    uint8 decompress();
+    void decompress(uint8* data, unsigned length);
     OL(SDD1::Decomp& self) : self(self) {}
   private:
     uint8 bitplanes_info;
@@ -69,12 +69,12 @@ struct Decomp {
   };
 
   void init(unsigned offset);
-  uint8 read();
+  void read(uint8* data, unsigned length);
   Decomp();
 
   IM  im;
   GCD gcd;
-  BG  bg0, bg1, bg2, bg3, bg4, bg5, bg6, bg7;
+  BG  bg[8];
   PEM pem;
   CM  cm;
   OL  ol;
@@ -79,10 +79,10 @@ void SDD1::write(unsigned addr, uint8 data) {
   case 0x4800: sdd1_enable = data; break;
   case 0x4801: xfer_enable = data; break;
 
-  case 0x4804: mmc[0] = data << 20; break;
-  case 0x4805: mmc[1] = data << 20; break;
-  case 0x4806: mmc[2] = data << 20; break;
-  case 0x4807: mmc[3] = data << 20; break;
+  case 0x4804: mmc_write(0, data); break;
+  case 0x4805: mmc_write(1, data); break;
+  case 0x4806: mmc_write(2, data); break;
+  case 0x4807: mmc_write(3, data); break;
   }
 }
 
@@ -90,6 +90,37 @@ uint8 SDD1::mmc_read(unsigned addr) {
   return rom.read(mmc[(addr >> 20) & 3] + (addr & 0x0fffff));
 }
 
+//only HDMA can write the MMC during a transfer. the decompressor reads the ROM through the MMC,
+//so the rest of the chunk already decompressed is invalid, and is decompressed again
+void SDD1::mmc_write(unsigned n, uint8 data) {
+  unsigned bank = data << 20;
+  if(dma_ready && bank != mmc[n]) {
+    xfer_mmc_writes.append({xfer_offset, n, bank});
+    if(xfer_offset % ChunkSize) return xfer_replay();
+  }
+  mmc[n] = bank;
+}
+
+//the decompressor cannot be rewound: restart it, and run it through the transfer so far
+//with the MMC banks that were set at each point, then decompress the rest of the chunk
+void SDD1::xfer_replay() {
+  uint8 discard[ChunkSize];
+  for(unsigned n = 0; n < 4; n++) mmc[n] = xfer_mmc[n];
+  decomp.init(xfer_addr);
+
+  unsigned offset = 0;
+  for(auto& write : xfer_mmc_writes) {
+    while(offset < write.offset) {
+      unsigned length = min((unsigned)ChunkSize, write.offset - offset);
+      decomp.read(discard, length);
+      offset += length;
+    }
+    mmc[write.n] = write.bank;
+  }
+
+  decomp.read(buffer + offset % ChunkSize, min((unsigned)ChunkSize - offset % ChunkSize, xfer_size - offset));
+}
+
 //SDD1::mcu_read() is mapped to $c0-ff:0000-ffff
 //the design is meant to be as close to the hardware design as possible, thus this code
 //avoids adding S-DD1 hooks inside S-CPU::DMA emulation.
@@ -125,11 +156,21 @@ uint8 SDD1::mcurom_read(unsigned addr) {
           if(!dma_ready) {
             //prepare streaming decompression
             decomp.init(addr);
+            xfer_addr = addr;
+            xfer_size = dma[i].size ? dma[i].size : 65536;
+            xfer_offset = 0;
+            for(unsigned n = 0; n < 4; n++) xfer_mmc[n] = mmc[n];
+            xfer_mmc_writes.reset();
             dma_ready = true;
           }
 
+          //decompress a chunk at a time, so an MMC write by HDMA (see SDD1::mmc_write()) costs little
+          if(xfer_offset % ChunkSize == 0) {
+            decomp.read(buffer, min((unsigned)ChunkSize, xfer_size - xfer_offset));
+          }
+
           //fetch a decompressed byte; once finished, disable channel and invalidate buffer
-          uint8 data = decomp.read();
+          uint8 data = buffer[xfer_offset++ % ChunkSize];
           if(--dma[i].size == 0) {
             dma_ready = false;
             xfer_enable &= ~(1 << i);
@@ -12,6 +12,7 @@ struct SDD1 {
   void write(unsigned addr, uint8 data);
 
   uint8 mmc_read(unsigned addr);
+  void mmc_write(unsigned n, uint8 data);
 
   uint8 mcurom_read(unsigned addr);
   void mcurom_write(unsigned addr, uint8 data);
@@ -27,6 +28,16 @@ private:
   bool dma_ready;     //used to initialize decompression module
   unsigned mmc[4];    //memory map controller ROM indices
 
+  enum : unsigned { ChunkSize = 256 };
+  uint8 buffer[ChunkSize];  //decompressed bytes of the current chunk of the transfer
+  unsigned xfer_addr;       //source address of the transfer
+  unsigned xfer_size;       //length of the transfer
+  unsigned xfer_offset;     //next byte to be read
+  unsigned xfer_mmc[4];     //MMC banks when the transfer began
+  struct MMCWrite { unsigned offset; unsigned n; unsigned bank; };
+  vector<MMCWrite> xfer_mmc_writes;  //MMC changes made by HDMA during the transfer
+  void xfer_replay();
+
   struct {
     unsigned addr;    //$43x2-$43x4 -- DMA transfer address
     uint16 size;      //$43x5-$43x6 -- DMA transfer size
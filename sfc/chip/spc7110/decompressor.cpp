@@ -46,14 +46,23 @@ struct Decompressor {
   }
 
   void decode() {
+    switch(bpp) {
+    case 1: return decode<1>();
+    case 2: return decode<2>();
+    case 4: return decode<4>();
+    }
+  }
+
+  //specialized per color depth, so that the depth tests below fold away
+  template<unsigned depth> void decode() {
     for(unsigned pixel = 0; pixel < 8; pixel++) {
       uint64 map = colormap;
       unsigned diff = 0;
 
-      if(bpp > 1) {
-        unsigned pa = (bpp == 2 ? pixels >>  2 & 3 : pixels >>  0 & 15);
-        unsigned pb = (bpp == 2 ? pixels >> 14 & 3 : pixels >> 28 & 15);
-        unsigned pc = (bpp == 2 ? pixels >> 16 & 3 : pixels >> 32 & 15);
+      if(depth > 1) {
+        unsigned pa = (depth == 2 ? pixels >>  2 & 3 : pixels >>  0 & 15);
+        unsigned pb = (depth == 2 ? pixels >> 14 & 3 : pixels >> 28 & 15);
+        unsigned pc = (depth == 2 ? pixels >> 16 & 3 : pixels >> 32 & 15);
 
         if(pa != pb || pb != pc) {
           unsigned match = pa ^ pb ^ pc;
@@ -70,13 +79,13 @@ struct Decompressor {
         map = moveToFront(map, pa);
       }
 
-      for(unsigned plane = 0; plane < bpp; plane++) {
-        unsigned bit = bpp > 1 ? 1 << plane : 1 << (pixel & 3);
+      for(unsigned plane = 0; plane < depth; plane++) {
+        unsigned bit = depth > 1 ? 1 << plane : 1 << (pixel & 3);
         unsigned history = bit - 1 & output;
         unsigned set = 0;
 
-        if(bpp == 1) set = pixel >= 4;
-        if(bpp == 2) set = diff;
+        if(depth == 1) set = pixel >= 4;
+        if(depth == 2) set = diff;
         if(plane >= 2 && history <= 1) set = diff;
 
         auto& ctx = context[set][bit + history - 1];
@@ -108,15 +117,15 @@ struct Decompressor {
         if(symbol == LPS && model.probability > Half) ctx.swap ^= 1;
       }
 
-      unsigned index = output & (1 << bpp) - 1;
-      if(bpp == 1) index ^= pixels >> 15 & 1;
+      unsigned index = output & (1 << depth) - 1;
+      if(depth == 1) index ^= pixels >> 15 & 1;
 
-      pixels = pixels << bpp | (map >> 4 * index & 15);
+      pixels = pixels << depth | (map >> 4 * index & 15);
     }
 
-    if(bpp == 1) result = pixels;
-    if(bpp == 2) result = deinterleave(pixels, 16);
-    if(bpp == 4) result = deinterleave(deinterleave(pixels, 32), 32);
+    if(depth == 1) result = pixels;
+    if(depth == 2) result = deinterleave(pixels, 16);
+    if(depth == 4) result = deinterleave(deinterleave(pixels, 32), 32);
   }
 
   void serialize(serializer& s) {
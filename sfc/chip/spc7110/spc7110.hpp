@@ -58,7 +58,7 @@ struct SPC7110 : Coprocessor {
   void alu_multiply();
   void alu_divide();
 
-private:
+privileged:
   //==================
   //decompression unit
   //==================
@@ -27,8 +27,9 @@ void SuperFX::enter() {
       continue;
     }
 
-    (this->*opcode_table[(regs.sfr & 0x0300) + peekpipe()])();
-    if(r15_modified == false) regs.r[15]++;
+    //sequential fetches bypass r15_modify(); peekpipe() clears r15_modified before it is tested again
+    (this->*opcode_table[regs.sfr.alt2 << 9 | regs.sfr.alt1 << 8 | peekpipe()])();
+    if(r15_modified == false) regs.r[15].data++;
 
     if(++instruction_counter >= 128) {
       instruction_counter = 0;
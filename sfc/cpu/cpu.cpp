@@ -46,6 +46,14 @@ void CPU::synchronize_coprocessors() {
   }
 }
 
+//deferred chips are caught up by their own handlers when accessed, and once per scanline
+void CPU::synchronize_lockstep_coprocessors() {
+  for(unsigned i = 0; i < coprocessors.size(); i++) {
+    auto& chip = *coprocessors[i];
+    if(chip.clock < 0 && chip.deferred == false) co_switch(chip.thread);
+  }
+}
+
 void CPU::synchronize_controllers() {
   if(input.port1->clock < 0) co_switch(input.port1->thread);
   if(input.port2->clock < 0) co_switch(input.port2->thread);
@@ -67,11 +75,17 @@ void CPU::enter() {
         regs.vector = (regs.e == false ? 0xffea : 0xfffa);
         op_irq();
         debugger.op_nmi();
+        #ifdef DEBUGGER
+        gilgamesh.profileEnter();
+        #endif
       } else if(status.irq_pending) {
         status.irq_pending = false;
         regs.vector = (regs.e == false ? 0xffee : 0xfffe);
         op_irq();
         debugger.op_irq();
+        #ifdef DEBUGGER
+        gilgamesh.profileEnter();
+        #endif
       } else if(status.reset_pending) {
         status.reset_pending = false;
         add_clocks(186);
@@ -88,14 +102,21 @@ void CPU::op_step() {
   debugger.op_exec(regs.pc.d);
 #ifdef DEBUGGER
   gilgamesh.trace();
+  unsigned pc = regs.pc.d;
+  if(pc < idle.head || pc > idle.tail) idle.active = false;
 #endif
 
   (this->*opcode_table[op_readpc()])();
+
+#ifdef DEBUGGER
+  gilgamesh.profile();
+  if(regs.pc.d < pc && configuration.idle_loops) idle_detect(pc);
+#endif
 }
 
 void CPU::enable() {
-  function<uint8 (unsigned)> reader = {&CPU::mmio_read, (CPU*)&cpu};
-  function<void (unsigned, uint8)> writer = {&CPU::mmio_write, (CPU*)&cpu};
+  Bus::Reader reader = {&CPU::mmio_read, (CPU*)&cpu};
+  Bus::Writer writer = {&CPU::mmio_write, (CPU*)&cpu};
 
   bus.map(reader, writer, 0x00, 0x3f, 0x2140, 0x2183);
   bus.map(reader, writer, 0x80, 0xbf, 0x2140, 0x2183);
@@ -2,11 +2,12 @@ struct CPU : Processor::R65816, Thread, public PPUcounter {
   uint8 wram[128 * 1024];
 
   enum : bool { Threaded = true };
-  vector<Thread*> coprocessors;
+  vector<Coprocessor*> coprocessors;
   alwaysinline void step(unsigned clocks);
   alwaysinline void synchronize_smp();
   void synchronize_ppu();
   void synchronize_coprocessors();
+  void synchronize_lockstep_coprocessors();
   void synchronize_controllers();
 
   uint8 port_read(uint2 port) const;
@@ -38,6 +39,7 @@ privileged:
 
     unsigned clock_count;
     unsigned line_clocks;
+    uint64 clock_total;  //every clock passed to add_clocks(); read by the profiler and SMP::idle_skip()
 
     //timing
     bool irq_lock;
@@ -131,6 +133,13 @@ privileged:
     unsigned shift;
   } alu;
 
+  struct Idle {
+    bool active;
+    bool valid;
+    unsigned head;
+    unsigned tail;
+  } idle;
+
   static void Enter();
   void op_step();
 
@@ -0,0 +1,113 @@
+#ifdef CPU_CPP
+
+//the debugger runs the S-SMP and PPU in lockstep with the S-CPU, at the cost of a thread switch per bus cycle.
+//a short branch-back loop that only polls $4210-$4212 or WRAM cannot observe either of them,
+//so while the S-CPU spins in one (or in WAI), they are left to catch up at the next scanline or register access.
+//the loop itself still executes normally, so timing is unchanged.
+//the S-CPU is never fast-forwarded: every tick of a polling loop can raise an IRQ, NMI, HDMA or
+//auto joypad event, and HDMA can rewrite polled WRAM. without the lockstep there is nothing to relax,
+//so builds without the debugger do not use this at all.
+
+//called after a backward transfer from tail to regs.pc
+void CPU::idle_detect(unsigned tail) {
+  unsigned head = regs.pc.d;
+  if(head != idle.head || tail != idle.tail) {
+    idle.head = head;
+    idle.tail = tail;
+    idle.valid = idle_scan(head, tail);
+  }
+  idle.active = idle.valid;
+}
+
+bool CPU::idle_scan(unsigned head, unsigned tail) {
+  if((head >> 16) != (tail >> 16) || tail - head > 16) return false;
+
+  unsigned addr = head;
+  while(addr <= tail) {
+    unsigned opcode = idle_peek(addr);
+    unsigned length = 0;
+    enum : unsigned { None, Direct, Absolute, Long } mode = None;
+    bool wide = !regs.p.m;
+
+    switch(opcode) {
+    case 0xea:  //nop
+      length = 1;
+      break;
+    case 0x10: case 0x30: case 0x50: case 0x70:  //bpl,bmi,bvc,bvs
+    case 0x80: case 0x90: case 0xb0: case 0xd0: case 0xf0:  //bra,bcc,bcs,bne,beq
+      length = 2;
+      break;
+    case 0x29: case 0x89: case 0xa9: case 0xc9:  //and,bit,lda,cmp #const
+      length = regs.p.m ? 2 : 3;
+      break;
+    case 0xa0: case 0xa2: case 0xc0: case 0xe0:  //ldy,ldx,cpy,cpx #const
+      length = regs.p.x ? 2 : 3;
+      break;
+    case 0x24: case 0x25: case 0xa5: case 0xc5:  //bit,and,lda,cmp dp
+      length = 2, mode = Direct;
+      break;
+    case 0xa4: case 0xa6: case 0xc4: case 0xe4:  //ldy,ldx,cpy,cpx dp
+      length = 2, mode = Direct, wide = !regs.p.x;
+      break;
+    case 0x2c: case 0x2d: case 0xad: case 0xcd:  //bit,and,lda,cmp addr
+      length = 3, mode = Absolute;
+      break;
+    case 0xac: case 0xae: case 0xcc: case 0xec:  //ldy,ldx,cpy,cpx addr
+      length = 3, mode = Absolute, wide = !regs.p.x;
+      break;
+    case 0x2f: case 0xaf: case 0xcf:  //and,lda,cmp long
+      length = 4, mode = Long;
+      break;
+    default:
+      return false;
+    }
+
+    uint8 operand[3] = {0, 0, 0};
+    for(unsigned n = 1; n < length; n++) {
+      unsigned data = idle_peek(addr + n);
+      if(data > 0xff) return false;
+      operand[n - 1] = data;
+    }
+
+    unsigned target = operand[2] << 16 | operand[1] << 8 | operand[0];
+    switch(mode) {
+    case None: break;
+    case Direct:
+      //the whole direct page must sit in the WRAM mirror
+      if(regs.d + 0x100 > 0x2000) return false;
+      break;
+    case Absolute:
+      target |= regs.db << 16;
+      //fallthrough
+    case Long:
+      if(!idle_readable(target)) return false;
+      if(wide && !idle_readable(target + 1)) return false;
+      break;
+    }
+
+    //the loop must end on the branch that closed it
+    if(addr == tail) return (opcode & 0x1f) == 0x10 || opcode == 0x80;
+    addr += length;
+  }
+
+  return false;
+}
+
+//only the S-CPU and its DMA can change these
+bool CPU::idle_readable(unsigned addr) {
+  uint8 bank = addr >> 16;
+  addr &= 0xffff;
+  if(bank == 0x7e || bank == 0x7f) return true;
+  if(bank & 0x40) return false;
+  return addr < 0x2000 || (addr >= 0x4210 && addr <= 0x4212);
+}
+
+//reads program code without bus side effects; returns ~0 outside of ROM and RAM
+unsigned CPU::idle_peek(unsigned addr) {
+  addr &= 0xffffff;
+  uint8* memory = bus.direct[bus.lookup[addr]];
+  if(memory == nullptr) return ~0;
+  return memory[bus.target[addr]];
+}
+
+#endif
@@ -2,6 +2,7 @@
 
 #include "irq.cpp"
 #include "joypad.cpp"
+#include "idle.cpp"
 
 unsigned CPU::dma_counter() {
   return (status.dma_counter + hcounter()) & 7;
@@ -17,6 +18,7 @@ again:
   }
 
   step(clocks);
+  status.clock_total += clocks;
 
   status.auto_joypad_clock += clocks;
   if(status.auto_joypad_clock >= 256) {
@@ -31,9 +33,15 @@ again:
   }
 
   #if defined(DEBUGGER)
-  synchronize_smp();
-  synchronize_ppu();
-  synchronize_coprocessors();
+  if(idle.active == false && (regs.wai == false || configuration.idle_loops == false)) {
+    synchronize_smp();
+    #if defined(PROFILE_ACCURACY)
+    if(configuration.batched_ppu == false) synchronize_ppu();
+    #else
+    synchronize_ppu();
+    #endif
+  }
+  synchronize_lockstep_coprocessors();
   #endif
 }
 
@@ -160,6 +168,7 @@ void CPU::last_cycle() {
 }
 
 void CPU::timing_power() {
+  status.clock_total = 0;
 }
 
 void CPU::timing_reset() {
@@ -202,6 +211,11 @@ void CPU::timing_reset() {
   status.auto_joypad_latch   = false;
   status.auto_joypad_counter = 0;
   status.auto_joypad_clock   = 0;
+
+  idle.active = false;
+  idle.valid  = false;
+  idle.head   = ~0;
+  idle.tail   = ~0;
 }
 
 #endif
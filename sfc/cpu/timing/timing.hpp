@@ -22,3 +22,9 @@ alwaysinline bool irq_test();
 
 //joypad.cpp
 void step_auto_joypad_poll();
+
+//idle.cpp
+void idle_detect(unsigned tail);
+bool idle_scan(unsigned head, unsigned tail);
+bool idle_readable(unsigned addr);
+unsigned idle_peek(unsigned addr);
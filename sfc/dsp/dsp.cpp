@@ -1,4 +1,9 @@
 #include <sfc/sfc.hpp>
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  #define DSP_GAUSSIAN_AVX2
+  #include <cpuid.h>
+  #include <immintrin.h>
+#endif
 
 #define DSP_CPP
 namespace SuperFamicom {
@@ -39,6 +44,8 @@ void DSP::enter() {
       scheduler.exit(Scheduler::ExitReason::SynchronizeEvent);
     }
 
+    gaussian_run();
+
     voice_5(voice[0]);
     voice_2(voice[1]);
     tick();
@@ -258,8 +265,13 @@ void DSP::power() {
   state.t_main_out[0] = state.t_main_out[1] = 0;
   state.t_echo_out[0] = state.t_echo_out[1] = 0;
   state.t_echo_in[0] = state.t_echo_in[1] = 0;
+  for(unsigned i = 0; i < echo_hist_size; i++) {
+    state.echo_hist[0].write(i, 0);
+    state.echo_hist[1].write(i, 0);
+  }
 
   for(unsigned i = 0; i < 8; i++) {
+    for(unsigned n = 0; n < brr_buf_size; n++) voice[i].buffer.write(n, 0);
     voice[i].buf_pos = 0;
     voice[i].interp_pos = 0;
     voice[i].brr_addr = 0;
@@ -270,6 +282,7 @@ void DSP::power() {
     voice[i].env_mode = env_release;
     voice[i].env = 0;
     voice[i].t_envx_out = 0;
+    voice[i].t_interp_out = 0;
     voice[i].hidden_env = 0;
   }
 }
@@ -296,6 +309,8 @@ DSP::DSP() {
   //-0x8000 <= n <= +0x7fff
   assert(sclamp<16>(+0x8000) == +0x7fff);
   assert(sclamp<16>(-0x8001) == -0x8000);
+
+  gaussian_init();
 }
 
 DSP::~DSP() {
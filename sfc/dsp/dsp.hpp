@@ -4,6 +4,7 @@ struct DSP : Thread {
   alwaysinline void synchronize_smp();
 
   bool mute();
+  bool echo_reaches(uint16 addr, unsigned size) const;
   uint8 read(uint8 addr);
   void write(uint8 addr, uint8 data);
 
@@ -111,12 +112,17 @@ privileged:
     int env_mode;
     int env;         //current envelope level
     int t_envx_out;
+    int t_interp_out;  //gaussian interpolation result for the current sample
     int hidden_env;  //used by GAIN mode 7, very obscure quirk
   } voice[8];
 
   //gaussian
   static const int16 gaussian_table[512];
-  int gaussian_interpolate(const voice_t& v);
+  static int32 gaussian_taps[256][4];  //gaussian_table reordered per offset for SIMD use
+  static bool gaussian_simd;  //AVX2 kernel in use; selected at runtime
+  static void gaussian_init();
+  int gaussian_interpolate(unsigned offset, const int* buffer);
+  void gaussian_run();
 
   //counter
   enum { counter_range = 2048 * 5 * 3 };  //30720 (0x7800)
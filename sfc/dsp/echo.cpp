@@ -109,6 +109,19 @@ void DSP::echo_27() {
   audio.sample(outl, outr);
 }
 
+//true if echo writes could land in [addr, addr + size) before the registers are written again:
+//the latched and the written ESA/EDL/FLG both take part until the latches catch up
+bool DSP::echo_reaches(uint16 addr, unsigned size) const {
+  if(state.t_echo_disabled & REG(flg) & 0x20) return false;
+
+  unsigned length = max(4u, max((unsigned)state.echo_length, (REG(edl) & 0x0fu) << 11));
+  for(unsigned esa : {(unsigned)state.t_esa, (unsigned)REG(esa)}) {
+    uint16 base = esa << 8;
+    if((uint16)(addr - base) < length || (uint16)(base - addr) < size) return true;
+  }
+  return false;
+}
+
 void DSP::echo_28() {
   state.t_echo_disabled = REG(flg);
 }
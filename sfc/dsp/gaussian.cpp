@@ -35,20 +35,121 @@ const int16 DSP::gaussian_table[512] = {
   1299, 1300, 1300, 1301, 1302, 1302, 1303, 1303, 1303, 1304, 1304, 1304, 1304, 1304, 1305, 1305,
 };
 
-int DSP::gaussian_interpolate(const voice_t& v) {
+int DSP::gaussian_interpolate(unsigned offset, const int* buffer) {
   //make pointers into gaussian table based on fractional position between samples
-  int offset = (v.interp_pos >> 4) & 0xff;
   const int16* fwd = gaussian_table + 255 - offset;
   const int16* rev = gaussian_table       + offset;  //mirror left half of gaussian table
 
-  offset = v.buf_pos + (v.interp_pos >> 12);
   int output;
-  output  = (fwd[  0] * v.buffer[offset + 0]) >> 11;
-  output += (fwd[256] * v.buffer[offset + 1]) >> 11;
-  output += (rev[256] * v.buffer[offset + 2]) >> 11;
+  output  = (fwd[  0] * buffer[0]) >> 11;
+  output += (fwd[256] * buffer[1]) >> 11;
+  output += (rev[256] * buffer[2]) >> 11;
   output  = (int16)output;
-  output += (rev[  0] * v.buffer[offset + 3]) >> 11;
+  output += (rev[  0] * buffer[3]) >> 11;
   return sclamp<16>(output) & ~1;
 }
 
+#if defined(DSP_GAUSSIAN_AVX2)
+static bool gaussian_avx2() {
+  unsigned a, b, c, d;
+  if(__get_cpuid_max(0, nullptr) < 7) return false;
+  __cpuid(1, a, b, c, d);
+  if((c & 1 << 27) == 0 || (c & 1 << 28) == 0) return false;  //OSXSAVE, AVX
+  unsigned xcr0, xcr0h;
+  __asm__ volatile("xgetbv" : "=a"(xcr0), "=d"(xcr0h) : "c"(0));
+  if((xcr0 & 6) != 6) return false;  //OS preserves YMM state
+  __cpuid_count(7, 0, a, b, c, d);
+  return b & 1 << 5;
+}
+
+__attribute__((target("avx2")))
+static void gaussian_run_avx2(const int32 (*taps)[4], const unsigned* offset, const int* const* buffer, int* result) {
+  //each 128-bit half holds the four taps of one voice
+  __m256i tap[4];
+  for(unsigned n = 0; n < 8; n += 2) {
+    __m256i coeff = _mm256_inserti128_si256(
+      _mm256_castsi128_si256(_mm_load_si128((const __m128i*)taps[offset[n + 0]])),
+      _mm_load_si128((const __m128i*)taps[offset[n + 1]]), 1
+    );
+    __m256i sample = _mm256_inserti128_si256(
+      _mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)buffer[n + 0])),
+      _mm_loadu_si128((const __m128i*)buffer[n + 1]), 1
+    );
+    tap[n >> 1] = _mm256_srai_epi32(_mm256_mullo_epi32(coeff, sample), 11);
+  }
+
+  //transpose so that each vector holds one tap of every voice:
+  //lanes are ordered as voices 0, 2, 4, 6, 1, 3, 5, 7
+  __m256i t0 = _mm256_unpacklo_epi32(tap[0], tap[1]);
+  __m256i t1 = _mm256_unpackhi_epi32(tap[0], tap[1]);
+  __m256i t2 = _mm256_unpacklo_epi32(tap[2], tap[3]);
+  __m256i t3 = _mm256_unpackhi_epi32(tap[2], tap[3]);
+  __m256i tap0 = _mm256_unpacklo_epi64(t0, t2);
+  __m256i tap1 = _mm256_unpackhi_epi64(t0, t2);
+  __m256i tap2 = _mm256_unpacklo_epi64(t1, t3);
+  __m256i tap3 = _mm256_unpackhi_epi64(t1, t3);
+
+  __m256i output = _mm256_add_epi32(_mm256_add_epi32(tap0, tap1), tap2);
+  output = _mm256_srai_epi32(_mm256_slli_epi32(output, 16), 16);
+  output = _mm256_add_epi32(output, tap3);
+  output = _mm256_min_epi32(output, _mm256_set1_epi32(+32767));
+  output = _mm256_max_epi32(output, _mm256_set1_epi32(-32768));
+  output = _mm256_and_si256(output, _mm256_set1_epi32(~1));
+
+  //restore voice order
+  output = _mm256_permutevar8x32_epi32(output, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+  _mm256_storeu_si256((__m256i*)result, output);
+}
+#endif
+
+//nothing can modify the interpolation inputs of a voice between the start of a
+//sample and that voice's voice_3c() step, so all eight voices are interpolated
+//together, once per sample, and voice_3c() picks up the precomputed result
+void DSP::gaussian_run() {
+  unsigned offset[8];
+  const int* buffer[8];
+
+  for(unsigned n = 0; n < 8; n++) {
+    const voice_t& v = voice[n];
+    int buf_pos = v.buf_pos;
+    int interp_pos = v.interp_pos;
+
+    //KON setup performed by voice_3c() before it interpolates
+    if(v.kon_delay) {
+      if(v.kon_delay == 5) buf_pos = 0;
+      interp_pos = (v.kon_delay - 1) & 3 ? 0x4000 : 0;
+    }
+
+    offset[n] = (interp_pos >> 4) & 0xff;
+    buffer[n] = v.buffer.data(buf_pos + (interp_pos >> 12));
+  }
+
+  #if defined(DSP_GAUSSIAN_AVX2)
+  if(gaussian_simd) {
+    int output[8];
+    gaussian_run_avx2(gaussian_taps, offset, buffer, output);
+    for(unsigned n = 0; n < 8; n++) voice[n].t_interp_out = output[n];
+    return;
+  }
+  #endif
+
+  for(unsigned n = 0; n < 8; n++) voice[n].t_interp_out = gaussian_interpolate(offset[n], buffer[n]);
+}
+
+alignas(16) int32 DSP::gaussian_taps[256][4];
+bool DSP::gaussian_simd = false;
+
+void DSP::gaussian_init() {
+  for(unsigned offset = 0; offset < 256; offset++) {
+    gaussian_taps[offset][0] = gaussian_table[255 - offset];
+    gaussian_taps[offset][1] = gaussian_table[511 - offset];
+    gaussian_taps[offset][2] = gaussian_table[256 + offset];
+    gaussian_taps[offset][3] = gaussian_table[  0 + offset];
+  }
+
+  #if defined(DSP_GAUSSIAN_AVX2)
+  gaussian_simd = gaussian_avx2();
+  #endif
+}
+
 #endif
@@ -7,6 +7,10 @@ template<typename T, unsigned size> struct moduloarray {
     return buffer[size + index];
   }
 
+  inline const T* data(int index) const {
+    return buffer + size + index;
+  }
+
   inline void write(unsigned index, const T value) {
     buffer[index] =
     buffer[index + size] =
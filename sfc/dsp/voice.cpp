@@ -78,8 +78,8 @@ void DSP::voice_3c(voice_t& v) {
     state.t_pitch = 0;
   }
 
-  //gaussian interpolation
-  int output = gaussian_interpolate(v);
+  //gaussian interpolation (computed by gaussian_run() at the start of the sample)
+  int output = v.t_interp_out;
 
   //noise
   if(state.t_non & v.vbit) {
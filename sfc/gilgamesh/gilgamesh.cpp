@@ -142,6 +142,7 @@ void Gilgamesh::trace() {
     instructions[i->pc.d] = i;
     traceVectors();  // Check if we have encounterd a interrupt handler.
   }
+  current = i;
 
   i->decodeRef();  // Get the instruction's references.
 
@@ -169,8 +170,114 @@ void Gilgamesh::traceVectors() {
     }
 }
 
+// Charge the clocks spent since the last instruction to it and to the current subroutine:
+void Gilgamesh::profile() {
+  // clock_total restarts from zero when the S-CPU is reset:
+  if (cpu.status.clock_total < profileClock) profileClock = 0;
+  uint64 clocks = cpu.status.clock_total - profileClock;
+  profileClock = cpu.status.clock_total;
+  if (!configuration.profiler) return;
+
+  auto pc = current->pc;
+  auto& bank = profileBanks[pc.b];
+  if (!bank) bank = new ProfileBank();
+  bank->cycles[pc.w] += clocks;
+  bank->count[pc.w]++;
+  frameCycles[pc.d] += clocks;
+
+  if (profileNodes.empty()) profileNodes.push_back({0, 0, 0});
+  profileNodes[profileStack.empty() ? 0 : profileStack.back().node].cycles += clocks;
+
+  // Leave the subroutines whose return address has been pulled off the stack:
+  while (!profileStack.empty() && profileStack.back().tag <= cpu.regs.s.w)
+    profileStack.pop_back();
+
+  if (current->isCall()) profileEnter();
+}
+
+// Enter the subroutine (or interrupt handler) at PC, whose return address was just pushed:
+void Gilgamesh::profileEnter() {
+  if (!configuration.profiler) return;
+  if (profileNodes.empty()) profileNodes.push_back({0, 0, 0});
+
+  unsigned parent = profileStack.empty() ? 0 : profileStack.back().node;
+  uint64 key = (uint64)parent << 24 | cpu.regs.pc.d;
+
+  unsigned node;
+  auto search = profileChildren.find(key);
+  if (search != profileChildren.end()) {
+    node = search->second;
+  } else {
+    node = profileNodes.size();
+    profileNodes.push_back({parent, cpu.regs.pc.d, 0});
+    profileChildren[key] = node;
+  }
+  profileStack.push_back({cpu.regs.s.w + 1u, node});
+}
+
+// Keep the hottest instructions of the frame that just ended:
+void Gilgamesh::profileFrame() {
+  if (!configuration.profiler || frameCycles.empty()) return;
+
+  std::vector<std::pair<unsigned, uint64>> top(frameCycles.begin(), frameCycles.end());
+  unsigned n = min((unsigned)Hotspots, (unsigned)top.size());
+  std::partial_sort(top.begin(), top.begin() + n, top.end(),
+    [](const std::pair<unsigned, uint64>& a, const std::pair<unsigned, uint64>& b) { return a.second > b.second; });
+
+  for (unsigned rank = 0; rank < n; rank++)
+    hotspots.push_back({frame, rank, top[rank].first, top[rank].second});
+  frameCycles.clear();
+  frame++;
+
+  if (hotspots.size() >= Hotspots * HotspotFrames) {
+    sql("BEGIN TRANSACTION");
+    profileFlush();
+    sql("COMMIT TRANSACTION");
+  }
+}
+
+// Write the hotspots kept so far and forget them:
+void Gilgamesh::profileFlush() {
+  for (auto& h: hotspots)
+    sql("INSERT INTO glg_hotspots VALUES(%u, %u, %u, %llu)",
+        h.frame, h.rank, h.pc, (unsigned long long)h.cycles);
+  hotspots.clear();
+}
+
+// Drop all profile data, so that a newly loaded game starts from nothing:
+void Gilgamesh::profileReset() {
+  for (auto& bank: profileBanks) {
+    delete bank;
+    bank = nullptr;
+  }
+  profileClock = 0;
+  profileNodes.clear();
+  profileChildren.clear();
+  profileStack.clear();
+  frameCycles.clear();
+  hotspots.clear();
+  frame = 0;
+}
+
+// Write the call tree in the folded stack format of flamegraph.pl:
+void Gilgamesh::writeFolded(const string& filename) {
+  if (profileNodes.empty()) return;
+
+  string output;
+  for (unsigned n = 0; n < profileNodes.size(); n++) {
+    if (profileNodes[n].cycles == 0) continue;
+
+    string stack;
+    for (unsigned p = n; p; p = profileNodes[p].parent)
+      stack = {";$", hex<6>(profileNodes[p].entry), stack};
+    output.append("reset", stack, " ", profileNodes[n].cycles, "\n");
+  }
+  file::write(filename, output);
+}
+
 void Gilgamesh::createDatabase(sqlite3* db) {
   this->db = db;
+  profileReset();
 
   sql(
     "CREATE TABLE glg_instructions(pc       INTEGER NOT NULL,"
@@ -193,6 +300,19 @@ void Gilgamesh::createDatabase(sqlite3* db) {
     "CREATE TABLE glg_vectors(vector INTEGER NOT NULL,"
                              "pc     INTEGER NOT NULL,"
                              "PRIMARY KEY (vector));"
+
+    "CREATE TABLE glg_profile(pc         INTEGER NOT NULL,"
+                             "executions INTEGER NOT NULL,"
+                             "cycles     INTEGER NOT NULL,"
+                             "PRIMARY KEY (pc),"
+                             "FOREIGN KEY (pc) REFERENCES glg_instructions(pc));"
+
+    "CREATE TABLE glg_hotspots(frame  INTEGER NOT NULL,"
+                              "rank   INTEGER NOT NULL,"
+                              "pc     INTEGER NOT NULL,"
+                              "cycles INTEGER NOT NULL,"
+                              "PRIMARY KEY (frame, rank),"
+                              "FOREIGN KEY (pc) REFERENCES glg_instructions(pc));"
   );
 }
 
@@ -212,6 +332,16 @@ void Gilgamesh::writeDatabase() {
   for (auto v: vectors)
     sql("INSERT INTO glg_vectors VALUES(%u, %u)", v.first, v.second);
 
+  for (unsigned b = 0; b < 256; b++) {
+    auto bank = profileBanks[b];
+    if (!bank) continue;
+    for (unsigned w = 0; w < 65536; w++)
+      if (bank->count[w])
+        sql("INSERT INTO glg_profile VALUES(%u, %u, %llu)",
+            b << 16 | w, bank->count[w], (unsigned long long)bank->cycles[w]);
+  }
+  profileFlush();
+
   sql("COMMIT TRANSACTION");
 }
 
@@ -177,12 +177,55 @@ struct Gilgamesh {
   void trace();
   void traceVectors();
 
+  // Cycle profiler (enabled by configuration.profiler):
+  void profile();
+  void profileEnter();
+  void profileFrame();
+  void profileFlush();
+  void profileReset();
+  void writeFolded(const string& filename);
+
   std::unordered_map<unsigned, Instruction*> instructions;
   std::unordered_map<unsigned, unsigned>     vectors;
   std::unordered_set<Reference, hash_ref>    references;
   std::unordered_map<unsigned, unsigned>     stackTags;
 
+  Instruction* current;  // Instruction being executed.
   sqlite3* db;
+
+  // Clocks and executions per PC, allocated a bank at a time:
+  struct ProfileBank {
+    uint64 cycles[65536];
+    uint32 count[65536];
+  };
+  ProfileBank* profileBanks[256] = {};
+  uint64 profileClock = 0;
+
+  // Call tree; node 0 is the code outside of any subroutine:
+  struct ProfileNode {
+    unsigned parent;
+    unsigned entry;
+    uint64   cycles;
+  };
+  struct ProfileCall {
+    unsigned tag;   // Stack address of the return address, as in stackTags.
+    unsigned node;
+  };
+  std::vector<ProfileNode>               profileNodes;
+  std::unordered_map<uint64, unsigned>   profileChildren;  // parent << 24 | entry -> node
+  std::vector<ProfileCall>               profileStack;
+
+  // Hottest instructions of each frame, written to the database every HotspotFrames frames:
+  enum : unsigned { Hotspots = 8, HotspotFrames = 600 };
+  struct Hotspot {
+    unsigned frame;
+    unsigned rank;
+    unsigned pc;
+    uint64   cycles;
+  };
+  std::unordered_map<unsigned, uint64> frameCycles;
+  std::vector<Hotspot>                 hotspots;
+  unsigned frame = 0;
 };
 
 extern Gilgamesh gilgamesh;
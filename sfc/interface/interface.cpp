@@ -357,6 +357,8 @@ bool Interface::tracerEnable(bool trace) {
   } else {
     gilgamesh.writeDatabase();
     sqlite3_close(db);
+    gilgamesh.writeFolded({path(group(ID::ROM)), "gilgamesh.folded"});
+    gilgamesh.profileReset();
   }
 
   return trace;
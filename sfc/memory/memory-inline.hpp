@@ -19,11 +19,12 @@ StaticRAM::~StaticRAM() { delete[] data_; }
 
 void MappedRAM::reset() {
   if(data_) {
-    delete[] data_;
+    if(!shared_) delete[] data_;
     data_ = nullptr;
   }
   size_ = 0;
   write_protect_ = false;
+  shared_ = false;
 }
 
 void MappedRAM::map(uint8* source, unsigned length) {
@@ -33,7 +34,8 @@ void MappedRAM::map(uint8* source, unsigned length) {
 }
 
 void MappedRAM::copy(const stream& memory) {
-  if(data_) delete[] data_;
+  if(data_ && !shared_) delete[] data_;
+  shared_ = false;
   //round size up to multiple of 256-bytes
   size_ = (memory.size() & ~255) + ((bool)(memory.size() & 255) << 8);
   data_ = new uint8[size_]();
@@ -41,17 +43,35 @@ void MappedRAM::copy(const stream& memory) {
 }
 
 void MappedRAM::read(const stream& memory) {
+  //read-only memory that outlives the stream (a mapped ROM file) is used in place rather than copied
+  if(memory.persistent() && !memory.writable() && memory.size() >= size_ && size_) {
+    if(data_ && !shared_) delete[] data_;
+    data_ = memory.data();
+    write_protect_ = shared_ = true;
+    return;
+  }
   memory.read(data_, min(memory.size(), size_));
 }
 
-void MappedRAM::write_protect(bool status) { write_protect_ = status; }
+void MappedRAM::write_protect(bool status) {
+  //memory used in place cannot be written to: take a private copy first
+  if(status == false && shared_) {
+    uint8* copy = new uint8[size_];
+    memcpy(copy, data_, size_);
+    data_ = copy;
+    shared_ = false;
+  }
+  write_protect_ = status;
+}
+
+bool MappedRAM::write_protected() const { return write_protect_; }
 uint8* MappedRAM::data() { return data_; }
 unsigned MappedRAM::size() const { return size_; }
 
 uint8 MappedRAM::read(unsigned addr) { return data_[addr]; }
 void MappedRAM::write(unsigned addr, uint8 n) { if(!write_protect_) data_[addr] = n; }
 const uint8& MappedRAM::operator[](unsigned addr) const { return data_[addr]; }
-MappedRAM::MappedRAM() : data_(nullptr), size_(0), write_protect_(false) {}
+MappedRAM::MappedRAM() : data_(nullptr), size_(0), write_protect_(false), shared_(false) {}
 
 //Bus
 
@@ -7,8 +7,8 @@ namespace SuperFamicom {
 Bus bus;
 
 void Bus::map(
-  const function<uint8 (unsigned)>& reader,
-  const function<void (unsigned, uint8)>& writer,
+  const Reader& reader,
+  const Writer& writer,
   unsigned banklo, unsigned bankhi,
   unsigned addrlo, unsigned addrhi,
   unsigned size, unsigned base, unsigned mask,
@@ -56,6 +56,7 @@ void Bus::map(
   unsigned id = idcount++;
   this->reader[id] = reader;
   this->writer[id] = writer;
+  this->direct[id] = fastmode != Cartridge::Mapping::fastmode_slow ? fastptr : nullptr;
 
   if (!(mask & (addrlo^addrhi)) && size%(addrhi+1-addrlo)==0) {
     //fastpath for common cases
@@ -83,8 +84,8 @@ void Bus::map(
 }
 
 void Bus::map_reset() {
-  function<uint8 (unsigned)> reader = [](unsigned) { return cpu.regs.mdr; };
-  function<void (unsigned, uint8)> writer = [](unsigned, uint8) {};
+  Reader reader = [](unsigned) { return cpu.regs.mdr; };
+  Writer writer = [](unsigned, uint8) {};
 
 #ifdef __LIBRETRO__
   libretro_mem_map.reset();
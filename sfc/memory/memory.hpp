@@ -33,6 +33,7 @@ struct MappedRAM : Memory {
   inline void read(const stream& memory);
 
   inline void write_protect(bool status);
+  inline bool write_protected() const;
   inline uint8* data();
   inline unsigned size() const;
 
@@ -45,9 +46,50 @@ private:
   uint8* data_;
   unsigned size_;
   bool write_protect_;
+  bool shared_;  //data_ is borrowed read-only memory
+};
+
+//bus handler: a static thunk plus the object it is bound to. unlike nall::function,
+//binding does not allocate, and invoking it is a single indirect call into the thunk,
+//which calls the member function (or the inlined body of a captureless lambda).
+template<typename T> struct Handler;
+
+template<typename R, typename... P> struct Handler<R (P...)> {
+  alwaysinline R operator()(P... p) const { return thunk(*this, std::forward<P>(p)...); }
+  explicit operator bool() const { return thunk; }
+
+  Handler() : thunk(nullptr), object(nullptr) {}
+
+  template<typename C> Handler(R (C::*function)(P...), C* object) : thunk(&member<C>), object(object) {
+    static_assert(sizeof(function) <= sizeof(storage), "member function pointer too large");
+    memcpy(storage, &function, sizeof(function));
+  }
+
+  template<typename L, typename = typename std::enable_if<std::is_empty<L>::value>::type>
+  Handler(const L& function) : thunk(&lambda<L>), object(nullptr) {
+    new(storage) L(function);
+  }
+
+private:
+  R (*thunk)(const Handler&, P...);
+  void* object;
+  uintptr_t storage[3];
+
+  template<typename C> static R member(const Handler& self, P... p) {
+    R (C::*function)(P...);
+    memcpy(&function, self.storage, sizeof(function));
+    return (((C*)self.object)->*function)(std::forward<P>(p)...);
+  }
+
+  template<typename L> static R lambda(const Handler& self, P... p) {
+    return (*(const L*)self.storage)(std::forward<P>(p)...);
+  }
 };
 
 struct Bus {
+  typedef Handler<uint8 (unsigned)> Reader;
+  typedef Handler<void (unsigned, uint8)> Writer;
+
   alwaysinline static unsigned mirror(unsigned addr, unsigned size);
   alwaysinline static unsigned reduce(unsigned addr, unsigned mask);
 
@@ -55,8 +97,9 @@ struct Bus {
   alwaysinline void write(unsigned addr, uint8 data);
 
   unsigned idcount;
-  function<uint8 (unsigned)> reader[256];
-  function<void (unsigned, uint8)> writer[256];
+  Reader reader[256];
+  Writer writer[256];
+  uint8* direct[256];  //backing memory of plain ROM/RAM mappings, for reads without side effects
 
   static const uint32 fast_page_size_bits = 13;//keep at 13 or lower so the RAM mirrors can be on the fast path
   static const uint32 fast_page_size = (1 << fast_page_size_bits);
@@ -65,8 +108,8 @@ struct Bus {
   uint8* fast_write[0x1000000>>fast_page_size_bits];
 
   void map(
-    const function<uint8 (unsigned)>& reader,
-    const function<void (unsigned, uint8)>& writer,
+    const Reader& reader,
+    const Writer& writer,
     unsigned banklo, unsigned bankhi,
     unsigned addrlo, unsigned addrhi,
     unsigned size = 0, unsigned base = 0, unsigned mask = 0,
@@ -40,23 +40,16 @@ void PPU::enter() {
     bg4.begin();
 
     if(vcounter() <= 239) {
-      for(signed pixel = -7; pixel <= 255; pixel++) {
-        bg1.run(1);
-        bg2.run(1);
-        bg3.run(1);
-        bg4.run(1);
-        add_clocks(2);
-
-        bg1.run(0);
-        bg2.run(0);
-        bg3.run(0);
-        bg4.run(0);
-        if(pixel >= 0) {
-          sprite.run();
-          window.run();
-          screen.run();
+      for(signed pixel = -7; pixel <= 255;) {
+        //the S-CPU cannot access the PPU until this tile has been rendered:
+        //run all eight dots back-to-back, and account for their time at once
+        if(configuration.batched_ppu && pixel <= 248 && clock + 32 < 0) {
+          for(unsigned n = 0; n < 8; n++) run_pixel<false>(pixel++);
+          add_clocks(32);
+          continue;
         }
-        add_clocks(2);
+
+        run_pixel<true>(pixel++);
       }
 
       add_clocks(14);
@@ -69,7 +62,34 @@ void PPU::enter() {
   }
 }
 
+template<bool Synchronize>
+void PPU::run_pixel(signed pixel) {
+  bg1.run(1);
+  bg2.run(1);
+  bg3.run(1);
+  bg4.run(1);
+  if(Synchronize) add_clocks(2);
+
+  bg1.run(0);
+  bg2.run(0);
+  bg3.run(0);
+  bg4.run(0);
+  if(pixel >= 0) {
+    sprite.run();
+    window.run();
+    screen.run();
+  }
+  if(Synchronize) add_clocks(2);
+}
+
 void PPU::add_clocks(unsigned clocks) {
+  if(configuration.batched_ppu && clock + clocks < 0) {
+    //span ends before the S-CPU: no synchronization point can occur within it
+    tick(clocks);
+    step(clocks);
+    return;
+  }
+
   clocks >>= 1;
   while(clocks--) {
     tick(2);
@@ -79,8 +99,8 @@ void PPU::add_clocks(unsigned clocks) {
 }
 
 void PPU::enable() {
-  function<uint8 (unsigned)> reader = {&PPU::mmio_read, (PPU*)&ppu};
-  function<void (unsigned, uint8)> writer = {&PPU::mmio_write, (PPU*)&ppu};
+  Bus::Reader reader = {&PPU::mmio_read, (PPU*)&ppu};
+  Bus::Writer writer = {&PPU::mmio_write, (PPU*)&ppu};
 
   bus.map(reader, writer, 0x00, 0x3f, 0x2100, 0x213f);
   bus.map(reader, writer, 0x80, 0xbf, 0x2100, 0x213f);
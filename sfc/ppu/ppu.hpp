@@ -48,6 +48,7 @@ privileged:
   Screen screen;
 
   static void Enter();
+  template<bool Synchronize> alwaysinline void run_pixel(signed pixel);
   void add_clocks(unsigned);
 
   void scanline();
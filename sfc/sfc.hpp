@@ -52,6 +52,8 @@ namespace SuperFamicom {
     }
   };
 
+  struct Coprocessor;
+
   #include <sfc/memory/memory.hpp>
   #include <sfc/ppu/counter/counter.hpp>
 
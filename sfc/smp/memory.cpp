@@ -184,7 +184,11 @@ uint8 SMP::op_read(uint16 addr) {
   debugger.op_read(addr);
 
   add_clocks(12);
-  uint8 r = op_busread(addr);
+  //opcode and operand fetches nearly always land in plain RAM: skip MMIO decoding there.
+  //there is no pre-decoded instruction cache: every fetch here is a timed bus cycle that ticks
+  //the timers and the S-DSP, so a cache could only save this one array index. it could not be
+  //invalidated through ram_write() alone either, as S-DSP echo writes store to apuram directly.
+  uint8 r = (addr & 0xfff0) != 0x00f0 && addr < 0xffc0 && !status.ram_disable ? apuram[addr] : op_busread(addr);
   add_clocks(12);
   cycle_edge();
   return r;
@@ -204,4 +208,125 @@ uint8 SMP::disassembler_read(uint16 addr) {
   return apuram[addr];
 }
 
+//the $00f0-$00ff registers the instruction at regs.pc can access (bit n for $00fn), decoded without side effects.
+//any address that cannot be known in advance (operands or pointers read from the registers themselves) counts as all of them
+unsigned SMP::io_access() {
+  unsigned mask = 0;
+  auto peek = [&](uint16 addr) -> uint8 {
+    if((addr & 0xfff0) == 0x00f0) { mask = 0xffff; return 0x00; }
+    return ram_read(addr);
+  };
+  auto access = [&](uint16 addr) {
+    if((addr & 0xfff0) == 0x00f0) mask |= 1 << (addr & 15);
+  };
+  auto dp = [&](uint8 addr) -> uint16 { return (regs.p.p << 8) + addr; };
+  auto pointer = [&](uint8 addr) -> uint16 { return peek(dp(addr)) | peek(dp(addr + 1)) << 8; };
+
+  uint16 pc = regs.pc;
+  uint8 opcode = peek(pc);
+  uint8 op0 = peek(pc + 1);
+  uint8 op1 = peek(pc + 2);
+  uint16 addr = op0 | op1 << 8;
+
+  switch(opcode) {
+  //dp
+  case 0x02: case 0x03: case 0x04: case 0x0b: case 0x12: case 0x13: case 0x22: case 0x23:
+  case 0x24: case 0x2b: case 0x2e: case 0x32: case 0x33: case 0x3e: case 0x42: case 0x43:
+  case 0x44: case 0x4b: case 0x52: case 0x53: case 0x62: case 0x63: case 0x64: case 0x6b:
+  case 0x6e: case 0x72: case 0x73: case 0x7e: case 0x82: case 0x83: case 0x84: case 0x8b:
+  case 0x92: case 0x93: case 0xa2: case 0xa3: case 0xa4: case 0xab: case 0xb2: case 0xb3:
+  case 0xc2: case 0xc3: case 0xc4: case 0xcb: case 0xd2: case 0xd3: case 0xd8: case 0xe2:
+  case 0xe3: case 0xe4: case 0xeb: case 0xf2: case 0xf3: case 0xf8:
+    access(dp(op0));
+    break;
+  //dp word
+  case 0x1a: case 0x3a: case 0x5a: case 0x7a: case 0x9a: case 0xba: case 0xda:
+    access(dp(op0));
+    access(dp(op0 + 1));
+    break;
+  //dp+x
+  case 0x14: case 0x1b: case 0x34: case 0x3b: case 0x54: case 0x5b: case 0x74: case 0x7b:
+  case 0x94: case 0x9b: case 0xb4: case 0xbb: case 0xd4: case 0xdb: case 0xde: case 0xf4:
+  case 0xfb:
+    access(dp(op0 + regs.x));
+    break;
+  //dp+y
+  case 0xd9: case 0xf9:
+    access(dp(op0 + regs.y));
+    break;
+  //dp,dp
+  case 0x09: case 0x29: case 0x49: case 0x69: case 0x89: case 0xa9: case 0xfa:
+    access(dp(op0));
+    access(dp(op1));
+    break;
+  //dp,#const
+  case 0x18: case 0x38: case 0x58: case 0x78: case 0x8f: case 0x98: case 0xb8:
+    access(dp(op1));
+    break;
+  //(x)
+  case 0x06: case 0x26: case 0x46: case 0x66: case 0x86: case 0xa6: case 0xaf: case 0xbf:
+  case 0xc6: case 0xe6:
+    access(dp(regs.x));
+    break;
+  //(x),(y)
+  case 0x19: case 0x39: case 0x59: case 0x79: case 0x99: case 0xb9:
+    access(dp(regs.x));
+    access(dp(regs.y));
+    break;
+  //!addr
+  case 0x05: case 0x0c: case 0x0e: case 0x1e: case 0x25: case 0x2c: case 0x45: case 0x4c:
+  case 0x4e: case 0x5e: case 0x65: case 0x6c: case 0x85: case 0x8c: case 0xa5: case 0xac:
+  case 0xc5: case 0xc9: case 0xcc: case 0xe5: case 0xe9: case 0xec:
+    access(addr);
+    break;
+  //!addr:bit
+  case 0x0a: case 0x2a: case 0x4a: case 0x6a: case 0x8a: case 0xaa: case 0xca: case 0xea:
+    access(addr & 0x1fff);
+    break;
+  //!addr+x
+  case 0x15: case 0x35: case 0x55: case 0x75: case 0x95: case 0xb5: case 0xd5: case 0xf5:
+    access(addr + regs.x);
+    break;
+  //!addr+y
+  case 0x16: case 0x36: case 0x56: case 0x76: case 0x96: case 0xb6: case 0xd6: case 0xf6:
+    access(addr + regs.y);
+    break;
+  //[!addr+x]
+  case 0x1f:
+    access(addr + regs.x);
+    access(addr + regs.x + 1);
+    break;
+  //[dp+x]
+  case 0x07: case 0x27: case 0x47: case 0x67: case 0x87: case 0xa7: case 0xc7: case 0xe7:
+    access(dp(op0 + regs.x));
+    access(dp(op0 + regs.x + 1));
+    access(pointer(op0 + regs.x));
+    break;
+  //[dp]+y
+  case 0x17: case 0x37: case 0x57: case 0x77: case 0x97: case 0xb7: case 0xd7: case 0xf7:
+    access(dp(op0));
+    access(dp(op0 + 1));
+    access(pointer(op0) + regs.y);
+    break;
+  //sleep, stop
+  case 0xef: case 0xff:
+    mask = 0xffff;
+    break;
+  }
+  //everything else reaches only the stack page and the vectors at $ffc0-$ffff
+
+  return mask;
+}
+
+//stepped: whether the instruction at regs.pc must run on the S-SMP thread. it must if it can lock up, or change TEST;
+//or if it can reach CONTROL or CPUIO while ahead of the S-CPU, where the threaded S-SMP would wait for the S-CPU.
+bool SMP::waits() {
+  if(status.clock_speed == 2) return true;  //TEST 0% speed
+  unsigned mask = io_access();
+  if(mask & 0x0001) return true;
+  if((mask & 0x00f2) == 0) return false;
+  //no instruction takes more than 12 cycles (DIV), of at most 240 clocks each (TEST 10% speed)
+  return clock + 12 * 240 * (int64)cpu.frequency >= 0;
+}
+
 #endif
@@ -47,6 +47,10 @@ void SMP::serialize(serializer& s) {
   s.integer(timer2.current_line);
   s.integer(timer2.enable);
   s.integer(timer2.target);
+
+  #if defined(DEBUGGER)
+  idle.lap = false;  //the recorded lap belongs to another timeline
+  #endif
 }
 
 #endif
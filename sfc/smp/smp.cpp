@@ -15,6 +15,7 @@ void SMP::step(unsigned clocks) {
 }
 
 void SMP::synchronize_cpu() {
+  if(Threaded == false && on_thread == false) return;  //stepped on the S-CPU thread, see SMP::enter()
   if(CPU::Threaded == true) {
     if(clock >= 0 && scheduler.sync != Scheduler::SynchronizeMode::All) co_switch(cpu.thread);
   } else {
@@ -30,19 +31,47 @@ void SMP::synchronize_dsp() {
   }
 }
 
-void SMP::Enter() { smp.enter(); }
-
-void SMP::enter() {
+void SMP::Enter() {
   while(true) {
     if(scheduler.sync == Scheduler::SynchronizeMode::All) {
       scheduler.exit(Scheduler::ExitReason::SynchronizeEvent);
     }
 
-    debugger.op_exec(regs.pc);
-    op_step();
+    if(Threaded == true) {
+      smp.instruction();
+      continue;
+    }
+
+    //stepped: run the instruction SMP::enter() handed over, then return to the S-CPU
+    smp.on_thread = true;
+    smp.instruction();
+    smp.on_thread = false;
+    if(scheduler.sync != Scheduler::SynchronizeMode::All) co_switch(cpu.thread);
   }
 }
 
+//Threaded == false: called from CPU::synchronize_smp() while the S-SMP is behind, executes one instruction.
+//most run right here on the S-CPU thread; one that may have to wait for the S-CPU mid-instruction,
+//or that can lock up, runs on the S-SMP thread instead, where synchronize_cpu() can suspend it.
+void SMP::enter() {
+  if(on_thread || waits()) return co_switch(thread);
+  instruction();
+}
+
+void SMP::instruction() {
+  debugger.op_exec(regs.pc);
+  #if defined(DEBUGGER)
+  uint16 pc = regs.pc;
+  if(pc < idle.head || pc > idle.tail) idle.active = false, idle.lap = false;
+  #endif
+
+  op_step();
+
+  #if defined(DEBUGGER)
+  if(regs.pc < pc && configuration.idle_loops) idle_detect(pc);
+  #endif
+}
+
 void SMP::power() {
   //targets not initialized/changed upon reset
   timer0.target = 0;
@@ -52,6 +81,7 @@ void SMP::power() {
 
 void SMP::reset() {
   create(Enter, system.apu_frequency());
+  on_thread = false;
 
   regs.pc = 0xffc0;
   regs.a = 0x00;
@@ -111,6 +141,14 @@ void SMP::reset() {
   timer0.enable = false;
   timer1.enable = false;
   timer2.enable = false;
+
+  idle.active = false;
+  idle.valid = false;
+  idle.polling = false;
+  idle.page = false;
+  idle.head = 0;
+  idle.tail = 0;
+  idle.lap = false;
 }
 
 SMP::SMP() {
@@ -2,7 +2,12 @@ struct SMP : Processor::SPC700, Thread {
   uint8 iplrom[64];
   uint8 apuram[64 * 1024];
 
-  enum : bool { Threaded = true };
+  #if defined(PROFILE_ACCURACY)
+  enum : bool { Threaded = true };   //paired with the cycle-stepped S-DSP coroutine
+  #else
+  enum : bool { Threaded = false };  //stepped together with the S-DSP from CPU::synchronize_smp()
+  #endif
+  bool on_thread;  //stepped: the instruction in progress runs on the S-SMP thread (see SMP::enter)
   alwaysinline void step(unsigned clocks);
   alwaysinline void synchronize_cpu();
   alwaysinline void synchronize_dsp();
@@ -45,6 +50,7 @@ privileged:
   } status;
 
   static void Enter();
+  void instruction();
 
   friend class SMPcore;
 
@@ -66,6 +72,8 @@ privileged:
   void op_write(uint16 addr, uint8 data);
 
   uint8 disassembler_read(uint16 addr);
+  unsigned io_access();
+  bool waits();
 
   //timing.cpp
   template<unsigned frequency>
@@ -86,8 +94,26 @@ privileged:
   Timer<192> timer1;
   Timer< 24> timer2;
 
+  struct Idle {
+    bool active;
+    bool valid;
+    bool polling;  //loop reads nothing but the CPUIO ports
+    bool page;     //direct page the loop was scanned with
+    uint16 head;
+    uint16 tail;
+
+    //state at the last arrival at head, if the loop has not been left since
+    bool lap;
+    int64 clock;
+    uint64 cpu_clock;
+    uint8 regs[5];
+  } idle;
+
   alwaysinline void add_clocks(unsigned clocks);
   alwaysinline void cycle_edge();
+  void idle_detect(uint16 tail);
+  bool idle_scan(uint16 head, uint16 tail);
+  void idle_skip();
 };
 
 extern SMP smp;
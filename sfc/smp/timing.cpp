@@ -5,12 +5,12 @@ void SMP::add_clocks(unsigned clocks) {
   synchronize_dsp();
 
   #if defined(DEBUGGER)
-  synchronize_cpu();
-  #else
+  if(idle.active == false) return synchronize_cpu();
+  #endif
+
   //forcefully sync S-SMP to S-CPU in case chips are not communicating
   //sync if S-SMP is more than 24 samples ahead of S-CPU
   if(clock > +(768 * 24 * (int64)24000000)) synchronize_cpu();
-  #endif
 }
 
 void SMP::cycle_edge() {
@@ -28,6 +28,126 @@ void SMP::cycle_edge() {
   }
 }
 
+//the debugger runs the S-SMP in lockstep with the S-CPU.
+//a short branch-back loop of reads and compares cannot affect the S-CPU,
+//and the CPUIO ports synchronize on access, so it is left to run ahead while spinning.
+
+//called after a backward transfer from tail to regs.pc
+void SMP::idle_detect(uint16 tail) {
+  uint16 head = regs.pc;
+  if(head != idle.head || tail != idle.tail || regs.p.p != idle.page) {
+    idle.head = head;
+    idle.tail = tail;
+    idle.page = regs.p.p;
+    idle.valid = idle_scan(head, tail);
+    idle.lap = false;
+  }
+  idle.active = idle.valid;
+  if(idle.polling) idle_skip();
+}
+
+bool SMP::idle_scan(uint16 head, uint16 tail) {
+  idle.polling = false;
+  if(tail - head > 16) return false;
+
+  //polling loops leave the registers as they found them, and read only the CPUIO ports
+  bool polling = true;
+  auto port = [&](uint8 dp) { return regs.p.p == 0 && dp >= 0xf4 && dp <= 0xf7; };
+
+  unsigned addr = head;
+  while(addr <= tail) {
+    uint8 opcode = disassembler_read(addr);
+    uint8 op0 = disassembler_read(addr + 1);
+    uint8 op1 = disassembler_read(addr + 2);
+    unsigned length = 0;
+    bool branch = false;
+
+    switch(opcode) {
+    case 0x00:  //nop
+      length = 1;
+      break;
+    case 0x10: case 0x30: case 0x50: case 0x70:  //bpl,bmi,bvc,bvs
+    case 0x90: case 0xb0: case 0xd0: case 0xf0:  //bcc,bcs,bne,beq
+    case 0x2f:  //bra
+      length = 2, branch = true;
+      break;
+    case 0xfe:  //dbnz y
+      length = 2, branch = true, polling = false;
+      break;
+    case 0x03: case 0x13: case 0x23: case 0x33: case 0x43: case 0x53: case 0x63: case 0x73:  //bbs
+    case 0x83: case 0x93: case 0xa3: case 0xb3: case 0xc3: case 0xd3: case 0xe3: case 0xf3:  //bbc
+    case 0x2e:  //cbne dp
+      length = 3, branch = true, polling &= port(op0);
+      break;
+    case 0x28: case 0x68: case 0xad: case 0xc8: case 0xe8:  //and a,#const; cmp a,#const; cmp y,#const; cmp x,#const; mov a,#const
+      length = 2;
+      break;
+    case 0x24: case 0x3e: case 0x64: case 0x7e:  //and a,dp; cmp x,dp; cmp a,dp; cmp y,dp
+    case 0xe4: case 0xeb: case 0xf8:  //mov a,dp; mov y,dp; mov x,dp
+      length = 2, polling &= port(op0);
+      break;
+    case 0xba:  //movw ya,dp
+      length = 2, polling &= port(op0) && port(op0 + 1);
+      break;
+    case 0xf4:  //mov a,dp+x
+      length = 2, polling = false;
+      break;
+    case 0x69:  //cmp dp,dp
+      length = 3, polling &= port(op0) && port(op1);
+      break;
+    case 0x78:  //cmp dp,#const
+      length = 3, polling &= port(op1);
+      break;
+    case 0x65: case 0xe5: case 0xe9: case 0xec:  //cmp a,addr; mov a,addr; mov x,addr; mov y,addr
+      length = 3, polling &= (op0 | op1 << 8) >= 0x00f4 && (op0 | op1 << 8) <= 0x00f7;
+      break;
+    default:
+      return false;
+    }
+
+    //the loop must end on the branch that closed it
+    if(addr == tail) return idle.polling = polling, branch;
+    addr += length;
+  }
+
+  return false;
+}
+
+//a polling loop whose last lap ran without the S-CPU advancing, and that arrives back at head
+//with the same registers, will repeat that lap exactly for as long as the ports hold their values.
+//only the S-CPU writes the ports, and it cannot do so at a time the S-SMP has not yet reached:
+//every further lap that ends while the S-SMP is still behind is accounted for without executing it.
+void SMP::idle_skip() {
+  uint8 state[5] = {regs.a, regs.x, regs.y, regs.s, (uint8)(unsigned)regs.p};
+  bool repeat = idle.lap && idle.cpu_clock == cpu.status.clock_total && !memcmp(state, idle.regs, 5);
+  int64 lap = clock - idle.clock;
+
+  idle.lap = true;
+  idle.clock = clock;
+  idle.cpu_clock = cpu.status.clock_total;
+  memcpy(idle.regs, state, 5);
+
+  if(repeat == false || lap <= 0 || clock >= 0 || status.clock_speed == 2) return;
+  if(scheduler.sync == Scheduler::SynchronizeMode::All) return;
+  //DSP echo writes could modify the loop itself
+  if(dsp.echo_reaches(idle.head, idle.tail + 3 - idle.head)) return;
+
+  static const unsigned cycle_clocks[4] = {24, 48, 0, 240};  //per TEST clock speed
+  uint64 clocks = lap / cpu.frequency;
+  uint64 cycles = clocks / cycle_clocks[status.clock_speed];
+  uint64 laps = (-clock - 1) / lap;
+  if(laps == 0) return;
+
+  for(uint64 n = 0; n < laps * cycles; n++) {
+    timer0.tick();
+    timer1.tick();
+    timer2.tick();
+  }
+  step(laps * clocks);
+  synchronize_dsp();
+  idle.clock = clock;
+}
+
 template<unsigned timer_frequency>
 void SMP::Timer<timer_frequency>::tick() {
   //stage 0 increment
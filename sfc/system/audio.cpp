@@ -2,6 +2,9 @@
 
 Audio audio;
 
+//samples are collected into output[] and handed to the frontend in one batch per frame.
+//with a coprocessor, both streams are queued and mixed block-wise as they become available.
+
 void Audio::coprocessor_enable(bool state) {
   coprocessor = state;
   dspaudio.clear();
@@ -17,13 +20,23 @@ void Audio::coprocessor_frequency(double input_frequency) {
   dspaudio.setResamplerFrequency(system.apu_frequency() / 768.0);
 }
 
+void Audio::coprocessor_quality(unsigned quality) {
+  dspaudio.setResamplerQuality(quality);
+}
+
 void Audio::sample(int16 lsample, int16 rsample) {
-  if(coprocessor == false) return interface->audioSample(lsample, rsample);
+  if(coprocessor == false) {
+    output[output_length * 2 + 0] = lsample;
+    output[output_length * 2 + 1] = rsample;
+    if(++output_length == buffer_size) flush();
+    return;
+  }
 
-  dsp_buffer[dsp_wroffset] = ((uint16)lsample << 0) + ((uint16)rsample << 16);
+  dsp_buffer[dsp_wroffset * 2 + 0] = lsample;
+  dsp_buffer[dsp_wroffset * 2 + 1] = rsample;
   dsp_wroffset = (dsp_wroffset + 1) & buffer_mask;
   dsp_length = (dsp_length + 1) & buffer_mask;
-  flush();
+  if(dsp_length >= buffer_size / 2) mix();
 }
 
 void Audio::coprocessor_sample(int16 lsample, int16 rsample) {
@@ -32,37 +45,65 @@ void Audio::coprocessor_sample(int16 lsample, int16 rsample) {
   while(dspaudio.pending()) {
     dspaudio.read(samples);
 
-    cop_buffer[cop_wroffset] = ((uint16)samples[0] << 0) + ((uint16)samples[1] << 16);
+    cop_buffer[cop_wroffset * 2 + 0] = samples[0];
+    cop_buffer[cop_wroffset * 2 + 1] = samples[1];
     cop_wroffset = (cop_wroffset + 1) & buffer_mask;
     cop_length = (cop_length + 1) & buffer_mask;
-    flush();
+    if(cop_length >= buffer_size / 2) mix();
   }
 }
 
 void Audio::init() {
+  output_length = 0;
 }
 
 void Audio::flush() {
-  while(dsp_length > 0 && cop_length > 0) {
-    uint32 dsp_sample = dsp_buffer[dsp_rdoffset];
-    uint32 cop_sample = cop_buffer[cop_rdoffset];
-
-    dsp_rdoffset = (dsp_rdoffset + 1) & buffer_mask;
-    cop_rdoffset = (cop_rdoffset + 1) & buffer_mask;
-
-    dsp_length--;
-    cop_length--;
+  if(coprocessor) mix();
+  if(output_length == 0) return;
+  interface->audioSamples(output, output_length);
+  output_length = 0;
+}
 
-    signed dsp_left  = (int16)(dsp_sample >>  0);
-    signed dsp_right = (int16)(dsp_sample >> 16);
+//averages two interleaved stereo blocks; the average of two int16 values cannot overflow,
+//but packs still saturates, matching sclamp<16> in the scalar path
+static void audio_mix(int16* output, const int16* dsp, const int16* cop, unsigned length) {
+  unsigned n = 0;
+
+  #if defined(__SSE2__)
+  for(; n + 8 <= length; n += 8) {
+    __m128i a = _mm_loadu_si128((const __m128i*)(dsp + n));
+    __m128i b = _mm_loadu_si128((const __m128i*)(cop + n));
+    __m128i lo = _mm_add_epi32(_mm_srai_epi32(_mm_unpacklo_epi16(a, a), 16), _mm_srai_epi32(_mm_unpacklo_epi16(b, b), 16));
+    __m128i hi = _mm_add_epi32(_mm_srai_epi32(_mm_unpackhi_epi16(a, a), 16), _mm_srai_epi32(_mm_unpackhi_epi16(b, b), 16));
+    //signed division by two truncates toward zero: add one to negative sums before shifting
+    lo = _mm_srai_epi32(_mm_add_epi32(lo, _mm_srli_epi32(lo, 31)), 1);
+    hi = _mm_srai_epi32(_mm_add_epi32(hi, _mm_srli_epi32(hi, 31)), 1);
+    _mm_storeu_si128((__m128i*)(output + n), _mm_packs_epi32(lo, hi));
+  }
+  #endif
 
-    signed cop_left  = (int16)(cop_sample >>  0);
-    signed cop_right = (int16)(cop_sample >> 16);
+  for(; n < length; n++) output[n] = sclamp<16>((dsp[n] + cop[n]) / 2);
+}
 
-    interface->audioSample(
-      sclamp<16>((dsp_left  + cop_left ) / 2),
-      sclamp<16>((dsp_right + cop_right) / 2)
-    );
+void Audio::mix() {
+  while(dsp_length > 0 && cop_length > 0) {
+    if(output_length == buffer_size) {
+      interface->audioSamples(output, output_length);
+      output_length = 0;
+    }
+
+    unsigned length = min(dsp_length, cop_length);
+    length = min(length, buffer_size - dsp_rdoffset);
+    length = min(length, buffer_size - cop_rdoffset);
+    length = min(length, buffer_size - output_length);
+
+    audio_mix(output + output_length * 2, dsp_buffer + dsp_rdoffset * 2, cop_buffer + cop_rdoffset * 2, length * 2);
+
+    dsp_rdoffset = (dsp_rdoffset + length) & buffer_mask;
+    cop_rdoffset = (cop_rdoffset + length) & buffer_mask;
+    dsp_length -= length;
+    cop_length -= length;
+    output_length += length;
   }
 }
 
@@ -1,20 +1,24 @@
 struct Audio {
   void coprocessor_enable(bool state);
   void coprocessor_frequency(double frequency);
+  void coprocessor_quality(unsigned quality);  //resampler: 0 (lowest latency) - 4 (best)
   void sample(int16 lsample, int16 rsample);
   void coprocessor_sample(int16 lsample, int16 rsample);
+  void flush();
   void init();
 
 private:
   nall::DSP dspaudio;
   bool coprocessor;
-  enum : unsigned { buffer_size = 256, buffer_mask = buffer_size - 1 };
-  uint32 dsp_buffer[buffer_size], cop_buffer[buffer_size];
+  enum : unsigned { buffer_size = 4096, buffer_mask = buffer_size - 1 };
+  int16 output[buffer_size * 2];
+  unsigned output_length;
+  int16 dsp_buffer[buffer_size * 2], cop_buffer[buffer_size * 2];
   unsigned dsp_rdoffset, cop_rdoffset;
   unsigned dsp_wroffset, cop_wroffset;
   unsigned dsp_length, cop_length;
 
-  void flush();
+  void mix();
 };
 
 extern Audio audio;
@@ -1,4 +1,7 @@
 #include <sfc/sfc.hpp>
+#if defined(__SSE2__)
+  #include <emmintrin.h>
+#endif
 
 #define SYSTEM_CPP
 namespace SuperFamicom {
@@ -21,6 +24,7 @@ void System::run() {
   if(scheduler.exit_reason() == Scheduler::ExitReason::FrameEvent) {
     video.update();
   }
+  audio.flush();
 }
 
 void System::runtosave() {
@@ -29,7 +33,7 @@ void System::runtosave() {
     runthreadtosave();
   }
 
-  if(SMP::Threaded == true) {
+  if(SMP::Threaded == true || smp.on_thread) {
     scheduler.thread = smp.thread;
     runthreadtosave();
   }
@@ -282,7 +286,12 @@ void System::reset() {
 
 void System::scanline() {
   video.scanline();
-  if(cpu.vcounter() == 241) scheduler.exit(Scheduler::ExitReason::FrameEvent);
+  if(cpu.vcounter() == 241) {
+    #ifdef DEBUGGER
+    gilgamesh.profileFrame();
+    #endif
+    scheduler.exit(Scheduler::ExitReason::FrameEvent);
+  }
 }
 
 void System::frame() {
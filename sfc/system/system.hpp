@@ -56,6 +56,9 @@ struct Configuration {
   System::ExpansionPortDevice expansion_port = System::ExpansionPortDevice::Satellaview;
   System::Region region = System::Region::Autodetect;
   bool random = true;
+  bool batched_ppu = false;  //accuracy profile: run the dot-based PPU in spans between S-CPU sync points (see ppu/ppu.cpp)
+  bool idle_loops = false;  //debugger builds: relax S-CPU/S-SMP lockstep in polling loops (see cpu/timing/idle.cpp)
+  bool profiler = false;
 };
 
 extern Configuration configuration;
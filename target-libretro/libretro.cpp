@@ -4,6 +4,9 @@
 #include <nall/stream/file.hpp>
 #include "../ananke/heuristics/super-famicom.hpp"
 #include "../ananke/heuristics/game-boy.hpp"
+namespace Database {
+  #include "../ananke/database/super-famicom-table.hpp"
+}
 #include <string>
 
 // Special memory types.
@@ -75,6 +78,7 @@ static void retro_log_default(enum retro_log_level level, const char *fmt, ...)
 static retro_log_printf_t output;
 
 static const char * read_opt(const char * name, const char * defval);
+static const char * read_var(const char * name, const char * defval);
 
 struct Callbacks : Emulator::Interface::Bind {
   retro_video_refresh_t pvideo_refresh;
@@ -88,6 +92,8 @@ struct Callbacks : Emulator::Interface::Bind {
   bool load_request_error;
   const uint8_t *rom_data;
   unsigned rom_size;
+  filemap rom_file;  //when open, rom_data points into it and ROM chips use it in place
+  string rom_path;   //the file rom_file maps
   const uint8_t *gb_rom_data;
   unsigned gb_rom_size;
   string xmlrom;
@@ -185,6 +191,14 @@ struct Callbacks : Emulator::Interface::Bind {
     }
   }
 
+  void audioSamples(const int16_t* samples, unsigned frames) override {
+    if(sampleBufPos) {
+      paudio(sampleBuf, sampleBufPos/2);
+      sampleBufPos = 0;
+    }
+    paudio(samples, frames);
+  }
+
   int16_t inputPoll(unsigned port, unsigned device, unsigned id) override {
     if(id > 11) return 0;
     if (!input_polled)
@@ -229,7 +243,7 @@ struct Callbacks : Emulator::Interface::Bind {
   }
 
   void loadROM(unsigned id) {
-    memorystream stream(rom_data, rom_size);
+    memorystream stream(rom_data, rom_size, rom_file.open());
     iface->load(id, stream);
   }
 
@@ -406,16 +420,17 @@ struct Callbacks : Emulator::Interface::Bind {
 
 static Callbacks core_bind;
 
+static const char * read_var(const char * name, const char * defval)
+{
+	struct retro_variable var = {name, defval};
+	if (!core_bind.penviron(RETRO_ENVIRONMENT_GET_VARIABLE, (void*)&var) || !var.value) return defval;
+	return var.value;
+}
+
 static const char * read_opt(const char * name, const char * defval)
 {
-	struct retro_variable allowvar = { "bsnes_violate_accuracy", "No" };
-	core_bind.penviron(RETRO_ENVIRONMENT_GET_VARIABLE, (void*)&allowvar);
-	if (!strcmp(allowvar.value, "Yes"))
-	{
-		struct retro_variable var = {name, defval};
-		core_bind.penviron(RETRO_ENVIRONMENT_GET_VARIABLE, (void*)&var);
-		return var.value;
-	}
+	if (!strcmp(read_var("bsnes_violate_accuracy", "No"), "Yes"))
+		return read_var(name, defval);
 	else return defval;
 }
 
@@ -495,6 +510,14 @@ void retro_set_environment(retro_environment_t environ_cb)
       { "bsnes_chip_hle", "Special chip accuracy; LLE|HLE" },
       { "bsnes_superfx_overclock", "SuperFX speed; 100%|150%|200%|300%|400%|500%|1000%" },
          //Any integer is usable here, but there is no such thing as "any integer" in core options.
+#ifdef PROFILE_ACCURACY
+      { "bsnes_ppu_sync", "PPU synchronization; Dot|Batched" },
+#endif
+      { "bsnes_cop_resampler", "Coprocessor audio resampler; High|Medium|Low" },
+#ifdef DEBUGGER
+      { "bsnes_idle_loops", "Idle loop detection; Off|On" },
+      { "bsnes_profiler", "Cycle profiler (writes gilgamesh.db); Off|On" },
+#endif
 #ifdef EXPERIMENTAL_FEATURES
       { "bsnes_sgb_core", "Super Game Boy core; Internal|Gambatte" },
 #endif
@@ -575,6 +598,17 @@ void retro_set_environment(retro_environment_t environ_cb)
 }
 
 static void update_variables(void) {
+   //these do not alter emulation results, so they need not be gated by bsnes_violate_accuracy
+#ifdef PROFILE_ACCURACY
+   SuperFamicom::configuration.batched_ppu = !strcmp(read_var("bsnes_ppu_sync", "Dot"), "Batched");
+#endif
+#ifdef DEBUGGER
+   SuperFamicom::configuration.idle_loops = !strcmp(read_var("bsnes_idle_loops", "Off"), "On");
+   SuperFamicom::configuration.profiler = !strcmp(read_var("bsnes_profiler", "Off"), "On");
+#endif
+   const char * resampler=read_var("bsnes_cop_resampler", "High");
+   SuperFamicom::audio.coprocessor_quality(!strcmp(resampler, "Low") ? 0 : !strcmp(resampler, "Medium") ? 2 : 4);
+
    if (SuperFamicom::cartridge.has_superfx()) {
       const char * speed=read_opt("bsnes_superfx_overclock", "100%");
       unsigned percent=strtoul(speed, NULL, 10);//we can assume that the input is one of our advertised options
@@ -729,16 +763,97 @@ static void output_multiline(enum retro_log_level level, char * data)
   }
 }
 
+//SHA-256 digests of ROM files, keyed by size, modification time and path, most recent first.
+//the list is kept in the save directory, so that reloading an unchanged file skips hashing it;
+//it is only consulted when the loaded data is known to be the file on disk (rom_file is open)
+static string digest_cache_file() {
+  const char *dir = nullptr;
+  if (!core_bind.penviron(RETRO_ENVIRONMENT_GET_SAVE_DIRECTORY, &dir) || !dir || !*dir) return "";
+  return {dir, "/bsnes_mercury_sha256.cache"};
+}
+
+static string digest_cache_key(const string &path) {
+  return {(unsigned long long)file::size(path), " ", (unsigned long long)file::timestamp(path, file::time::modify), " ", path};
+}
+
+static string digest_cache_find(const string &path) {
+  string cache = digest_cache_file();
+  if (!cache || !file::exists(cache)) return "";
+  string key = digest_cache_key(path);
+  lstring lines = string::read(cache).split("\n");
+  for (auto &line : lines) {
+    if (line.size() > 65 && substr(line, 65) == key) return substr(line, 0, 64);
+  }
+  return "";
+}
+
+static void digest_cache_store(const string &path, const string &digest) {
+  enum : unsigned { Entries = 256 };
+  string cache = digest_cache_file();
+  if (!cache) return;
+  string output = {digest, " ", digest_cache_key(path), "\n"};
+  unsigned entries = 1;
+  if (file::exists(cache)) {
+    lstring lines = string::read(cache).split("\n");
+    for (auto &line : lines) {
+      if (line.size() <= 65 || entries == Entries) continue;
+      lstring key = substr(line, 65).split<2>(" ");
+      if (key.size() != 3 || key[2] == path) continue;  //older digest of the same file
+      output.append(line, "\n");
+      entries++;
+    }
+  }
+  file::write(cache, output);
+}
+
+//known dumps get their board from the database; everything else is left to the heuristics
+//the image digest is returned in digest (or taken from it, if already known), so that the cartridge need not hash the image again
+static string snes_cartridge_markup(const uint8_t *rom_data, unsigned rom_size, string &digest) {
+  uint8_t hash[32];
+  if (digest.size() == 64) {
+    for (unsigned n = 0; n < 32; n++) hash[n] = hex(substr(digest, n * 2, 2));
+  } else {
+    sha256_ctx sha;
+    sha256_init(&sha);
+    sha256_chunk(&sha, rom_data, rom_size);
+    sha256_final(&sha);
+    sha256_hash(&sha, hash);
+    digest = "";
+    for (auto byte : hash) digest.append(hex<2>(byte));
+  }
+
+  //only configurations with a single ROM can be served from rom_data
+  auto entry = Database::SuperFamicomTable::find(hash);
+  if (entry && entry->roms == 1 && entry->romSize == rom_size) {
+    //strip "release" root node, as ananke does for game folders
+    string markup = substr(Database::SuperFamicomTable::markup, entry->offset, entry->length);
+    markup.replace("\n  ", "\n");
+    markup.replace("information", "\ninformation");
+    markup.ltrim<1>("release\n");
+    return markup;
+  }
+
+  return SuperFamicomCartridge(rom_data, rom_size).markup;
+}
+
 static bool snes_load_cartridge_normal(
   const char *rom_xml, const uint8_t *rom_data, unsigned rom_size
 ) {
-  string xmlrom = (rom_xml && *rom_xml) ? string(rom_xml) : SuperFamicomCartridge(rom_data, rom_size).markup;
+  string digest, xmlrom;
+  if (rom_xml && *rom_xml) {
+    xmlrom = rom_xml;
+  } else {
+    bool cached = core_bind.rom_file.open() && (digest = digest_cache_find(core_bind.rom_path));
+    xmlrom = snes_cartridge_markup(rom_data, rom_size, digest);
+    if (!cached && core_bind.rom_file.open()) digest_cache_store(core_bind.rom_path, digest);
+  }
 
   core_bind.rom_data = rom_data;
   core_bind.rom_size = rom_size;
   core_bind.xmlrom   = xmlrom;
   output(RETRO_LOG_INFO, "BML map:\n");
   output_multiline(RETRO_LOG_INFO, xmlrom.data());
+  if (digest) SuperFamicom::cartridge.set_sha256(digest, rom_size);
   core_bind.iface->load(SuperFamicom::ID::SuperFamicom);
   SuperFamicom::system.power();
   return !core_bind.load_request_error;
@@ -912,6 +1027,17 @@ bool retro_load_game(const struct retro_game_info *info) {
     core_bind.load_request_error = false;
     core_bind.basename = info->path;
 
+    //if the file on disk is exactly what the frontend loaded, map it read-only instead of copying it;
+    //instances running the same game then share its pages through the page cache
+    if (!core_bind.manifest && info->data && info->size
+       && core_bind.rom_file.open(info->path, filemap::mode::read)
+       && core_bind.rom_file.size() == info->size
+       && !memcmp(core_bind.rom_file.data(), info->data, info->size)) {
+      data = core_bind.rom_file.data() + (data - (const uint8_t*)info->data);
+      core_bind.rom_path = info->path;
+    } else
+      core_bind.rom_file.close();
+
     char *posix_slash = (char*)strrchr(core_bind.basename, '/');
     char *win_slash = (char*)strrchr(core_bind.basename, '\\');
     if (posix_slash && !win_slash)
@@ -946,6 +1072,7 @@ bool retro_load_game(const struct retro_game_info *info) {
 bool retro_load_game_special(unsigned game_type,
       const struct retro_game_info *info, size_t num_info) {
   core_bind.manifest = false;
+  core_bind.rom_file.close();
   init_descriptors();
   const uint8_t *data = (const uint8_t*)info[0].data;
   size_t size = info[0].size;
@@ -1021,6 +1148,7 @@ bool retro_load_game_special(unsigned game_type,
 
 void retro_unload_game(void) {
   core_bind.iface->unload();
+  core_bind.rom_file.close();
   core_bind.sram = nullptr;
   core_bind.sram_size = 0;
 }
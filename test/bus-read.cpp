@@ -0,0 +1,87 @@
+//measures reads through Bus::read(): the fast path (WRAM) against the slow path, which dispatches through
+//Bus::reader[] into open bus, S-CPU and PPU registers; and the bare cost of a Bus::Reader call against the
+//nall::function the bus tables held before
+//usage: bus-read [seconds]
+
+#include "test.hpp"
+
+using SuperFamicom::bus;
+using SuperFamicom::ppu;
+
+struct Register {
+  uint8 value = 0;
+  uint8 read(unsigned addr) { return value + addr; }
+} target;
+
+//tables like Bus::reader[], filled at run time so the calls are not resolved at compile time
+static SuperFamicom::Bus::Reader handlers[256];
+static function<uint8 (unsigned)> closures[256];
+
+static void bind() {
+  for(unsigned n = 0; n < 256; n++) {
+    handlers[n] = {&Register::read, &target};
+    closures[n] = {&Register::read, &target};
+  }
+}
+
+static volatile unsigned sink;
+
+//reads/s over one address list, best of four runs of seconds / 4 each
+template<typename Read> static double measure(const vector<unsigned>& addresses, double seconds, unsigned& sum, const Read& read) {
+  double best = 0;
+  for(unsigned run = 0; run < 4; run++) {
+    uint64_t count = 0;
+    double start = timestamp(), elapsed = 0;
+    while(elapsed < seconds / 4) {
+      for(unsigned n = 0; n < 1000; n++) {
+        for(auto addr : addresses) sum += read(addr);
+      }
+      count += 1000 * addresses.size();
+      elapsed = timestamp() - start;
+    }
+    best = max(best, count / elapsed);
+  }
+  return best;
+}
+
+static void report(const string& name, double reads) {
+  print(name, ": ", unsigned(reads / 1000000.0), "M reads/s, ", unsigned(1e9 / reads * 10 + 0.5) / 10.0, "ns per read\n");
+}
+
+int main(int argc, char** argv) {
+  double seconds = argc > 1 && atof(argv[1]) > 0 ? atof(argv[1]) : 2.0;
+  if(frontend.load(stub_rom()) == false) {
+    print("failed to load\n");
+    return 1;
+  }
+  frontend.run();
+
+  //the reads run on the host thread, outside the schedule: hold the PPU level with the S-CPU
+  //so that PPU::mmio_read() does not synchronize
+  auto clock = ppu.clock;
+  ppu.clock = 0;
+
+  struct Case { string name; vector<unsigned> addresses; };
+  vector<Case> cases = {
+    {"WRAM $7e0000 (fast path)", {0x7e0000}},
+    {"open bus $002000", {0x002000}},
+    {"S-CPU $004218", {0x004218}},
+    {"PPU $002134", {0x002134}},
+    {"mix", {0x002000, 0x004218, 0x002134, 0x7e0000, 0x004212, 0x00213e}},
+  };
+
+  unsigned sum = 0;
+  for(auto& item : cases) {
+    report(item.name, measure(item.addresses, seconds / 7, sum, [](unsigned addr) { return bus.read(addr); }));
+  }
+
+  bind();
+  vector<unsigned> addresses = {0x00, 0x21, 0x42, 0x7e};
+  report("dispatch, Bus::Reader", measure(addresses, seconds / 7, sum, [](unsigned id) { return handlers[id](id); }));
+  report("dispatch, nall::function", measure(addresses, seconds / 7, sum, [](unsigned id) { return closures[id](id); }));
+
+  ppu.clock = clock;
+  frontend.unload();
+  sink = sum;
+  return 0;
+}
@@ -0,0 +1,81 @@
+//measures libco: co_switch round trips, and the create/delete cycle Thread::create() performs on every reset
+//usage: co-switch [seconds]
+//built once per backend (out/test-co-switch-amd64, -sjlj, -ucontext; -fiber on Windows)
+
+#include <libco/libco.h>
+#include <nall/string.hpp>
+#include <chrono>
+using namespace nall;
+
+#if !defined(BACKEND)
+  #define BACKEND "libco"
+#endif
+
+//the stack size of Thread::create()
+static const unsigned stack_size = 65536 * sizeof(void*);
+
+static cothread_t host;
+static cothread_t thread;
+static uint64_t switches;
+
+static double timestamp() {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static void entry() {
+  while(true) {
+    switches++;
+    co_switch(host);
+  }
+}
+
+static void leave() {
+  while(true) co_switch(host);
+}
+
+//ns per round trip (host -> thread -> host), best of four runs of seconds / 4 each
+static double round_trip(double seconds) {
+  thread = co_create(stack_size, entry);
+  double best = 1e9;
+  for(unsigned run = 0; run < 4; run++) {
+    unsigned count = 0;
+    switches = 0;
+    double start = timestamp(), elapsed = 0;
+    while(elapsed < seconds / 4) {
+      for(unsigned n = 0; n < 100000; n++) co_switch(thread);
+      count += 100000;
+      elapsed = timestamp() - start;
+    }
+    if(switches != count) print(BACKEND, ": lost switches\n");
+    best = min(best, elapsed * 1e9 / count);
+  }
+  co_delete(thread);
+  return best;
+}
+
+//ns per co_create + first switch + co_delete
+static double create_delete(double seconds) {
+  unsigned count = 0;
+  double start = timestamp(), elapsed = 0;
+  while(elapsed < seconds / 4) {
+    for(unsigned n = 0; n < 1000; n++) {
+      thread = co_create(stack_size, leave);
+      co_switch(thread);
+      co_delete(thread);
+    }
+    count += 1000;
+    elapsed = timestamp() - start;
+  }
+  return elapsed * 1e9 / count;
+}
+
+int main(int argc, char** argv) {
+  double seconds = argc > 1 && atof(argv[1]) > 0 ? atof(argv[1]) : 2.0;
+  host = co_active();
+
+  double trip = round_trip(seconds);
+  double cycle = create_delete(seconds);
+  print(BACKEND, ": ", (unsigned)(trip * 10 + 0.5) / 10.0, "ns per co_switch round trip, ",
+    (unsigned)(cycle + 0.5), "ns per co_create/co_switch/co_delete\n");
+  return 0;
+}
@@ -0,0 +1,85 @@
+//checks the generated Super Famicom table against the database it was compiled from,
+//and that the digest the libretro loader computes (or caches) is the one the cartridge reports
+//usage: database [file.sfc ...]
+
+#include "test.hpp"
+
+namespace Database {
+  #include <ananke/database/super-famicom.hpp>
+  #include <ananke/database/super-famicom-table.hpp>
+}
+
+static bool decode(const string& text, uint8_t* sha256) {
+  if(text.size() != 64) return false;
+  for(unsigned n = 0; n < 32; n++) sha256[n] = hex(substr(text, n * 2, 2));
+  return true;
+}
+
+//every release must be found through the table, with the same text; split as database/compile.cpp does
+static bool check_table() {
+  unsigned count = 0, failed = 0;
+  lstring items = string{Database::SuperFamicom}.strip().split("\n\n");
+  for(auto& item : items) {
+    item.append("\n");
+    auto document = Markup::Document(item);
+    uint8_t sha256[32];
+    if(decode(document["release/information/sha256"].text(), sha256) == false) continue;
+    count++;
+
+    unsigned roms = 0, romSize = 0;
+    for(auto& node : document["release/information/configuration"]) {
+      if(node.name == "rom") roms++, romSize += node["size"].decimal();
+    }
+
+    auto entry = Database::SuperFamicomTable::find(sha256);
+    if(entry == nullptr
+    || substr(Database::SuperFamicomTable::markup, entry->offset, entry->length) != item
+    || entry->roms != roms || entry->romSize != romSize) {
+      if(failed++ < 8) print(document["release/information/title"].text(), ": table entry missing or stale\n");
+    }
+  }
+
+  unsigned slots = 0;
+  for(auto& entry : Database::SuperFamicomTable::entry) slots += entry.length != 0;
+  if(slots != count) failed++, print("table holds ", slots, " entries, database has ", count, "\n");
+
+  print("table: ", count, " entries checked", failed ? ", out of date (run make database in ananke/)" : "", "\n");
+  return failed == 0;
+}
+
+//the cartridge must report the digest of its ROM whether or not the loader handed one over
+//(plain LoROM/HiROM images only: there the ROM is all that is hashed)
+static bool check_digest(const string& name, const vector<uint8_t>& rom, const string& path = "out/test.sfc") {
+  if(frontend.load(rom, path) == false) { print(name, ": failed to load\n"); return false; }
+  string digest = SuperFamicom::cartridge.sha256();
+  string expected = nall::sha256(SuperFamicom::cartridge.rom.data(), SuperFamicom::cartridge.rom.size());
+  frontend.unload();
+
+  print(name, ": ", digest, "\n");
+  if(digest != expected) print(name, ": expected ", expected, "\n");
+  return digest == expected;
+}
+
+//loaded from a file, the digest is kept in the loader's cache; the second load is served from it
+static bool check_cached_digest(const string& name, const vector<uint8_t>& rom) {
+  string path = "out/test-database.sfc";
+  file::write(path, rom);
+  bool passed = check_digest(name, rom, path);
+  bool cached = false;
+  lstring lines = string::read("out/bsnes_mercury_sha256.cache").split("\n");
+  string key = {" ", path};
+  for(auto& line : lines) cached |= line.endsWith(key);
+  if(cached == false) print(name, ": digest was not cached\n");
+  passed &= cached && check_digest({name, " (cached)"}, rom, path);
+  file::remove(path);
+  return passed;
+}
+
+int main(int argc, char** argv) {
+  bool passed = check_table();
+  passed &= check_digest("stub", stub_rom());
+  for(unsigned n = 1; n < argc; n++) {
+    passed &= check_cached_digest(argv[n], file::read(argv[n]));
+  }
+  return passed ? 0 : 1;
+}
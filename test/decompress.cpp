@@ -0,0 +1,106 @@
+//measures the S-DD1 and SPC7110 decompressors on a cartridge, outside of emulation
+//usage: decompress [table=address] [length=bytes] file.sfc|manifest.bml ...
+//SPC7110: every stream index (0-255) of the directory at table (a data ROM address, default 0) is decoded
+//S-DD1: there is no directory, so a stream is started at the beginning of every mapped 64KB bank
+//the output hash identifies the decoded data, so runs can be compared across builds
+
+#include "test.hpp"
+
+using SuperFamicom::cartridge;
+using SuperFamicom::spc7110;
+using SuperFamicom::sdd1;
+
+struct Result {
+  unsigned streams = 0;
+  uint64_t bytes = 0;
+  double seconds = 0;
+  Hash output;
+};
+
+//the DCU is driven directly through its privileged members; with the scheduler in SynchronizeMode::All,
+//dcu_begin_transfer() does not yield to the S-CPU
+static void decompress_spc7110(unsigned table, unsigned length, Result& result) {
+  auto sync = SuperFamicom::scheduler.sync;
+  SuperFamicom::scheduler.sync = SuperFamicom::Scheduler::SynchronizeMode::All;
+  unsigned megabytes = spc7110.drom.size() + 0xfffff >> 20;
+  spc7110.r4834 = megabytes <= 1 ? 0 : megabytes <= 2 ? 1 : 2;
+
+  vector<uint8_t> buffer;
+  buffer.resize(length);
+  double start = timestamp();
+  for(unsigned index = 0; index < 256; index++) {
+    spc7110.r4801 = table >>  0;
+    spc7110.r4802 = table >>  8;
+    spc7110.r4803 = table >> 16;
+    spc7110.r4804 = index;
+    spc7110.dcu_load_address();
+    if(spc7110.dcu_mode == 3) continue;  //invalid entry
+
+    spc7110.r4805 = spc7110.r4806 = 0;
+    spc7110.r480b = 0;  //no seek, unit stride
+    spc7110.dcu_begin_transfer();
+    for(auto& byte : buffer) byte = spc7110.dcu_read();
+
+    result.output.data(buffer.data(), length);
+    result.streams++;
+    result.bytes += length;
+  }
+  result.seconds = timestamp() - start;
+  SuperFamicom::scheduler.sync = sync;
+}
+
+static void decompress_sdd1(unsigned length, Result& result) {
+  vector<uint8_t> buffer;
+  buffer.resize(length);
+  unsigned banks = min(sdd1.rom.size(), 0x400000u) >> 16;
+  double start = timestamp();
+  for(unsigned bank = 0; bank < banks; bank++) {
+    sdd1.decomp.init(0xc00000 + (bank << 16));
+    sdd1.decomp.read(buffer.data(), length);
+
+    result.output.data(buffer.data(), length);
+    result.streams++;
+    result.bytes += length;
+  }
+  result.seconds = timestamp() - start;
+}
+
+int main(int argc, char** argv) {
+  unsigned table = 0;
+  unsigned length = 0x4000;
+  bool passed = true;
+  unsigned files = 0;
+
+  for(unsigned n = 1; n < argc; n++) {
+    string argument = argv[n];
+    if(argument.beginsWith("table=")) { table = numeral(substr(argument, 6)); continue; }
+    if(argument.beginsWith("length=")) { length = max(1u, (unsigned)numeral(substr(argument, 7))); continue; }
+    files++;
+
+    //manifests are loaded by path; the loader reads the images named in them from the same folder
+    auto data = file::read(argument);
+    if(data.size() == 0 || frontend.load(data, argument.endsWith(".bml") ? argument : string{"out/test.sfc"}) == false) {
+      print(argument, ": failed to load\n");
+      frontend.unload();
+      passed = false;
+      continue;
+    }
+
+    Result result;
+    if(cartridge.has_spc7110()) decompress_spc7110(table, length, result);
+    else if(cartridge.has_sdd1()) decompress_sdd1(length, result);
+    frontend.unload();
+
+    if(result.streams == 0) {
+      print(argument, ": no S-DD1 or SPC7110 streams\n");
+      passed = false;
+      continue;
+    }
+
+    print(argument, ": ", result.streams, " streams, ", result.bytes, " bytes in ", result.seconds, "s, ",
+      unsigned(result.bytes / result.seconds / 1000.0), "KB/s, output ", result.output.text(), "\n");
+  }
+
+  if(files == 0) print("decompress: no cartridge given (rom=\"...\"), skipped\n");
+  return passed ? 0 : 1;
+}
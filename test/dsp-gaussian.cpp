@@ -0,0 +1,78 @@
+//compares the scalar and AVX2 gaussian interpolation kernels of the accuracy S-DSP
+//usage: dsp-gaussian [file.spc ...]
+
+#include "test.hpp"
+
+using SuperFamicom::dsp;
+
+//every offset, with random and full-scale samples in each tap
+static bool compare_kernels() {
+  uint32_t seed = 1;
+  auto random = [&] { seed = seed * 1103515245 + 12345; return int16_t(seed >> 12); };
+  static const int extremes[] = {-32768, -32767, -1, 0, 1, 32766, 32767};
+
+  for(unsigned round = 0; round < 4096; round++) {
+    for(unsigned n = 0; n < 8; n++) {
+      auto& voice = dsp.voice[n];
+      for(unsigned i = 0; i < SuperFamicom::DSP::brr_buf_size; i++) {
+        voice.buffer.write(i, round & 1 ? extremes[(round / 2 + n + i) % 7] : random());
+      }
+      voice.buf_pos = (round + n) % SuperFamicom::DSP::brr_buf_size;
+      voice.interp_pos = (round * 8 + n) * 16 & 0x3fff;
+      voice.kon_delay = round % 16 < 6 ? round % 16 : 0;
+    }
+
+    int scalar[8], vector[8];
+    SuperFamicom::DSP::gaussian_simd = false;
+    dsp.gaussian_run();
+    for(unsigned n = 0; n < 8; n++) scalar[n] = dsp.voice[n].t_interp_out;
+    SuperFamicom::DSP::gaussian_simd = true;
+    dsp.gaussian_run();
+    for(unsigned n = 0; n < 8; n++) vector[n] = dsp.voice[n].t_interp_out;
+
+    if(memcmp(scalar, vector, sizeof scalar)) {
+      print("kernel mismatch in round ", round, "\n");
+      return false;
+    }
+  }
+  return true;
+}
+
+//plays the file through each kernel; the audio must match sample for sample
+static bool compare_playback(const string& filename, unsigned frames) {
+  vector<int16_t> output[2];
+  for(unsigned simd = 0; simd < 2; simd++) {
+    if(frontend.load(stub_rom()) == false) return false;
+    if(load_spc(filename) == false) { print(filename, ": not an SPC file\n"); frontend.unload(); return false; }
+    SuperFamicom::DSP::gaussian_simd = simd;
+    frontend.output.reset();
+    frontend.run(frames);
+    output[simd] = frontend.output;
+    frontend.unload();
+  }
+
+  unsigned n = 0;
+  while(n < output[0].size() && n < output[1].size() && output[0][n] == output[1][n]) n++;
+  if(n != output[0].size() || n != output[1].size()) {
+    print(filename, ": output differs from sample ", n / 2, "\n");
+    return false;
+  }
+
+  unsigned active = 0;
+  for(auto sample : output[0]) active += sample != 0;
+  print(filename, ": ", output[0].size() / 2, " samples match (", active, " non-zero)\n");
+  return true;
+}
+
+int main(int argc, char** argv) {
+  SuperFamicom::DSP::gaussian_init();
+  if(SuperFamicom::DSP::gaussian_simd == false) {
+    print("dsp-gaussian: AVX2 kernel not available on this host, skipped\n");
+    return 0;
+  }
+
+  bool passed = compare_kernels();
+  print("kernels: ", passed ? "match" : "differ", "\n");
+  for(unsigned n = 1; n < argc; n++) passed &= compare_playback(argv[n], 600);
+  return passed ? 0 : 1;
+}
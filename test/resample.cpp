@@ -0,0 +1,82 @@
+//measures the sinc resampler used for coprocessor audio (MSU-1, Super Game Boy)
+//usage: resample [seconds]
+//each channel of a stereo run must match a mono run of the same input, as both take the same path per lane
+
+#include "test.hpp"
+
+//the S-DSP sample rate, which coprocessor audio is mixed into
+static const double output_frequency = 32040.0;
+
+//deterministic input: two tones plus noise, different on each channel
+static signed input(unsigned channel, unsigned n, double frequency) {
+  uint32_t seed = (n * 2 + channel) * 2654435761u;
+  double t = n / frequency;
+  double tone = sin(t * 2 * M_PI * (channel ? 440.0 : 1000.0)) * 12000 + sin(t * 2 * M_PI * 7000.0) * 6000;
+  return signed(tone) + (int16_t(seed >> 8) >> 4);
+}
+
+struct Run {
+  double seconds;
+  uint64_t samples;
+  vector<int16_t> output;  //interleaved
+};
+
+static Run resample(unsigned channels, double frequency, unsigned quality, unsigned length, bool keep) {
+  nall::DSP dsp;
+  dsp.setChannels(channels);
+  dsp.setPrecision(16);
+  dsp.setFrequency(frequency);
+  dsp.setResampler(nall::DSP::ResampleEngine::Sinc);
+  dsp.setResamplerFrequency(output_frequency);
+  dsp.setResamplerQuality(quality);
+
+  //the input is generated up front so that only the resampler is timed
+  vector<signed> samples;
+  samples.resize(length * 2);
+  for(unsigned n = 0; n < length; n++) {
+    samples[n * 2 + 0] = input(0, n, frequency);
+    samples[n * 2 + 1] = input(1, n, frequency);
+  }
+
+  Run run;
+  run.samples = length;
+  double start = timestamp();
+  for(unsigned n = 0; n < length; n++) {
+    dsp.sample(&samples[n * 2]);
+    while(dsp.pending()) {
+      signed channel[2];
+      dsp.read(channel);
+      if(keep) for(unsigned c = 0; c < channels; c++) run.output.append(channel[c]);
+    }
+  }
+  run.seconds = timestamp() - start;
+  return run;
+}
+
+int main(int argc, char** argv) {
+  double seconds = argc > 1 && atof(argv[1]) > 0 ? atof(argv[1]) : 10.0;
+  static const double frequencies[] = {44100.0, 2097152.0};  //MSU-1, Super Game Boy
+  static const unsigned qualities[] = {4, 2, 0};  //bsnes_cop_resampler High, Medium, Low
+
+  bool passed = true;
+  for(auto frequency : frequencies) {
+    for(auto quality : qualities) {
+      unsigned length = frequency * seconds;
+      auto stereo = resample(2, frequency, quality, length, true);
+      auto mono = resample(1, frequency, quality, length, true);
+
+      bool match = stereo.output.size() == mono.output.size() * 2;
+      for(unsigned n = 0; match && n < mono.output.size(); n++) match = stereo.output[n * 2] == mono.output[n];
+      passed &= match;
+
+      Hash hash;
+      hash.data(stereo.output.data(), stereo.output.size() * sizeof(int16_t));
+      auto timed = resample(2, frequency, quality, length, false);
+      print(unsigned(frequency), "Hz quality ", quality, ": ",
+        unsigned(timed.samples / timed.seconds / 1000.0), "K stereo samples/s (",
+        unsigned(timed.samples / timed.seconds / frequency), "x realtime), ",
+        "output ", hash.text(), match ? "" : ", stereo differs from mono", "\n");
+    }
+  }
+  return passed ? 0 : 1;
+}
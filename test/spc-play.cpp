@@ -0,0 +1,60 @@
+//plays .spc snapshots headless and reports S-SMP instructions per second
+//usage: spc-play [frames] file.spc ...
+//the audio hash identifies the output, so runs can be compared across builds
+
+#include "test.hpp"
+
+using SuperFamicom::smp;
+
+struct Result {
+  uint64_t instructions;
+  double seconds;
+  string audio;
+};
+
+static bool play(const string& filename, unsigned frames, bool count, Result& result) {
+  if(frontend.load(stub_rom()) == false) return false;
+  if(load_spc(filename) == false) { frontend.unload(); return false; }
+
+  uint64_t instructions = 0;
+  if(count) smp.debugger.op_exec = [&](uint16) { instructions++; };
+  frontend.audio = Hash();
+  double start = timestamp();
+  frontend.run(frames);
+  result.seconds = timestamp() - start;
+  result.audio = frontend.audio.text();
+  if(count) result.instructions = instructions;
+  smp.debugger.op_exec = hook<void (uint16)>();
+  frontend.unload();
+  return true;
+}
+
+int main(int argc, char** argv) {
+  unsigned frames = 3600;
+  unsigned first = 1;
+  if(argc > 1 && decimal(argv[1]) > 0) frames = decimal(argv[1]), first++;
+  if(first >= argc) {
+    print("spc-play: no SPC file given (spc=\"...\"), skipped\n");
+    return 0;
+  }
+
+  bool passed = true;
+  for(unsigned n = first; n < argc; n++) {
+    //instructions are counted through the debugger hook in a separate, untimed run
+    Result counted, timed;
+    if(play(argv[n], frames, true, counted) == false || play(argv[n], frames, false, timed) == false) {
+      print(argv[n], ": not an SPC file\n");
+      passed = false;
+      continue;
+    }
+    if(counted.audio != timed.audio) {
+      print(argv[n], ": playback is not deterministic\n");
+      passed = false;
+    }
+
+    print(argv[n], ": ", frames, " frames in ", timed.seconds, "s, ",
+      counted.instructions, " instructions, ",
+      unsigned(counted.instructions / timed.seconds / 1000.0), "K instructions/s, audio ", timed.audio, "\n");
+  }
+  return passed ? 0 : 1;
+}
@@ -0,0 +1,175 @@
+//shared frontend for the programs in test/
+//drives the core through the libretro interface, with video and audio reduced to hashes
+
+#include <target-libretro/libretro.h>
+#include <sfc/sfc.hpp>
+#include <chrono>
+
+namespace Test {
+
+using namespace nall;
+
+//FNV-1a
+struct Hash {
+  uint64_t value = 0xcbf29ce484222325ull;
+
+  void data(const void* data, unsigned size) {
+    auto p = (const uint8_t*)data;
+    while(size--) value = (value ^ *p++) * 0x100000001b3ull;
+  }
+
+  string text() const { return hex<16>(value); }
+};
+
+struct Variable {
+  string name;
+  string value;
+};
+
+struct Frontend {
+  vector<Variable> variables;
+  Hash video;
+  Hash audio;
+  uint64_t samples = 0;
+  vector<int16_t> output;  //audio of the current frame(s); cleared by the caller
+  bool loaded = false;
+
+  //core options are passed as name=value arguments
+  void option(const string& name, const string& value) {
+    for(auto& variable : variables) if(variable.name == name) { variable.value = value; return; }
+    variables.append({name, value});
+  }
+
+  bool load(const vector<uint8_t>& rom, const string& path = "out/test.sfc");
+  void unload();
+  void run(unsigned frames = 1) { while(frames--) retro_run(); }
+} frontend;
+
+static void log(enum retro_log_level, const char*, ...) {}
+
+static bool environment(unsigned command, void* data) {
+  if(command == RETRO_ENVIRONMENT_GET_VARIABLE) {
+    auto variable = (retro_variable*)data;
+    for(auto& item : frontend.variables) {
+      if(item.name == variable->key) { variable->value = item.value; return true; }
+    }
+    variable->value = nullptr;
+    return false;
+  }
+  if(command == RETRO_ENVIRONMENT_GET_VARIABLE_UPDATE) { *(bool*)data = false; return true; }
+  if(command == RETRO_ENVIRONMENT_SET_PIXEL_FORMAT) return true;
+  if(command == RETRO_ENVIRONMENT_GET_LOG_INTERFACE) { ((retro_log_callback*)data)->log = log; return true; }
+  if(command == RETRO_ENVIRONMENT_GET_SAVE_DIRECTORY) { *(const char**)data = "out"; return true; }
+  return false;
+}
+
+static void video_refresh(const void* data, unsigned width, unsigned height, size_t pitch) {
+  if(data == nullptr) return;
+  for(unsigned y = 0; y < height; y++) frontend.video.data((const uint8_t*)data + y * pitch, width * 4);
+}
+
+static size_t audio_sample_batch(const int16_t* data, size_t frames) {
+  frontend.audio.data(data, frames * 4);
+  frontend.samples += frames;
+  for(size_t n = 0; n < frames * 2; n++) frontend.output.append(data[n]);
+  return frames;
+}
+
+static void audio_sample(int16_t left, int16_t right) {
+  int16_t data[2] = {left, right};
+  audio_sample_batch(data, 1);
+}
+
+static void input_poll() {}
+static int16_t input_state(unsigned, unsigned, unsigned, unsigned) { return 0; }
+
+//path need not exist; when it names the file rom was read from, the loader maps that file instead
+bool Frontend::load(const vector<uint8_t>& rom, const string& path) {
+  retro_set_environment(environment);
+  retro_set_video_refresh(video_refresh);
+  retro_set_audio_sample(audio_sample);
+  retro_set_audio_sample_batch(audio_sample_batch);
+  retro_set_input_poll(input_poll);
+  retro_set_input_state(input_state);
+  retro_init();
+  SuperFamicom::configuration.random = false;
+
+  //the tracer database of debugger builds is written next to the game path
+  retro_game_info info = {path, rom.data(), rom.size(), nullptr};
+  return loaded = retro_load_game(&info);
+}
+
+void Frontend::unload() {
+  if(loaded) retro_unload_game();
+  retro_deinit();
+  loaded = false;
+}
+
+//32KB LoROM whose S-CPU program is a single "bra *"; it leaves the APU ports alone
+inline vector<uint8_t> stub_rom() {
+  vector<uint8_t> rom;
+  rom.resize(0x8000);
+  memset(rom.data(), 0, rom.size());
+  rom[0x0000] = 0x80;  //bra *
+  rom[0x0001] = 0xfe;
+  memcpy(rom.data() + 0x7fc0, "TEST                 ", 21);
+  rom[0x7fd5] = 0x20;  //LoROM
+  rom[0x7fd7] = 0x08;  //32KB
+  rom[0x7ffc] = 0x00;  //reset vector: $8000
+  rom[0x7ffd] = 0x80;
+  uint16_t sum = 0;
+  for(auto byte : rom) sum += byte;
+  sum += 0x01fe;  //complement and checksum bytes
+  rom[0x7fdc] = ~sum; rom[0x7fdd] = ~sum >> 8;
+  rom[0x7fde] = sum;  rom[0x7fdf] = sum >> 8;
+  return rom;
+}
+
+inline double timestamp() {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+#if !defined(PROFILE_PERFORMANCE)
+//loads an .spc snapshot into a freshly loaded system, before the first frame runs
+inline bool load_spc(const string& filename) {
+  using namespace SuperFamicom;
+  auto spc = file::read(filename);
+  if(spc.size() < 0x10180 || memcmp(spc.data(), "SNES-SPC700 Sound File Data", 27)) return false;
+
+  const uint8_t* ram = spc.data() + 0x100;
+  const uint8_t* regs = spc.data() + 0x10100;
+  memcpy(smp.apuram, ram, 64 * 1024);
+  if(spc.size() >= 0x10200) memcpy(smp.apuram + 0xffc0, spc.data() + 0x101c0, 64);  //RAM under the IPL ROM
+
+  smp.regs.pc = spc[0x25] | spc[0x26] << 8;
+  smp.regs.a = spc[0x27];
+  smp.regs.x = spc[0x28];
+  smp.regs.y = spc[0x29];
+  smp.regs.p = spc[0x2a];
+  smp.regs.s = spc[0x2b];
+
+  smp.status.iplrom_enable = ram[0xf1] & 0x80;
+  smp.status.dsp_addr = ram[0xf2];
+  smp.timer0.enable = ram[0xf1] & 0x01;
+  smp.timer1.enable = ram[0xf1] & 0x02;
+  smp.timer2.enable = ram[0xf1] & 0x04;
+  smp.timer0.target = ram[0xfa];
+  smp.timer1.target = ram[0xfb];
+  smp.timer2.target = ram[0xfc];
+  smp.timer0.stage3_ticks = ram[0xfd];
+  smp.timer1.stage3_ticks = ram[0xfe];
+  smp.timer2.stage3_ticks = ram[0xff];
+  for(unsigned n = 0; n < 4; n++) cpu.port_write(n, ram[0xf4 + n]);
+
+  //KON is written last, once the voices it keys on are set up
+  for(unsigned addr = 0; addr < 128; addr++) {
+    if(addr != 0x4c) dsp.write(addr, regs[addr]);
+  }
+  dsp.write(0x4c, regs[0x4c]);
+  return true;
+}
+#endif
+
+}
+
+using namespace Test;